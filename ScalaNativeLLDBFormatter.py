@@ -232,13 +232,16 @@ class ArraySynthProvider(ArrayLikeSynthProvider):
 
 # Base class for *String providers
 class StringLikeSynthProvider(ArrayLikeSynthProvider):
+    encoding = 'utf-16'
+    bytes_per_char = 2
+
     def get_child_at_index(self, index):
         ch = ArrayLikeSynthProvider.get_child_at_index(self, index)
         ch.SetFormat(lldb.eFormatChar)
         return ch
 
     def get_summary(self):
-        strval = string_from_ptr(self.ptr, min(self.len, max_string_summary_langth))
+        strval = string_from_ptr(self.ptr, min(self.len, max_string_summary_langth), self.encoding, self.bytes_per_char)
         if self.len > max_string_summary_langth:
             strval += u'...'
         return u'"%s"' % strval
@@ -247,16 +250,21 @@ class StringSynthProvider(StringLikeSynthProvider):
     def ptr_and_len(self, valobj):
         offset = gcm(valobj, "offset").GetValueAsUnsigned()
         count = gcm(valobj, "count").GetValueAsUnsigned()
-        arrayUnsized = gcm(valobj, "value", "values")
-        # Quick, hot path
-        if(offset == 0):
-          return (array_as_pointer(arrayUnsized),count)
-        elementType = arrayUnsized.GetType().GetArrayElementType()
-        arrayAddr = arrayUnsized.GetLoadAddress()
-        offsetAddr = arrayAddr + offset * elementType.GetByteSize()
-        pointerToOffset = arrayUnsized.CreateValueFromAddress("data", offsetAddr, elementType.GetPointerType())
-        return (pointerToOffset, count)
-  
+        target = valobj.GetTarget()
+        # Latin-1 strings (coder 0) store a byte per char, others UTF-16 chars
+        if gcm(valobj, "coder").GetValueAsUnsigned() == 0:
+            self.encoding, self.bytes_per_char = 'latin-1', 1
+            elementType = target.GetBasicType(lldb.eBasicTypeUnsignedChar)
+        else:
+            self.encoding, self.bytes_per_char = 'utf-16', 2
+            elementType = target.GetBasicType(lldb.eBasicTypeChar16)
+        # `value` is typed as an Object, its elements follow the array header
+        header = target.FindFirstType("scala.scalanative.runtime.ArrayHeader")
+        arrayAddr = gcm(valobj, "value").GetValueAsUnsigned()
+        dataAddr = arrayAddr + header.GetByteSize() + offset * elementType.GetByteSize()
+        data = lldb.SBData.CreateDataFromUInt64Array(target.GetByteOrder(), target.GetAddressByteSize(), [dataAddr])
+        return (valobj.CreateValueFromData("data", data, elementType.GetPointerType()), count)
+
 
 def __lldb_init_module(debugger_obj, internal_dict): # pyright: ignore
     log.info('Initializing')
@@ -0,0 +1,42 @@
+#ifndef SCALANATIVE_JAVALIB_SIMD_H
+#define SCALANATIVE_JAVALIB_SIMD_H
+
+/* Selection of the vector instructions used by the javalib native helpers.
+ *
+ * On x86-64 SSE2 is always available, wider or newer instructions are used
+ * from functions compiled with the target attribute, once the CPU is known
+ * to support them. Other targets rely on portable code, which the C compiler
+ * is free to vectorize.
+ */
+
+#if defined(__x86_64__) && !defined(_WIN32) &&                               \
+    (defined(__GNUC__) || defined(__clang__))
+#define SCALANATIVE_SIMD_X86 1
+#include <immintrin.h>
+
+#define SCALANATIVE_SIMD_SSE2 1
+#define SCALANATIVE_SIMD_SSE4 2 // SSSE3 and SSE4.1
+#define SCALANATIVE_SIMD_AVX2 3
+
+static int scalanative_simd_cached_level = 0;
+
+static inline int scalanative_simd_level(void) {
+    int level =
+        __atomic_load_n(&scalanative_simd_cached_level, __ATOMIC_RELAXED);
+    if (level == 0) {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            level = SCALANATIVE_SIMD_AVX2;
+        else if (__builtin_cpu_supports("ssse3") &&
+                 __builtin_cpu_supports("sse4.1"))
+            level = SCALANATIVE_SIMD_SSE4;
+        else
+            level = SCALANATIVE_SIMD_SSE2;
+        __atomic_store_n(&scalanative_simd_cached_level, level,
+                         __ATOMIC_RELAXED);
+    }
+    return level;
+}
+#endif
+
+#endif // SCALANATIVE_JAVALIB_SIMD_H
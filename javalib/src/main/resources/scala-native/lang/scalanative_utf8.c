@@ -0,0 +1,565 @@
+#if defined(SCALANATIVE_COMPILE_ALWAYS) || defined(__SCALANATIVE_JAVALIB_UTF8)
+
+/* UTF-8 validation and transcoding kernels used by the UTF-8 charset and by
+ * java.lang.String.
+ *
+ * Validation uses the lookup algorithm of Keiser and Lemire ("Validating
+ * UTF-8 In Less Than One Instruction Per Byte", 2021): the error classes of
+ * each pair of consecutive bytes are looked up by their nibbles in three
+ * 16-entry tables, so that a whole vector is checked with a few shuffles.
+ * Transcoding of validated input widens or narrows runs of ASCII using
+ * vectors, other sequences are decoded one at a time without any checks.
+ *
+ * On x86-64 the AVX2 or SSSE3 variant is selected at runtime, SSE2 being
+ * always available for the ASCII runs. Other targets use portable code
+ * processing 8 bytes at a time.
+ *
+ * All the functions stop before the first malformed or incomplete sequence,
+ * or unpaired surrogate, leaving error reporting to the callers.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "scalanative_simd.h"
+
+// Checks the single sequence starting at src[i], returns its length or 0
+static inline size_t scalanative_utf8_sequence(const uint8_t *src, size_t i,
+                                               size_t len) {
+    uint8_t b = src[i];
+    if (b < 0x80)
+        return 1;
+    if (b < 0xc2)
+        return 0;
+    if (b < 0xe0)
+        return i + 1 < len && (src[i + 1] & 0xc0) == 0x80 ? 2 : 0;
+    if (b < 0xf0) {
+        if (i + 2 >= len)
+            return 0;
+        uint8_t b2 = src[i + 1];
+        if ((b2 & 0xc0) != 0x80 || (src[i + 2] & 0xc0) != 0x80)
+            return 0;
+        // Overlong encoding or surrogate
+        if ((b == 0xe0 && b2 < 0xa0) || (b == 0xed && b2 >= 0xa0))
+            return 0;
+        return 3;
+    }
+    if (b < 0xf5) {
+        if (i + 3 >= len)
+            return 0;
+        uint8_t b2 = src[i + 1];
+        if ((b2 & 0xc0) != 0x80 || (src[i + 2] & 0xc0) != 0x80 ||
+            (src[i + 3] & 0xc0) != 0x80)
+            return 0;
+        // Overlong encoding or above U+10FFFF
+        if ((b == 0xf0 && b2 < 0x90) || (b == 0xf4 && b2 >= 0x90))
+            return 0;
+        return 4;
+    }
+    return 0;
+}
+
+static size_t scalanative_utf8_valid_prefix_scalar(const uint8_t *src,
+                                                   size_t start, size_t len) {
+    size_t i = start;
+    while (i < len) {
+        size_t n = scalanative_utf8_sequence(src, i, len);
+        if (n == 0)
+            break;
+        i += n;
+    }
+    return i;
+}
+
+/* Returns the position from which a scalar check needs to resume when the
+ * vectors before `block` were found valid: the sequence crossing the block
+ * boundary, if any, is checked again.
+ */
+static inline size_t scalanative_utf8_resume(const uint8_t *src, size_t start,
+                                             size_t block) {
+    size_t i = block;
+    while (i > start && block - i < 3) {
+        uint8_t b = src[i - 1];
+        if (b < 0x80)
+            return i;
+        i--;
+        if (b >= 0xc0)
+            return i;
+    }
+    return i == start ? start : block;
+}
+
+static inline size_t scalanative_utf8_ascii_prefix_scalar(const uint8_t *src,
+                                                          size_t i,
+                                                          size_t len) {
+    while (i + 8 <= len) {
+        uint64_t word;
+        memcpy(&word, src + i, 8);
+        if (word & UINT64_C(0x8080808080808080))
+            break;
+        i += 8;
+    }
+    while (i < len && src[i] < 0x80)
+        i++;
+    return i;
+}
+
+#ifdef SCALANATIVE_SIMD_X86
+
+// Error classes of Keiser and Lemire
+#define TOO_SHORT (1 << 0)
+#define TOO_LONG (1 << 1)
+#define OVERLONG_3 (1 << 2)
+#define TOO_LARGE (1 << 3)
+#define SURROGATE (1 << 4)
+#define OVERLONG_2 (1 << 5)
+#define TOO_LARGE_1000 (1 << 6)
+#define OVERLONG_4 (1 << 6)
+#define TWO_CONTS (1 << 7)
+#define CARRY (TOO_SHORT | TOO_LONG | TWO_CONTS)
+
+#define BYTE_1_HIGH                                                            \
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,      \
+        TOO_LONG, TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,                  \
+        TOO_SHORT | OVERLONG_2, TOO_SHORT, TOO_SHORT | OVERLONG_3 | SURROGATE, \
+        TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+
+#define BYTE_1_LOW                                                             \
+    CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4, CARRY | OVERLONG_2, CARRY,   \
+        CARRY, CARRY | TOO_LARGE, CARRY | TOO_LARGE | TOO_LARGE_1000,          \
+        CARRY | TOO_LARGE | TOO_LARGE_1000,                                    \
+        CARRY | TOO_LARGE | TOO_LARGE_1000,                                    \
+        CARRY | TOO_LARGE | TOO_LARGE_1000,                                    \
+        CARRY | TOO_LARGE | TOO_LARGE_1000,                                    \
+        CARRY | TOO_LARGE | TOO_LARGE_1000,                                    \
+        CARRY | TOO_LARGE | TOO_LARGE_1000,                                    \
+        CARRY | TOO_LARGE | TOO_LARGE_1000,                                    \
+        CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,                        \
+        CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000
+
+#define BYTE_2_HIGH                                                            \
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,          \
+        TOO_SHORT, TOO_SHORT,                                                  \
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 |      \
+            OVERLONG_4,                                                        \
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,            \
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,             \
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE, TOO_SHORT,  \
+        TOO_SHORT, TOO_SHORT, TOO_SHORT
+
+__attribute__((target("avx2"))) static size_t
+scalanative_utf8_valid_prefix_avx2(const uint8_t *src, size_t len) {
+    const __m256i byte_1_high =
+        _mm256_setr_epi8(BYTE_1_HIGH, BYTE_1_HIGH);
+    const __m256i byte_1_low = _mm256_setr_epi8(BYTE_1_LOW, BYTE_1_LOW);
+    const __m256i byte_2_high =
+        _mm256_setr_epi8(BYTE_2_HIGH, BYTE_2_HIGH);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    // Bytes which cannot end a vector without a continuation in the next one
+    const __m256i max_last = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xf0 - 1),
+        (char)(0xe0 - 1), (char)(0xc0 - 1));
+
+    __m256i prev = _mm256_setzero_si256();
+    __m256i prev_incomplete = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i input = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i error;
+        if (_mm256_movemask_epi8(input) == 0) {
+            error = prev_incomplete;
+        } else {
+            // Bytes shifted by 1, 2 and 3 positions, taking the previous
+            // vector's last bytes
+            __m256i carried = _mm256_permute2x128_si256(prev, input, 0x21);
+            __m256i prev1 = _mm256_alignr_epi8(input, carried, 16 - 1);
+            __m256i prev2 = _mm256_alignr_epi8(input, carried, 16 - 2);
+            __m256i prev3 = _mm256_alignr_epi8(input, carried, 16 - 3);
+
+            __m256i b1h = _mm256_shuffle_epi8(
+                byte_1_high,
+                _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+            __m256i b1l = _mm256_shuffle_epi8(
+                byte_1_low, _mm256_and_si256(prev1, nibble));
+            __m256i b2h = _mm256_shuffle_epi8(
+                byte_2_high,
+                _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+            __m256i special =
+                _mm256_and_si256(_mm256_and_si256(b1h, b1l), b2h);
+
+            __m256i third = _mm256_subs_epu8(prev2, _mm256_set1_epi8(0x60));
+            __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(0x70));
+            __m256i must23 = _mm256_and_si256(_mm256_or_si256(third, fourth),
+                                              _mm256_set1_epi8((char)0x80));
+            error = _mm256_xor_si256(must23, special);
+            prev_incomplete = _mm256_subs_epu8(input, max_last);
+        }
+        if (!_mm256_testz_si256(error, error))
+            return scalanative_utf8_valid_prefix_scalar(
+                src, scalanative_utf8_resume(src, 0, i), len);
+        prev = input;
+    }
+    return scalanative_utf8_valid_prefix_scalar(
+        src, scalanative_utf8_resume(src, 0, i), len);
+}
+
+__attribute__((target("ssse3,sse4.1"))) static size_t
+scalanative_utf8_valid_prefix_ssse3(const uint8_t *src, size_t len) {
+    const __m128i byte_1_high = _mm_setr_epi8(BYTE_1_HIGH);
+    const __m128i byte_1_low = _mm_setr_epi8(BYTE_1_LOW);
+    const __m128i byte_2_high = _mm_setr_epi8(BYTE_2_HIGH);
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    const __m128i max_last =
+        _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                      (char)(0xf0 - 1), (char)(0xe0 - 1), (char)(0xc0 - 1));
+
+    __m128i prev = _mm_setzero_si128();
+    __m128i prev_incomplete = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i input = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i error;
+        if (_mm_movemask_epi8(input) == 0) {
+            error = prev_incomplete;
+        } else {
+            __m128i prev1 = _mm_alignr_epi8(input, prev, 16 - 1);
+            __m128i prev2 = _mm_alignr_epi8(input, prev, 16 - 2);
+            __m128i prev3 = _mm_alignr_epi8(input, prev, 16 - 3);
+
+            __m128i b1h = _mm_shuffle_epi8(
+                byte_1_high, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+            __m128i b1l =
+                _mm_shuffle_epi8(byte_1_low, _mm_and_si128(prev1, nibble));
+            __m128i b2h = _mm_shuffle_epi8(
+                byte_2_high, _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+            __m128i special = _mm_and_si128(_mm_and_si128(b1h, b1l), b2h);
+
+            __m128i third = _mm_subs_epu8(prev2, _mm_set1_epi8(0x60));
+            __m128i fourth = _mm_subs_epu8(prev3, _mm_set1_epi8(0x70));
+            __m128i must23 = _mm_and_si128(_mm_or_si128(third, fourth),
+                                           _mm_set1_epi8((char)0x80));
+            error = _mm_xor_si128(must23, special);
+            prev_incomplete = _mm_subs_epu8(input, max_last);
+        }
+        if (!_mm_testz_si128(error, error))
+            return scalanative_utf8_valid_prefix_scalar(
+                src, scalanative_utf8_resume(src, 0, i), len);
+        prev = input;
+    }
+    return scalanative_utf8_valid_prefix_scalar(
+        src, scalanative_utf8_resume(src, 0, i), len);
+}
+
+#undef BYTE_1_HIGH
+#undef BYTE_1_LOW
+#undef BYTE_2_HIGH
+
+__attribute__((target("avx2"))) static size_t
+scalanative_utf8_ascii_prefix_avx2(const uint8_t *src, size_t len) {
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+        int mask = _mm256_movemask_epi8(v);
+        if (mask != 0)
+            return i + __builtin_ctz((unsigned)mask);
+    }
+    return scalanative_utf8_ascii_prefix_scalar(src, i, len);
+}
+
+static size_t scalanative_utf8_ascii_prefix_sse2(const uint8_t *src,
+                                                 size_t len) {
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        int mask = _mm_movemask_epi8(v);
+        if (mask != 0)
+            return i + __builtin_ctz((unsigned)mask);
+    }
+    return scalanative_utf8_ascii_prefix_scalar(src, i, len);
+}
+
+#endif // SCALANATIVE_SIMD_X86
+
+/* Returns the number of leading ASCII bytes. */
+size_t scalanative_utf8_ascii_prefix(const uint8_t *src, size_t len) {
+#ifdef SCALANATIVE_SIMD_X86
+    if (scalanative_simd_level() == SCALANATIVE_SIMD_AVX2)
+        return scalanative_utf8_ascii_prefix_avx2(src, len);
+    return scalanative_utf8_ascii_prefix_sse2(src, len);
+#else
+    return scalanative_utf8_ascii_prefix_scalar(src, 0, len);
+#endif
+}
+
+/* Returns the length of the longest prefix made only of complete and
+ * well-formed sequences.
+ */
+size_t scalanative_utf8_valid_prefix(const uint8_t *src, size_t len) {
+#ifdef SCALANATIVE_SIMD_X86
+    switch (scalanative_simd_level()) {
+    case SCALANATIVE_SIMD_AVX2:
+        return scalanative_utf8_valid_prefix_avx2(src, len);
+    case SCALANATIVE_SIMD_SSE4:
+        return scalanative_utf8_valid_prefix_ssse3(src, len);
+    }
+#endif
+    size_t i = scalanative_utf8_ascii_prefix_scalar(src, 0, len);
+    return scalanative_utf8_valid_prefix_scalar(src, i, len);
+}
+
+#ifdef SCALANATIVE_SIMD_X86
+__attribute__((target("avx2"))) static size_t
+scalanative_utf8_widen_avx2(const uint8_t *src, size_t i, size_t len,
+                            uint16_t *dst, size_t *o) {
+    size_t j = *o;
+    while (i + 16 <= len) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        if (_mm_movemask_epi8(v) != 0)
+            break;
+        _mm256_storeu_si256((__m256i *)(dst + j), _mm256_cvtepu8_epi16(v));
+        i += 16;
+        j += 16;
+    }
+    *o = j;
+    return i;
+}
+#endif
+
+/* Widens the run of ASCII bytes starting at src[i], returns its end. */
+static inline size_t scalanative_utf8_widen(const uint8_t *src, size_t i,
+                                            size_t len, uint16_t *dst,
+                                            size_t *o) {
+#ifdef SCALANATIVE_SIMD_X86
+    if (scalanative_simd_level() == SCALANATIVE_SIMD_AVX2)
+        i = scalanative_utf8_widen_avx2(src, i, len, dst, o);
+    size_t j = *o;
+    const __m128i zero = _mm_setzero_si128();
+    while (i + 16 <= len) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        if (_mm_movemask_epi8(v) != 0)
+            break;
+        _mm_storeu_si128((__m128i *)(dst + j), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128((__m128i *)(dst + j + 8), _mm_unpackhi_epi8(v, zero));
+        i += 16;
+        j += 16;
+    }
+#else
+    size_t j = *o;
+#endif
+    while (i < len && src[i] < 0x80)
+        dst[j++] = src[i++];
+    *o = j;
+    return i;
+}
+
+/* Decodes the sequences of well-formed input fitting in `dstlen` chars.
+ * Returns the number of written chars, the number of consumed bytes is stored
+ * in `read`. */
+static size_t scalanative_utf8_decode_valid(const uint8_t *src, size_t len,
+                                            uint16_t *dst, size_t dstlen,
+                                            size_t *read) {
+    size_t i = 0, o = 0;
+    while (i < len && o < dstlen) {
+        uint8_t b = src[i];
+        if (b < 0x80) {
+            // A char for every byte
+            size_t end = dstlen - o < len - i ? i + (dstlen - o) : len;
+            i = scalanative_utf8_widen(src, i, end, dst, &o);
+        } else if (b < 0xe0) {
+            dst[o++] = (uint16_t)(((b & 0x1f) << 6) | (src[i + 1] & 0x3f));
+            i += 2;
+        } else if (b < 0xf0) {
+            dst[o++] = (uint16_t)(((b & 0x0f) << 12) |
+                                  ((src[i + 1] & 0x3f) << 6) |
+                                  (src[i + 2] & 0x3f));
+            i += 3;
+        } else {
+            if (dstlen - o < 2)
+                break;
+            uint32_t cp = ((uint32_t)(b & 0x07) << 18) |
+                          ((uint32_t)(src[i + 1] & 0x3f) << 12) |
+                          ((uint32_t)(src[i + 2] & 0x3f) << 6) |
+                          (src[i + 3] & 0x3f);
+            cp -= 0x10000;
+            dst[o++] = (uint16_t)(0xd800 | (cp >> 10));
+            dst[o++] = (uint16_t)(0xdc00 | (cp & 0x3ff));
+            i += 4;
+        }
+    }
+    *read = i;
+    return o;
+}
+
+// Validated at once, so that the input is still in cache when decoded
+#define SCALANATIVE_UTF8_CHUNK 16384
+
+/* Decodes the longest well-formed prefix of `src` fitting in `dstlen`
+ * chars. Returns the number of written chars, the number of consumed bytes
+ * is stored in `read`.
+ */
+size_t scalanative_utf8_to_utf16(const uint8_t *src, size_t len,
+                                 uint16_t *dst, size_t dstlen, size_t *read) {
+    size_t i = 0, o = 0;
+    while (o < dstlen) {
+        size_t chunk = len - i;
+        if (chunk > SCALANATIVE_UTF8_CHUNK)
+            chunk = SCALANATIVE_UTF8_CHUNK;
+        size_t valid = scalanative_utf8_valid_prefix(src + i, chunk);
+        if (valid == 0)
+            break;
+        // Bounded by the output, multibyte sequences might not all fit
+        size_t decoded;
+        o += scalanative_utf8_decode_valid(src + i, valid, dst + o, dstlen - o,
+                                           &decoded);
+        i += decoded;
+        if (decoded < valid)
+            break;
+    }
+    *read = i;
+    return o;
+}
+
+#ifdef SCALANATIVE_SIMD_X86
+__attribute__((target("avx2"))) static size_t
+scalanative_utf16_narrow_avx2(const uint16_t *src, size_t i, size_t len,
+                              uint8_t *dst, size_t *o, size_t dstlen) {
+    size_t j = *o;
+    const __m256i high = _mm256_set1_epi16((short)0xff80);
+    while (i + 16 <= len && j + 16 <= dstlen) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+        if (!_mm256_testz_si256(v, high))
+            break;
+        __m128i packed = _mm_packus_epi16(_mm256_castsi256_si128(v),
+                                          _mm256_extracti128_si256(v, 1));
+        _mm_storeu_si128((__m128i *)(dst + j), packed);
+        i += 16;
+        j += 16;
+    }
+    *o = j;
+    return i;
+}
+#endif
+
+/* Narrows the run of ASCII chars starting at src[i], returns its end. */
+static inline size_t scalanative_utf16_narrow(const uint16_t *src, size_t i,
+                                              size_t len, uint8_t *dst,
+                                              size_t *o, size_t dstlen) {
+#ifdef SCALANATIVE_SIMD_X86
+    if (scalanative_simd_level() == SCALANATIVE_SIMD_AVX2)
+        i = scalanative_utf16_narrow_avx2(src, i, len, dst, o, dstlen);
+    size_t j = *o;
+    const __m128i high = _mm_set1_epi16((short)0xff80);
+    while (i + 8 <= len && j + 8 <= dstlen) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, high),
+                                              _mm_setzero_si128())) != 0xffff)
+            break;
+        _mm_storel_epi64((__m128i *)(dst + j), _mm_packus_epi16(v, v));
+        i += 8;
+        j += 8;
+    }
+#else
+    size_t j = *o;
+#endif
+    while (i < len && j < dstlen && src[i] < 0x80)
+        dst[j++] = (uint8_t)src[i++];
+    *o = j;
+    return i;
+}
+
+/* Encodes the longest prefix of `src` without unpaired surrogates whose
+ * encoding fits in `dstlen` bytes. Returns the number of written bytes, the
+ * number of consumed chars is stored in `read`.
+ */
+size_t scalanative_utf16_to_utf8(const uint16_t *src, size_t len,
+                                 uint8_t *dst, size_t dstlen, size_t *read) {
+    size_t i = 0, o = 0;
+    while (i < len) {
+        uint16_t c = src[i];
+        if (c < 0x80) {
+            if (o == dstlen)
+                break;
+            i = scalanative_utf16_narrow(src, i, len, dst, &o, dstlen);
+        } else if (c < 0x800) {
+            if (o + 2 > dstlen)
+                break;
+            dst[o] = (uint8_t)(0xc0 | (c >> 6));
+            dst[o + 1] = (uint8_t)(0x80 | (c & 0x3f));
+            o += 2;
+            i += 1;
+        } else if ((c & 0xf800) != 0xd800) {
+            if (o + 3 > dstlen)
+                break;
+            dst[o] = (uint8_t)(0xe0 | (c >> 12));
+            dst[o + 1] = (uint8_t)(0x80 | ((c >> 6) & 0x3f));
+            dst[o + 2] = (uint8_t)(0x80 | (c & 0x3f));
+            o += 3;
+            i += 1;
+        } else {
+            if (c >= 0xdc00 || i + 1 == len ||
+                (src[i + 1] & 0xfc00) != 0xdc00 || o + 4 > dstlen)
+                break;
+            uint32_t cp =
+                0x10000 + (((uint32_t)(c & 0x3ff) << 10) | (src[i + 1] & 0x3ff));
+            dst[o] = (uint8_t)(0xf0 | (cp >> 18));
+            dst[o + 1] = (uint8_t)(0x80 | ((cp >> 12) & 0x3f));
+            dst[o + 2] = (uint8_t)(0x80 | ((cp >> 6) & 0x3f));
+            dst[o + 3] = (uint8_t)(0x80 | (cp & 0x3f));
+            o += 4;
+            i += 2;
+        }
+    }
+    *read = i;
+    return o;
+}
+
+/* Returns the length of the UTF-8 encoding of `src`, or -1 if it contains
+ * an unpaired surrogate.
+ */
+ptrdiff_t scalanative_utf16_utf8_length(const uint16_t *src, size_t len) {
+    size_t i = 0;
+    size_t length = 0;
+#ifdef SCALANATIVE_SIMD_X86
+    // Each char needs 1 byte, plus 1 from U+0080, plus 1 from U+0800
+    const __m128i sign = _mm_set1_epi16((short)0x8000);
+    const __m128i above_7f = _mm_set1_epi16((short)(0x8000 + 0x7f));
+    const __m128i above_7ff = _mm_set1_epi16((short)(0x8000 + 0x7ff));
+    const __m128i surrogate_mask = _mm_set1_epi16((short)0xf800);
+    const __m128i surrogate = _mm_set1_epi16((short)0xd800);
+    while (i + 8 <= len) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(
+                _mm_and_si128(v, surrogate_mask), surrogate)) != 0)
+            break;
+        __m128i biased = _mm_xor_si128(v, sign);
+        __m128i two = _mm_cmpgt_epi16(biased, above_7f);
+        __m128i three = _mm_cmpgt_epi16(biased, above_7ff);
+        // Each set lane sets two bits of the mask
+        unsigned extra = (unsigned)__builtin_popcount(_mm_movemask_epi8(two)) +
+                         (unsigned)__builtin_popcount(_mm_movemask_epi8(three));
+        length += 8 + extra / 2;
+        i += 8;
+    }
+#endif
+    while (i < len) {
+        uint16_t c = src[i];
+        if (c < 0x80) {
+            length += 1;
+        } else if (c < 0x800) {
+            length += 2;
+        } else if ((c & 0xf800) != 0xd800) {
+            length += 3;
+        } else {
+            if (c >= 0xdc00 || i + 1 == len || (src[i + 1] & 0xfc00) != 0xdc00)
+                return -1;
+            length += 4;
+            i += 1;
+        }
+        i += 1;
+    }
+    return (ptrdiff_t)length;
+}
+
+#endif // __SCALANATIVE_JAVALIB_UTF8
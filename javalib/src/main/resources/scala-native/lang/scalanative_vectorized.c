@@ -0,0 +1,370 @@
+#if defined(SCALANATIVE_COMPILE_ALWAYS) ||                                     \
+    defined(__SCALANATIVE_JAVALIB_VECTORIZED)
+
+/* Vectorized primitives behind java.lang.String and java.util.Arrays:
+ * searching, comparing, hashing and filling arrays of primitive values.
+ *
+ * Array elements are only accessed through the pointers and lengths given
+ * by the callers, which are responsible for bounds checks. Functions
+ * returning an index use -1 when nothing is found.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "scalanative_simd.h"
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define SCALANATIVE_LITTLE_ENDIAN 1
+#endif
+
+#ifdef SCALANATIVE_SIMD_X86
+__attribute__((target("avx2"))) static size_t
+scalanative_mismatch_avx2(const uint8_t *a, const uint8_t *b, size_t len,
+                          ptrdiff_t *found) {
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(b + i));
+        unsigned equal =
+            (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb));
+        if (equal != 0xffffffffu) {
+            *found = (ptrdiff_t)(i + __builtin_ctz(~equal));
+            break;
+        }
+    }
+    return i;
+}
+#endif
+
+/* Index of the first differing byte of `left` and `right`. */
+ptrdiff_t scalanative_mismatch(const void *left, const void *right,
+                               size_t len) {
+    const uint8_t *a = left;
+    const uint8_t *b = right;
+    size_t i = 0;
+#ifdef SCALANATIVE_SIMD_X86
+    ptrdiff_t found = -1;
+    if (scalanative_simd_level() == SCALANATIVE_SIMD_AVX2) {
+        i = scalanative_mismatch_avx2(a, b, len, &found);
+        if (found >= 0)
+            return found;
+    }
+    for (; i + 16 <= len; i += 16) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+        unsigned equal = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb));
+        if (equal != 0xffffu)
+            return (ptrdiff_t)(i + __builtin_ctz(~equal));
+    }
+#endif
+#ifdef SCALANATIVE_LITTLE_ENDIAN
+    for (; i + 8 <= len; i += 8) {
+        uint64_t wa, wb;
+        memcpy(&wa, a + i, 8);
+        memcpy(&wb, b + i, 8);
+        if (wa != wb)
+            return (ptrdiff_t)(i + __builtin_ctzll(wa ^ wb) / 8);
+    }
+#endif
+    for (; i < len; i++) {
+        if (a[i] != b[i])
+            return (ptrdiff_t)i;
+    }
+    return -1;
+}
+
+/* Polynomial hashes, as computed by String.hashCode and Arrays.hashCode:
+ * hash = 31 * hash + element, for each element, starting from `hash`.
+ *
+ * Elements are consumed in blocks, which are independent of each other
+ * once multiplied by the matching powers of 31, so that they can be
+ * computed in parallel:
+ *   hash' = hash * 31^n + e[0] * 31^(n-1) + ... + e[n-1] * 31^0
+ */
+static const uint32_t scalanative_hash_powers[33] = {
+    0x00000001u, 0x0000001fu, 0x000003c1u, 0x0000745fu, 0x000e1781u,
+    0x01b4d89fu, 0x34e63b41u, 0x67e12cdfu, 0x94446f01u, 0xf449711fu,
+    0x94e4b2c1u, 0x07b1a55fu, 0xee830681u, 0xe1ddc99fu, 0x59db6a41u,
+    0xe191dddfu, 0x50a9de01u, 0xc491e21fu, 0xcdaa61c1u, 0xe7a1d65fu,
+    0x0c98f581u, 0x8685ba9fu, 0x4a319941u, 0xfc018edfu, 0x84304d01u,
+    0x01d9531fu, 0x395110c1u, 0xf0d1075fu, 0x294fe481u, 0x00acab9fu,
+    0x14e8c841u, 0x88303fdfu, 0x7dd7bc01u};
+
+#define SCALANATIVE_HASH_PORTABLE(NAME, TYPE, WIDEN)                           \
+    static uint32_t NAME##_portable(const TYPE *src, size_t len,               \
+                                    uint32_t h) {                              \
+        const uint32_t *p = scalanative_hash_powers;                           \
+        size_t i = 0;                                                          \
+        for (; i + 8 <= len; i += 8) {                                         \
+            uint32_t block = 0;                                                \
+            for (int j = 0; j < 8; j++)                                        \
+                block += WIDEN(src[i + j]) * p[7 - j];                         \
+            h = h * p[8] + block;                                              \
+        }                                                                      \
+        for (; i < len; i++)                                                   \
+            h = 31 * h + WIDEN(src[i]);                                        \
+        return h;                                                              \
+    }
+
+#define SCALANATIVE_WIDEN_U8(x) ((uint32_t)(uint8_t)(x))
+#define SCALANATIVE_WIDEN_I8(x) ((uint32_t)(int32_t)(int8_t)(x))
+#define SCALANATIVE_WIDEN_U16(x) ((uint32_t)(uint16_t)(x))
+#define SCALANATIVE_WIDEN_I16(x) ((uint32_t)(int32_t)(int16_t)(x))
+#define SCALANATIVE_WIDEN_I32(x) ((uint32_t)(x))
+
+SCALANATIVE_HASH_PORTABLE(scalanative_hash_u8, uint8_t, SCALANATIVE_WIDEN_U8)
+SCALANATIVE_HASH_PORTABLE(scalanative_hash_i8, int8_t, SCALANATIVE_WIDEN_I8)
+SCALANATIVE_HASH_PORTABLE(scalanative_hash_u16, uint16_t,
+                          SCALANATIVE_WIDEN_U16)
+SCALANATIVE_HASH_PORTABLE(scalanative_hash_i16, int16_t, SCALANATIVE_WIDEN_I16)
+SCALANATIVE_HASH_PORTABLE(scalanative_hash_i32, int32_t, SCALANATIVE_WIDEN_I32)
+
+#ifdef SCALANATIVE_SIMD_X86
+/* Four accumulators of 8 lanes, each one covering 8 elements of every block
+ * of 32, hide the latency of the multiplications.
+ */
+#define SCALANATIVE_HASH_AVX2(NAME, TYPE, LOAD)                                \
+    __attribute__((target("avx2"))) static uint32_t NAME##_avx2(               \
+        const TYPE *src, size_t len, uint32_t h) {                             \
+        const uint32_t *p = scalanative_hash_powers;                           \
+        size_t blocks = len / 32;                                              \
+        if (blocks == 0)                                                       \
+            return NAME##_portable(src, len, h);                               \
+        const __m256i p32 = _mm256_set1_epi32((int)p[32]);                     \
+        __m256i acc0 = _mm256_setzero_si256();                                 \
+        __m256i acc1 = _mm256_setzero_si256();                                 \
+        __m256i acc2 = _mm256_setzero_si256();                                 \
+        __m256i acc3 = _mm256_setzero_si256();                                 \
+        uint32_t scale = 1;                                                    \
+        for (size_t k = 0; k < blocks; k++) {                                  \
+            const TYPE *block = src + k * 32;                                  \
+            acc0 = _mm256_add_epi32(_mm256_mullo_epi32(acc0, p32),             \
+                                    LOAD(block));                              \
+            acc1 = _mm256_add_epi32(_mm256_mullo_epi32(acc1, p32),             \
+                                    LOAD(block + 8));                          \
+            acc2 = _mm256_add_epi32(_mm256_mullo_epi32(acc2, p32),             \
+                                    LOAD(block + 16));                         \
+            acc3 = _mm256_add_epi32(_mm256_mullo_epi32(acc3, p32),             \
+                                    LOAD(block + 24));                         \
+            scale *= p[32];                                                    \
+        }                                                                      \
+        /* Element j of a block is weighted by 31^(31 - j) */                  \
+        const uint32_t *w = p + 1;                                             \
+        __m256i sum = _mm256_mullo_epi32(                                      \
+            acc0, _mm256_setr_epi32(w[30], w[29], w[28], w[27], w[26], w[25],  \
+                                    w[24], w[23]));                            \
+        sum = _mm256_add_epi32(                                                \
+            sum, _mm256_mullo_epi32(                                           \
+                     acc1, _mm256_setr_epi32(w[22], w[21], w[20], w[19],       \
+                                             w[18], w[17], w[16], w[15])));    \
+        sum = _mm256_add_epi32(                                                \
+            sum, _mm256_mullo_epi32(                                           \
+                     acc2, _mm256_setr_epi32(w[14], w[13], w[12], w[11],       \
+                                             w[10], w[9], w[8], w[7])));       \
+        sum = _mm256_add_epi32(                                                \
+            sum, _mm256_mullo_epi32(                                           \
+                     acc3, _mm256_setr_epi32(w[6], w[5], w[4], w[3], w[2],     \
+                                             w[1], w[0], w[-1])));             \
+        __m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum),              \
+                                     _mm256_extracti128_si256(sum, 1));        \
+        half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4e));             \
+        half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xb1));             \
+        h = h * scale + (uint32_t)_mm_cvtsi128_si32(half);                     \
+        return NAME##_portable(src + blocks * 32, len - blocks * 32, h);       \
+    }
+
+#define SCALANATIVE_LOAD_U8(ptr)                                               \
+    _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(ptr)))
+#define SCALANATIVE_LOAD_I8(ptr)                                               \
+    _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)(ptr)))
+#define SCALANATIVE_LOAD_U16(ptr)                                              \
+    _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(ptr)))
+#define SCALANATIVE_LOAD_I16(ptr)                                              \
+    _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(ptr)))
+#define SCALANATIVE_LOAD_I32(ptr) _mm256_loadu_si256((const __m256i *)(ptr))
+
+SCALANATIVE_HASH_AVX2(scalanative_hash_u8, uint8_t, SCALANATIVE_LOAD_U8)
+SCALANATIVE_HASH_AVX2(scalanative_hash_i8, int8_t, SCALANATIVE_LOAD_I8)
+SCALANATIVE_HASH_AVX2(scalanative_hash_u16, uint16_t, SCALANATIVE_LOAD_U16)
+SCALANATIVE_HASH_AVX2(scalanative_hash_i16, int16_t, SCALANATIVE_LOAD_I16)
+SCALANATIVE_HASH_AVX2(scalanative_hash_i32, int32_t, SCALANATIVE_LOAD_I32)
+
+#define SCALANATIVE_HASH(NAME, TYPE)                                           \
+    int32_t NAME(const TYPE *src, size_t len, int32_t hash) {                  \
+        if (scalanative_simd_level() == SCALANATIVE_SIMD_AVX2)                 \
+            return (int32_t)NAME##_avx2(src, len, (uint32_t)hash);             \
+        return (int32_t)NAME##_portable(src, len, (uint32_t)hash);             \
+    }
+#else
+#define SCALANATIVE_HASH(NAME, TYPE)                                           \
+    int32_t NAME(const TYPE *src, size_t len, int32_t hash) {                  \
+        return (int32_t)NAME##_portable(src, len, (uint32_t)hash);             \
+    }
+#endif
+
+SCALANATIVE_HASH(scalanative_hash_u8, uint8_t)
+SCALANATIVE_HASH(scalanative_hash_i8, int8_t)
+SCALANATIVE_HASH(scalanative_hash_u16, uint16_t)
+SCALANATIVE_HASH(scalanative_hash_i16, int16_t)
+SCALANATIVE_HASH(scalanative_hash_i32, int32_t)
+
+#ifdef SCALANATIVE_SIMD_X86
+__attribute__((target("avx2"))) static size_t
+scalanative_index_of_u16_avx2(const uint16_t *src, size_t len, uint16_t c,
+                              ptrdiff_t *found) {
+    const __m256i needle = _mm256_set1_epi16((short)c);
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+        unsigned mask =
+            (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi16(v, needle));
+        if (mask != 0) {
+            *found = (ptrdiff_t)(i + __builtin_ctz(mask) / 2);
+            break;
+        }
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) static size_t
+scalanative_last_index_of_u8_avx2(const uint8_t *src, size_t len, uint8_t c,
+                                  ptrdiff_t *found) {
+    const __m256i needle = _mm256_set1_epi8((char)c);
+    size_t end = len;
+    for (; end >= 32; end -= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(src + end - 32));
+        unsigned mask =
+            (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, needle));
+        if (mask != 0) {
+            *found = (ptrdiff_t)(end - 32 + 31 - __builtin_clz(mask));
+            break;
+        }
+    }
+    return end;
+}
+
+__attribute__((target("avx2"))) static size_t
+scalanative_last_index_of_u16_avx2(const uint16_t *src, size_t len, uint16_t c,
+                                   ptrdiff_t *found) {
+    const __m256i needle = _mm256_set1_epi16((short)c);
+    size_t end = len;
+    for (; end >= 16; end -= 16) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(src + end - 16));
+        unsigned mask =
+            (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi16(v, needle));
+        if (mask != 0) {
+            *found = (ptrdiff_t)(end - 16 + (31 - __builtin_clz(mask)) / 2);
+            break;
+        }
+    }
+    return end;
+}
+#endif
+
+/* Index of the first `value` in `src`, Latin-1 strings use memchr. Values
+ * are passed as int, their low bits being compared.
+ */
+ptrdiff_t scalanative_index_of_u16(const uint16_t *src, size_t len,
+                                   int value) {
+    uint16_t c = (uint16_t)value;
+    size_t i = 0;
+#ifdef SCALANATIVE_SIMD_X86
+    ptrdiff_t found = -1;
+    if (scalanative_simd_level() == SCALANATIVE_SIMD_AVX2) {
+        i = scalanative_index_of_u16_avx2(src, len, c, &found);
+        if (found >= 0)
+            return found;
+    }
+    const __m128i needle = _mm_set1_epi16((short)c);
+    for (; i + 8 <= len; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi16(v, needle));
+        if (mask != 0)
+            return (ptrdiff_t)(i + __builtin_ctz(mask) / 2);
+    }
+#endif
+    for (; i < len; i++) {
+        if (src[i] == c)
+            return (ptrdiff_t)i;
+    }
+    return -1;
+}
+
+/* Index of the last `value` in `src`. */
+ptrdiff_t scalanative_last_index_of_u8(const uint8_t *src, size_t len,
+                                       int value) {
+    uint8_t c = (uint8_t)value;
+    size_t end = len;
+#ifdef SCALANATIVE_SIMD_X86
+    ptrdiff_t found = -1;
+    if (scalanative_simd_level() == SCALANATIVE_SIMD_AVX2) {
+        end = scalanative_last_index_of_u8_avx2(src, len, c, &found);
+        if (found >= 0)
+            return found;
+    }
+    const __m128i needle = _mm_set1_epi8((char)c);
+    for (; end >= 16; end -= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + end - 16));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, needle));
+        if (mask != 0)
+            return (ptrdiff_t)(end - 16 + 31 - __builtin_clz(mask));
+    }
+#endif
+    while (end > 0) {
+        end--;
+        if (src[end] == c)
+            return (ptrdiff_t)end;
+    }
+    return -1;
+}
+
+/* Index of the last `value` in `src`. */
+ptrdiff_t scalanative_last_index_of_u16(const uint16_t *src, size_t len,
+                                        int value) {
+    uint16_t c = (uint16_t)value;
+    size_t end = len;
+#ifdef SCALANATIVE_SIMD_X86
+    ptrdiff_t found = -1;
+    if (scalanative_simd_level() == SCALANATIVE_SIMD_AVX2) {
+        end = scalanative_last_index_of_u16_avx2(src, len, c, &found);
+        if (found >= 0)
+            return found;
+    }
+    const __m128i needle = _mm_set1_epi16((short)c);
+    for (; end >= 8; end -= 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + end - 8));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi16(v, needle));
+        if (mask != 0)
+            return (ptrdiff_t)(end - 8 + (31 - __builtin_clz(mask)) / 2);
+    }
+#endif
+    while (end > 0) {
+        end--;
+        if (src[end] == c)
+            return (ptrdiff_t)end;
+    }
+    return -1;
+}
+
+/* Stores `value` in `count` consecutive elements. Plain loops, which the C
+ * compiler turns into vector stores, unlike the bounds checked loops of
+ * Scala code. Bytes and booleans use memset.
+ */
+void scalanative_fill_16(uint16_t *dst, size_t count, int value) {
+    for (size_t i = 0; i < count; i++)
+        dst[i] = (uint16_t)value;
+}
+
+void scalanative_fill_32(uint32_t *dst, size_t count, uint32_t value) {
+    for (size_t i = 0; i < count; i++)
+        dst[i] = value;
+}
+
+void scalanative_fill_64(uint64_t *dst, size_t count, uint64_t value) {
+    for (size_t i = 0; i < count; i++)
+        dst[i] = value;
+}
+
+#endif // __SCALANATIVE_JAVALIB_VECTORIZED
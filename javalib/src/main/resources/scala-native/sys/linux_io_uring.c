@@ -0,0 +1,300 @@
+#if (defined(SCALANATIVE_COMPILE_ALWAYS) ||                                    \
+     defined(__SCALANATIVE_JAVALIB_SYS_LINUX_IO_URING)) &&                     \
+    defined(__linux__)
+
+/* Minimal io_uring submission and completion rings, used by
+ * AsynchronousFileChannel. The system calls are used directly, so that
+ * liburing is not required to build or to run.
+ *
+ * A ring is expected to be used by a single submitting thread at a time
+ * (callers serialize scalanative_io_uring_prep and
+ * scalanative_io_uring_submit) and a single completing thread calling
+ * scalanative_io_uring_wait.
+ *
+ * On systems where the kernel headers are too old, or io_uring is not
+ * available at runtime, scalanative_io_uring_create returns NULL and callers
+ * fall back to blocking I/O.
+ */
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+
+// IORING_FEAT_FAST_POLL (Linux 5.7) implies IORING_OP_READ and IORING_OP_WRITE
+#if defined(__NR_io_uring_setup) && defined(IORING_FEAT_FAST_POLL)
+#define SCALANATIVE_IO_URING 1
+#endif
+
+// Operation codes used by callers, independent of the kernel headers
+#define SCALANATIVE_IO_URING_READ 0
+#define SCALANATIVE_IO_URING_WRITE 1
+#define SCALANATIVE_IO_URING_READ_FIXED 2
+#define SCALANATIVE_IO_URING_WRITE_FIXED 3
+
+#ifdef SCALANATIVE_IO_URING
+
+typedef struct scalanative_io_uring {
+    int fd;
+    // Submission queue
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned *sq_array;
+    unsigned sq_mask;
+    unsigned sq_entries;
+    unsigned sq_local_tail; // includes prepared but not yet published entries
+    struct io_uring_sqe *sqes;
+    // Completion queue
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned cq_mask;
+    struct io_uring_cqe *cqes;
+    // Mappings
+    void *sq_ring;
+    size_t sq_ring_size;
+    void *cq_ring;
+    size_t cq_ring_size;
+    size_t sqes_size;
+    struct iovec *buffers;
+} scalanative_io_uring;
+
+static void scalanative_io_uring_unmap(scalanative_io_uring *ring) {
+    if (ring->sqes != NULL && ring->sqes != MAP_FAILED)
+        munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_ring != NULL && ring->cq_ring != MAP_FAILED &&
+        ring->cq_ring != ring->sq_ring)
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    if (ring->sq_ring != NULL && ring->sq_ring != MAP_FAILED)
+        munmap(ring->sq_ring, ring->sq_ring_size);
+}
+
+void *scalanative_io_uring_create(unsigned entries, unsigned *cq_entries) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    int fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (fd < 0)
+        return NULL;
+    if (!(params.features & IORING_FEAT_FAST_POLL) ||
+        !(params.features & IORING_FEAT_SINGLE_MMAP)) {
+        close(fd);
+        errno = ENOSYS;
+        return NULL;
+    }
+
+    scalanative_io_uring *ring = calloc(1, sizeof(scalanative_io_uring));
+    if (ring == NULL) {
+        close(fd);
+        return NULL;
+    }
+    ring->fd = fd;
+
+    ring->sq_ring_size =
+        params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size =
+        params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    // Both rings share a single mapping
+    if (ring->cq_ring_size > ring->sq_ring_size)
+        ring->sq_ring_size = ring->cq_ring_size;
+    ring->cq_ring_size = ring->sq_ring_size;
+
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    ring->cq_ring = ring->sq_ring;
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (ring->sq_ring == MAP_FAILED || ring->sqes == MAP_FAILED) {
+        int err = errno;
+        scalanative_io_uring_unmap(ring);
+        close(fd);
+        free(ring);
+        errno = err;
+        return NULL;
+    }
+
+    char *sq = ring->sq_ring;
+    ring->sq_head = (unsigned *)(sq + params.sq_off.head);
+    ring->sq_tail = (unsigned *)(sq + params.sq_off.tail);
+    ring->sq_array = (unsigned *)(sq + params.sq_off.array);
+    ring->sq_mask = *(unsigned *)(sq + params.sq_off.ring_mask);
+    ring->sq_entries = *(unsigned *)(sq + params.sq_off.ring_entries);
+    ring->sq_local_tail = *ring->sq_tail;
+
+    char *cq = ring->cq_ring;
+    ring->cq_head = (unsigned *)(cq + params.cq_off.head);
+    ring->cq_tail = (unsigned *)(cq + params.cq_off.tail);
+    ring->cq_mask = *(unsigned *)(cq + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+
+    if (cq_entries != NULL)
+        *cq_entries = params.cq_entries;
+    return ring;
+}
+
+void scalanative_io_uring_destroy(void *ptr) {
+    scalanative_io_uring *ring = ptr;
+    scalanative_io_uring_unmap(ring);
+    close(ring->fd);
+    free(ring->buffers);
+    free(ring);
+}
+
+/* Registers `count` consecutive buffers of `size` bytes starting at `base`,
+ * used by fixed reads and writes with their index.
+ * Returns 0 on success or a negated errno value, e.g. when exceeding
+ * RLIMIT_MEMLOCK.
+ */
+int scalanative_io_uring_register_buffers(void *ptr, void *base,
+                                          unsigned count, size_t size) {
+    scalanative_io_uring *ring = ptr;
+    struct iovec *iovs = calloc(count, sizeof(struct iovec));
+    if (iovs == NULL)
+        return -ENOMEM;
+    for (unsigned i = 0; i < count; i++) {
+        iovs[i].iov_base = (char *)base + i * size;
+        iovs[i].iov_len = size;
+    }
+    int ret = (int)syscall(__NR_io_uring_register, ring->fd,
+                           IORING_REGISTER_BUFFERS, iovs, count);
+    if (ret < 0) {
+        ret = -errno;
+        free(iovs);
+        return ret;
+    }
+    free(ring->buffers);
+    ring->buffers = iovs;
+    return 0;
+}
+
+/* Adds an operation to the submission queue without submitting it.
+ * Returns 0 on success or -EBUSY when the submission queue is full.
+ */
+int scalanative_io_uring_prep(void *ptr, int op, int fd, void *addr,
+                              unsigned len, uint64_t offset, int buf_index,
+                              uint64_t user_data) {
+    scalanative_io_uring *ring = ptr;
+    unsigned head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+    unsigned tail = ring->sq_local_tail;
+    if (tail - head >= ring->sq_entries)
+        return -EBUSY;
+
+    unsigned idx = tail & ring->sq_mask;
+    struct io_uring_sqe *sqe = &ring->sqes[idx];
+    memset(sqe, 0, sizeof(*sqe));
+    switch (op) {
+    case SCALANATIVE_IO_URING_READ:
+        sqe->opcode = IORING_OP_READ;
+        break;
+    case SCALANATIVE_IO_URING_WRITE:
+        sqe->opcode = IORING_OP_WRITE;
+        break;
+    case SCALANATIVE_IO_URING_READ_FIXED:
+        sqe->opcode = IORING_OP_READ_FIXED;
+        sqe->buf_index = (uint16_t)buf_index;
+        break;
+    case SCALANATIVE_IO_URING_WRITE_FIXED:
+        sqe->opcode = IORING_OP_WRITE_FIXED;
+        sqe->buf_index = (uint16_t)buf_index;
+        break;
+    default:
+        return -EINVAL;
+    }
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)addr;
+    sqe->len = len;
+    sqe->off = offset;
+    sqe->user_data = user_data;
+    ring->sq_array[idx] = idx;
+    ring->sq_local_tail = tail + 1;
+    return 0;
+}
+
+/* Publishes prepared operations and submits all those not yet consumed by
+ * the kernel using a single system call.
+ * Returns the number of submitted operations or a negated errno value.
+ */
+int scalanative_io_uring_submit(void *ptr) {
+    scalanative_io_uring *ring = ptr;
+    __atomic_store_n(ring->sq_tail, ring->sq_local_tail, __ATOMIC_RELEASE);
+    unsigned pending =
+        ring->sq_local_tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+    if (pending == 0)
+        return 0;
+    int ret;
+    do {
+        ret = (int)syscall(__NR_io_uring_enter, ring->fd, pending, 0, 0, NULL,
+                           0);
+    } while (ret < 0 && errno == EINTR);
+    return ret < 0 ? -errno : ret;
+}
+
+/* Waits for at least one completion and copies up to `max` of them.
+ * Returns the number of completions or a negated errno value.
+ */
+int scalanative_io_uring_wait(void *ptr, uint64_t *user_data, int32_t *results,
+                              int max) {
+    scalanative_io_uring *ring = ptr;
+    for (;;) {
+        unsigned head = *ring->cq_head;
+        unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+        if (head != tail) {
+            int count = 0;
+            while (head != tail && count < max) {
+                struct io_uring_cqe *cqe = &ring->cqes[head & ring->cq_mask];
+                user_data[count] = cqe->user_data;
+                results[count] = cqe->res;
+                head++;
+                count++;
+            }
+            __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+            return count;
+        }
+        int ret = (int)syscall(__NR_io_uring_enter, ring->fd, 0, 1,
+                               IORING_ENTER_GETEVENTS, NULL, 0);
+        if (ret < 0 && errno != EINTR)
+            return -errno;
+    }
+}
+
+#else // !SCALANATIVE_IO_URING
+
+void *scalanative_io_uring_create(unsigned entries, unsigned *cq_entries) {
+    errno = ENOSYS;
+    return NULL;
+}
+
+void scalanative_io_uring_destroy(void *ptr) {}
+
+int scalanative_io_uring_register_buffers(void *ptr, void *base,
+                                          unsigned count, size_t size) {
+    return -ENOSYS;
+}
+
+int scalanative_io_uring_prep(void *ptr, int op, int fd, void *addr,
+                              unsigned len, uint64_t offset, int buf_index,
+                              uint64_t user_data) {
+    return -ENOSYS;
+}
+
+int scalanative_io_uring_submit(void *ptr) { return -ENOSYS; }
+
+int scalanative_io_uring_wait(void *ptr, uint64_t *user_data, int32_t *results,
+                              int max) {
+    return -ENOSYS;
+}
+
+#endif // SCALANATIVE_IO_URING
+
+#endif // __SCALANATIVE_JAVALIB_SYS_LINUX_IO_URING && __linux__
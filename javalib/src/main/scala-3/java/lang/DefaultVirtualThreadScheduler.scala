@@ -4,13 +4,10 @@ package java.lang
 
 import java.util.concurrent.*
 import java.util.concurrent.ForkJoinPool.ForkJoinWorkerThreadFactory
-import java.util.concurrent.atomic.AtomicInteger
 
 import scala.scalanative.runtime.VirtualThreadScheduler
 
-/** Default VT scheduler: {@link ForkJoinPool} carriers plus fan-out {@link ScheduledThreadPoolExecutor} for delayed
- *  tasks.
- */
+/** Default VT scheduler: {@link ForkJoinPool} carriers plus a {@link VirtualThreadTimer} for delayed tasks. */
 private[java] object DefaultVirtualThreadScheduler extends VirtualThreadScheduler {
   private val pool: ForkJoinPool = {
     val factory: ForkJoinWorkerThreadFactory = new ForkJoinWorkerThreadFactory {
@@ -34,25 +31,10 @@ private[java] object DefaultVirtualThreadScheduler extends VirtualThreadSchedule
     )
   }
 
-  private val delayedSchedulers: Array[ScheduledThreadPoolExecutor] = {
-    val paralellism = Runtime.getRuntime().availableProcessors()
-    val queueCount = Integer.highestOneBit(paralellism * 4).max(1)
-    Array.fill(queueCount) {
-      val executor: ScheduledThreadPoolExecutor =
-        new ScheduledThreadPoolExecutor(
-          1,
-          task => {
-            val t = new Thread(task)
-            t.setName("VirtualThread-unparker")
-            t.setDaemon(true)
-            t
-          }
-        )
-      executor.setRemoveOnCancelPolicy(true)
-      executor
-    }
-  }
-  private val nextDelayedScheduler = new AtomicInteger()
+  private val timer = new VirtualThreadTimer(
+    threadName = "VirtualThread-unparker",
+    tickNanos = TimeUnit.MILLISECONDS.toNanos(1L)
+  )
 
   override def execute(task: Runnable): Unit = pool.execute(task)
 
@@ -63,14 +45,8 @@ private[java] object DefaultVirtualThreadScheduler extends VirtualThreadSchedule
       task: Runnable,
       delay: scala.Long,
       unit: TimeUnit
-  ): VirtualThreadScheduler.Cancellable = {
-    val idx = nextDelayedScheduler.getAndIncrement() & (delayedSchedulers.length - 1)
-    val future = delayedSchedulers(idx).schedule(task, delay, unit)
-    new VirtualThreadScheduler.Cancellable {
-      override def cancel(): scala.Boolean = future.cancel(false)
-      override def isDone(): scala.Boolean = future.isDone()
-    }
-  }
+  ): VirtualThreadScheduler.Cancellable =
+    timer.schedule(task, delay, unit)
 
   override def isCarrierThread(thread: Thread): scala.Boolean =
     thread.isInstanceOf[VirtualThreadCarrier] &&
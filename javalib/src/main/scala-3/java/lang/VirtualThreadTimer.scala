@@ -0,0 +1,266 @@
+// scalafmt: { maxColumn = 120 }
+
+package java.lang
+
+import java.util.concurrent.TimeUnit
+import java.util.concurrent.atomic.{AtomicBoolean, AtomicInteger, AtomicReference}
+import java.util.concurrent.locks.LockSupport
+
+import scala.annotation.tailrec
+import scala.util.control.NonFatal
+import scala.scalanative.runtime.VirtualThreadScheduler
+
+/** Hashed hierarchical timer wheel used for virtual thread sleeps and timed parks.
+ *
+ *  Timeouts are rounded up to whole ticks and stored in `Levels` wheels of `WheelSize` slots each, level `n` slot
+ *  covering `WheelSize^n` ticks. When the current tick reaches the start of a higher level slot its timeouts are
+ *  redistributed to lower levels, those in level 0 expire once their slot is reached. Timeouts never expire early, but
+ *  can expire up to one tick late.
+ *
+ *  Scheduling and cancelling is O(1) and lock-free: timeouts are pushed to intrusive stacks which are drained by a
+ *  single timer thread, the only one accessing the wheels. It sleeps until the next tick at which a timeout could
+ *  expire, or indefinitely when there are no timeouts. Expired tasks are executed by the timer thread, so they need to
+ *  be short, e.g. resubmitting a virtual thread to its scheduler.
+ */
+private[lang] final class VirtualThreadTimer(threadName: String, tickNanos: scala.Long) {
+  import VirtualThreadTimer.*
+
+  private val origin = System.nanoTime()
+  private val started = new AtomicBoolean(false)
+  @volatile private var thread: Thread = _
+
+  private val scheduled = new AtomicReference[Timeout]()
+  private val cancelled = new AtomicReference[Timeout]()
+
+  /** Tick at which the timer thread is going to wake up, Long.MaxValue if parked indefinitely */
+  @volatile private var wakeupTick: scala.Long = scala.Long.MaxValue
+
+  // Owned by the timer thread
+  private val slots = new Array[Timeout](Levels * WheelSize)
+  private val levelSizes = new Array[Int](Levels)
+  private var currentTick: scala.Long = 0L
+
+  def schedule(task: Runnable, delay: scala.Long, unit: TimeUnit): VirtualThreadScheduler.Cancellable = {
+    val timeout = new Timeout(this, task, deadlineTick(unit.toNanos(delay.max(0L))))
+    push(scheduled, timeout)(_.nextScheduled = _)
+    if (!started.get() && started.compareAndSet(false, true)) startThread()
+    else if (timeout.deadline < wakeupTick) LockSupport.unpark(thread)
+    timeout
+  }
+
+  private def deadlineTick(delayNanos: scala.Long): scala.Long = {
+    val elapsed = System.nanoTime() - origin
+    // Overflowing delays are effectively infinite
+    if (delayNanos >= scala.Long.MaxValue - elapsed - tickNanos) scala.Long.MaxValue
+    else (elapsed + delayNanos + tickNanos - 1) / tickNanos
+  }
+
+  private def nowTick(): scala.Long = (System.nanoTime() - origin) / tickNanos
+
+  private def onCancelled(timeout: Timeout): Unit =
+    push(cancelled, timeout)(_.nextCancelled = _)
+
+  private def startThread(): Unit = {
+    val t = new Thread(() => run())
+    t.setName(threadName)
+    t.setDaemon(true)
+    thread = t
+    t.start()
+  }
+
+  private def run(): Unit =
+    while (true) {
+      drainScheduled()
+      drainCancelled()
+      advance(nowTick())
+      val next = nextEventTick()
+      wakeupTick = next
+      // Recheck after publishing wakeupTick, schedule() does not unpark if it sees a later deadline
+      if (scheduled.get() == null) {
+        if (next == scala.Long.MaxValue) LockSupport.park(this)
+        else {
+          val nanos = origin + next * tickNanos - System.nanoTime()
+          if (nanos > 0L) LockSupport.parkNanos(this, nanos)
+        }
+      }
+      wakeupTick = scala.Long.MinValue
+    }
+
+  private def drainScheduled(): Unit = {
+    var timeout = scheduled.getAndSet(null)
+    while (timeout != null) {
+      val next = timeout.nextScheduled
+      timeout.nextScheduled = null
+      if (timeout.isPending) insert(timeout)
+      timeout = next
+    }
+  }
+
+  private def drainCancelled(): Unit = {
+    var timeout = cancelled.getAndSet(null)
+    while (timeout != null) {
+      val next = timeout.nextCancelled
+      timeout.nextCancelled = null
+      if (timeout.slot >= 0) unlink(timeout)
+      timeout = next
+    }
+  }
+
+  /** Places the timeout in the lowest level which can hold its deadline */
+  private def insert(timeout: Timeout): Unit = {
+    val delta = timeout.deadline - currentTick
+    // Already expired, e.g. while waiting in the scheduled stack
+    if (delta <= 0L) timeout.expire()
+    else {
+      var level = 0
+      while (level < Levels - 1 && delta >= (1L << ((level + 1) * WheelBits))) level += 1
+      // Deadlines out of range are placed in the last slot of the top level, and reinserted once it is reached
+      val tick =
+        if (level == Levels - 1 && delta >= (1L << (Levels * WheelBits)))
+          currentTick + (1L << (Levels * WheelBits)) - 1
+        else timeout.deadline
+      insertAt(timeout, level, tick)
+    }
+  }
+
+  private def insertAt(timeout: Timeout, level: Int, tick: scala.Long): Unit = {
+    val slot = level * WheelSize + ((tick >>> (level * WheelBits)) & WheelMask).toInt
+    val head = slots(slot)
+    timeout.slot = slot
+    timeout.prev = null
+    timeout.next = head
+    if (head != null) head.prev = timeout
+    slots(slot) = timeout
+    levelSizes(level) += 1
+  }
+
+  private def unlink(timeout: Timeout): Unit = {
+    val slot = timeout.slot
+    if (timeout.prev != null) timeout.prev.next = timeout.next
+    else slots(slot) = timeout.next
+    if (timeout.next != null) timeout.next.prev = timeout.prev
+    levelSizes(slot / WheelSize) -= 1
+    timeout.slot = -1
+    timeout.prev = null
+    timeout.next = null
+  }
+
+  /** Processes all ticks up to `until`, skipping those at which nothing could happen */
+  @tailrec private def advance(until: scala.Long): Unit =
+    if (currentTick < until) {
+      val next = nextEventTick()
+      if (next > until) currentTick = until
+      else {
+        currentTick = next
+        // Redistribute higher levels first, their timeouts could land in the current slot of a lower level
+        var level = Levels - 1
+        while (level > 0) {
+          if ((currentTick & ((1L << (level * WheelBits)) - 1)) == 0L) cascade(level)
+          level -= 1
+        }
+        expire(currentTick)
+        advance(until)
+      }
+    }
+
+  private def cascade(level: Int): Unit = {
+    val slot = level * WheelSize + ((currentTick >>> (level * WheelBits)) & WheelMask).toInt
+    var timeout = slots(slot)
+    while (timeout != null) {
+      val next = timeout.next
+      unlink(timeout)
+      insert(timeout)
+      timeout = next
+    }
+  }
+
+  private def expire(tick: scala.Long): Unit = {
+    val slot = (tick & WheelMask).toInt
+    var timeout = slots(slot)
+    while (timeout != null) {
+      val next = timeout.next
+      unlink(timeout)
+      if (timeout.deadline > tick) insert(timeout)
+      else timeout.expire()
+      timeout = next
+    }
+  }
+
+  /** Earliest tick after the current one at which a timeout expires or a level needs to be redistributed */
+  private def nextEventTick(): scala.Long = {
+    var result = scala.Long.MaxValue
+    if (levelSizes(0) > 0) {
+      var tick = currentTick + 1
+      while (result == scala.Long.MaxValue && tick <= currentTick + WheelSize) {
+        if (slots((tick & WheelMask).toInt) != null) result = tick
+        tick += 1
+      }
+    }
+    // Slot boundaries of a lower level include these of all higher levels
+    var level = 1
+    while (level < Levels && levelSizes(level) == 0) level += 1
+    if (level < Levels) {
+      val span = 1L << (level * WheelBits)
+      result = result.min((currentTick / span + 1) * span)
+    }
+    result
+  }
+}
+
+private[lang] object VirtualThreadTimer {
+  private final val WheelBits = 6
+  private final val WheelSize = 1 << WheelBits
+  private final val WheelMask = WheelSize - 1L
+  // Covers 2^36 ticks, over 2 years with 1ms ticks
+  private final val Levels = 6
+
+  private final val Pending = 0
+  private final val Expired = 1
+  private final val Cancelled = 2
+
+  @tailrec private def push(stack: AtomicReference[Timeout], timeout: Timeout)(
+      link: (Timeout, Timeout) => Unit
+  ): Unit = {
+    val head = stack.get()
+    link(timeout, head)
+    if (!stack.compareAndSet(head, timeout)) push(stack, timeout)(link)
+  }
+
+  private[lang] final class Timeout(timer: VirtualThreadTimer, private var task: Runnable, val deadline: scala.Long)
+      extends VirtualThreadScheduler.Cancellable {
+    private val state = new AtomicInteger(Pending)
+
+    // Links of the scheduled and cancelled stacks
+    @volatile var nextScheduled: Timeout = _
+    @volatile var nextCancelled: Timeout = _
+    // Owned by the timer thread
+    var slot: Int = -1
+    var prev: Timeout = _
+    var next: Timeout = _
+
+    def isPending: scala.Boolean = state.get() == Pending
+
+    override def isDone(): scala.Boolean = !isPending
+
+    override def cancel(): scala.Boolean =
+      if (state.compareAndSet(Pending, Cancelled)) {
+        // Release the task right away, it is removed from the wheel with a delay
+        task = null
+        timer.onCancelled(this)
+        true
+      } else false
+
+    private[lang] def expire(): Unit =
+      if (state.compareAndSet(Pending, Expired)) {
+        val action = task
+        task = null
+        // Reported like failures of virtual threads, the timer thread keeps running
+        try action.run()
+        catch {
+          case NonFatal(ex) =>
+            val thread = Thread.currentThread()
+            thread.getUncaughtExceptionHandler().uncaughtException(thread, ex)
+        }
+      }
+  }
+}
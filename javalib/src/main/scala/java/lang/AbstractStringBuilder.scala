@@ -598,6 +598,9 @@ protected abstract class AbstractStringBuilder private (unit: Unit) {
     throw new StringIndexOutOfBoundsException()
   }
 
+  /* Builder always uses UTF-16 buffer, the String is compressed to Latin-1
+   * when possible.
+   */
   override def toString(): String = {
     if (count == 0) {
       return ""
@@ -660,9 +663,9 @@ protected abstract class AbstractStringBuilder private (unit: Unit) {
       if (subCount + start > count) {
         return -1
       }
-      val target = subString.toCharArray() // different than SN String.scala
+      val target = subString // different than SN String.scala
       val subOffset = 0 // different than SN String.scala
-      val firstChar = target(subOffset)
+      val firstChar = target.charAt(subOffset)
       val end = subOffset + subCount
       while (true) {
         val i = indexOf(firstChar, start)
@@ -671,7 +674,8 @@ protected abstract class AbstractStringBuilder private (unit: Unit) {
         }
         var o1 = offset + i
         var o2 = subOffset
-        while ({ o2 += 1; o2 } < end && value({ o1 += 1; o1 }) == target(o2)) ()
+        while ({ o2 += 1; o2 } < end &&
+            value({ o1 += 1; o1 }) == target.charAt(o2)) ()
         if (o2 == end) {
           return i
         }
@@ -728,9 +732,9 @@ protected abstract class AbstractStringBuilder private (unit: Unit) {
         if (start > count - subCount) {
           start = count - subCount
         }
-        val target = subString.toCharArray() // different than SN String.scala
+        val target = subString // different than SN String.scala
         val subOffset = 0 // different than SN String.scala
-        val firstChar = target(subOffset)
+        val firstChar = target.charAt(subOffset)
         val end = subOffset + subCount
         while (true) {
           val i = lastIndexOf(firstChar, start)
@@ -739,7 +743,8 @@ protected abstract class AbstractStringBuilder private (unit: Unit) {
           }
           var o1 = offset + i
           var o2 = subOffset
-          while ({ o2 += 1; o2 } < end && value({ o1 += 1; o1 }) == target(o2))
+          while ({ o2 += 1; o2 } < end &&
+              value({ o1 += 1; o1 }) == target.charAt(o2))
             ()
           if (o2 == end) {
             return i
@@ -6,6 +6,7 @@ import java.{lang => jl}
 
 import scalanative.libc
 import scalanative.runtime.Intrinsics
+import scalanative.runtime.ieee754fromstring.{EiselLemire, FastFloat}
 import scalanative.runtime.ieee754tostring.ryu.{RyuDouble, RyuRoundingMode}
 
 final class Double(val _value: scala.Double)
@@ -219,8 +220,11 @@ object Double {
   @inline def min(a: scala.Double, b: scala.Double): scala.Double =
     Math.min(a, b)
 
-  def parseDouble(s: String): scala.Double =
-    parseIEEE754[scala.Double](s, libc.stdlib.strtod)
+  def parseDouble(s: String): scala.Double = {
+    val bits = FastFloat.doubleBits(s)
+    if (bits != EiselLemire.Fallback) longBitsToDouble(bits)
+    else parseIEEE754[scala.Double](s, libc.stdlib.strtod)
+  }
 
   @inline def sum(a: scala.Double, b: scala.Double): scala.Double =
     a + b
@@ -293,7 +297,7 @@ object Double {
     val result = new scala.Array[Char](RyuDouble.RESULT_STRING_MAX_LENGTH)
     val strLen =
       RyuDouble.doubleToChars(d, RyuRoundingMode.Conservative, result, 0)
-    new _String(0, strLen, result).asInstanceOf[String]
+    new _String(result, 0, strLen).asInstanceOf[String]
   }
 
   @inline def valueOf(d: scala.Double): Double =
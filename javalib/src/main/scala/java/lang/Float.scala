@@ -5,6 +5,7 @@ import java.lang.constant.{Constable, ConstantDesc}
 
 import scalanative.libc
 import scalanative.runtime.Intrinsics
+import scalanative.runtime.ieee754fromstring.{EiselLemire, FastFloat}
 import scalanative.runtime.ieee754tostring.ryu.{RyuFloat, RyuRoundingMode}
 
 final class Float(val _value: scala.Float)
@@ -216,8 +217,11 @@ object Float {
   @inline def min(a: scala.Float, b: scala.Float): scala.Float =
     Math.min(a, b)
 
-  def parseFloat(s: String): scala.Float =
-    parseIEEE754[scala.Float](s, libc.stdlib.strtof)
+  def parseFloat(s: String): scala.Float = {
+    val bits = FastFloat.floatBits(s)
+    if (bits != EiselLemire.Fallback) intBitsToFloat(bits.toInt)
+    else parseIEEE754[scala.Float](s, libc.stdlib.strtof)
+  }
 
   @inline def sum(a: scala.Float, b: scala.Float): scala.Float =
     a + b
@@ -298,7 +302,7 @@ object Float {
     val result = new scala.Array[Char](RyuFloat.RESULT_STRING_MAX_LENGTH)
     val strLen =
       RyuFloat.floatToChars(f, RyuRoundingMode.Conservative, result, 0)
-    new _String(0, strLen, result).asInstanceOf[String]
+    new _String(result, 0, strLen).asInstanceOf[String]
   }
 
   @inline def valueOf(s: String): Float =
@@ -13,12 +13,13 @@ import java.{lang => jl}
 
 import scala.annotation.{switch, tailrec}
 
-import scalanative.libc.string.memcmp
+import scalanative.javalib.lang.{Utf8, Vectorized}
+import scalanative.libc.string.{memchr, memcmp}
 import scalanative.runtime.{Intrinsics, toRawPtr}
 import scalanative.unsafe._
 import scalanative.unsigned._
 
-import _String.{_string2string, string2_string}
+import _String.{_string2string, string2_string, LATIN1, UTF16}
 
 final class _String()
     extends Serializable
@@ -26,29 +27,180 @@ final class _String()
     with CharSequence
     with Constable
     with ConstantDesc {
-  protected[_String] var value: Array[Char] = _
+  /* Compact strings: when all chars are in the Latin-1 range (<= 0xFF) they
+   * are stored in an Array[Byte] using a single byte per char, otherwise
+   * `value` is an UTF-16 Array[Char]. The representation is selected by
+   * `coder`. Strings sharing the buffer of another UTF-16 string, e.g. its
+   * substrings, might use UTF-16 even if all their chars fit in Latin-1.
+   */
+  protected[_String] var value: AnyRef = _
   protected[_String] var offset: Int = 0
   protected[_String] var count: Int = 0
   protected[_String] var cachedHashCode: Int = _
+  protected[_String] var coder: Int = _
 
   @inline
   private def thisString: String =
     this.asInstanceOf[String]
 
+  @inline private def isLatin1: scala.Boolean = coder == LATIN1
+
+  @inline private def latin1Value: Array[scala.Byte] =
+    value.asInstanceOf[Array[scala.Byte]]
+
+  @inline private def utf16Value: Array[Char] =
+    value.asInstanceOf[Array[Char]]
+
+  /* Char at given index of this string, without bounds checks */
+  @inline private def charAt0(index: Int): Char =
+    if (isLatin1) (latin1Value(offset + index) & 0xff).toChar
+    else utf16Value(offset + index)
+
+  /* Pointer to the char at given index of this string, each char takes
+   * `1 << coder` bytes. Index needs to be lower than count.
+   */
+  @inline private def dataAt(index: Int): Ptr[scala.Byte] =
+    if (isLatin1) latin1Value.at(offset + index)
+    else utf16Value.at(offset + index).asInstanceOf[Ptr[scala.Byte]]
+
+  /* Initializes this string with a copy of given chars */
+  private def initFromChars(
+      data: Array[Char],
+      start: Int,
+      length: Int
+  ): Unit = {
+    val bytes = _String.compress(data, start, length)
+    offset = 0
+    count = length
+    if (bytes != null) {
+      value = bytes
+      coder = LATIN1
+    } else {
+      val chars = new Array[Char](length)
+      System.arraycopy(data, start, chars, 0, length)
+      value = chars
+      coder = UTF16
+    }
+  }
+
+  /* Initializes this string with given chars, takes ownership of the array if
+   * they cannot be compressed.
+   */
+  private def initFromOwnedChars(data: Array[Char], length: Int): Unit = {
+    val bytes = _String.compress(data, 0, length)
+    offset = 0
+    count = length
+    if (bytes != null) {
+      value = bytes
+      coder = LATIN1
+    } else {
+      value = data
+      coder = UTF16
+    }
+  }
+
+  /* Decodes bytes in one of the charsets covering ASCII directly to Latin-1.
+   * Returns false if charset is not supported or the input contains chars
+   * which cannot be represented in Latin-1.
+   */
+  private def initFromLatin1Bytes(
+      data: Array[scala.Byte],
+      start: Int,
+      length: Int,
+      charset: Charset
+  ): scala.Boolean = {
+    val isUTF8 = charset eq StandardCharsets.UTF_8
+    val maxValue =
+      if (charset eq StandardCharsets.ISO_8859_1) 0xff
+      else if (isUTF8 || (charset eq StandardCharsets.US_ASCII)) 0x7f
+      else -1
+    if (maxValue < 0) {
+      false
+    } else {
+      Objects.checkFromIndexSize(start, length, data.length)
+      // Leading bytes which are copied as they are
+      val prefix =
+        if (maxValue == 0xff || length == 0) length
+        else
+          Utf8
+            .scalanative_utf8_ascii_prefix(data.at(start), length.toCSize)
+            .toInt
+      val bytes = new Array[scala.Byte](length)
+      System.arraycopy(data, start, bytes, 0, prefix)
+      val end = start + length
+      var i = start + prefix
+      var j = prefix
+      while (i < end) {
+        val b = data(i) & 0xff
+        if (b <= maxValue) {
+          bytes(j) = b.toByte
+          i += 1
+        } else if (isUTF8 && (b == 0xc2 || b == 0xc3) && i + 1 < end &&
+            (data(i + 1) & 0xc0) == 0x80) {
+          // 2-byte sequence encoding U+0080..U+00FF
+          bytes(j) = (((b & 0x1f) << 6) | (data(i + 1) & 0x3f)).toByte
+          i += 2
+        } else {
+          return false
+        }
+        j += 1
+      }
+      value = if (j == length) bytes else Arrays.copyOf(bytes, j)
+      offset = 0
+      count = j
+      coder = LATIN1
+      true
+    }
+  }
+
+  /* Decodes well-formed UTF-8 bytes directly to UTF-16 chars. Returns false
+   * if the input contains malformed sequences, which need to be replaced by
+   * the decoder.
+   */
+  private def initFromUTF8Bytes(
+      data: Array[scala.Byte],
+      start: Int,
+      length: Int
+  ): scala.Boolean = {
+    // Never more chars than bytes
+    val chars = new Array[Char](length)
+    val read = stackalloc[CSize]()
+    val written = Utf8.scalanative_utf8_to_utf16(
+      data.at(start),
+      length.toCSize,
+      chars.at(0),
+      length.toCSize,
+      read
+    )
+    if ((!read).toInt != length) false
+    else {
+      initFromOwnedChars(chars, written.toInt)
+      true
+    }
+  }
+
   def this(data: Array[scala.Byte], high: Int, start: Int, length: Int) = {
     this()
     if (length <= data.length - start && start >= 0 && 0 <= length) {
       offset = 0
       count = length
-      value = {
-        val value = new Array[Char](length)
-        val highByte = (high & 0xff) << 8
-        var i = 0
-        while (i < length) {
-          value(i) = (highByte | (data(start + i) & 0xff)).toChar
-          i += 1
+      if ((high & 0xff) == 0) {
+        val bytes = new Array[scala.Byte](length)
+        System.arraycopy(data, start, bytes, 0, length)
+        value = bytes
+        coder = LATIN1
+      } else {
+        value = {
+          val value = new Array[Char](length)
+          val highByte = (high & 0xff) << 8
+          var i = 0
+          while (i < length) {
+            value(i) = (highByte | (data(start + i) & 0xff)).toChar
+            i += 1
+          }
+          value
         }
-        value
+        coder = UTF16
       }
     } else {
       throw new StringIndexOutOfBoundsException()
@@ -62,10 +214,12 @@ final class _String()
       encoding: Charset
   ) = {
     this()
-    offset = 0
-    val charBuffer = encoding.decode(ByteBuffer.wrap(data, start, length))
-    value = charBuffer.array()
-    count = charBuffer.length()
+    if (!initFromLatin1Bytes(data, start, length, encoding) &&
+        !((encoding eq StandardCharsets.UTF_8) &&
+          initFromUTF8Bytes(data, start, length))) {
+      val charBuffer = encoding.decode(ByteBuffer.wrap(data, start, length))
+      initFromOwnedChars(charBuffer.array(), charBuffer.length())
+    }
   }
 
   def this(
@@ -105,10 +259,7 @@ final class _String()
   def this(data: Array[Char], start: Int, length: Int) = {
     this()
     if (start >= 0 && 0 <= length && length <= data.length - start) {
-      offset = 0
-      value = new Array[Char](length)
-      count = length
-      System.arraycopy(data, start, value, 0, count)
+      initFromChars(data, start, length)
     } else {
       throw new StringIndexOutOfBoundsException()
     }
@@ -125,20 +276,33 @@ final class _String()
    *   Any code with access to the "data" Array can change the content and
    *   that change will also be in a String created with this constructor.
    *   Use with knowledge, wisdom, and discretion.
+   *
+   *   The created String always uses UTF-16 representation.
    */
   private[lang] def this(start: Int, length: Int, data: Array[Char]) = {
     this()
     value = data
     offset = start
     count = length
+    coder = UTF16
   }
 
-  // Zero-copy: share the buffer with AbstractStringBuilder via copy-on-write.
+  /* Latin-1 content is compressed to a new array, otherwise it is zero-copy:
+   * share the buffer with AbstractStringBuilder via copy-on-write.
+   */
   private[lang] def this(asb: AbstractStringBuilder, sig: Void) = {
     this()
-    value = asb.shareValue()
+    val length = asb.length()
+    val bytes = _String.compress(asb.getValue(), 0, length)
     offset = 0
-    count = asb.length()
+    count = length
+    if (bytes != null) {
+      value = bytes
+      coder = LATIN1
+    } else {
+      value = asb.shareValue()
+      coder = UTF16
+    }
   }
 
   def this(string: _String) = {
@@ -146,13 +310,15 @@ final class _String()
     value = string.value
     offset = string.offset
     count = string.count
+    coder = string.coder
   }
 
   def this(sb: StringBuffer) = {
     this()
-    count = sb.length()
-    value = new Array[Char](count)
-    sb.getChars(0, count, value, 0)
+    val length = sb.length()
+    val chars = new Array[Char](length)
+    sb.getChars(0, length, chars, 0)
+    initFromOwnedChars(chars, length)
   }
 
   def this(codePoints: Array[Int], offset: Int, count: Int) = {
@@ -160,39 +326,32 @@ final class _String()
     if (offset < 0 || count < 0 || offset > codePoints.length - count) {
       throw new StringIndexOutOfBoundsException()
     } else {
-      this.offset = 0
-      this.value = new Array[Char](count * 2)
-      this.count = {
-        var c = 0
-        var i = offset
-        while (i < offset + count) {
-          c += Character.toChars(codePoints(i), this.value, c)
-          i += 1
-        }
-        c
+      val chars = new Array[Char](count * 2)
+      var c = 0
+      var i = offset
+      while (i < offset + count) {
+        c += Character.toChars(codePoints(i), chars, c)
+        i += 1
       }
+      initFromOwnedChars(chars, c)
     }
   }
 
   def this(sb: java.lang.StringBuilder) = {
     this()
-    count = sb.length()
-    value = new Array[Char](count)
-    sb.getChars(0, count, value, 0)
+    initFromChars(sb.getValue(), 0, sb.length())
   }
 
   // Extended API
   def this(data: ByteBuffer, encoding: Charset) = {
     this()
-    offset = 0
     val charBuffer = encoding.decode(data)
-    value = charBuffer.array()
-    count = charBuffer.length()
+    initFromOwnedChars(charBuffer.array(), charBuffer.length())
   }
 
   def charAt(index: Int): Char = {
     if (0 <= index && index < count) {
-      value(offset + index)
+      charAt0(index)
     } else {
       throw new StringIndexOutOfBoundsException(
         s"String index out of range: $index"
@@ -207,18 +366,29 @@ final class _String()
     Character.toUpperCase(ch)
 
   def compareTo(string: _String): Int = {
-    var o1 = offset
-    var o2 = string.offset
-    val end =
-      if (count < string.count) offset + count
-      else offset + string.count
-    val target = string.value
-    while (o1 < end) {
-      val result = value(o1) - target(o2)
-      o1 += 1
-      o2 += 1
-      if (result != 0) {
-        return result
+    val length = Math.min(count, string.count)
+    if (coder == string.coder) {
+      if (length > 0) {
+        val mismatch = Vectorized
+          .scalanative_mismatch(
+            dataAt(0),
+            string.dataAt(0),
+            (length << coder).toCSize
+          )
+          .toInt
+        if (mismatch >= 0) {
+          val i = mismatch >> coder
+          return charAt0(i) - string.charAt0(i)
+        }
+      }
+    } else {
+      var i = 0
+      while (i < length) {
+        val result = charAt0(i) - string.charAt0(i)
+        i += 1
+        if (result != 0) {
+          return result
+        }
       }
     }
     count - string.count
@@ -240,8 +410,8 @@ final class _String()
   def concat(string: _String): _String = {
     if (string.count == 0) {
       this
-    } else {
-      val buffer = new Array[Char](count + string.count)
+    } else if (isLatin1 && string.isLatin1) {
+      val buffer = new Array[scala.Byte](count + string.count)
 
       if (count > 0) {
         System.arraycopy(value, offset, buffer, 0, count)
@@ -250,6 +420,16 @@ final class _String()
       System
         .arraycopy(string.value, string.offset, buffer, count, string.count)
 
+      _String.fromLatin1(buffer)
+    } else {
+      val buffer = new Array[Char](count + string.count)
+
+      if (count > 0) {
+        getChars(0, count, buffer, 0)
+      }
+
+      string.getChars(0, string.count, buffer, count)
+
       new _String(0, buffer.length, buffer)
     }
   }
@@ -273,16 +453,16 @@ final class _String()
           val thatHash = s.cachedHashCode
           if (thisHash != thatHash && thisHash != 0 && thatHash != 0) {
             false
+          } else if (coder == s.coder) {
+            val data1 = dataAt(0)
+            val data2 = s.dataAt(0)
+            memcmp(data1, data2, (count << coder).toUInt) == 0
           } else {
-            val data1 =
-              value
-                .at(offset)
-                .asInstanceOf[Ptr[scala.Byte]]
-            val data2 =
-              s.value
-                .at(s.offset)
-                .asInstanceOf[Ptr[scala.Byte]]
-            memcmp(data1, data2, (count * 2).toUInt) == 0
+            var i = 0
+            while (i < thisCount && charAt0(i) == s.charAt0(i)) {
+              i += 1
+            }
+            i == thisCount
           }
         }
       }
@@ -330,9 +510,94 @@ final class _String()
     _String.format(this, args) // Must use underbarString.format()
   }
 
-  def getBytes(): Array[scala.Byte] = {
-    val buffer =
-      Charset.defaultCharset().encode(CharBuffer.wrap(value, offset, count))
+  def getBytes(): Array[scala.Byte] =
+    encode(Charset.defaultCharset())
+
+  /* Latin-1 strings are encoded to the charsets covering ASCII directly,
+   * without an intermediate CharBuffer and encoder.
+   */
+  private def encode(charset: Charset): Array[scala.Byte] = {
+    if (isLatin1 && (charset eq StandardCharsets.ISO_8859_1)) {
+      Arrays.copyOfRange(latin1Value, offset, offset + count)
+    } else if (isLatin1 && (charset eq StandardCharsets.US_ASCII)) {
+      val bytes = Arrays.copyOfRange(latin1Value, offset, offset + count)
+      var i = 0
+      while (i < bytes.length) {
+        // Same as the replacement used by the encoder for unmappable chars
+        if (bytes(i) < 0) bytes(i) = '?'.toByte
+        i += 1
+      }
+      bytes
+    } else if (isLatin1 && (charset eq StandardCharsets.UTF_8)) {
+      val data = latin1Value
+      val end = offset + count
+      val prefix =
+        if (count == 0) 0
+        else
+          Utf8
+            .scalanative_utf8_ascii_prefix(data.at(offset), count.toCSize)
+            .toInt
+      var nonAscii = 0
+      var i = offset + prefix
+      while (i < end) {
+        if (data(i) < 0) nonAscii += 1
+        i += 1
+      }
+      if (nonAscii == 0) {
+        Arrays.copyOfRange(data, offset, end)
+      } else {
+        val bytes = new Array[scala.Byte](count + nonAscii)
+        System.arraycopy(data, offset, bytes, 0, prefix)
+        var j = prefix
+        i = offset + prefix
+        while (i < end) {
+          val b = data(i)
+          if (b >= 0) {
+            bytes(j) = b
+            j += 1
+          } else {
+            bytes(j) = (0xc0 | ((b & 0xff) >> 6)).toByte
+            bytes(j + 1) = (0x80 | (b & 0x3f)).toByte
+            j += 2
+          }
+          i += 1
+        }
+        bytes
+      }
+    } else if (!isLatin1 && (charset eq StandardCharsets.UTF_8)) {
+      val length =
+        if (count == 0) 0L
+        else
+          Utf8
+            .scalanative_utf16_utf8_length(utf16Value.at(offset), count.toCSize)
+            .toLong
+      if (length < 0L || length > Int.MaxValue) {
+        // Unpaired surrogates are replaced by the encoder
+        encodeWithEncoder(charset)
+      } else {
+        val bytes = new Array[scala.Byte](length.toInt)
+        if (length > 0L) {
+          val read = stackalloc[CSize]()
+          Utf8.scalanative_utf16_to_utf8(
+            utf16Value.at(offset),
+            count.toCSize,
+            bytes.at(0),
+            length.toCSize,
+            read
+          )
+        }
+        bytes
+      }
+    } else {
+      encodeWithEncoder(charset)
+    }
+  }
+
+  private def encodeWithEncoder(charset: Charset): Array[scala.Byte] = {
+    val chars =
+      if (isLatin1) CharBuffer.wrap(toCharArray())
+      else CharBuffer.wrap(utf16Value, offset, count)
+    val buffer = charset.encode(chars)
     val bytes = new Array[scala.Byte](buffer.limit())
     buffer.get(bytes)
     bytes
@@ -351,10 +616,12 @@ final class _String()
 
       try {
         val len = end - (offset + start)
-        if (len > 0) {
+        if (len > 0 && isLatin1) {
+          System.arraycopy(value, offset + start, data, _index, len)
+        } else if (len > 0) {
           if (_index < 0 || len > data.length - _index)
             throw new ArrayIndexOutOfBoundsException()
-          val srcRaw = toRawPtr(value.at(offset + start))
+          val srcRaw = toRawPtr(utf16Value.at(offset + start))
           val dstRaw = toRawPtr(data.at(_index))
           var i = 0
           // Process 4 chars (8 bytes) at a time using Long loads.
@@ -393,22 +660,22 @@ final class _String()
         case e: UnsupportedCharsetException =>
           throw new java.io.UnsupportedEncodingException(encoding)
       }
-    val buffer = charset.encode(CharBuffer.wrap(value, offset, count))
-    val bytes = new Array[scala.Byte](buffer.limit())
-    buffer.get(bytes)
-    bytes
+    encode(charset)
   }
 
-  def getBytes(encoding: Charset): Array[scala.Byte] = {
-    val buffer = encoding.encode(CharBuffer.wrap(value, offset, count))
-    val bytes = new Array[scala.Byte](buffer.limit())
-    buffer.get(bytes)
-    bytes
-  }
+  def getBytes(encoding: Charset): Array[scala.Byte] =
+    encode(encoding)
 
   def getChars(start: Int, end: Int, buffer: Array[Char], index: Int): Unit = {
     if (0 <= start && start <= end && end <= count) {
-      System.arraycopy(value, start + offset, buffer, index, end - start)
+      if (isLatin1) {
+        val length = end - start
+        if (index < 0 || index > buffer.length - length)
+          throw new ArrayIndexOutOfBoundsException()
+        _String.inflate(latin1Value, start + offset, buffer, index, length)
+      } else {
+        System.arraycopy(value, start + offset, buffer, index, end - start)
+      }
     } else {
       throw new StringIndexOutOfBoundsException()
     }
@@ -421,13 +688,13 @@ final class _String()
       if (count == 0) {
         0
       } else {
-        val data = value.at(offset)
-        var hash = 0
-        var i = 0
-        while (i < count) {
-          hash = data(i) + ((hash << 5) - hash)
-          i += 1
-        }
+        val hash =
+          if (isLatin1)
+            Vectorized
+              .scalanative_hash_u8(latin1Value.at(offset), count.toCSize, 0)
+          else
+            Vectorized
+              .scalanative_hash_u16(utf16Value.at(offset), count.toCSize, 0)
         cachedHashCode = hash
         hash
       }
@@ -459,40 +726,35 @@ final class _String()
    *
    *   For details, see note above indexOfImpl(str, fromIndex, toIndex).
    */
-  private def indexOfImpl(ch: Int, beginIndex: Int, endIndex: Int): Int = {
+  private def indexOfImpl(ch: Int, beginIndex: Int, endIndex: Int): Int =
+    if (isLatin1) indexOfLatin1(ch, beginIndex, endIndex)
+    else indexOfUTF16(ch, beginIndex, endIndex)
+
+  private def indexOfLatin1(ch: Int, beginIndex: Int, endIndex: Int): Int = {
+    val len = endIndex - beginIndex
+    // Chars outside of the Latin-1 range cannot be present in the string
+    if (ch >= 0 && ch <= 0xff && len > 0) {
+      val data = latin1Value.at(offset + beginIndex)
+      val foundAt = memchr(data, ch, len.toUInt)
+      if (foundAt != null) {
+        return beginIndex + (foundAt.toLong - data.toLong).toInt
+      }
+    }
+    -1
+  }
+
+  private def indexOfUTF16(ch: Int, beginIndex: Int, endIndex: Int): Int = {
+    val value = utf16Value
     var start = beginIndex
 
     if (ch >= 0 && ch <= Character.MAX_VALUE) {
       val len = endIndex - start
       if (len > 0) {
-        // SWAR (SIMD Within A Register) search for BMP chars.
-        // Process 4 chars (8 bytes) at a time using Long loads.
-        val charMask =
-          ch.toLong | (ch.toLong << 16) | (ch.toLong << 32) | (ch.toLong << 48)
-        val srcRaw = toRawPtr(value.at(offset + start))
-        var i = 0
-        while (i + 4 <= len) {
-          val long =
-            Intrinsics.loadLong(Intrinsics.elemRawPtr(srcRaw, i * 2))
-          val xored = long ^ charMask
-          // SWAR zero-detection: true if any 16-bit lane is zero after XOR
-          val hasZero =
-            ((xored - 0x0001000100010001L) & ~xored & 0x8000800080008000L) != 0
-          if (hasZero) {
-            val vi = offset + start + i
-            val si = start + i
-            if (value(vi) == ch) return si
-            if (value(vi + 1) == ch) return si + 1
-            if (value(vi + 2) == ch) return si + 2
-            if (value(vi + 3) == ch) return si + 3
-          }
-          i += 4
-        }
-        val vi0 = offset + start
-        while (i < len) {
-          if (value(vi0 + i) == ch)
-            return start + i
-          i += 1
+        val foundAt = Vectorized
+          .scalanative_index_of_u16(value.at(offset + start), len.toCSize, ch)
+          .toInt
+        if (foundAt >= 0) {
+          return start + foundAt
         }
       }
     } else if (ch > Character.MAX_VALUE && ch <= Character.MAX_CODE_POINT) {
@@ -551,12 +813,14 @@ final class _String()
        * a.k.a "".
        */
       -1
+    } else if (coder != str.coder) {
+      indexOfMixedCoders(str, beginIndex, endIndex)
     } else {
-      val haystackStartPtr =
-        this.value.at(offset + beginIndex).asInstanceOf[Ptr[Byte]]
+      // Both strings use the same number of bytes per char: 1 << coder
+      val haystackStartPtr = this.dataAt(beginIndex)
 
-      val haystackEndPtr =
-        haystackStartPtr + ((endIndex - beginIndex) * 2) // First excluded byte
+      val haystackEndPtr = // First excluded byte
+        haystackStartPtr + ((endIndex - beginIndex) << coder)
 
       var result = -1
 
@@ -569,19 +833,20 @@ final class _String()
           .memmem(
             cursor,
             nHaystackBytesRemaining,
-            str.value.at(str.offset),
-            str.count * 2
+            str.dataAt(0),
+            str.count << coder
           )
-          .asInstanceOf[Ptr[Byte]]
+          .asInstanceOf[Ptr[scala.Byte]]
 
         if (foundAt == null) {
           cursor = haystackEndPtr
-        } else if ((foundAt.toInt & 0x1) == 1) { // found on odd bit boundary
+        } else if (coder == UTF16 && (foundAt.toInt & 0x1) == 1) {
+          // found on odd bit boundary
           cursor = foundAt + 1 // skip to next 16 bit Character boundary
-        } else { // found on even bit boundary
+        } else { // found on char boundary
           cursor = haystackEndPtr
           val foundOffsetCharCount =
-            ((foundAt.toLong - haystackStartPtr.toLong) >> 1).toInt
+            ((foundAt.toLong - haystackStartPtr.toLong) >> coder).toInt
 
           // Make relative to public start of 'this': (this.value + offset)
           result = beginIndex + foundOffsetCharCount
@@ -592,6 +857,33 @@ final class _String()
     }
   }
 
+  /* Naive search used when one of the strings is Latin-1 and the other one
+   * is UTF-16, preconditions are the same as in indexOfImpl(str, ...)
+   */
+  private def indexOfMixedCoders(
+      str: _String,
+      beginIndex: Int,
+      endIndex: Int
+  ): Int = {
+    val needleLen = str.count
+    val firstChar = str.charAt0(0)
+    val last = endIndex - needleLen
+    var i = beginIndex
+    while (i <= last) {
+      if (charAt0(i) == firstChar) {
+        var j = 1
+        while (j < needleLen && charAt0(i + j) == str.charAt0(j)) {
+          j += 1
+        }
+        if (j == needleLen) {
+          return i
+        }
+      }
+      i += 1
+    }
+    -1
+  }
+
   def indexOf(str: _String): Int =
     indexOfImpl(str, 0, count)
 
@@ -616,19 +908,28 @@ final class _String()
 
   def lastIndexOf(c: Int, _start: Int): Int = {
     var start = _start
-    if (start >= 0) {
+    if (start >= 0 && count > 0) {
       if (start >= count) {
         start = count - 1
       }
-      if (c >= 0 && c <= Character.MAX_VALUE) {
-        var i = offset + start
-        while (i >= offset) {
-          if (value(i) == c) {
-            return i - offset
-          } else {
-            i -= 1
-          }
+      if (c >= 0 && c <= Character.MAX_VALUE && isLatin1) {
+        if (c <= 0xff) {
+          return Vectorized
+            .scalanative_last_index_of_u8(
+              latin1Value.at(offset),
+              (start + 1).toCSize,
+              c
+            )
+            .toInt
         }
+      } else if (c >= 0 && c <= Character.MAX_VALUE) {
+        return Vectorized
+          .scalanative_last_index_of_u16(
+            utf16Value.at(offset),
+            (start + 1).toCSize,
+            c
+          )
+          .toInt
       } else if (c > Character.MAX_VALUE && c <= Character.MAX_CODE_POINT) {
         var i = start
         while (i >= 0) {
@@ -657,20 +958,16 @@ final class _String()
         if (start > count - subCount) {
           start = count - subCount
         }
-        val target = subString.value
-        val subOffset = subString.offset
-        val firstChar = target(subOffset)
-        val end = subOffset + subCount
+        val firstChar = subString.charAt0(0)
         while (true) {
           val i = lastIndexOf(firstChar, start)
           if (i == -1) {
             return -1
           }
-          var o1 = offset + i
-          var o2 = subOffset
-          while ({ o2 += 1; o2 } < end && value({ o1 += 1; o1 }) == target(o2))
-            ()
-          if (o2 == end) {
+          var j = 1
+          while (j < subCount && charAt0(i + j) == subString.charAt0(j))
+            j += 1
+          if (j == subCount) {
             return i
           }
           start = i - 1
@@ -685,18 +982,14 @@ final class _String()
 
   @inline def length(): Int = count
 
-  private class _StringLineReader(
-      src: Array[Char],
-      srcOffset: Int,
-      srcCount: Int
-  ) {
+  private class _StringLineReader(src: _String) {
     /* See also similar code in java.io.BufferedReader
      * Strings are immutable, so the content of the array should not
      * change while it is being traversed by this class.
      */
 
-    var nextOrigin = srcOffset
-    val srcEnd = srcOffset + srcCount
+    var nextOrigin = 0
+    val srcEnd = src.count
 
     def readLine(): _String = {
       if (nextOrigin >= srcEnd) {
@@ -706,23 +999,23 @@ final class _String()
         var cursor = origin
 
         while ((cursor < srcEnd) &&
-            ((src(cursor) != '\n') && src(cursor) != '\r')) {
+            ((src.charAt0(cursor) != '\n') && src.charAt0(cursor) != '\r')) {
           cursor += 1
         }
 
         val nChars = cursor - origin
 
         if (cursor < srcEnd) {
-          if (src(cursor) == '\r')
+          if (src.charAt0(cursor) == '\r')
             cursor += 1
 
-          if ((cursor < srcEnd) && src(cursor) == '\n')
+          if ((cursor < srcEnd) && src.charAt0(cursor) == '\n')
             cursor += 1
         }
 
         nextOrigin = cursor
 
-        new _String(src, origin, nChars)
+        src.copySlice(origin, nChars)
       }
     }
   }
@@ -734,11 +1027,11 @@ final class _String()
      *    (new java.io.BufferedReader(new java.io.StringReader(this))).lines()
      *
      * Since this method is a member of the _String class, it has access to the
-     * underlying Class "value" Array[Char]. Allowing it to use Array indexing
+     * underlying Class "value" Array. Allowing it to use Array indexing
      * to pursue faster execution and fewer allocations.
      */
 
-    val lineSrc = new _StringLineReader(value, offset, count)
+    val lineSrc = new _StringLineReader(this)
 
     // "this.count" - high guess for maximum possible lines not an exact number
     val spliter =
@@ -790,15 +1083,16 @@ final class _String()
        * to skip the latter checking arguments that have already been checked.
        */
 
-      val data1 = this.value
-        .at(this.offset + toffset)
-        .asInstanceOf[Ptr[scala.Byte]]
-
-      val data2 = other.value
-        .at(other.offset + ooffset)
-        .asInstanceOf[Ptr[scala.Byte]]
-
-      memcmp(data1, data2, (len * 2).toUInt) == 0
+      if (this.coder == other.coder) {
+        val data1 = this.dataAt(toffset)
+        val data2 = other.dataAt(ooffset)
+        memcmp(data1, data2, (len << coder).toUInt) == 0
+      } else {
+        var i = 0
+        while (i < len && charAt0(toffset + i) == other.charAt0(ooffset + i))
+          i += 1
+        i == len
+      }
     }
   }
 
@@ -841,9 +1135,21 @@ final class _String()
     var index = indexOf(oldChar, 0)
     if (index == -1) {
       this
+    } else if (isLatin1 && newChar <= 0xff) {
+      val buffer = new Array[scala.Byte](count)
+      System.arraycopy(value, offset, buffer, 0, count)
+
+      while ({
+        buffer(index) = newChar.toByte
+        index += 1
+        index = indexOf(oldChar, index)
+        index != -1
+      }) ()
+
+      _String.fromLatin1(buffer)
     } else {
       val buffer = new Array[Char](count)
-      System.arraycopy(value, offset, buffer, 0, count)
+      getChars(0, count, buffer, 0)
 
       while ({
         buffer(index) = newChar
@@ -876,7 +1182,7 @@ final class _String()
 
         var i = 0
         while (i < count) {
-          buffer.append(value(offset + i))
+          buffer.append(charAt0(i))
           buffer.append(rs)
           i += 1
         }
@@ -888,13 +1194,13 @@ final class _String()
       val tl = target.length()
       var tail = 0
       while ({
-        buffer.append(value, offset + tail, index - tail)
+        buffer.append(this, tail, index)
         buffer.append(rs)
         tail = index + tl
         index = indexOf(ts, tail)
         index != -1
       }) ()
-      buffer.append(value, offset + tail, count - tail)
+      buffer.append(this, tail, count)
 
       buffer.toString
     }
@@ -910,7 +1216,7 @@ final class _String()
     if (start == 0) {
       this
     } else if (0 <= start && start <= count) {
-      new _String(offset + start, count - start, value)
+      sharedSlice(start, count - start)
     } else {
       throw new StringIndexOutOfBoundsException(start)
     }
@@ -927,12 +1233,32 @@ final class _String()
         throw new StringIndexOutOfBoundsException(end)
       }
 
-      new _String(offset + start, end - start, value)
+      sharedSlice(start, end - start)
+    }
+
+  /* Substring sharing the underlying array with this string */
+  private def sharedSlice(start: Int, length: Int): _String = {
+    val string = new _String()
+    string.value = value
+    string.offset = offset + start
+    string.count = length
+    string.coder = coder
+    string
+  }
+
+  /* Substring using its own copy of the underlying array */
+  private def copySlice(start: Int, length: Int): _String =
+    if (isLatin1) {
+      val bytes = new Array[scala.Byte](length)
+      System.arraycopy(value, offset + start, bytes, 0, length)
+      _String.fromLatin1(bytes)
+    } else {
+      new _String(utf16Value, offset + start, length)
     }
 
   def toCharArray(): Array[Char] = {
     val buffer = new Array[Char](count)
-    System.arraycopy(value, offset, buffer, 0, count)
+    getChars(0, count, buffer, 0)
     buffer
   }
 
@@ -1250,14 +1576,32 @@ for (cp <- 0 to Character.MAX_CODE_POINT) {
 
   private def toCase(convert: Int => Int): _String = {
     if (count == 0) return this
+    if (isLatin1) {
+      val value = latin1Value
+      val buffer = new Array[scala.Byte](count)
+      var i = 0
+      while (i < count) {
+        val cased = convert(value(offset + i) & 0xff)
+        // e.g. upper case of U+00FF or U+00B5 is outside of Latin-1 range
+        if (cased > 0xff) return toCaseUTF16(convert)
+        buffer(i) = cased.toByte
+        i += 1
+      }
+      _String.fromLatin1(buffer)
+    } else {
+      toCaseUTF16(convert)
+    }
+  }
+
+  private def toCaseUTF16(convert: Int => Int): _String = {
     val buf = new jl.StringBuilder(count)
-    var i = offset
-    while (i < offset + count) {
-      val high = value(i)
+    var i = 0
+    while (i < count) {
+      val high = charAt0(i)
       i += 1
       if (Character.isHighSurrogate(high)) {
-        if (i < offset + count) {
-          val low = value(i)
+        if (i < count) {
+          val low = charAt0(i)
           i += 1
           if (Character.isLowSurrogate(low)) {
             val cp = Character.toCodePoint(high, low)
@@ -1384,22 +1728,22 @@ for (cp <- 0 to Character.MAX_CODE_POINT) {
   }
 
   def trim(): _String = {
-    var start = offset
-    val last = offset + count - 1
+    var start = 0
+    val last = count - 1
     var end = last
 
-    while ((start <= end) && (value(start) <= ' ')) {
+    while ((start <= end) && (charAt0(start) <= ' ')) {
       start += 1
     }
 
-    while ((end >= start) && (value(end) <= ' ')) {
+    while ((end >= start) && (charAt0(end) <= ' ')) {
       end -= 1
     }
 
-    if (start == offset && end == last) {
+    if (start == 0 && end == last) {
       this
     } else {
-      new _String(start, end - start + 1, value)
+      sharedSlice(start, end - start + 1)
     }
   }
 
@@ -1480,34 +1824,52 @@ for (cp <- 0 to Character.MAX_CODE_POINT) {
   def codePointAt(index: Int): Int =
     if (index < 0 || index >= count) {
       throw new StringIndexOutOfBoundsException()
+    } else if (isLatin1) {
+      latin1Value(index + offset) & 0xff
     } else {
-      Character.codePointAt(value, index + offset, offset + count)
+      Character.codePointAt(utf16Value, index + offset, offset + count)
     }
 
   def codePointBefore(index: Int): Int =
     if (index < 1 || index > count) {
       throw new StringIndexOutOfBoundsException()
+    } else if (isLatin1) {
+      latin1Value(index - 1 + offset) & 0xff
     } else {
-      Character.codePointBefore(value, index + offset)
+      Character.codePointBefore(utf16Value, index + offset)
     }
 
   def codePointCount(beginIndex: Int, endIndex: Int): Int =
     if (beginIndex < 0 || endIndex > count || beginIndex > endIndex) {
       throw new StringIndexOutOfBoundsException()
+    } else if (isLatin1) {
+      endIndex - beginIndex
     } else {
       Character
-        .codePointCount(value, beginIndex + offset, endIndex - beginIndex)
+        .codePointCount(utf16Value, beginIndex + offset, endIndex - beginIndex)
     }
 
   def contains(cs: CharSequence): scala.Boolean =
     indexOf(cs.toString) >= 0
 
-  def offsetByCodePoints(index: Int, codePointOffset: Int): Int = {
-    val s = index + offset
-    val r =
-      Character.offsetByCodePoints(value, offset, count, s, codePointOffset)
-    r - offset
-  }
+  def offsetByCodePoints(index: Int, codePointOffset: Int): Int =
+    if (isLatin1) {
+      // Each Latin-1 char is a single code point
+      val r = index.toLong + codePointOffset
+      if (index < 0 || index > count || r < 0 || r > count)
+        throw new IndexOutOfBoundsException()
+      r.toInt
+    } else {
+      val s = index + offset
+      val r = Character.offsetByCodePoints(
+        utf16Value,
+        offset,
+        count,
+        s,
+        codePointOffset
+      )
+      r - offset
+    }
 
   def stripLeading(): String = {
     val len = length()
@@ -1740,17 +2102,98 @@ object _String {
       o1.compareToIgnoreCase(o2)
   }
 
-  private object ASCII {
-    val chars: Array[Char] = new Array[Char](128)
+  // Coders of _String.value, keep in sync with Lower.genStringVal
+  private[lang] final val LATIN1 = 0
+  private[lang] final val UTF16 = 1
+
+  private object Latin1 {
+    val chars: Array[scala.Byte] = new Array[scala.Byte](256)
     locally {
       var i = 0
       while (i < chars.length) {
-        chars(i) = i.toChar
+        chars(i) = i.toByte
+        i += 1
+      }
+    }
+  }
+
+  /* Creates Latin-1 string taking the ownership of given array */
+  private[lang] def fromLatin1(data: Array[scala.Byte]): _String = {
+    val string = new _String()
+    string.value = data
+    string.count = data.length
+    string.coder = LATIN1
+    string
+  }
+
+  /* Returns Latin-1 copy of given chars, or null if any of them is outside
+   * of the Latin-1 range.
+   */
+  private[lang] def compress(
+      src: Array[Char],
+      start: Int,
+      length: Int
+  ): Array[scala.Byte] = {
+    val dst = new Array[scala.Byte](length)
+    if (length > 0) {
+      val srcRaw = toRawPtr(src.at(start))
+      val dstRaw = toRawPtr(dst.at(0))
+      var i = 0
+      // Process 4 chars (8 bytes) at a time using Long loads.
+      while (i + 4 <= length) {
+        val long = Intrinsics.loadLong(Intrinsics.elemRawPtr(srcRaw, i * 2))
+        if ((long & 0xff00ff00ff00ff00L) != 0L) return null
+        val packed = ((long & 0xffL) |
+          ((long >> 8) & 0xff00L) |
+          ((long >> 16) & 0xff0000L) |
+          ((long >> 24) & 0xff000000L)).toInt
+        Intrinsics.storeInt(Intrinsics.elemRawPtr(dstRaw, i), packed)
+        i += 4
+      }
+      while (i < length) {
+        val ch = Intrinsics.loadChar(Intrinsics.elemRawPtr(srcRaw, i * 2))
+        if (ch > 0xff) return null
+        Intrinsics.storeByte(Intrinsics.elemRawPtr(dstRaw, i), ch.toByte)
         i += 1
       }
     }
+    dst
   }
 
+  /* Widens Latin-1 bytes to chars, caller needs to check bounds of both
+   * arrays.
+   */
+  private[lang] def inflate(
+      src: Array[scala.Byte],
+      srcStart: Int,
+      dst: Array[Char],
+      dstStart: Int,
+      length: Int
+  ): Unit =
+    if (length > 0) {
+      val srcRaw = toRawPtr(src.at(srcStart))
+      val dstRaw = toRawPtr(dst.at(dstStart))
+      var i = 0
+      // Process 4 bytes at a time, storing them as 4 chars in single Long.
+      while (i + 4 <= length) {
+        val int = Intrinsics.loadInt(Intrinsics.elemRawPtr(srcRaw, i)).toLong
+        val long = (int & 0xffL) |
+          ((int & 0xff00L) << 8) |
+          ((int & 0xff0000L) << 16) |
+          ((int & 0xff000000L) << 24)
+        Intrinsics.storeLong(Intrinsics.elemRawPtr(dstRaw, i * 2), long)
+        i += 4
+      }
+      while (i < length) {
+        val b = Intrinsics.loadByte(Intrinsics.elemRawPtr(srcRaw, i))
+        Intrinsics.storeChar(
+          Intrinsics.elemRawPtr(dstRaw, i * 2),
+          (b & 0xff).toChar
+        )
+        i += 1
+      }
+    }
+
   def copyValueOf(data: Array[Char], start: Int, length: Int): _String =
     new _String(data, start, length)
 
@@ -1788,8 +2231,14 @@ object _String {
 
   def valueOf(value: Char): _String = {
     val s =
-      if (value < 128) new _String(value, 1, ASCII.chars)
-      else new _String(0, 1, Array(value))
+      if (value <= 0xff) {
+        val s = new _String()
+        s.value = Latin1.chars
+        s.offset = value
+        s.count = 1
+        s.coder = LATIN1
+        s
+      } else new _String(0, 1, Array(value))
     s.cachedHashCode = value
     s
   }
@@ -3,7 +3,10 @@ package java.lang.process
 import java.io._
 
 import scala.scalanative.annotation.stub
+import scala.scalanative.javalib.io.VirtualThreadPoller
 import scala.scalanative.meta.LinktimeInfo.isWindows
+import scala.scalanative.posix.poll._
+import scala.scalanative.posix.pollOps._
 import scala.scalanative.posix.sys.ioctl._
 import scala.scalanative.unsafe._
 import scala.scalanative.unsigned._
@@ -101,24 +104,59 @@ private[process] object PipeIO {
 
   class StreamImpl(is: FileInputStream) extends Stream {
 
-    private var src: InputStream = is
+    @volatile private var src: InputStream = is
+    // Set once awaited using the poller, needs to be deregistered on close
+    @volatile private var polled = false
 
     override def available(): Int =
       synchronized(src.available())
 
+    private def closeInput(): Unit = {
+      if (polled) VirtualThreadPoller.deregister(is.getFD().fd)
+      is.close()
+    }
+
     private def switchToNullInput(): Unit = {
-      src.close()
+      closeInput()
       src = NullInput
     }
 
+    /* Reading from the pipe would block the carrier thread of a virtual
+     * thread, it is parked until there is input to read or the child has
+     * closed its end of the pipe instead.
+     */
+    private def awaitInput(): Unit =
+      if (VirtualThreadPoller.isEnabled) {
+        val fd = is.getFD().fd
+        polled = true
+        try {
+          while ((src eq is) && !isReadable(fd))
+            VirtualThreadPoller.awaitReadable(fd, 0L)
+        } catch {
+          // Drained and closed by other thread, read from `src` instead
+          case _: IOException if src ne is => ()
+        }
+      }
+
+    private def isReadable(fd: Int): Boolean = {
+      val pollFd = stackalloc[struct_pollfd]()
+      pollFd.fd = fd
+      pollFd.events = POLLIN.toShort
+      pollFd.revents = 0
+      // Errors are reported by the following read
+      poll(pollFd, 1.toUInt, 0) != 0
+    }
+
     override def read(): Int =
       if (src eq NullInput) -1
-      else
+      else {
+        awaitInput()
         synchronized {
           val res = src.read()
           if (res == -1) switchToNullInput()
           res
         }
+      }
 
     override def read(buf: Array[scala.Byte], offset: Int, len: Int): Int = {
       if (offset < 0 || len < 0 || len > buf.length - offset) {
@@ -130,12 +168,14 @@ private[process] object PipeIO {
 
       if (len == 0) 0
       else if (src eq NullInput) -1
-      else
+      else {
+        awaitInput()
         synchronized {
           val res = src.read(buf, offset, len)
           if (res < 0) switchToNullInput()
           res
         }
+      }
     }
 
     /* Switch horses, or at least InputStreams, "in media res".
@@ -150,7 +190,7 @@ private[process] object PipeIO {
           else new ByteArrayInputStream(is.readNBytes(avail))
 
         // release JVM FileDescriptor and, especially, its OS fd.
-        is.close()
+        closeInput()
       }
     }
   }
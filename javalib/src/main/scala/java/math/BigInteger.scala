@@ -429,6 +429,8 @@ class BigInteger extends Number with Comparable[BigInteger] {
           else MINUS_ONE
         } else if (cmp == LESS) {
           ZERO
+        } else if (Division.useBurnikelZiegler(thisLen, divisorLen)) {
+          Division.divideAndRemainderBurnikelZiegler(this, divisor).quot
         } else {
           val resLength = thisLen - divisorLen + 1
           val resDigits = new Array[Int](resLength)
@@ -481,6 +483,8 @@ class BigInteger extends Number with Comparable[BigInteger] {
 
       if (cmp < 0) {
         new QuotAndRem(ZERO, this)
+      } else if (Division.useBurnikelZiegler(thisLen, divisorLen)) {
+        Division.divideAndRemainderBurnikelZiegler(this, divisor)
       } else {
         val thisSign = sign
         val quotientLength = thisLen - divisorLen + 1
@@ -713,6 +717,8 @@ class BigInteger extends Number with Comparable[BigInteger] {
 
     if (cmp == LESS) {
       this
+    } else if (Division.useBurnikelZiegler(thisLen, divisorLen)) {
+      Division.divideAndRemainderBurnikelZiegler(this, divisor).rem
     } else {
       val resLength = divisorLen
       var resDigits = new Array[Int](resLength)
@@ -917,6 +923,24 @@ class BigInteger extends Number with Comparable[BigInteger] {
     else BitLevel.shiftLeftOneBit(this)
   }
 
+  /** Returns the magnitude of digits in range [from, until).
+   *
+   *  Used to split numbers into blocks by recursive algorithms.
+   */
+  private[math] def slice(from: Int, until: Int): BigInteger = {
+    val end = Math.min(until, numberLength)
+    if (from >= end) {
+      ZERO
+    } else {
+      val sliceLength = end - from
+      val sliceDigits = new Array[Int](sliceLength)
+      System.arraycopy(digits, from, sliceDigits, 0, sliceLength)
+      val result = new BigInteger(1, sliceLength, sliceDigits)
+      result.cutOffLeadingZeroes()
+      result
+    }
+  }
+
   private[math] def unCache(): Unit =
     firstNonzeroDigit = firstNonzeroDigitNotSet
 
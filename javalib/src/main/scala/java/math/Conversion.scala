@@ -106,6 +106,22 @@ private[math] object Conversion {
     729000000, 887503681, 1073741824, 1291467969, 1544804416, 1838265625,
     60466176)
 
+  /** Numbers having at least this many ints are converted to strings using
+   *  the recursive divide-and-conquer algorithm.
+   */
+  private final val RecursiveToStringThreshold = 20
+
+  /** Cache of radix^(2^i) values used by recursive conversion, indexed by
+   *  radix. Arrays are replaced instead of mutated, so that they can be safely
+   *  shared between threads.
+   */
+  @volatile private var radixPowers: Array[Array[BigInteger]] = {
+    val cache = new Array[Array[BigInteger]](Character.MAX_RADIX + 1)
+    for (radix <- Character.MIN_RADIX to Character.MAX_RADIX)
+      cache(radix) = Array(BigInteger.valueOf(radix))
+    cache
+  }
+
   private def stripLeadingZeros(sb: jl.StringBuilder): jl.StringBuilder = {
     val leadingZeroCount = sb.chars().takeWhile(_ == '0').count()
     if (leadingZeroCount > 0L)
@@ -131,6 +147,8 @@ private[math] object Conversion {
       java.lang.Long.toString(v, radix)
     } else if (radix == 10 || radixOutOfBounds) {
       bi.toString
+    } else if (numberLength >= RecursiveToStringThreshold) {
+      recursiveToString(bi, radix)
     } else {
       var bitsForRadixDigit: Double = 0.0
       bitsForRadixDigit = Math.log(radix) / Math.log(2)
@@ -225,6 +243,8 @@ private[math] object Conversion {
 
     if (sign == 0) {
       "0"
+    } else if (numberLength >= RecursiveToStringThreshold) {
+      recursiveToString(bi, 10)
     } else {
       // one 32-bit unsigned value may contain 10 decimal digits
       // Explanation why +1+7:
@@ -318,6 +338,69 @@ private[math] object Conversion {
     }
   }
 
+  /** Converts a large number to string using the divide-and-conquer algorithm
+   *  by Schönhage.
+   *
+   *  The number is divided by radix^(2^n) close to its square root and both
+   *  quotient and remainder are converted recursively, which makes the
+   *  conversion as fast as the division of large numbers.
+   */
+  private def recursiveToString(bi: BigInteger, radix: Int): String = {
+    val result = new jl.StringBuilder(bi.numberLength * 10 + 1)
+    if (bi.sign < 0)
+      result.append('-')
+    appendRecursive(bi.abs(), radix, result, 0)
+    result.toString()
+  }
+
+  /** Appends non-negative number left padded with zeros to given length. */
+  private def appendRecursive(
+      u: BigInteger,
+      radix: Int,
+      result: jl.StringBuilder,
+      padTo: Int
+  ): Unit = {
+    if (u.numberLength < RecursiveToStringThreshold) {
+      val str =
+        if (u.sign == 0) ""
+        else if (radix == 10) toDecimalScaledString(u)
+        else bigInteger2String(u, radix)
+      var padding = padTo - str.length
+      while (padding > 0) {
+        result.append('0')
+        padding -= 1
+      }
+      result.append(str)
+    } else {
+      val bitLength = u.bitLength()
+      // Smallest n such that radix^(2^n) is greater than the square root of u
+      val n = Math.round(
+        Math.log(bitLength * Math.log(2) / Math.log(radix)) / Math.log(2) - 1.0
+      ).toInt
+      val qr = u.divideAndRemainderImpl(radixPower(radix, n))
+      val expectedDigits = 1 << n
+      appendRecursive(qr.quot, radix, result, padTo - expectedDigits)
+      appendRecursive(qr.rem, radix, result, expectedDigits)
+    }
+  }
+
+  /** Returns radix^(2^exponent) */
+  private def radixPower(radix: Int, exponent: Int): BigInteger = {
+    val powers = radixPowers(radix)
+    if (exponent < powers.length) {
+      powers(exponent)
+    } else {
+      val extended = new Array[BigInteger](exponent + 1)
+      System.arraycopy(powers, 0, extended, 0, powers.length)
+      for (i <- powers.length to exponent)
+        extended(i) = extended(i - 1).pow(2)
+      val cache = radixPowers.clone()
+      cache(radix) = extended
+      radixPowers = cache
+      extended(exponent)
+    }
+  }
+
   /* can process only 32-bit numbers */
   def toDecimalScaledString(value: Long, scale: Int): String = {
     if (value == 0) {
@@ -71,6 +71,21 @@ private[math] object Division {
 
   private final val UINT_MAX = 0xffffffffL
 
+  /** Divisors having at least this many ints are divided using the
+   *  Burnikel-Ziegler algorithm.
+   */
+  private final val BurnikelZieglerThreshold = 80
+
+  /** Minimal difference between lengths of dividend and divisor required to
+   *  use the Burnikel-Ziegler algorithm, shorter quotients are computed faster
+   *  using schoolbook division.
+   */
+  private final val BurnikelZieglerOffset = 40
+
+  def useBurnikelZiegler(dividendLength: Int, divisorLength: Int): Boolean =
+    divisorLength >= BurnikelZieglerThreshold &&
+      dividendLength - divisorLength >= BurnikelZieglerOffset
+
   /** Divides an array by another array.
    *
    *  Divides the array 'a' by the array 'b' and gets the quotient and the
@@ -212,6 +227,61 @@ private[math] object Division {
     }
   }
 
+  /** Computes the quotient and the remainder using the recursive division by
+   *  Burnikel and Ziegler.
+   *
+   *  See C. Burnikel, J. Ziegler, Fast Recursive Division, MPI-I-98-1-022.
+   *  Dividend is split into blocks of the divisor size, each pair of blocks is
+   *  divided recursively by halving the problem until it gets small enough for
+   *  schoolbook division. Multiplications of the recursive steps make the
+   *  division as fast as the multiplication algorithm in use.
+   *
+   *  @return
+   *    quotient with the sign of {@code a * b} and remainder with the sign of
+   *    {@code a}
+   */
+  def divideAndRemainderBurnikelZiegler(
+      a: BigInteger,
+      b: BigInteger
+  ): QuotAndRem = {
+    val s = b.numberLength
+    // Block length n = j * 2^k, so that it can be halved k times before
+    // reaching the threshold of schoolbook division
+    val m = 1 << (32 - java.lang.Integer.numberOfLeadingZeros(
+      s / BurnikelZieglerThreshold
+    ))
+    val j = (s + m - 1) / m
+    val n = j * m
+    val n32 = n * 32
+
+    // Normalize the divisor, so that it has exactly n ints with highest bit set
+    val sigma = Math.max(0, n32 - b.bitLength())
+    val bShifted = b.abs().shiftLeft(sigma)
+    val aShifted = a.abs().shiftLeft(sigma)
+
+    // Number of blocks of the dividend, highest one needs to be less than
+    // the divisor, hence the extra bit
+    val t = Math.max((aShifted.bitLength() + n32) / n32, 2)
+
+    var z = aShifted.slice((t - 2) * n, t * n)
+    var quotient = BigInteger.ZERO
+    var i = t - 2
+    while (i > 0) {
+      val qr = divide2n1n(z, bShifted, n)
+      quotient = quotient.shiftLeft(n32).add(qr.quot)
+      z = qr.rem.shiftLeft(n32).add(aShifted.slice((i - 1) * n, i * n))
+      i -= 1
+    }
+    val qr = divide2n1n(z, bShifted, n)
+    quotient = quotient.shiftLeft(n32).add(qr.quot)
+    val remainder = qr.rem.shiftRight(sigma)
+
+    new QuotAndRem(
+      if (a.sign != b.sign) quotient.negate() else quotient,
+      if (a.sign < 0) remainder.negate() else remainder
+    )
+  }
+
   /** Computes the quotient and the remainder after a division by an {@code
    *  Int}.
    *
@@ -1022,6 +1092,77 @@ private[math] object Division {
     res
   }
 
+  /** Divides {@code a < b * 2^(32 * n)} by normalized {@code b} of n ints. */
+  private def divide2n1n(a: BigInteger, b: BigInteger, n: Int): QuotAndRem = {
+    if ((n & 1) != 0 || n < BurnikelZieglerThreshold) {
+      divideAndRemainderKnuth(a, b)
+    } else {
+      // a = [a1, a2, a3, a4], each of n/2 ints
+      val half = n >> 1
+      val qr1 = divide3n2n(a.slice(half, 4 * half), b, half)
+      val qr2 = divide3n2n(
+        qr1.rem.shiftLeft(half * 32).add(a.slice(0, half)),
+        b,
+        half
+      )
+      new QuotAndRem(qr1.quot.shiftLeft(half * 32).add(qr2.quot), qr2.rem)
+    }
+  }
+
+  /** Divides {@code a < b * 2^(32 * n)} of 3n ints by normalized {@code b} of
+   *  2n ints.
+   */
+  private def divide3n2n(a: BigInteger, b: BigInteger, n: Int): QuotAndRem = {
+    // a = [a1, a2, a3], b = [b1, b2], each of n ints
+    val a12 = a.slice(n, 3 * n)
+    val b1 = b.slice(n, 2 * n)
+    val b2 = b.slice(0, n)
+
+    var quot: BigInteger = null
+    var rem: BigInteger = null
+    if (a.slice(2 * n, 3 * n).compareTo(b1) < 0) {
+      val qr = divide2n1n(a12, b1, n)
+      quot = qr.quot
+      rem = qr.rem
+    } else {
+      // Quotient estimate is 2^(32 * n) - 1
+      quot = BigInteger.ONE.shiftLeft(n * 32).subtract(BigInteger.ONE)
+      rem = a12.subtract(b1.shiftLeft(n * 32)).add(b1)
+    }
+
+    // Estimate exceeds the quotient by at most 2
+    rem = rem.shiftLeft(n * 32).add(a.slice(0, n)).subtract(quot.multiply(b2))
+    while (rem.sign < 0) {
+      rem = rem.add(b)
+      quot = quot.subtract(BigInteger.ONE)
+    }
+    new QuotAndRem(quot, rem)
+  }
+
+  /** Divides non-negative numbers using the schoolbook algorithm. */
+  private def divideAndRemainderKnuth(
+      a: BigInteger,
+      b: BigInteger
+  ): QuotAndRem = {
+    val aLen = a.numberLength
+    val bLen = b.numberLength
+    if (a.compareTo(b) < 0) {
+      new QuotAndRem(BigInteger.ZERO, a)
+    } else if (bLen == 1) {
+      divideAndRemainderByInteger(a, b.digits(0), b.sign)
+    } else {
+      val quotLength = aLen - bLen + 1
+      val quotDigits = new Array[Int](quotLength)
+      val remDigits =
+        divide(quotDigits, quotLength, a.digits, aLen, b.digits, bLen)
+      val quot = new BigInteger(1, quotLength, quotDigits)
+      val rem = new BigInteger(1, bLen, remDigits)
+      quot.cutOffLeadingZeroes()
+      rem.cutOffLeadingZeroes()
+      new QuotAndRem(quot, rem)
+    }
+  }
+
   /** Calculate the first digit of the inverse. */
   private def calcN(a: BigInteger): Int = {
     val m0: Long = a.digits(0) & UINT_MAX
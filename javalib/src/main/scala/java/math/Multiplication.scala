@@ -57,6 +57,11 @@ private[math] object Multiplication {
 
   private final val whenUseKaratsuba = 63
 
+  /** Factors longer than this many ints are multiplied using Toom-Cook-3. */
+  private final val whenUseToomCook3 = 240
+
+  private val Three = BigInteger.valueOf(3)
+
   initialiseArrays()
 
   /** Multiplies an array of integers by an integer value.
@@ -240,7 +245,13 @@ private[math] object Multiplication {
     }
   }
 
-  def multiply(x: BigInteger, y: BigInteger): BigInteger = karatsuba(x, y)
+  def multiply(x: BigInteger, y: BigInteger): BigInteger = {
+    val xLen = x.numberLength
+    val yLen = y.numberLength
+    if (Math.min(xLen, yLen) >= whenUseKaratsuba &&
+        Math.max(xLen, yLen) >= whenUseToomCook3) toomCook3(x, y)
+    else karatsuba(x, y)
+  }
 
   /** Multiplies two BigIntegers.
    *
@@ -314,6 +325,70 @@ private[math] object Multiplication {
     }
   }
 
+  /** Performs the multiplication with the Toom-Cook-3 algorithm.
+   *
+   *  Factors are split into 3 slices and treated as polynomials of degree 2,
+   *  which are evaluated at points 0, 1, -1, 2 and infinity. Their product is
+   *  recovered from 5 point-wise multiplications using the interpolation
+   *  sequence by M. Bodrato, "Towards Optimal Toom-Cook Multiplication for
+   *  Univariate and Multivariate Polynomials in Characteristic 2 and 0".
+   *
+   *  @param a
+   *    first factor of the product
+   *  @param b
+   *    second factor of the product
+   *  @return
+   *    {@code a * b}
+   */
+  def toomCook3(a: BigInteger, b: BigInteger): BigInteger = {
+    val largest = Math.max(a.numberLength, b.numberLength)
+    // Size in ints of the two lower slices, the highest one might be shorter
+    val k = (largest + 2) / 3
+
+    val a0 = a.slice(0, k)
+    val a1 = a.slice(k, 2 * k)
+    val a2 = a.slice(2 * k, largest)
+    val b0 = b.slice(0, k)
+    val b1 = b.slice(k, 2 * k)
+    val b2 = b.slice(2 * k, largest)
+
+    val v0 = a0.multiply(b0)
+    var da1 = a2.add(a0)
+    var db1 = b2.add(b0)
+    val vm1 = da1.subtract(a1).multiply(db1.subtract(b1))
+    da1 = da1.add(a1)
+    db1 = db1.add(b1)
+    val v1 = da1.multiply(db1)
+    val v2 = da1
+      .add(a2)
+      .shiftLeft(1)
+      .subtract(a0)
+      .multiply(db1.add(b2).shiftLeft(1).subtract(b0))
+    val vinf = a2.multiply(b2)
+
+    // All of the divisions are exact
+    var t2 = v2.subtract(vm1).divide(Three)
+    var tm1 = v1.subtract(vm1).shiftRight(1)
+    var t1 = v1.subtract(v0)
+    t2 = t2.subtract(t1).shiftRight(1)
+    t1 = t1.subtract(tm1).subtract(vinf)
+    t2 = t2.subtract(vinf.shiftLeft(1))
+    tm1 = tm1.subtract(t2)
+
+    val shift = k * 32
+    val result = vinf
+      .shiftLeft(shift)
+      .add(t2)
+      .shiftLeft(shift)
+      .add(t1)
+      .shiftLeft(shift)
+      .add(tm1)
+      .shiftLeft(shift)
+      .add(v0)
+    if (a.sign != b.sign) result.negate()
+    else result
+  }
+
   def pow(base: BigInteger, exponent: Int): BigInteger = {
     @inline
     @tailrec
@@ -323,7 +398,7 @@ private[math] object Multiplication {
           if ((exp & 1) != 0) res.multiply(acc)
           else res
         val acc2 = {
-          if (acc.numberLength == 1) {
+          if (acc.numberLength == 1 || acc.numberLength >= whenUseKaratsuba) {
             acc.multiply(acc)
           } else {
             val a = new Array[Int](acc.numberLength << 1)
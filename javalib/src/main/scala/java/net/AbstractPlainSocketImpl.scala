@@ -1,6 +1,9 @@
 package java.net
 
 import java.io.{FileDescriptor, IOException, InputStream, OutputStream}
+import java.util.concurrent.TimeUnit
+
+import scala.scalanative.javalib.io.VirtualThreadPoller
 
 import scala.scalanative.libc.LibcExt
 import scala.scalanative.meta.LinktimeInfo.isWindows
@@ -30,12 +33,30 @@ private[net] abstract class AbstractPlainSocketImpl extends SocketImpl {
   protected def tryPollOnConnect(timeout: Int): Unit
   protected def tryPollOnAccept(): Unit
 
+  /** Switches the socket to non-blocking mode when used by a virtual thread,
+   *  so that it can be parked instead of blocking its carrier thread.
+   */
+  protected def configureNonBlocking(): Unit = ()
+
+  /** Waits until the socket in non-blocking mode is ready for reading or
+   *  writing, might return before that.
+   *
+   *  @param deadline
+   *    `System.nanoTime` after which to give up or 0 to wait indefinitely
+   *  @return
+   *    false if timed out
+   */
+  protected def awaitReady(write: Boolean, deadline: Long): Boolean = true
+
   protected[net] var fd = new FileDescriptor
   protected[net] var localport = 0
   protected[net] var address: InetAddress = _
   protected[net] var port = 0
 
   protected var timeout = 0
+  // Set by `configureNonBlocking`, operations which would block need to wait
+  // using `awaitReady` and retry
+  protected var nonBlocking = false
   private var listening = false
 
   private final val useIPv4Only = SocketHelpers.getUseIPv4Stack()
@@ -151,7 +172,8 @@ private[net] abstract class AbstractPlainSocketImpl extends SocketImpl {
   override def accept(s: SocketImpl): Unit = {
     throwIfClosed("accept") // Do not send negative fd.fd to poll()
 
-    if (timeout > 0)
+    configureNonBlocking()
+    if (timeout > 0 && !nonBlocking)
       tryPollOnAccept()
 
     val storage = stackalloc[socket.sockaddr_storage]()
@@ -159,7 +181,18 @@ private[net] abstract class AbstractPlainSocketImpl extends SocketImpl {
     val addressLen = stackalloc[socket.socklen_t]()
     !addressLen = sizeof[in.sockaddr_in6].toUInt
 
-    val newFd = socket.accept(fd.fd, address, addressLen)
+    var newFd = socket.accept(fd.fd, address, addressLen)
+    if (newFd == -1 && nonBlocking) {
+      val deadline = deadlineAfter(timeout)
+      while (newFd == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        if (!awaitReady(write = false, deadline))
+          throw new SocketTimeoutException(
+            s"accept timed out, SO_TIMEOUT: ${timeout}"
+          )
+        !addressLen = sizeof[in.sockaddr_in6].toUInt
+        newFd = socket.accept(fd.fd, address, addressLen)
+      }
+    }
     if (newFd == -1) {
       throw new SocketException("Accept failed")
     }
@@ -176,14 +209,16 @@ private[net] abstract class AbstractPlainSocketImpl extends SocketImpl {
     val sa4Len = sizeof[in.sockaddr_in].toUInt
     SocketHelpers.prepareSockaddrIn4(addr, port, sa4)
 
-    if (timeout != 0)
+    configureNonBlocking()
+    if (timeout != 0 && !nonBlocking)
       setSocketFdBlocking(fd, blocking = false)
 
-    val connectRet = socket.connect(
+    def doConnect() = socket.connect(
       fd.fd,
       sa4.asInstanceOf[Ptr[socket.sockaddr]],
       sa4Len
     )
+    val connectRet = doConnect()
 
     if (connectRet < 0) {
       def inProgress = mapLastError(
@@ -193,7 +228,9 @@ private[net] abstract class AbstractPlainSocketImpl extends SocketImpl {
           case _                               => false
         }
       )
-      if (timeout > 0 && inProgress) {
+      if (nonBlocking && inProgress) {
+        awaitConnected(addr, port, timeout)(doConnect())
+      } else if (timeout > 0 && inProgress) {
         tryPollOnConnect(timeout)
       } else {
         throw new ConnectException(
@@ -218,14 +255,16 @@ private[net] abstract class AbstractPlainSocketImpl extends SocketImpl {
     // By contract, all the bytes in sa6 are zero going in.
     SocketHelpers.prepareSockaddrIn6(addr, port, sa6)
 
-    if (timeout != 0)
+    configureNonBlocking()
+    if (timeout != 0 && !nonBlocking)
       setSocketFdBlocking(fd, blocking = false)
 
-    val connectRet = socket.connect(
+    def doConnect() = socket.connect(
       fd.fd,
       sa6.asInstanceOf[Ptr[socket.sockaddr]],
       sa6Len
     )
+    val connectRet = doConnect()
 
     if (connectRet < 0) {
       def inProgress = mapLastError(
@@ -236,7 +275,9 @@ private[net] abstract class AbstractPlainSocketImpl extends SocketImpl {
         }
       )
 
-      if (timeout > 0 && inProgress) {
+      if (nonBlocking && inProgress) {
+        awaitConnected(addr, port, timeout)(doConnect())
+      } else if (timeout > 0 && inProgress) {
         tryPollOnConnect(timeout)
       } else {
         throw new ConnectException(
@@ -254,6 +295,30 @@ private[net] abstract class AbstractPlainSocketImpl extends SocketImpl {
     }
   }
 
+  private def awaitConnected(addr: InetAddress, port: Int, timeout: Int)(
+      connect: => CInt
+  ): Unit = {
+    val deadline = deadlineAfter(timeout)
+    var connected = false
+    while (!connected) {
+      if (!awaitReady(write = true, deadline))
+        throw new SocketTimeoutException(
+          s"connect timed out, SO_TIMEOUT: ${timeout}"
+        )
+      // Connecting again reports either the outcome or that it is in progress
+      connected = connect == 0 || errno == EISCONN
+      if (!connected && errno != EALREADY && errno != EINPROGRESS)
+        throw new ConnectException(
+          s"Could not connect to address: $addr on port: $port, errno: ${errno}"
+        )
+    }
+  }
+
+  private def deadlineAfter(timeoutMillis: Int): Long =
+    if (timeoutMillis > 0)
+      System.nanoTime() + TimeUnit.MILLISECONDS.toNanos(timeoutMillis)
+    else 0L
+
   private lazy val connectFunc =
     if (useIPv4Only) connect4(_: InetAddress, _: Int, _: Int)
     else connect6(_: InetAddress, _: Int, _: Int)
@@ -294,6 +359,7 @@ private[net] abstract class AbstractPlainSocketImpl extends SocketImpl {
         } catch {
           case _: SocketException => ()
         }
+        if (nonBlocking) VirtualThreadPoller.deregister(fd.fd)
         unistd.close(fd.fd)
       }
       fd = InvalidSocketDescriptor
@@ -358,22 +424,35 @@ private[net] abstract class AbstractPlainSocketImpl extends SocketImpl {
     } else if (isClosed) {
       0
     } else {
+      configureNonBlocking()
       val cArr = buffer.at(offset)
       var sent = 0
       while (sent < count) {
         val ret = socket
           .send(fd.fd, cArr + sent, (count - sent).toUInt, socket.MSG_NOSIGNAL)
           .toInt
-        if (ret < 0) {
+        if (ret >= 0) sent += ret
+        // SO_TIMEOUT only applies to accept, connect and read
+        else if (nonBlocking && (errno == EAGAIN || errno == EWOULDBLOCK))
+          awaitReady(write = true, deadline = 0L)
+        else
           throw new IOException("Could not send the packet to the client")
-        }
-        sent += ret
       }
       sent
     }
   }
 
   def read(buffer: Array[Byte], offset: Int, count: Int): Int = {
+    configureNonBlocking()
+    read(buffer, offset, count, deadlineAfter(timeout))
+  }
+
+  private def read(
+      buffer: Array[Byte],
+      offset: Int,
+      count: Int,
+      deadline: Long
+  ): Int = {
     if (shutInput) -1
     else {
       val bytesNum = socket
@@ -395,10 +474,15 @@ private[net] abstract class AbstractPlainSocketImpl extends SocketImpl {
         case 0 => if (count == 0) 0 else -1
 
         case _ if timeoutDetected =>
-          throw new SocketTimeoutException("Socket timeout while reading data")
+          if (nonBlocking && awaitReady(write = false, deadline))
+            read(buffer, offset, count, deadline)
+          else
+            throw new SocketTimeoutException(
+              "Socket timeout while reading data"
+            )
 
         case _ if interruptDetected && !Thread.interrupted() =>
-          read(buffer, offset, count)
+          read(buffer, offset, count, deadline)
 
         case _ =>
           throw new SocketException(s"read failed, errno: ${lastError()}")
@@ -1,9 +1,12 @@
 package java.net
 
 import java.io.{FileDescriptor, IOException}
+import java.util.concurrent.TimeUnit
 
 import scala.annotation.tailrec
 
+import scala.scalanative.javalib.io.VirtualThreadPoller
+
 import scala.scalanative.posix.errno._
 import scala.scalanative.posix.fcntl._
 import scala.scalanative.posix.poll._
@@ -121,6 +124,45 @@ private[net] class UnixPlainSocketImpl extends AbstractPlainSocketImpl {
     }
   }
 
+  override protected def configureNonBlocking(): Unit =
+    if (!nonBlocking && VirtualThreadPoller.isEnabled) {
+      setSocketFdBlocking(fd, blocking = false)
+      nonBlocking = true
+    }
+
+  override protected def awaitReady(write: Boolean, deadline: Long): Boolean = {
+    val remaining =
+      if (deadline == 0L) 0L
+      else deadline - System.nanoTime()
+    if (deadline != 0L && remaining <= 0L) false
+    else if (VirtualThreadPoller.isEnabled) {
+      if (write) VirtualThreadPoller.awaitWritable(fd.fd, remaining)
+      else VirtualThreadPoller.awaitReadable(fd.fd, remaining)
+      if (Thread.currentThread().isInterrupted()) {
+        close()
+        throw new SocketException("Closed by interrupt")
+      }
+      true
+    } else {
+      // Socket switched to non-blocking mode by a virtual thread, but used
+      // from a platform thread
+      val pollFd: Ptr[struct_pollfd] = stackalloc[struct_pollfd]()
+      pollFd.fd = fd.fd
+      pollFd.revents = 0
+      pollFd.events = (if (write) POLLOUT else POLLIN).toShort
+      val timeoutMillis =
+        if (deadline == 0L) -1
+        else {
+          val millis = TimeUnit.NANOSECONDS.toMillis(remaining)
+          Math.min(Math.max(millis, 1L), Int.MaxValue.toLong).toInt
+        }
+      val pollRes = poll(pollFd, 1.toUInt, timeoutMillis)
+      if (pollRes < 0 && errno != EINTR)
+        throw new SocketException(s"poll failed, errno: $errno")
+      pollRes != 0
+    }
+  }
+
   protected def setSocketFdBlocking(
       fd: FileDescriptor,
       blocking: Boolean
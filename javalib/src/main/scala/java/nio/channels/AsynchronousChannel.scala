@@ -0,0 +1,5 @@
+package java.nio.channels
+
+trait AsynchronousChannel extends Channel {
+  def close(): Unit
+}
@@ -0,0 +1,93 @@
+package java.nio.channels
+
+import java.nio.ByteBuffer
+import java.nio.file._
+import java.nio.file.attribute.FileAttribute
+import java.util.concurrent.{ExecutorService, Future}
+import java.util.{HashSet, Set}
+
+abstract class AsynchronousFileChannel protected ()
+    extends AsynchronousChannel {
+
+  def size(): Long
+
+  def truncate(size: Long): AsynchronousFileChannel
+
+  def force(metaData: Boolean): Unit
+
+  def lock[A](
+      position: Long,
+      size: Long,
+      shared: Boolean,
+      attachment: A,
+      handler: CompletionHandler[FileLock, _ >: A]
+  ): Unit
+
+  final def lock[A](
+      attachment: A,
+      handler: CompletionHandler[FileLock, _ >: A]
+  ): Unit =
+    lock(0L, Long.MaxValue, false, attachment, handler)
+
+  def lock(position: Long, size: Long, shared: Boolean): Future[FileLock]
+
+  final def lock(): Future[FileLock] = lock(0L, Long.MaxValue, false)
+
+  def tryLock(position: Long, size: Long, shared: Boolean): FileLock
+
+  final def tryLock(): FileLock = tryLock(0L, Long.MaxValue, false)
+
+  def read[A](
+      dst: ByteBuffer,
+      position: Long,
+      attachment: A,
+      handler: CompletionHandler[Integer, _ >: A]
+  ): Unit
+
+  def read(dst: ByteBuffer, position: Long): Future[Integer]
+
+  def write[A](
+      src: ByteBuffer,
+      position: Long,
+      attachment: A,
+      handler: CompletionHandler[Integer, _ >: A]
+  ): Unit
+
+  def write(src: ByteBuffer, position: Long): Future[Integer]
+}
+
+object AsynchronousFileChannel {
+
+  def open(
+      file: Path,
+      options: Set[_ <: OpenOption],
+      executor: ExecutorService,
+      attrs: Array[FileAttribute[_]]
+  ): AsynchronousFileChannel = {
+    import StandardOpenOption._
+
+    if (options.contains(APPEND))
+      throw new UnsupportedOperationException("APPEND not allowed")
+
+    val writing = options.contains(WRITE)
+    val reading = options.contains(READ) || !writing
+
+    new AsynchronousFileChannelImpl(
+      FileChannel.openImpl(file, options, attrs),
+      file.toString(),
+      openForReading = reading,
+      openForWriting = writing,
+      executor
+    )
+  }
+
+  def open(file: Path, options: Array[OpenOption]): AsynchronousFileChannel = {
+    var i = 0
+    val set = new HashSet[OpenOption]()
+    while (i < options.length) {
+      set.add(options(i))
+      i += 1
+    }
+    open(file, set, null, Array.empty)
+  }
+}
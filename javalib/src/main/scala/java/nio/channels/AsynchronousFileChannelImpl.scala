@@ -0,0 +1,240 @@
+package java.nio.channels
+
+import java.nio.ByteBuffer
+import java.util.Objects
+import java.util.concurrent.{
+  CompletableFuture, Executor, ExecutorService, Executors, Future, ThreadFactory
+}
+
+import scala.scalanative.javalib.io.IoUring
+import scala.scalanative.meta.LinktimeInfo.isWindows
+import scala.scalanative.nio.fs.unix.UnixException
+
+/* Reads and writes are performed by the shared io_uring instance when it is
+ * available, submissions of concurrent operations being batched.
+ * Otherwise, and for locking, blocking operations are executed by the
+ * executor given when opening the channel or by a default thread pool.
+ *
+ * Completion handlers are always invoked by the executor, futures are
+ * completed by the thread which finished the operation.
+ */
+private[java] final class AsynchronousFileChannelImpl(
+    channel: FileChannelImpl,
+    fileName: String,
+    openForReading: Boolean,
+    openForWriting: Boolean,
+    executor: ExecutorService
+) extends AsynchronousFileChannel {
+  import AsynchronousFileChannelImpl._
+
+  private val ring = IoUring.shared
+
+  private def handlerExecutor: Executor =
+    if (executor != null) executor
+    else defaultExecutor
+
+  private def ensureOpen(): Unit =
+    if (!isOpen()) throw new ClosedChannelException()
+
+  override def isOpen(): Boolean = channel.isOpen()
+
+  override def close(): Unit = channel.close()
+
+  override def size(): Long = {
+    ensureOpen()
+    channel.size()
+  }
+
+  override def truncate(size: Long): AsynchronousFileChannel = {
+    if (size < 0)
+      throw new IllegalArgumentException("Negative size")
+    ensureOpen()
+    if (!openForWriting)
+      throw new NonWritableChannelException()
+    channel.truncate(size)
+    this
+  }
+
+  override def force(metaData: Boolean): Unit = {
+    ensureOpen()
+    channel.force(metaData)
+  }
+
+  override def lock[A](
+      position: Long,
+      size: Long,
+      shared: Boolean,
+      attachment: A,
+      handler: CompletionHandler[FileLock, _ >: A]
+  ): Unit = {
+    Objects.requireNonNull(handler, "handler")
+    handlerExecutor.execute { () =>
+      val result =
+        try Right(lockNow(position, size, shared))
+        catch { case exc: Throwable => Left(exc) }
+      result.fold(
+        handler.failed(_, attachment),
+        handler.completed(_, attachment)
+      )
+    }
+  }
+
+  override def lock(
+      position: Long,
+      size: Long,
+      shared: Boolean
+  ): Future[FileLock] = {
+    val future = new CompletableFuture[FileLock]()
+    handlerExecutor.execute { () =>
+      try future.complete(lockNow(position, size, shared))
+      catch { case exc: Throwable => future.completeExceptionally(exc) }
+    }
+    future
+  }
+
+  private def lockNow(position: Long, size: Long, shared: Boolean): FileLock =
+    new AsynchronousFileLock(this, channel.lock(position, size, shared))
+
+  override def tryLock(
+      position: Long,
+      size: Long,
+      shared: Boolean
+  ): FileLock = {
+    val lock = channel.tryLock(position, size, shared)
+    if (lock == null) null
+    else new AsynchronousFileLock(this, lock)
+  }
+
+  override def read[A](
+      dst: ByteBuffer,
+      position: Long,
+      attachment: A,
+      handler: CompletionHandler[Integer, _ >: A]
+  ): Unit = {
+    Objects.requireNonNull(handler, "handler")
+    checkRead(dst, position)
+    val completion = handlerCompletion(attachment, handler)
+    transfer(write = false, dst, position, completion)
+  }
+
+  override def read(dst: ByteBuffer, position: Long): Future[Integer] = {
+    checkRead(dst, position)
+    val future = new CompletableFuture[Integer]()
+    transfer(write = false, dst, position, futureCompletion(future))
+    future
+  }
+
+  override def write[A](
+      src: ByteBuffer,
+      position: Long,
+      attachment: A,
+      handler: CompletionHandler[Integer, _ >: A]
+  ): Unit = {
+    Objects.requireNonNull(handler, "handler")
+    checkWrite(src, position)
+    val completion = handlerCompletion(attachment, handler)
+    transfer(write = true, src, position, completion)
+  }
+
+  override def write(src: ByteBuffer, position: Long): Future[Integer] = {
+    checkWrite(src, position)
+    val future = new CompletableFuture[Integer]()
+    transfer(write = true, src, position, futureCompletion(future))
+    future
+  }
+
+  private def checkRead(dst: ByteBuffer, position: Long): Unit = {
+    Objects.requireNonNull(dst, "dst")
+    if (position < 0)
+      throw new IllegalArgumentException("Negative position")
+    if (dst.isReadOnly())
+      throw new IllegalArgumentException("Read-only buffer")
+    if (!openForReading)
+      throw new NonReadableChannelException()
+  }
+
+  private def checkWrite(src: ByteBuffer, position: Long): Unit = {
+    Objects.requireNonNull(src, "src")
+    if (position < 0)
+      throw new IllegalArgumentException("Negative position")
+    if (!openForWriting)
+      throw new NonWritableChannelException()
+  }
+
+  private def transfer(
+      write: Boolean,
+      buffer: ByteBuffer,
+      position: Long,
+      completion: Completion
+  ): Unit =
+    if (!isOpen()) completion.failed(new ClosedChannelException())
+    else if (!buffer.hasRemaining()) completion.completed(0)
+    else if (ring != null) {
+      val fd = channel.fd.fd
+      ring.submit(new IoUring.Operation(fd, write, buffer, position) {
+        def completed(result: Int): Unit =
+          if (result > 0) completion.completed(result)
+          else if (result == 0) completion.completed(if (write) 0 else -1)
+          else completion.failed(UnixException(fileName, -result))
+      })
+    } else {
+      handlerExecutor.execute { () =>
+        def transferNow(): Int =
+          if (write) channel.write(buffer, position)
+          else channel.read(buffer, position)
+        val result =
+          try {
+            // Positional operations change the current position on Windows
+            if (isWindows) Right(channel.synchronized(transferNow()))
+            else Right(transferNow())
+          } catch { case exc: Throwable => Left(exc) }
+        result.fold(completion.failed, completion.completed)
+      }
+    }
+
+  private def handlerCompletion[A](
+      attachment: A,
+      handler: CompletionHandler[Integer, _ >: A]
+  ): Completion = new Completion {
+    def completed(result: Int): Unit =
+      dispatch(handler.completed(Integer.valueOf(result), attachment))
+    def failed(exc: Throwable): Unit =
+      dispatch(handler.failed(exc, attachment))
+    // Avoid running handlers on the io_uring completion thread
+    private def dispatch(action: => Unit): Unit =
+      if (ring != null) handlerExecutor.execute(() => action)
+      else action
+  }
+
+  private def futureCompletion(future: CompletableFuture[Integer]): Completion =
+    new Completion {
+      def completed(result: Int): Unit =
+        future.complete(Integer.valueOf(result))
+      def failed(exc: Throwable): Unit = future.completeExceptionally(exc)
+    }
+}
+
+private object AsynchronousFileChannelImpl {
+  abstract class Completion {
+    def completed(result: Int): Unit
+    def failed(exc: Throwable): Unit
+  }
+
+  private lazy val defaultExecutor: ExecutorService =
+    Executors.newCachedThreadPool(new ThreadFactory {
+      def newThread(task: Runnable): Thread = {
+        val thread = new Thread(task)
+        thread.setName("AsynchronousFileChannel-worker")
+        thread.setDaemon(true)
+        thread
+      }
+    })
+
+  final class AsynchronousFileLock(
+      channel: AsynchronousFileChannel,
+      lock: FileLock
+  ) extends FileLock(channel, lock.position, lock.size, lock.isShared()) {
+    override def isValid(): Boolean = lock.isValid()
+    override def release(): Unit = lock.release()
+  }
+}
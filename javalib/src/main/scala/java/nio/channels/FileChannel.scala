@@ -86,7 +86,14 @@ object FileChannel {
       path: Path,
       options: Set[_ <: OpenOption],
       attrs: Array[FileAttribute[_]]
-  ): FileChannel = {
+  ): FileChannel =
+    openImpl(path, options, attrs)
+
+  private[channels] def openImpl(
+      path: Path,
+      options: Set[_ <: OpenOption],
+      attrs: Array[FileAttribute[_]]
+  ): FileChannelImpl = {
     import StandardOpenOption._
 
     val appending = options.contains(APPEND)
@@ -24,7 +24,7 @@ import scala.scalanative.windows.MinWinBaseApiOps._
 import scala.scalanative.windows._
 
 private[java] final class FileChannelImpl(
-    fd: FileDescriptor,
+    private[channels] val fd: FileDescriptor,
     file: Option[File],
     deleteFileOnClose: Boolean,
     openForReading: Boolean,
@@ -308,6 +308,38 @@ private[java] final class FileChannelImpl(
 
   override def read(buffer: ByteBuffer, pos: Long): Int = {
     ensureOpen()
+    if (!isWindows && buffer.hasArray()) preadArray(buffer, pos)
+    else readAtByRepositioning(buffer, pos)
+  }
+
+  /* Does not use nor change the current position, so it is safe to use
+   * concurrently, e.g. by AsynchronousFileChannel.
+   */
+  private def preadArray(buffer: ByteBuffer, pos: Long): Int = {
+    if (pos < 0)
+      throw new IllegalArgumentException("Negative position")
+    val bufPosition = buffer.position()
+    val count = buffer.limit() - bufPosition
+    if (count == 0) 0
+    else {
+      val offset = buffer.arrayOffset() + bufPosition
+      val readCount = unistd.pread(
+        fd.fd,
+        buffer.array().at(offset),
+        count.toCSize,
+        pos.toSize
+      )
+      if (readCount < 0)
+        throw UnixException(getFileName(), errno)
+      else if (readCount == 0) -1 // end of file
+      else {
+        buffer.position(bufPosition + readCount.toInt)
+        readCount.toInt
+      }
+    }
+  }
+
+  private def readAtByRepositioning(buffer: ByteBuffer, pos: Long): Int = {
     val stashPosition = position()
     compelPosition(pos)
     val bufPosition: Int = buffer.position()
@@ -754,6 +786,32 @@ private[java] final class FileChannelImpl(
    */
   override def write(src: ByteBuffer, pos: Long): Int = {
     ensureOpenForWrite()
+    // Appending ignores the position of pwrite(2) on Linux
+    if (!isWindows && !openForAppending && src.hasArray()) pwriteArray(src, pos)
+    else writeAtByRepositioning(src, pos)
+  }
+
+  private def pwriteArray(src: ByteBuffer, pos: Long): Int = {
+    if (pos < 0)
+      throw new IllegalArgumentException("Negative position")
+    val srcPos = src.position()
+    val count = src.limit() - srcPos
+    if (count == 0) 0
+    else {
+      val writeCount = unistd.pwrite(
+        fd.fd,
+        src.array().at(src.arrayOffset() + srcPos),
+        count.toCSize,
+        pos.toSize
+      )
+      if (writeCount < 0)
+        throw UnixException(getFileName("<file descriptor>"), errno)
+      src.position(srcPos + writeCount.toInt)
+      writeCount.toInt
+    }
+  }
+
+  private def writeAtByRepositioning(src: ByteBuffer, pos: Long): Int = {
     val stashPosition = position()
     compelPosition(pos)
 
@@ -65,7 +65,7 @@ abstract class FileSystemProvider protected () {
       executor: ExecutorService,
       attrs: Array[FileAttribute[_]]
   ): AsynchronousFileChannel =
-    throw new UnsupportedOperationException
+    AsynchronousFileChannel.open(path, options, executor, attrs)
 
   def newByteChannel(
       path: Path,
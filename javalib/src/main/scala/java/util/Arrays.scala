@@ -6,6 +6,7 @@
 
 package java.util
 
+import java.lang.{Double => JDouble, Float => JFloat}
 import java.util.function._
 import java.util.stream.StreamSupport
 import java.{util => ju}
@@ -13,6 +14,8 @@ import java.{util => ju}
 import scala.annotation.tailrec
 import scala.reflect.ClassTag
 
+import scala.scalanative.javalib.lang.Vectorized
+import scala.scalanative.libc.string.{memcmp, memset}
 import scala.scalanative.unsafe._
 import scala.scalanative.unsigned._
 
@@ -517,22 +520,22 @@ object Arrays extends ArraysJDK9Methods {
   }
 
   @noinline def equals(a: Array[Long], b: Array[Long]): Boolean =
-    equalsImpl(a, b)
+    equalsBytesImpl(a, b, 8)
 
   @noinline def equals(a: Array[Int], b: Array[Int]): Boolean =
-    equalsImpl(a, b)
+    equalsBytesImpl(a, b, 4)
 
   @noinline def equals(a: Array[Short], b: Array[Short]): Boolean =
-    equalsImpl(a, b)
+    equalsBytesImpl(a, b, 2)
 
   @noinline def equals(a: Array[Char], b: Array[Char]): Boolean =
-    equalsImpl(a, b)
+    equalsBytesImpl(a, b, 2)
 
   @noinline def equals(a: Array[Byte], b: Array[Byte]): Boolean =
-    equalsImpl(a, b)
+    equalsBytesImpl(a, b, 1)
 
   @noinline def equals(a: Array[Boolean], b: Array[Boolean]): Boolean =
-    equalsImpl(a, b)
+    equalsBytesImpl(a, b, 1)
 
   @noinline def equals(
       a: Array[scala.Double],
@@ -557,6 +560,22 @@ object Arrays extends ArraysJDK9Methods {
   @noinline def equals(a: Array[AnyRef], b: Array[AnyRef]): Boolean =
     equalsImpl(a, b)
 
+  // Primitive elements are equal if and only if their bytes are equal
+  @inline private def equalsBytesImpl[T](
+      a: Array[T],
+      b: Array[T],
+      elementSize: Int
+  ): Boolean = {
+    if (a eq b) true
+    else if (a == null || b == null) false
+    else {
+      val len = a.length
+      if (b.length != len) false
+      else if (len == 0) true
+      else memcmp(a.at(0), b.at(0), (len.toLong * elementSize).toCSize) == 0
+    }
+  }
+
   @inline private def equalsImpl[T](a: Array[T], b: Array[T]): Boolean = {
     // scalastyle:off return
     if (a eq b)
@@ -577,42 +596,57 @@ object Arrays extends ArraysJDK9Methods {
   }
 
   @noinline def fill(a: Array[Long], value: Long): Unit =
-    fillImpl(a, 0, a.length, value, checkIndices = false)
+    fillPrimitiveImpl(a, 0, a.length, 8, value)
 
   @noinline
-  def fill(a: Array[Long], fromIndex: Int, toIndex: Int, value: Long): Unit =
-    fillImpl(a, fromIndex, toIndex, value)
+  def fill(a: Array[Long], fromIndex: Int, toIndex: Int, value: Long): Unit = {
+    checkRangeIndices(a, fromIndex, toIndex)
+    fillPrimitiveImpl(a, fromIndex, toIndex, 8, value)
+  }
 
   @noinline def fill(a: Array[Int], value: Int): Unit =
-    fillImpl(a, 0, a.length, value, checkIndices = false)
+    fillPrimitiveImpl(a, 0, a.length, 4, value)
 
   @noinline
-  def fill(a: Array[Int], fromIndex: Int, toIndex: Int, value: Int): Unit =
-    fillImpl(a, fromIndex, toIndex, value)
+  def fill(a: Array[Int], fromIndex: Int, toIndex: Int, value: Int): Unit = {
+    checkRangeIndices(a, fromIndex, toIndex)
+    fillPrimitiveImpl(a, fromIndex, toIndex, 4, value)
+  }
 
   @noinline def fill(a: Array[Short], value: Short): Unit =
-    fillImpl(a, 0, a.length, value, checkIndices = false)
+    fillPrimitiveImpl(a, 0, a.length, 2, value)
 
   @noinline
-  def fill(a: Array[Short], fromIndex: Int, toIndex: Int, value: Short): Unit =
-    fillImpl(a, fromIndex, toIndex, value)
+  def fill(
+      a: Array[Short],
+      fromIndex: Int,
+      toIndex: Int,
+      value: Short
+  ): Unit = {
+    checkRangeIndices(a, fromIndex, toIndex)
+    fillPrimitiveImpl(a, fromIndex, toIndex, 2, value)
+  }
 
   @noinline def fill(a: Array[Char], value: Char): Unit =
-    fillImpl(a, 0, a.length, value, checkIndices = false)
+    fillPrimitiveImpl(a, 0, a.length, 2, value)
 
   @noinline
-  def fill(a: Array[Char], fromIndex: Int, toIndex: Int, value: Char): Unit =
-    fillImpl(a, fromIndex, toIndex, value)
+  def fill(a: Array[Char], fromIndex: Int, toIndex: Int, value: Char): Unit = {
+    checkRangeIndices(a, fromIndex, toIndex)
+    fillPrimitiveImpl(a, fromIndex, toIndex, 2, value)
+  }
 
   @noinline def fill(a: Array[Byte], value: Byte): Unit =
-    fillImpl(a, 0, a.length, value, checkIndices = false)
+    fillPrimitiveImpl(a, 0, a.length, 1, value)
 
   @noinline
-  def fill(a: Array[Byte], fromIndex: Int, toIndex: Int, value: Byte): Unit =
-    fillImpl(a, fromIndex, toIndex, value)
+  def fill(a: Array[Byte], fromIndex: Int, toIndex: Int, value: Byte): Unit = {
+    checkRangeIndices(a, fromIndex, toIndex)
+    fillPrimitiveImpl(a, fromIndex, toIndex, 1, value)
+  }
 
   @noinline def fill(a: Array[Boolean], value: Boolean): Unit =
-    fillImpl(a, 0, a.length, value, checkIndices = false)
+    fillPrimitiveImpl(a, 0, a.length, 1, if (value) 1 else 0)
 
   @noinline
   def fill(
@@ -620,11 +654,13 @@ object Arrays extends ArraysJDK9Methods {
       fromIndex: Int,
       toIndex: Int,
       value: Boolean
-  ): Unit =
-    fillImpl(a, fromIndex, toIndex, value)
+  ): Unit = {
+    checkRangeIndices(a, fromIndex, toIndex)
+    fillPrimitiveImpl(a, fromIndex, toIndex, 1, if (value) 1 else 0)
+  }
 
   @noinline def fill(a: Array[Double], value: Double): Unit =
-    fillImpl(a, 0, a.length, value, checkIndices = false)
+    fillPrimitiveImpl(a, 0, a.length, 8, JDouble.doubleToRawLongBits(value))
 
   @noinline
   def fill(
@@ -632,15 +668,30 @@ object Arrays extends ArraysJDK9Methods {
       fromIndex: Int,
       toIndex: Int,
       value: Double
-  ): Unit =
-    fillImpl(a, fromIndex, toIndex, value)
+  ): Unit = {
+    checkRangeIndices(a, fromIndex, toIndex)
+    fillPrimitiveImpl(
+      a,
+      fromIndex,
+      toIndex,
+      8,
+      JDouble.doubleToRawLongBits(value)
+    )
+  }
 
   @noinline def fill(a: Array[Float], value: Float): Unit =
-    fillImpl(a, 0, a.length, value, checkIndices = false)
+    fillPrimitiveImpl(a, 0, a.length, 4, JFloat.floatToRawIntBits(value))
 
   @noinline
-  def fill(a: Array[Float], fromIndex: Int, toIndex: Int, value: Float): Unit =
-    fillImpl(a, fromIndex, toIndex, value)
+  def fill(
+      a: Array[Float],
+      fromIndex: Int,
+      toIndex: Int,
+      value: Float
+  ): Unit = {
+    checkRangeIndices(a, fromIndex, toIndex)
+    fillPrimitiveImpl(a, fromIndex, toIndex, 4, JFloat.floatToRawIntBits(value))
+  }
 
   @noinline def fill(a: Array[AnyRef], value: AnyRef): Unit =
     fillImpl(a, 0, a.length, value, checkIndices = false)
@@ -654,6 +705,27 @@ object Arrays extends ArraysJDK9Methods {
   ): Unit =
     fillImpl(a, fromIndex, toIndex, value)
 
+  // Stores the bits of a primitive value in a range of elements of given size
+  @inline
+  private def fillPrimitiveImpl[T](
+      a: Array[T],
+      fromIndex: Int,
+      toIndex: Int,
+      elementSize: Int,
+      bits: Long
+  ): Unit = {
+    if (fromIndex < toIndex) {
+      val dst = a.at(fromIndex)
+      val count = (toIndex - fromIndex).toCSize
+      elementSize match {
+        case 1 => memset(dst, bits.toInt, count)
+        case 2 => Vectorized.scalanative_fill_16(dst, count, bits.toInt)
+        case 4 => Vectorized.scalanative_fill_32(dst, count, bits.toInt)
+        case _ => Vectorized.scalanative_fill_64(dst, count, bits)
+      }
+    }
+  }
+
   @inline
   private def fillImpl[T](
       a: Array[T],
@@ -829,16 +901,24 @@ object Arrays extends ArraysJDK9Methods {
     hashCodeImpl[Long](a, _.hashCode())
 
   @noinline def hashCode(a: Array[Int]): Int =
-    hashCodeImpl[Int](a, _.hashCode())
+    if (a == null) 0
+    else if (a.length == 0) 1
+    else Vectorized.scalanative_hash_i32(a.at(0), a.length.toCSize, 1)
 
   @noinline def hashCode(a: Array[Short]): Int =
-    hashCodeImpl[Short](a, _.hashCode())
+    if (a == null) 0
+    else if (a.length == 0) 1
+    else Vectorized.scalanative_hash_i16(a.at(0), a.length.toCSize, 1)
 
   @noinline def hashCode(a: Array[Char]): Int =
-    hashCodeImpl[Char](a, _.hashCode())
+    if (a == null) 0
+    else if (a.length == 0) 1
+    else Vectorized.scalanative_hash_u16(a.at(0), a.length.toCSize, 1)
 
   @noinline def hashCode(a: Array[Byte]): Int =
-    hashCodeImpl[Byte](a, _.hashCode())
+    if (a == null) 0
+    else if (a.length == 0) 1
+    else Vectorized.scalanative_hash_i8(a.at(0), a.length.toCSize, 1)
 
   @noinline def hashCode(a: Array[Boolean]): Int =
     hashCodeImpl[Boolean](a, _.hashCode())
@@ -9,10 +9,13 @@ package java.util
 
 import scala.scalanative.annotation.alwaysinline
 
+import scala.scalanative.javalib.lang.Vectorized
+
 import scala.scalanative.libc
 
 import scala.scalanative.unsafe.UnsafeRichArray
 import scala.scalanative.unsafe.Size.intToSize
+import scala.scalanative.unsigned.UnsignedRichLong
 
 import java.{lang => jl}
 import java.{util => ju}
@@ -94,12 +97,18 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
   /* Validate args here, in one place, rather than usual practice of in caller.
    * Pass cmp by name so that Integer.compare() & such get inlined.
    * The specific required validation steps vary by number of arguments.
+   *
+   * A positive stride is the size in bytes of elements which are equal
+   * if and only if their bytes are equal. The search for the first mismatch
+   * is then done on the raw bytes. Zero means elements must be compared
+   * one by one using cmp, e.g. for floating point and object elements.
    */
 
   private def compareImpl[T](
       a: Array[T],
       b: Array[T],
-      cmp: => ju.function.BiFunction[T, T, Int]
+      cmp: => ju.function.BiFunction[T, T, Int],
+      stride: Int
   ): Int = {
     // JVM checks cmp first, before checking for null Array args.
     Objects.requireNonNull(cmp, cmpIsNullMsg)
@@ -109,7 +118,7 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
     } else if (b == null) {
       1
     } else {
-      compareImplCore[T](a, 0, a.length, b, 0, b.length, cmp)
+      compareImplCore[T](a, 0, a.length, b, 0, b.length, cmp, stride)
     }
   }
 
@@ -120,7 +129,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b: Array[T],
       bFromIndex: Int,
       bToIndex: Int,
-      cmp: => ju.function.BiFunction[T, T, Int]
+      cmp: => ju.function.BiFunction[T, T, Int],
+      stride: Int
   ): Int = {
     // JVM checks cmp first, before checking for null Array args.
     Objects.requireNonNull(cmp, cmpIsNullMsg)
@@ -138,7 +148,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      cmp
+      cmp,
+      stride
     )
   }
 
@@ -150,9 +161,19 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b: Array[T],
       bFromIndex: Int,
       bToIndex: Int,
-      cmp: => ju.function.BiFunction[T, T, Int]
+      cmp: => ju.function.BiFunction[T, T, Int],
+      stride: Int
   ): Int = {
-    val i = mismatchImpl(a, aFromIndex, aToIndex, b, bFromIndex, bToIndex, cmp)
+    val i = mismatchImpl(
+      a,
+      aFromIndex,
+      aToIndex,
+      b,
+      bFromIndex,
+      bToIndex,
+      cmp,
+      stride
+    )
 
     if ((i >= 0) && (i < Math.min(
           aToIndex - aFromIndex,
@@ -198,12 +219,13 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
   private def mismatchImpl[T](
       a: Array[T],
       b: Array[T],
-      cmp: => ju.function.BiFunction[T, T, Int]
+      cmp: => ju.function.BiFunction[T, T, Int],
+      stride: Int
   ): Int = {
     Objects.requireNonNull(a, noArrayLengthMsg("a"))
     Objects.requireNonNull(a, noArrayLengthMsg("b"))
 
-    mismatchImplCore(a, 0, a.length, b, 0, b.length, cmp)
+    mismatchImplCore(a, 0, a.length, b, 0, b.length, cmp, stride)
   }
 
   @alwaysinline
@@ -214,7 +236,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b: Array[T],
       bFromIndex: Int,
       bToIndex: Int,
-      cmp: => ju.function.BiFunction[T, T, Int]
+      cmp: => ju.function.BiFunction[T, T, Int],
+      stride: Int
   ): Int = {
     Objects.requireNonNull(a, noArrayLengthMsg("a"))
     validateFromToIndex(aFromIndex, aToIndex, a.length)
@@ -222,7 +245,16 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
     Objects.requireNonNull(a, noArrayLengthMsg("b"))
     validateFromToIndex(bFromIndex, bToIndex, b.length)
 
-    mismatchImplCore(a, aFromIndex, aToIndex, b, bFromIndex, bToIndex, cmp)
+    mismatchImplCore(
+      a,
+      aFromIndex,
+      aToIndex,
+      b,
+      bFromIndex,
+      bToIndex,
+      cmp,
+      stride
+    )
   }
 
   @alwaysinline
@@ -233,20 +265,35 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b: Array[T],
       bFromIndex: Int,
       bToIndex: Int,
-      cmp: => ju.function.BiFunction[T, T, Int]
+      cmp: => ju.function.BiFunction[T, T, Int],
+      stride: Int
   ): Int = {
     val aRangeLen = aToIndex - aFromIndex
     val bRangeLen = bToIndex - bFromIndex
     val matchLen = Math.min(aRangeLen, bRangeLen)
 
-    val abOffset = bFromIndex - aFromIndex
-
-    var j = aFromIndex // relative to first Array argument
     var mismatchedAt = -1
 
-    while ((j < (aFromIndex + matchLen)) && (mismatchedAt < 0)) {
-      if (cmp(a(j), b(j + abOffset)) == 0) j += 1
-      else mismatchedAt = j - aFromIndex
+    if (stride > 0) {
+      if (matchLen > 0) {
+        val byteIndex = Vectorized
+          .scalanative_mismatch(
+            a.at(aFromIndex),
+            b.at(bFromIndex),
+            (matchLen.toLong * stride).toCSize
+          )
+          .toLong
+        if (byteIndex >= 0) mismatchedAt = (byteIndex / stride).toInt
+      }
+    } else {
+      val abOffset = bFromIndex - aFromIndex
+
+      var j = aFromIndex // relative to first Array argument
+
+      while ((j < (aFromIndex + matchLen)) && (mismatchedAt < 0)) {
+        if (cmp(a(j), b(j + abOffset)) == 0) j += 1
+        else mismatchedAt = j - aFromIndex
+      }
     }
 
     if (mismatchedAt > -1) mismatchedAt
@@ -257,7 +304,7 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
 
   /** @since JDK 9 */
   def compare(a: Array[scala.Boolean], b: Array[scala.Boolean]): Int =
-    compareImpl(a, b, jl.Boolean.compare)
+    compareImpl(a, b, jl.Boolean.compare, 1)
 
   /** @since JDK 9 */
   def compare(
@@ -275,7 +322,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Boolean.compare
+      jl.Boolean.compare,
+      1
     )
 
 
@@ -323,7 +371,7 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
   /** @since JDK 9 */
   @noinline
   def mismatch(a: Array[scala.Boolean], b: Array[scala.Boolean]): Int =
-    mismatchImpl(a, b, jl.Boolean.compare)
+    mismatchImpl(a, b, jl.Boolean.compare, 1)
 
   /** @since JDK 9 */
   @noinline
@@ -342,12 +390,13 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Boolean.compare
+      jl.Boolean.compare,
+      1
     )
 
   /** @since JDK 9 */
   def compare(a: Array[scala.Byte], b: Array[scala.Byte]): Int =
-    compareImpl(a, b, jl.Byte.compare)
+    compareImpl(a, b, jl.Byte.compare, jl.Byte.BYTES)
 
   /** @since JDK 9 */
   def compare(
@@ -365,12 +414,13 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Byte.compare
+      jl.Byte.compare,
+      jl.Byte.BYTES
     )
 
   /** @since JDK 9 */
   def compareUnsigned(a: Array[scala.Byte], b: Array[scala.Byte]): Int =
-    compareImpl(a, b, jl.Byte.compareUnsigned)
+    compareImpl(a, b, jl.Byte.compareUnsigned, jl.Byte.BYTES)
 
   /** @since JDK 9 */
   def compareUnsigned(
@@ -388,7 +438,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Byte.compareUnsigned
+      jl.Byte.compareUnsigned,
+      jl.Byte.BYTES
     )
 
   def equals(
@@ -414,7 +465,7 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
   /** @since JDK 9 */
   @noinline
   def mismatch(a: Array[scala.Byte], b: Array[scala.Byte]): Int =
-    mismatchImpl(a, b, jl.Byte.compare)
+    mismatchImpl(a, b, jl.Byte.compare, jl.Byte.BYTES)
 
   /** @since JDK 9 */
   @noinline
@@ -433,12 +484,13 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Byte.compare
+      jl.Byte.compare,
+      jl.Byte.BYTES
     )
 
   /** @since JDK 9 */
   def compare(a: Array[scala.Char], b: Array[scala.Char]): Int =
-    compareImpl(a, b, jl.Character.compare)
+    compareImpl(a, b, jl.Character.compare, jl.Character.BYTES)
 
   /** @since JDK 9 */
   def compare(
@@ -456,7 +508,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Character.compare
+      jl.Character.compare,
+      jl.Character.BYTES
     )
 
 
@@ -483,7 +536,7 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
   /** @since JDK 9 */
   @noinline
   def mismatch(a: Array[scala.Char], b: Array[scala.Char]): Int =
-    mismatchImpl(a, b, jl.Character.compare)
+    mismatchImpl(a, b, jl.Character.compare, jl.Character.BYTES)
 
   /** @since JDK 9 */
   @noinline
@@ -502,12 +555,13 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Character.compare
+      jl.Character.compare,
+      jl.Character.BYTES
     )
 
   /** @since JDK 9 */
   def compare(a: Array[scala.Double], b: Array[scala.Double]): Int =
-    compareImpl(a, b, jl.Double.compare)
+    compareImpl(a, b, jl.Double.compare, 0)
 
   /** @since JDK 9 */
   def compare(
@@ -525,7 +579,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Double.compare
+      jl.Double.compare,
+      0
     )
 
 
@@ -573,7 +628,7 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
   /** @since JDK 9 */
   @noinline
   def mismatch(a: Array[scala.Double], b: Array[scala.Double]): Int =
-    mismatchImpl(a, b, jl.Double.compare)
+    mismatchImpl(a, b, jl.Double.compare, 0)
 
   /** @since JDK 9 */
   @noinline
@@ -592,12 +647,13 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Double.compare
+      jl.Double.compare,
+      0
     )
 
   /** @since JDK 9 */
   def compare(a: Array[scala.Float], b: Array[scala.Float]): Int =
-    compareImpl(a, b, jl.Float.compare)
+    compareImpl(a, b, jl.Float.compare, 0)
 
   /** @since JDK 9 */
   def compare(
@@ -615,7 +671,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Float.compare
+      jl.Float.compare,
+      0
     )
 
 
@@ -663,7 +720,7 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
   /** @since JDK 9 */
   @noinline
   def mismatch(a: Array[scala.Float], b: Array[scala.Float]): Int =
-    mismatchImpl(a, b, jl.Float.compare)
+    mismatchImpl(a, b, jl.Float.compare, 0)
 
   /** @since JDK 9 */
   @noinline
@@ -682,12 +739,13 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Float.compare
+      jl.Float.compare,
+      0
     )
 
   /** @since JDK 9 */
   def compare(a: Array[scala.Int], b: Array[scala.Int]): Int =
-    compareImpl(a, b, jl.Integer.compare)
+    compareImpl(a, b, jl.Integer.compare, jl.Integer.BYTES)
 
   /** @since JDK 9 */
   def compare(
@@ -705,12 +763,13 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Integer.compare
+      jl.Integer.compare,
+      jl.Integer.BYTES
     )
 
   /** @since JDK 9 */
   def compareUnsigned(a: Array[scala.Int], b: Array[scala.Int]): Int =
-    compareImpl(a, b, jl.Integer.compareUnsigned)
+    compareImpl(a, b, jl.Integer.compareUnsigned, jl.Integer.BYTES)
 
   /** @since JDK 9 */
   def compareUnsigned(
@@ -728,7 +787,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Integer.compareUnsigned
+      jl.Integer.compareUnsigned,
+      jl.Integer.BYTES
     )
 
   def equals(
@@ -754,7 +814,7 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
   /** @since JDK 9 */
   @noinline
   def mismatch(a: Array[scala.Int], b: Array[scala.Int]): Int =
-    mismatchImpl(a, b, jl.Integer.compare)
+    mismatchImpl(a, b, jl.Integer.compare, jl.Integer.BYTES)
 
   /** @since JDK 9 */
   @noinline
@@ -773,12 +833,13 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Integer.compare
+      jl.Integer.compare,
+      jl.Integer.BYTES
     )
 
   /** @since JDK 9 */
   def compare(a: Array[scala.Long], b: Array[scala.Long]): Int =
-    compareImpl(a, b, jl.Long.compare)
+    compareImpl(a, b, jl.Long.compare, jl.Long.BYTES)
 
   /** @since JDK 9 */
   def compare(
@@ -796,12 +857,13 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Long.compare
+      jl.Long.compare,
+      jl.Long.BYTES
     )
 
   /** @since JDK 9 */
   def compareUnsigned(a: Array[scala.Long], b: Array[scala.Long]): Int =
-    compareImpl(a, b, jl.Long.compareUnsigned)
+    compareImpl(a, b, jl.Long.compareUnsigned, jl.Long.BYTES)
 
   /** @since JDK 9 */
   def compareUnsigned(
@@ -819,7 +881,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Long.compareUnsigned
+      jl.Long.compareUnsigned,
+      jl.Long.BYTES
     )
 
   def equals(
@@ -845,7 +908,7 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
   /** @since JDK 9 */
   @noinline
   def mismatch(a: Array[scala.Long], b: Array[scala.Long]): Int =
-    mismatchImpl(a, b, jl.Long.compare)
+    mismatchImpl(a, b, jl.Long.compare, jl.Long.BYTES)
 
   /** @since JDK 9 */
   @noinline
@@ -864,12 +927,13 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Long.compare
+      jl.Long.compare,
+      jl.Long.BYTES
     )
 
   /** @since JDK 9 */
   def compare(a: Array[scala.Short], b: Array[scala.Short]): Int =
-    compareImpl(a, b, jl.Short.compare)
+    compareImpl(a, b, jl.Short.compare, jl.Short.BYTES)
 
   /** @since JDK 9 */
   def compare(
@@ -887,12 +951,13 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Short.compare
+      jl.Short.compare,
+      jl.Short.BYTES
     )
 
   /** @since JDK 9 */
   def compareUnsigned(a: Array[scala.Short], b: Array[scala.Short]): Int =
-    compareImpl(a, b, jl.Short.compareUnsigned)
+    compareImpl(a, b, jl.Short.compareUnsigned, jl.Short.BYTES)
 
   /** @since JDK 9 */
   def compareUnsigned(
@@ -910,7 +975,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Short.compareUnsigned
+      jl.Short.compareUnsigned,
+      jl.Short.BYTES
     )
 
   def equals(
@@ -936,7 +1002,7 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
   /** @since JDK 9 */
   @noinline
   def mismatch(a: Array[scala.Short], b: Array[scala.Short]): Int =
-    mismatchImpl(a, b, jl.Short.compare)
+    mismatchImpl(a, b, jl.Short.compare, jl.Short.BYTES)
 
   /** @since JDK 9 */
   @noinline
@@ -955,7 +1021,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b,
       bFromIndex,
       bToIndex,
-      jl.Short.compare
+      jl.Short.compare,
+      jl.Short.BYTES
     )
 
   /** @since JDK 9 */
@@ -967,7 +1034,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       a,
       b,
       (a: Comparable[_], b: Comparable[_]) =>
-        compareNullsFirst[T](a.asInstanceOf[T], b.asInstanceOf[T])
+        compareNullsFirst[T](a.asInstanceOf[T], b.asInstanceOf[T]),
+      stride = 0
     )
   }
 
@@ -983,7 +1051,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       a.asInstanceOf[Array[AnyRef]],
       b.asInstanceOf[Array[AnyRef]],
       (a: AnyRef, b: AnyRef) =>
-        cmp.compare(a.asInstanceOf[T], b.asInstanceOf[T])
+        cmp.compare(a.asInstanceOf[T], b.asInstanceOf[T]),
+      stride = 0
     )
   }
 
@@ -1004,7 +1073,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       bFromIndex,
       bToIndex,
       (a: Comparable[_], b: Comparable[_]) =>
-        compareNullsFirst[T](a.asInstanceOf[T], b.asInstanceOf[T])
+        compareNullsFirst[T](a.asInstanceOf[T], b.asInstanceOf[T]),
+      stride = 0
     )
   }
 
@@ -1027,7 +1097,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b.asInstanceOf[Array[Any]],
       bFromIndex,
       bToIndex,
-      (a: Any, b: Any) => cmp.compare(a.asInstanceOf[T], b.asInstanceOf[T])
+      (a: Any, b: Any) => cmp.compare(a.asInstanceOf[T], b.asInstanceOf[T]),
+      stride = 0
     )
   }
 
@@ -1042,7 +1113,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       a.asInstanceOf[Array[AnyRef]],
       b.asInstanceOf[Array[AnyRef]],
       (a: AnyRef, b: AnyRef) =>
-        cmp.compare(a.asInstanceOf[T], b.asInstanceOf[T])
+        cmp.compare(a.asInstanceOf[T], b.asInstanceOf[T]),
+      stride = 0
     ) == 0
   }
 
@@ -1063,7 +1135,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       bFromIndex,
       bToIndex,
       // objectsCompareZeroOrMinus1 // Scala 3
-      (a: T, b: T) => objectsCompareZeroOrMinus1(a, b)
+      (a: T, b: T) => objectsCompareZeroOrMinus1(a, b),
+      stride = 0
     ) == 0
   }
 
@@ -1084,7 +1157,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       b.asInstanceOf[Array[Any]],
       bFromIndex,
       bToIndex,
-      (a: Any, b: Any) => cmp.compare(a.asInstanceOf[T], b.asInstanceOf[T])
+      (a: Any, b: Any) => cmp.compare(a.asInstanceOf[T], b.asInstanceOf[T]),
+      stride = 0
     ) == 0
   }
 
@@ -1098,7 +1172,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       0,
       b.length,
       // objectsCompareZeroOrMinus1 // Scala 3
-      (a: Object, b: Object) => objectsCompareZeroOrMinus1(a, b)
+      (a: Object, b: Object) => objectsCompareZeroOrMinus1(a, b),
+      stride = 0
     )
 
   /** @since JDK 9 */
@@ -1110,7 +1185,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
     mismatchImpl(
       a.asInstanceOf[Array[Any]],
       b.asInstanceOf[Array[Any]],
-      (a: Any, b: Any) => cmp.compare(a.asInstanceOf[T], b.asInstanceOf[T])
+      (a: Any, b: Any) => cmp.compare(a.asInstanceOf[T], b.asInstanceOf[T]),
+      stride = 0
     )
 
   /** @since JDK 9 */
@@ -1130,7 +1206,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       bFromIndex,
       bToIndex,
       // objectsCompareZeroOrMinus1 // Scala 3
-      (a: T, b: T) => objectsCompareZeroOrMinus1(a, b)
+      (a: T, b: T) => objectsCompareZeroOrMinus1(a, b),
+      stride = 0
     )
 
   /** @since JDK 9 */
@@ -1153,7 +1230,8 @@ private[util] trait ArraysJDK9Methods { self: Arrays.type =>
       bFromIndex,
       bToIndex,
       (a: AnyRef, b: AnyRef) =>
-        cmp.compare(a.asInstanceOf[T], b.asInstanceOf[T])
+        cmp.compare(a.asInstanceOf[T], b.asInstanceOf[T]),
+      stride = 0
     )
   }
 }
@@ -13,7 +13,9 @@ import java.nio.charset._
 
 import scala.annotation.tailrec
 
-import scala.scalanative.unsafe.UnsafeRichArray
+import scala.scalanative.javalib.lang.Utf8
+import scala.scalanative.unsafe._
+import scala.scalanative.unsigned._
 
 private[niocharset] object UTF_8
     extends Charset("UTF-8", Array("UTF8", "unicode-1-1-utf-8")) {
@@ -188,7 +190,19 @@ private[niocharset] object UTF_8
         }
       }
 
-      loop(inStart, outStart)
+      if (inPtr != null && outArray != null &&
+          inStart < inEnd && outStart < outEnd) {
+        // Well-formed prefix is decoded natively, errors are left to the loop
+        val read = stackalloc[CSize]()
+        val written = Utf8.scalanative_utf8_to_utf16(
+          inPtr + inStart,
+          (inEnd - inStart).toCSize,
+          outArray.at(outStart),
+          (outEnd - outStart).toCSize,
+          read
+        )
+        loop(inStart + (!read).toInt, outStart + written.toInt)
+      } else loop(inStart, outStart)
     }
 
     @inline private def isInvalidNextByte(b: Int): Boolean =
@@ -339,7 +353,18 @@ private[niocharset] object UTF_8
         }
       }
 
-      loop(inStart, outStart)
+      if (inStart < inEnd && outStart < outEnd) {
+        // Prefix without unpaired surrogates is encoded natively
+        val read = stackalloc[CSize]()
+        val written = Utf8.scalanative_utf16_to_utf8(
+          inArray.at(inStart),
+          (inEnd - inStart).toCSize,
+          outArray.at(outStart),
+          (outEnd - outStart).toCSize,
+          read
+        )
+        loop(inStart + (!read).toInt, outStart + written.toInt)
+      } else loop(inStart, outStart)
     }
 
     private def encodeLoopNoArray(
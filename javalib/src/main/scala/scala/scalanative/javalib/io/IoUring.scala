@@ -0,0 +1,323 @@
+package scala.scalanative.javalib.io
+
+import java.nio.ByteBuffer
+import java.util.concurrent.atomic.{AtomicInteger, AtomicLong}
+import java.util.concurrent.locks.{LockSupport, ReentrantLock}
+import java.util.concurrent.{
+  ConcurrentHashMap, ConcurrentLinkedDeque, ConcurrentLinkedQueue, Semaphore
+}
+
+import scala.scalanative.libc.string.memcpy
+import scala.scalanative.libc.stdlib
+import scala.scalanative.meta.LinktimeInfo
+import scala.scalanative.posix.errno.EBUSY
+import scala.scalanative.unsafe._
+import scala.scalanative.unsigned._
+
+/* Asynchronous positional file reads and writes using a single io_uring
+ * instance shared by all the channels.
+ *
+ * Submitted operations are queued and published to the submission queue by
+ * whichever thread acquires the submission lock first, so that operations
+ * submitted concurrently are passed to the kernel in a single system call.
+ * Completions are dispatched by a dedicated platform thread, which should
+ * only be used for short callbacks.
+ *
+ * Transfers up to FixedBufferSize bytes go through buffers registered with
+ * the kernel, sparing it from mapping the user memory on each operation,
+ * larger ones use the memory of heap buffers directly.
+ */
+final class IoUring private (
+    ring: CVoidPtr,
+    capacity: Int
+) {
+  import IoUring._
+
+  // Bounds operations in flight, so that the completion queue cannot overflow
+  private val permits = new Semaphore(capacity)
+  private val pending = new ConcurrentLinkedDeque[Operation]()
+  private val inflight = new ConcurrentHashMap[java.lang.Long, Operation]()
+  private val nextId = new AtomicLong(0L)
+  private val submitLock = new ReentrantLock()
+  // Prepared operations were not consumed by the kernel yet
+  @volatile private var unsubmitted = false
+  // Operations consumed by the kernel and not completed yet
+  private val submitted = new AtomicInteger(0)
+
+  private val fixedBuffers: Ptr[Byte] = {
+    val size = FixedBufferCount.toCSize * FixedBufferSize.toCSize
+    val base = stdlib.malloc(size)
+    if (base != null &&
+        uring.scalanative_io_uring_register_buffers(
+          ring,
+          base,
+          FixedBufferCount.toUInt,
+          FixedBufferSize.toCSize
+        ) != 0) {
+      // Most likely limited by RLIMIT_MEMLOCK
+      stdlib.free(base)
+      null
+    } else base
+  }
+  private val freeFixedBuffers = new ConcurrentLinkedQueue[Integer]()
+  if (fixedBuffers != null)
+    for (i <- 0 until FixedBufferCount) freeFixedBuffers.add(i)
+
+  locally {
+    val thread = new Thread(() => run())
+    thread.setName("io_uring-completion")
+    thread.setDaemon(true)
+    thread.start()
+  }
+
+  /** Queues the operation for submission, blocks if too many operations are
+   *  in flight. The operation is completed by the completion thread.
+   */
+  def submit(op: Operation): Unit = {
+    permits.acquireUninterruptibly()
+    pending.offer(op)
+    flush()
+  }
+
+  private def flush(): Unit = {
+    var stalled = false
+    while (!stalled && (unsubmitted || !pending.isEmpty()) &&
+        submitLock.tryLock()) {
+      try {
+        var op = pending.poll()
+        while (op != null) {
+          if (op.id == 0L) assign(op)
+          if (prep(op) == 0) op = pending.poll()
+          else if (enter()) () // submission queue drained, retry
+          else {
+            // Kernel refused to consume the queue, the completion thread
+            // flushes again once operations in flight complete
+            pending.offerFirst(op)
+            op = null
+            stalled = true
+          }
+        }
+        if (!stalled && !enter() && unsubmitted) stalled = true
+      } finally submitLock.unlock()
+      // Nothing in flight would complete and flush again, retry after a pause
+      if (stalled && submitted.get() == 0) {
+        LockSupport.parkNanos(this, RetryDelayNanos)
+        stalled = false
+      }
+    }
+  }
+
+  private def enter(): Boolean = {
+    val count = uring.scalanative_io_uring_submit(ring)
+    if (count > 0) submitted.addAndGet(count)
+    unsubmitted = count < 0
+    count > 0
+  }
+
+  private def assign(op: Operation): Unit = {
+    op.id = nextId.incrementAndGet()
+    val length = op.length
+    val fixed =
+      if (length <= FixedBufferSize) freeFixedBuffers.poll()
+      else null
+    if (fixed != null) {
+      op.opcode = if (op.write) WriteFixed else ReadFixed
+      op.fixedIndex = fixed.intValue()
+      op.address = fixedBuffers + fixed.intValue().toLong * FixedBufferSize
+      if (op.write) copyFromBuffer(op.buffer, op.address, length)
+    } else if (op.buffer.hasArray()) {
+      op.opcode = if (op.write) Write else Read
+      val buffer = op.buffer
+      op.address = buffer.array().at(buffer.arrayOffset() + buffer.position())
+    } else {
+      // E.g. direct or read-only buffers
+      op.opcode = if (op.write) Write else Read
+      op.staging = new Array[Byte](length)
+      op.address = op.staging.at(0)
+      if (op.write) copyFromBuffer(op.buffer, op.address, length)
+    }
+    inflight.put(op.id, op)
+  }
+
+  private def prep(op: Operation): Int = {
+    val res = uring.scalanative_io_uring_prep(
+      ring,
+      op.opcode,
+      op.fd,
+      op.address,
+      op.length.toUInt,
+      op.position.toULong,
+      op.fixedIndex,
+      op.id.toULong
+    )
+    if (res != 0 && res != -EBUSY)
+      throw new IllegalStateException(s"io_uring prep failed: $res")
+    res
+  }
+
+  private def run(): Unit = {
+    val ids = stackalloc[CUnsignedLongLong](CompletionBatch)
+    val results = stackalloc[CInt](CompletionBatch)
+    while (true) {
+      val count =
+        uring.scalanative_io_uring_wait(ring, ids, results, CompletionBatch)
+      if (count < 0) {
+        // Not expected to happen, avoid spinning if it persists
+        LockSupport.parkNanos(this, RetryDelayNanos)
+      } else submitted.addAndGet(-count)
+      var i = 0
+      while (i < count) {
+        val op = inflight.remove(java.lang.Long.valueOf(ids(i).toLong))
+        if (op != null) {
+          permits.release()
+          complete(op, results(i))
+        }
+        i += 1
+      }
+      if (unsubmitted || !pending.isEmpty()) flush()
+    }
+  }
+
+  private def complete(op: Operation, result: Int): Unit = {
+    val buffer = op.buffer
+    if (result > 0) {
+      if (!op.write && (op.fixedIndex >= 0 || op.staging != null))
+        copyToBuffer(op.address, buffer, result)
+      buffer.position(buffer.position() + result)
+    }
+    if (op.fixedIndex >= 0) freeFixedBuffers.add(op.fixedIndex)
+    op.address = null
+    op.staging = null
+    try op.completed(result)
+    catch { case _: Throwable => () }
+  }
+}
+
+object IoUring {
+
+  /** A read into, or write from, the remaining bytes of `buffer` at `position`
+   *  in the file. The buffer needs to have remaining bytes.
+   */
+  abstract class Operation(
+      val fd: Int,
+      val write: Boolean,
+      val buffer: ByteBuffer,
+      val position: Long
+  ) {
+    private[IoUring] val length = buffer.remaining()
+    private[IoUring] var id = 0L
+    private[IoUring] var opcode = 0
+    private[IoUring] var fixedIndex = -1
+    private[IoUring] var address: Ptr[Byte] = _
+    private[IoUring] var staging: Array[Byte] = _
+
+    /** Invoked on the completion thread with the number of transferred bytes,
+     *  the buffer position is already advanced, or a negated errno value.
+     */
+    def completed(result: Int): Unit
+  }
+
+  @resolvedAtLinktime()
+  def isSupported: Boolean = LinktimeInfo.isLinux
+
+  /** Shared instance or null if io_uring is not available, e.g. when
+   *  disabled by the kernel, seccomp filters or too old kernel.
+   */
+  lazy val shared: IoUring =
+    if (!isSupported) null
+    else {
+      val cqEntries = stackalloc[CUnsignedInt]()
+      val ring = uring.scalanative_io_uring_create(Entries.toUInt, cqEntries)
+      if (ring == null) null
+      else new IoUring(ring, (!cqEntries).toInt)
+    }
+
+  private final val Entries = 256
+  private final val CompletionBatch = 64
+  private final val FixedBufferCount = 32
+  private final val FixedBufferSize = 16 * 1024
+  private final val RetryDelayNanos = 1000000L
+
+  // Operation codes of scalanative_io_uring_prep
+  private final val Read = 0
+  private final val Write = 1
+  private final val ReadFixed = 2
+  private final val WriteFixed = 3
+
+  private def copyFromBuffer(
+      buffer: ByteBuffer,
+      dst: Ptr[Byte],
+      length: Int
+  ): Unit =
+    if (buffer.hasArray())
+      memcpy(
+        dst,
+        buffer.array().at(buffer.arrayOffset() + buffer.position()),
+        length.toCSize
+      )
+    else {
+      val position = buffer.position()
+      var i = 0
+      while (i < length) {
+        dst(i) = buffer.get(position + i)
+        i += 1
+      }
+    }
+
+  private def copyToBuffer(
+      src: Ptr[Byte],
+      buffer: ByteBuffer,
+      length: Int
+  ): Unit =
+    if (buffer.hasArray())
+      memcpy(
+        buffer.array().at(buffer.arrayOffset() + buffer.position()),
+        src,
+        length.toCSize
+      )
+    else {
+      val position = buffer.position()
+      var i = 0
+      while (i < length) {
+        buffer.put(position + i, src(i))
+        i += 1
+      }
+    }
+}
+
+@define("__SCALANATIVE_JAVALIB_SYS_LINUX_IO_URING")
+@extern
+private[io] object uring {
+  def scalanative_io_uring_create(
+      entries: CUnsignedInt,
+      cqEntries: Ptr[CUnsignedInt]
+  ): CVoidPtr = extern
+
+  def scalanative_io_uring_register_buffers(
+      ring: CVoidPtr,
+      base: CVoidPtr,
+      count: CUnsignedInt,
+      size: CSize
+  ): CInt = extern
+
+  def scalanative_io_uring_prep(
+      ring: CVoidPtr,
+      op: CInt,
+      fd: CInt,
+      addr: CVoidPtr,
+      len: CUnsignedInt,
+      offset: CUnsignedLongLong,
+      bufIndex: CInt,
+      userData: CUnsignedLongLong
+  ): CInt = extern
+
+  def scalanative_io_uring_submit(ring: CVoidPtr): CInt = extern
+
+  @blocking
+  def scalanative_io_uring_wait(
+      ring: CVoidPtr,
+      userData: Ptr[CUnsignedLongLong],
+      results: Ptr[CInt],
+      max: CInt
+  ): CInt = extern
+}
@@ -0,0 +1,151 @@
+package scala.scalanative.javalib.io
+
+import java.util.concurrent.ConcurrentHashMap
+import java.util.concurrent.locks.LockSupport
+
+import scala.scalanative.libc.stdlib
+import scala.scalanative.linux.epoll._
+import scala.scalanative.meta.LinktimeInfo
+import scala.scalanative.posix.errno._
+import scala.scalanative.posix.stdint
+import scala.scalanative.unsafe._
+import scala.scalanative.unsigned._
+
+/* Parks virtual threads until a non-blocking file descriptor becomes ready,
+ * instead of blocking their carrier threads in a system call.
+ *
+ * Awaited descriptors are registered as one-shot in an epoll instance shared by
+ * all the carriers. Its events are dispatched by a dedicated platform thread,
+ * unparking the waiting virtual threads. Separate instances are used for
+ * reading and writing, so that both can be awaited at the same time.
+ * Registrations are kept until the descriptor is deregistered or closed, later
+ * waits only rearm them. A single registration is shared by all the threads
+ * awaiting the same descriptor, each event unparks all of them.
+ */
+object VirtualThreadPoller {
+
+  @resolvedAtLinktime()
+  def isSupported: Boolean =
+    LinktimeInfo.isLinux && LinktimeInfo.isVirtualThreadsSupported
+
+  /** Whether the current thread should wait for descriptors using the poller.
+   */
+  def isEnabled: Boolean =
+    isSupported && Thread.currentThread().isVirtual()
+
+  /** Parks the current virtual thread until `fd` can be read from without
+   *  blocking, `timeoutNanos` elapses (unless 0) or it is unparked. Callers
+   *  need to retry the operation and wait again if it would still block.
+   */
+  def awaitReadable(fd: Int, timeoutNanos: Long): Unit =
+    readPoller.await(fd, timeoutNanos)
+
+  /** Like [[awaitReadable]], waiting until `fd` can be written to. */
+  def awaitWritable(fd: Int, timeoutNanos: Long): Unit =
+    writePoller.await(fd, timeoutNanos)
+
+  /** Removes registrations of `fd` and unparks threads waiting for it, needs
+   *  to be called before it is closed.
+   */
+  def deregister(fd: Int): Unit = if (isSupported) {
+    readPoller.deregister(fd)
+    writePoller.deregister(fd)
+  }
+
+  private lazy val readPoller =
+    new Poller("VirtualThread-read-poller", EPOLLIN | EPOLLRDHUP)
+  private lazy val writePoller =
+    new Poller("VirtualThread-write-poller", EPOLLOUT)
+
+  private final val MaxEvents = 256
+
+  private class Poller(name: String, events: Int) {
+    private val epfd = {
+      val fd = epoll_create1(EPOLL_CLOEXEC)
+      if (fd < 0)
+        throw new java.io.IOException(s"epoll_create1 failed, errno: $errno")
+      fd
+    }
+    private val waiters = new ConcurrentHashMap[Integer, List[Thread]]()
+
+    locally {
+      val thread = new Thread(() => run())
+      thread.setName(name)
+      thread.setDaemon(true)
+      thread.start()
+    }
+
+    def await(fd: Int, timeoutNanos: Long): Unit = {
+      val thread = Thread.currentThread()
+      val key = Integer.valueOf(fd)
+      waiters.compute(
+        key,
+        (_: Integer, awaiting: List[Thread]) =>
+          if (awaiting == null) thread :: Nil
+          else thread :: awaiting
+      )
+      try {
+        // Rearms the registration, also when already armed by other waiter
+        register(fd)
+        if (timeoutNanos > 0L) LockSupport.parkNanos(this, timeoutNanos)
+        else LockSupport.park(this)
+      } finally {
+        waiters.computeIfPresent(
+          key,
+          (_: Integer, awaiting: List[Thread]) =>
+            awaiting.filterNot(_ eq thread) match {
+              case Nil       => null
+              case remaining => remaining
+            }
+        )
+      }
+    }
+
+    def deregister(fd: Int): Unit = {
+      epoll_ctl(epfd, EPOLL_CTL_DEL, fd, null)
+      unparkAll(fd)
+    }
+
+    private def unparkAll(fd: Int): Unit =
+      waiters.remove(Integer.valueOf(fd)) match {
+        case null     => ()
+        case awaiting => awaiting.foreach(LockSupport.unpark(_))
+      }
+
+    private def register(fd: Int): Unit = {
+      val event = stackalloc[Byte](scalanative_epoll_event_size())
+      scalanative_epoll_event_set(
+        event,
+        0,
+        (events | EPOLLONESHOT).toUInt,
+        fd.toULong
+      )
+      if (epoll_ctl(epfd, EPOLL_CTL_MOD, fd, event) != 0) {
+        val res =
+          if (errno == ENOENT) epoll_ctl(epfd, EPOLL_CTL_ADD, fd, event)
+          else -1
+        if (res != 0)
+          throw new java.io.IOException(
+            s"Failed to register descriptor $fd in $name, errno: $errno"
+          )
+      }
+    }
+
+    private def run(): Unit = {
+      val buffer = stdlib.malloc(
+        MaxEvents.toCSize * scalanative_epoll_event_size()
+      )
+      val eventPtr = stackalloc[stdint.uint32_t]()
+      val dataPtr = stackalloc[stdint.uint64_t]()
+      while (true) {
+        val count = epoll_wait(epfd, buffer, MaxEvents, -1)
+        var idx = 0
+        while (idx < count) {
+          scalanative_epoll_event_get(buffer, idx, eventPtr, dataPtr)
+          unparkAll((!dataPtr).toInt)
+          idx += 1
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,51 @@
+package scala.scalanative.javalib.lang
+
+import scala.scalanative.unsafe._
+
+/* Vectorized UTF-8 validation and transcoding shared by java.lang.String and
+ * the UTF-8 charset, see scalanative_utf8.c.
+ *
+ * The functions process the longest prefix of the input which is well-formed
+ * and fits in the output, callers are expected to handle the remaining input,
+ * including the reporting of malformed sequences.
+ */
+@define("__SCALANATIVE_JAVALIB_UTF8")
+@extern
+object Utf8 {
+
+  /** Number of leading bytes in the ASCII range. */
+  def scalanative_utf8_ascii_prefix(src: Ptr[Byte], len: CSize): CSize =
+    extern
+
+  /** Length of the longest prefix made of complete, well-formed sequences. */
+  def scalanative_utf8_valid_prefix(src: Ptr[Byte], len: CSize): CSize =
+    extern
+
+  /** Decodes bytes to UTF-16, returns the number of written chars and stores
+   *  the number of consumed bytes in `read`.
+   */
+  def scalanative_utf8_to_utf16(
+      src: Ptr[Byte],
+      len: CSize,
+      dst: Ptr[Char],
+      dstLen: CSize,
+      read: Ptr[CSize]
+  ): CSize = extern
+
+  /** Encodes UTF-16 chars, returns the number of written bytes and stores the
+   *  number of consumed chars in `read`.
+   */
+  def scalanative_utf16_to_utf8(
+      src: Ptr[Char],
+      len: CSize,
+      dst: Ptr[Byte],
+      dstLen: CSize,
+      read: Ptr[CSize]
+  ): CSize = extern
+
+  /** Length of the UTF-8 encoding of chars, or -1 if they contain an unpaired
+   *  surrogate.
+   */
+  def scalanative_utf16_utf8_length(src: Ptr[Char], len: CSize): CSSize =
+    extern
+}
@@ -0,0 +1,59 @@
+package scala.scalanative.javalib.lang
+
+import scala.scalanative.unsafe._
+
+/* Vectorized searching, comparing, hashing and filling of primitive arrays,
+ * used by java.lang.String and java.util.Arrays, see scalanative_vectorized.c.
+ *
+ * Callers pass pointers to array elements and are responsible for checking
+ * the bounds. Indices are -1 when nothing is found.
+ */
+@define("__SCALANATIVE_JAVALIB_VECTORIZED")
+@extern
+object Vectorized {
+
+  /** Index of the first differing byte. */
+  def scalanative_mismatch(a: CVoidPtr, b: CVoidPtr, len: CSize): CSSize =
+    extern
+
+  /** `31 * hash + element` applied to unsigned bytes, e.g. Latin-1 chars. */
+  def scalanative_hash_u8(src: Ptr[Byte], len: CSize, hash: CInt): CInt =
+    extern
+
+  def scalanative_hash_i8(src: Ptr[Byte], len: CSize, hash: CInt): CInt =
+    extern
+
+  def scalanative_hash_u16(src: Ptr[Char], len: CSize, hash: CInt): CInt =
+    extern
+
+  def scalanative_hash_i16(src: Ptr[Short], len: CSize, hash: CInt): CInt =
+    extern
+
+  def scalanative_hash_i32(src: Ptr[Int], len: CSize, hash: CInt): CInt =
+    extern
+
+  /** Searched values are passed as Int, only their low bits are compared. */
+  def scalanative_index_of_u16(src: Ptr[Char], len: CSize, c: Int): CSSize =
+    extern
+
+  def scalanative_last_index_of_u8(
+      src: Ptr[Byte],
+      len: CSize,
+      c: Int
+  ): CSSize = extern
+
+  def scalanative_last_index_of_u16(
+      src: Ptr[Char],
+      len: CSize,
+      c: Int
+  ): CSSize = extern
+
+  def scalanative_fill_16(dst: CVoidPtr, count: CSize, value: Int): Unit =
+    extern
+
+  def scalanative_fill_32(dst: CVoidPtr, count: CSize, value: Int): Unit =
+    extern
+
+  def scalanative_fill_64(dst: CVoidPtr, count: CSize, value: Long): Unit =
+    extern
+}
@@ -0,0 +1,198 @@
+package scala.scalanative
+package runtime.ieee754fromstring
+
+import java.nio.charset.StandardCharsets
+import java.util.Objects
+
+import EiselLemire.{Binary32, Binary64, Fallback, Format, MaxDigits}
+
+/** Parses decimal floating point numbers using the syntax accepted by
+ *  `Double.parseDouble` and `Float.parseFloat`, directly from characters or
+ *  Latin-1/ASCII bytes, without copying them to a C string.
+ *
+ *  Inputs outside of the fast path: hexadecimal notation, `NaN`, `Infinity`,
+ *  malformed numbers and decimals which cannot be rounded using only their
+ *  first 19 significant digits are handled by the libc based implementation
+ *  of `Double.parseDouble` and `Float.parseFloat`.
+ */
+object FastFloat {
+
+  def parseDouble(s: CharSequence, start: Int, end: Int): scala.Double = {
+    Objects.checkFromToIndex(start, end, s.length())
+    val bits = scan(s, start, end, Binary64)
+    if (bits != Fallback) java.lang.Double.longBitsToDouble(bits)
+    else java.lang.Double.parseDouble(s.subSequence(start, end).toString)
+  }
+
+  def parseDouble(bytes: Array[Byte], start: Int, end: Int): scala.Double = {
+    Objects.checkFromToIndex(start, end, bytes.length)
+    val bits = scan(bytes, start, end, Binary64)
+    if (bits != Fallback) java.lang.Double.longBitsToDouble(bits)
+    else java.lang.Double.parseDouble(latin1String(bytes, start, end))
+  }
+
+  def parseFloat(s: CharSequence, start: Int, end: Int): scala.Float = {
+    Objects.checkFromToIndex(start, end, s.length())
+    val bits = scan(s, start, end, Binary32)
+    if (bits != Fallback) java.lang.Float.intBitsToFloat(bits.toInt)
+    else java.lang.Float.parseFloat(s.subSequence(start, end).toString)
+  }
+
+  def parseFloat(bytes: Array[Byte], start: Int, end: Int): scala.Float = {
+    Objects.checkFromToIndex(start, end, bytes.length)
+    val bits = scan(bytes, start, end, Binary32)
+    if (bits != Fallback) java.lang.Float.intBitsToFloat(bits.toInt)
+    else java.lang.Float.parseFloat(latin1String(bytes, start, end))
+  }
+
+  /** Raw bits of parsed double or [[EiselLemire.Fallback]] */
+  def doubleBits(s: String): scala.Long =
+    if (s == null) Fallback
+    else scan(s, 0, s.length(), Binary64)
+
+  /** Raw bits of parsed float or [[EiselLemire.Fallback]] */
+  def floatBits(s: String): scala.Long =
+    if (s == null) Fallback
+    else scan(s, 0, s.length(), Binary32)
+
+  private def latin1String(bytes: Array[Byte], start: Int, end: Int) =
+    new String(bytes, start, end - start, StandardCharsets.ISO_8859_1)
+
+  @inline private def isTypeSuffix(c: Int): Boolean =
+    (c | 0x20) == 'd' || (c | 0x20) == 'f'
+
+  // Both scanners below need to be kept in sync. They are not abstracted over
+  // the kind of input, so that reading a character stays a direct access.
+
+  private def scan(
+      s: CharSequence,
+      start: Int,
+      end: Int,
+      format: Format
+  ): scala.Long = {
+    // Java allows for leading and trailing chars <= ' '
+    var i = start
+    var limit = end
+    while (i < limit && s.charAt(i) <= ' ') i += 1
+    while (limit > i && s.charAt(limit - 1) <= ' ') limit -= 1
+    if (limit > i && isTypeSuffix(s.charAt(limit - 1))) limit -= 1
+    if (i == limit) return Fallback
+
+    val negative = s.charAt(i) == '-'
+    if (negative || s.charAt(i) == '+') i += 1
+
+    var mantissa = 0L
+    var digits = 0
+    var exponent = 0
+    var truncated = false
+    var seenDigit = false
+    var seenDot = false
+    var scanning = true
+    while (i < limit && scanning) {
+      val c = s.charAt(i)
+      if (c >= '0' && c <= '9') {
+        val digit = c - '0'
+        seenDigit = true
+        if (mantissa == 0L && digit == 0) {
+          if (seenDot) exponent -= 1
+        } else if (digits < MaxDigits) {
+          mantissa = mantissa * 10 + digit
+          digits += 1
+          if (seenDot) exponent -= 1
+        } else {
+          truncated |= digit != 0
+          if (!seenDot) exponent += 1
+        }
+        i += 1
+      } else if (c == '.' && !seenDot) {
+        seenDot = true
+        i += 1
+      } else scanning = false
+    }
+    if (!seenDigit) return Fallback
+
+    if (i < limit && (s.charAt(i) | 0x20) == 'e') {
+      i += 1
+      val negativeExponent = i < limit && s.charAt(i) == '-'
+      if (negativeExponent || (i < limit && s.charAt(i) == '+')) i += 1
+      if (i == limit) return Fallback
+      var explicitExponent = 0
+      while (i < limit && s.charAt(i) >= '0' && s.charAt(i) <= '9') {
+        // Larger exponents overflow or underflow anyway
+        if (explicitExponent < 0x10000)
+          explicitExponent = explicitExponent * 10 + (s.charAt(i) - '0')
+        i += 1
+      }
+      if (negativeExponent) exponent -= explicitExponent
+      else exponent += explicitExponent
+    }
+    if (i != limit) return Fallback
+
+    EiselLemire.toBits(negative, mantissa, exponent, truncated, format)
+  }
+
+  private def scan(
+      bytes: Array[Byte],
+      start: Int,
+      end: Int,
+      format: Format
+  ): scala.Long = {
+    var i = start
+    var limit = end
+    while (i < limit && (bytes(i) & 0xff) <= ' ') i += 1
+    while (limit > i && (bytes(limit - 1) & 0xff) <= ' ') limit -= 1
+    if (limit > i && isTypeSuffix(bytes(limit - 1))) limit -= 1
+    if (i == limit) return Fallback
+
+    val negative = bytes(i) == '-'
+    if (negative || bytes(i) == '+') i += 1
+
+    var mantissa = 0L
+    var digits = 0
+    var exponent = 0
+    var truncated = false
+    var seenDigit = false
+    var seenDot = false
+    var scanning = true
+    while (i < limit && scanning) {
+      val b = bytes(i)
+      if (b >= '0' && b <= '9') {
+        val digit = b - '0'
+        seenDigit = true
+        if (mantissa == 0L && digit == 0) {
+          if (seenDot) exponent -= 1
+        } else if (digits < MaxDigits) {
+          mantissa = mantissa * 10 + digit
+          digits += 1
+          if (seenDot) exponent -= 1
+        } else {
+          truncated |= digit != 0
+          if (!seenDot) exponent += 1
+        }
+        i += 1
+      } else if (b == '.' && !seenDot) {
+        seenDot = true
+        i += 1
+      } else scanning = false
+    }
+    if (!seenDigit) return Fallback
+
+    if (i < limit && (bytes(i) | 0x20) == 'e') {
+      i += 1
+      val negativeExponent = i < limit && bytes(i) == '-'
+      if (negativeExponent || (i < limit && bytes(i) == '+')) i += 1
+      if (i == limit) return Fallback
+      var explicitExponent = 0
+      while (i < limit && bytes(i) >= '0' && bytes(i) <= '9') {
+        if (explicitExponent < 0x10000)
+          explicitExponent = explicitExponent * 10 + (bytes(i) - '0')
+        i += 1
+      }
+      if (negativeExponent) exponent -= explicitExponent
+      else exponent += explicitExponent
+    }
+    if (i != limit) return Fallback
+
+    EiselLemire.toBits(negative, mantissa, exponent, truncated, format)
+  }
+}
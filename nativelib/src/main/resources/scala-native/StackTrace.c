@@ -5,6 +5,18 @@
 #include <string.h>
 #include "platform/unwind.h"
 #include "gc/shared/ThreadUtil.h"
+#include "nativeThreadTLS.h"
+#include "StackTrace.h"
+#ifdef __SCALANATIVE_DELIMCC
+#include "delimcc.h"
+#endif
+
+#if !defined(_WIN32) &&                                                        \
+    (defined(__x86_64__) || defined(__aarch64__) || defined(__i386__))
+// Each frame record stores the caller frame pointer followed by the return
+// address: [fp] = previous fp, [fp + sizeof(void*)] = return address
+#define SCALANATIVE_FRAME_RECORDS_SUPPORTED
+#endif
 
 static mutex_t *getStackTraceLock() {
     static mutex_t lock;
@@ -49,3 +61,56 @@ void StackTrace_PrintStackTrace() {
     free(cursor);
     free(context);
 }
+
+__attribute__((noinline)) int
+scalanative_stackTrace_captureFramePointers(size_t *buffer, int maxFrames) {
+#ifdef SCALANATIVE_FRAME_RECORDS_SUPPORTED
+    ThreadInfo *threadInfo = scalanative_currentThreadInfo();
+    if (threadInfo == NULL || threadInfo->stackBottom == NULL)
+        return -1;
+    // The stack grows down from stackBottom, its highest address. stackTop is
+    // only the lowest address in use when the thread was registered, deeper
+    // frames are limited by the maximal size of the stack instead.
+    void **stackBottom = (void **)threadInfo->stackBottom;
+    void **stackLimit =
+        threadInfo->maxStackSize > 0 &&
+                threadInfo->maxStackSize < (uintptr_t)stackBottom
+            ? (void **)((char *)stackBottom - threadInfo->maxStackSize)
+            : NULL;
+    void **fp = (void **)__builtin_frame_address(0);
+    // Executing on alternative stack (signal handler) or on the heap fragment
+    // of resumed continuation, frame records cannot be trusted.
+    if (fp >= stackBottom || (stackLimit != NULL && fp < stackLimit))
+        return -1;
+
+    // Skip the frame of our direct caller
+    int toSkip = 1;
+    int frames = 0;
+    while (frames < maxFrames) {
+        void **next = (void **)fp[0];
+        void *returnAddress = fp[1];
+        if (returnAddress == NULL)
+            break;
+#if defined(__SCALANATIVE_DELIMCC) && defined(SCALANATIVE_DELIMCC_LAZY_THAW)
+        // Callers of this frame belong to resumed continuation and were not
+        // copied back to the stack yet.
+        if (returnAddress == scalanative_continuation_return_barrier)
+            break;
+#endif
+        if (toSkip > 0)
+            toSkip--;
+        else
+            buffer[frames++] = (size_t)returnAddress;
+        // The chain needs to strictly grow towards the bottom of stack,
+        // otherwise we've reached either the outermost frame or a function
+        // compiled without frame pointers.
+        if (next <= fp || next >= stackBottom ||
+            ((uintptr_t)next & (sizeof(void *) - 1)) != 0)
+            break;
+        fp = next;
+    }
+    return frames;
+#else
+    return -1;
+#endif
+}
@@ -1,5 +1,16 @@
 #ifndef SCALANATIVE_STACKTRACE_H
 #define SCALANATIVE_STACKTRACE_H
 
+#include <stddef.h>
+
 void StackTrace_PrintStackTrace();
+
+/* Captures return addresses of the current thread by following the chain of
+ * frame records. Frames are reported starting from the caller of the function
+ * invoking the capture, the same frames which would be reported by stepping a
+ * freshly initialized unwind cursor. Returns the number of stored frames or -1
+ * if frame pointer walking is not supported for the current thread or
+ * platform, in which case the caller should fallback to unwinding. Reliable
+ * only if the program was compiled with frame pointers preserved. */
+int scalanative_stackTrace_captureFramePointers(size_t *buffer, int maxFrames);
 #endif
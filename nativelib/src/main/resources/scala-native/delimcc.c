@@ -1,4 +1,7 @@
-#if defined(SCALANATIVE_COMPILE_ALWAYS) || defined(__SCALANATIVE_DELIMCC)
+#if (defined(SCALANATIVE_COMPILE_ALWAYS) || defined(__SCALANATIVE_DELIMCC)) && \
+    !defined(SCALANATIVE_DELIMCC_STACKFUL)
+// Continuations copying the suspended stack segment into the heap, see
+// `delimcc/stackful.c` for the implementation using dedicated stacks.
 #include "delimcc.h"
 #include <stddef.h>
 #include <stdio.h>
@@ -10,54 +13,7 @@
 #include <stdint.h>
 #include "gc/shared/ThreadUtil.h"
 #include "nativeThreadTLS.h"
-
-// Defined symbols here:
-// - ASM_JMPBUF_SIZE: The size of the jmpbuf, should be a constant defined in
-// `setjmp.S`.
-// - JMPBUF_STACK_POINTER_OFFSET: The offset within the jmpbuf where
-//   the stack pointer is located. Should be defined in `setjmp.S`.
-#if defined(__aarch64__) // ARM64
-#define ASM_JMPBUF_SIZE 192
-#define JMPBUF_STACK_POINTER_OFFSET (104 / 8)
-#define JMPBUF_FRAME_POINTER_OFFSET (88 / 8)
-#elif defined(__x86_64__) &&                                                   \
-    (defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__) ||       \
-     defined(__OpenBSD__) || defined(__NetBSD__))
-#define ASM_JMPBUF_SIZE 72
-#define JMPBUF_STACK_POINTER_OFFSET (16 / 8)
-#define JMPBUF_FRAME_POINTER_OFFSET (24 / 8)
-#elif defined(__i386__) &&                                                     \
-    (defined(__linux__) || defined(__APPLE__)) // x86 linux and macOS
-#define ASM_JMPBUF_SIZE 32
-#define JMPBUF_STACK_POINTER_OFFSET (16 / 4)
-#define JMPBUF_FRAME_POINTER_OFFSET (0 / 4)
-#elif defined(__x86_64__) && defined(_WIN64) // x86-64 Windows
-#define ASM_JMPBUF_SIZE 256
-#define JMPBUF_STACK_POINTER_OFFSET (16 / 8)
-#define JMPBUF_FRAME_POINTER_OFFSET (24 / 8)
-#else
-#error "Unsupported platform"
-#endif
-
-#ifdef SCALANATIVE_DELIMCC_DEBUG
-#define debug_printf(...) printf(__VA_ARGS__)
-#else
-#define debug_printf(...) (void)0
-#endif
-
-#define DELIMCC_ERROR(...)                                                     \
-    do {                                                                       \
-        fprintf(stderr, "[ScalaNative Continuations | Error] ");               \
-        fprintf(stderr, __VA_ARGS__);                                          \
-        fprintf(stderr, "\n");                                                 \
-        fflush(stderr);                                                        \
-    } while (0)
-
-#define DELIMCC_ERROR_ABORT(...)                                               \
-    do {                                                                       \
-        DELIMCC_ERROR(__VA_ARGS__);                                            \
-        abort();                                                               \
-    } while (0)
+#include "delimcc/lh_setjmp.h"
 
 // The return address is always stored in stack_btm - BOUNDARY_LR_OFFSET.
 // See `_lh_boundary_entry`.
@@ -67,32 +23,39 @@
 #define BOUNDARY_LR_OFFSET 8
 #endif
 
+// When all code preserves frame pointers the suspended frames can be walked
+// using the chain of frame records: [fp] = caller's fp, [fp + sizeof(void *)] =
+// return address. Saved frame pointers are then rebased when resuming.
+#if defined(SCALANATIVE_FRAME_POINTERS) && !defined(_WIN32)
+#define DELIMCC_FRAME_RECORDS
+// Frames of resumed continuation are copied back lazily. Only the topmost
+// chunk of frames is copied when resuming, the return address of its last
+// frame is replaced with `_lh_return_barrier`, which copies the next chunk once
+// returned into. Frames not copied back yet are shared with the continuation
+// when suspending again, so that suspend and resume cost does not depend on
+// the depth of the stack. The unwinder cannot step through the return barrier,
+// all frames are copied back before retrying to throw an exception.
+#ifdef SCALANATIVE_DELIMCC_LAZY_THAW
+#define DELIMCC_LAZY_THAW
+#define DELIMCC_THAW_CHUNK_SIZE ((ptrdiff_t)(8 * 1024))
+// Incoming stack arguments of the last copied frame are stored in its caller,
+// copy them together with it.
+#define DELIMCC_THAW_ARGUMENTS_SIZE ((ptrdiff_t)512)
+#endif
+#endif
+
 // Apple platforms mangle the names of some symbols in assembly. We override the
 // names here.
 #if defined(__APPLE__)
-#define _lh_setjmp lh_setjmp
-#define _lh_longjmp lh_longjmp
 #define _lh_boundary_entry lh_boundary_entry
 #define _lh_resume_entry lh_resume_entry
-#define _lh_get_sp lh_get_sp
 
 #define __continuation_boundary_impl _continuation_boundary_impl
 #define __continuation_resume_impl _continuation_resume_impl
+#define __continuation_thaw_next _continuation_thaw_next
+#define _lh_return_barrier lh_return_barrier
 #endif
 
-#define __externc extern
-#define __noreturn __attribute__((noreturn))
-#define __returnstwice __attribute__((returns_twice))
-#ifndef __noinline
-#define __noinline __attribute__((noinline))
-#endif
-// define the lh_jmp_buf in terms of `void*` elements to have natural alignment
-typedef void *lh_jmp_buf[ASM_JMPBUF_SIZE / sizeof(void *)];
-// Non-standard setjmp.
-__externc __returnstwice int _lh_setjmp(lh_jmp_buf buf);
-// Jumps to the given setjmp'd buffer, returning arg as the value.
-// arg must be non-zero.
-__externc void *_lh_longjmp(lh_jmp_buf buf, int arg);
 // Stores the return address in sp+BOUNDARY_LR_OFFSET, then calls
 // __cont_boundary_impl.
 __externc __returnstwice void *_lh_boundary_entry(ContinuationBody *f,
@@ -100,8 +63,11 @@ __externc __returnstwice void *_lh_boundary_entry(ContinuationBody *f,
 // Allocate enough stack for the resumption, and then call __cont_resume_impl.
 __externc void *_lh_resume_entry(ptrdiff_t cont_size, Continuation *c,
                                  void *arg);
-// Returns the stack pointer of the calling function.
-__externc void *_lh_get_sp();
+#ifdef DELIMCC_LAZY_THAW
+// Calls __continuation_thaw_next to copy back the next chunk of frames, then
+// jumps to the original return address preserving the returned values.
+__externc void _lh_return_barrier(void);
+#endif
 
 // Label counter
 volatile static atomic_ulong label_count;
@@ -240,6 +206,54 @@ __noinline static void *handler_head_longjmp(int arg) {
     return _lh_longjmp(cur->buf, arg);
 }
 
+__noinline static Handler *handler_find(ContinuationBoundaryLabel l) {
+    Handler *h = handlers_load();
+    while (h != NULL && h->id != l)
+        h = h->next;
+    return h;
+}
+
+#ifdef DELIMCC_LAZY_THAW
+/**
+ * Resumed continuation whose frames were not all copied back to the stack,
+ * stored in the frame of `scalanative_continuation_resume`. Frames in
+ * [copied_end, target + size) are stored only in the continuation, the return
+ * address in `barrier_slot` is replaced with `_lh_return_barrier`.
+ */
+typedef struct Thaw {
+    Continuation *continuation;
+    char *target;          // where the stack segment is placed
+    char *copied_end;      // NULL if all frames were copied back
+    void **barrier_slot;   // return address replaced with the barrier
+    void *return_address;  // original value of `*barrier_slot`
+    void *next_frame;      // next frame record to rebase, continuation address
+    void *resumer_frame;   // frame record of `scalanative_continuation_resume`
+    void *boundary_return; // return address of the outermost frame
+    struct Thaw *next;
+} Thaw;
+
+/**
+ * Thread local chain of resumed continuations, innermost first. Same as
+ * handlers it is accessed only using __noinline functions.
+ */
+static SN_ThreadLocal Thaw *volatile __thaws = NULL;
+
+__noinline static Thaw *thaws_load(void) { return (Thaw *)__thaws; }
+
+__noinline static void thaws_store(Thaw *t) { __thaws = t; }
+
+// Removes `t` and all thaws above it, if `t` was not removed already
+// when suspending the frame owning it.
+__noinline static void thaws_pop(Thaw *t) {
+    for (Thaw *it = thaws_load(); it != NULL; it = it->next) {
+        if (it == t) {
+            thaws_store(t->next);
+            return;
+        }
+    }
+}
+#endif
+
 // =============================
 // Continuation exception escape state (shared by eh.c / eh.cpp)
 
@@ -293,7 +307,15 @@ void scalanative_continuation_init(void *(*alloc_f)(unsigned long, void *)) {
     atomic_init(&label_count, 0);
 }
 
-void scalanative_continuation_handlers_reset(void) { handlers_store(NULL); }
+// Stack fragments are allocated using `continuation_alloc_fn`, nothing to do.
+void scalanative_continuation_release(Continuation *continuation) {}
+
+void scalanative_continuation_handlers_reset(void) {
+    handlers_store(NULL);
+#ifdef DELIMCC_LAZY_THAW
+    thaws_store(NULL);
+#endif
+}
 
 NO_SANITIZE
 __returnstwice void *
@@ -353,6 +375,15 @@ struct Continuation {
      * heap_stack_fragment via continuation_alloc_fn (non-moving GC). */
     void *alloc_arg;
 
+    /* Only the first `copied` bytes of the stack segment are stored in
+     * `stack`. Remaining frames were not copied back since `rest` was resumed,
+     * these are shared with it starting at `rest_offset` of its stack segment.
+     * `rest_owner` keeps the allocation of `rest` reachable. */
+    ptrdiff_t copied;
+    struct Continuation *rest;
+    ptrdiff_t rest_offset;
+    void *rest_owner;
+
     char stack[];
 };
 
@@ -396,6 +427,325 @@ static inline void *continuation_rebase_ptr(const void *p, const void *old_base,
     return (void *)(new_addr + (p_addr - old_addr));
 }
 
+/* Finds the continuation storing the byte at `offset` of the stack segment,
+ * which might be shared with continuations resumed before. Returns its address
+ * in `*owner`, `*available` bytes of the segment are stored contiguously from
+ * there. Stack addresses stored by `*owner` are moved by `*delta` relative to
+ * the addresses of `continuation`. */
+static char *continuation_locate(const Continuation *continuation,
+                                 ptrdiff_t offset, const Continuation **owner,
+                                 ptrdiff_t *delta, ptrdiff_t *available) {
+    const Continuation *c = continuation;
+    ptrdiff_t d = 0;
+    while (offset >= c->copied) {
+        const Continuation *rest = c->rest;
+        d += continuation_address_diff((char *)c->stack_top + c->copied,
+                                       (char *)rest->stack_top +
+                                           c->rest_offset);
+        offset = c->rest_offset + (offset - c->copied);
+        c = rest;
+    }
+    if (owner != NULL)
+        *owner = c;
+    if (delta != NULL)
+        *delta = d;
+    if (available != NULL)
+        *available = c->copied - offset;
+    return (char *)c->stack + offset;
+}
+
+// Copies `size` bytes of the stack segment starting at `offset` into `to`.
+static void continuation_copy_out(const Continuation *continuation,
+                                  ptrdiff_t offset, char *to, ptrdiff_t size) {
+    while (size > 0) {
+        ptrdiff_t available;
+        char *from =
+            continuation_locate(continuation, offset, NULL, NULL, &available);
+        ptrdiff_t n = available < size ? available : size;
+        memcpy(to, from, n);
+        to += n;
+        offset += n;
+        size -= n;
+    }
+}
+
+// Translates stack address `value` stored at `offset` of the stack segment to
+// the addresses of `continuation`.
+static void *continuation_translate(const Continuation *continuation,
+                                    ptrdiff_t offset, void *value) {
+    const Continuation *owner;
+    ptrdiff_t delta;
+    continuation_locate(continuation, offset, &owner, &delta, NULL);
+    if (owner == continuation || value == NULL ||
+        !continuation_contains_stack_address(owner, value))
+        return value;
+    return (char *)value + delta;
+}
+
+#ifdef DELIMCC_FRAME_RECORDS
+// Returns the frame pointer of the caller saved in the frame record `frame`.
+static void *continuation_saved_frame(const Continuation *continuation,
+                                      void *frame) {
+    ptrdiff_t offset =
+        continuation_address_diff(frame, continuation->stack_top);
+    void *saved;
+    continuation_copy_out(continuation, offset, (char *)&saved, sizeof(void *));
+    return continuation_translate(continuation, offset, saved);
+}
+
+static inline int continuation_is_caller_frame(const Continuation *continuation,
+                                               void *frame, void *next) {
+    uintptr_t end =
+        (uintptr_t)continuation->stack_top + (uintptr_t)continuation->size;
+    return (uintptr_t)next > (uintptr_t)frame && (uintptr_t)next < end &&
+           ((uintptr_t)next & (sizeof(void *) - 1)) == 0;
+}
+
+/* Rebases frame pointers saved in the frame records starting with `frame`,
+ * which are stored before `end` offset of the stack segment placed at
+ * `target`. The outermost frame is linked with `resumer_frame`. Returns the
+ * first frame record which was not rebased or NULL if none is left. */
+static void *continuation_rebase_frames(const Continuation *continuation,
+                                        char *target, void *frame,
+                                        ptrdiff_t end, void *resumer_frame) {
+    while (frame != NULL) {
+        ptrdiff_t offset =
+            continuation_address_diff(frame, continuation->stack_top);
+        if (offset + (ptrdiff_t)sizeof(void *) > end)
+            return frame;
+        void *next = continuation_saved_frame(continuation, frame);
+        void **slot = (void **)(target + offset);
+        if (!continuation_is_caller_frame(continuation, frame, next)) {
+            // Either the outermost frame, returning to the resumer, or the
+            // chain is broken by a function compiled without frame pointers.
+            if ((uintptr_t)next >= (uintptr_t)continuation->stack_top +
+                                       (uintptr_t)continuation->size)
+                *slot = resumer_frame;
+            return NULL;
+        }
+        *slot = continuation_rebase_ptr(next, continuation->stack_top, target);
+        frame = next;
+    }
+    return NULL;
+}
+#endif
+
+#ifdef DELIMCC_LAZY_THAW
+/* Chooses the end offset of the chunk of frames to copy back starting at
+ * `start` offset, with the first frame record `frame`. Sets `*last_frame` to
+ * the frame record whose return address shall be replaced with the return
+ * barrier, or NULL if the chunk extends to the end of the stack segment. */
+static ptrdiff_t continuation_chunk_end(const Continuation *continuation,
+                                        void *frame, ptrdiff_t start,
+                                        void **last_frame) {
+    *last_frame = NULL;
+    while (frame != NULL) {
+        ptrdiff_t end =
+            continuation_address_diff(frame, continuation->stack_top) +
+            2 * (ptrdiff_t)sizeof(void *);
+        void *next = continuation_saved_frame(continuation, frame);
+        if (!continuation_is_caller_frame(continuation, frame, next))
+            break;
+        if (end - start >= DELIMCC_THAW_CHUNK_SIZE) {
+            end += DELIMCC_THAW_ARGUMENTS_SIZE;
+            if (end >= continuation->size)
+                break;
+            *last_frame = frame;
+            return end;
+        }
+        frame = next;
+    }
+    return continuation->size;
+}
+
+// Translates stack addresses stored in a handler shared with a continuation
+// resumed before, placed at `offset` of the stack segment.
+static void continuation_translate_handler(const Continuation *continuation,
+                                           ptrdiff_t offset, Handler *h) {
+#define translate_field(field)                                                 \
+    continuation_translate(continuation, offset + offsetof(Handler, field),    \
+                           (void *)h->field)
+    h->stack_btm = translate_field(stack_btm);
+    h->result = translate_field(result);
+    h->next = translate_field(next);
+    // rbx, rsp, rbp, r12-r15
+    for (int i = 1; i < 8; i++) {
+        ptrdiff_t field = offsetof(Handler, buf) + i * sizeof(void *);
+        h->buf[i] = continuation_translate(continuation, offset + field,
+                                           h->buf[i]);
+    }
+#undef translate_field
+    // The boundary of this continuation, outer handlers are not captured
+    if (h->stack_btm ==
+        (char *)continuation->stack_top + (uintptr_t)continuation->size)
+        h->next = NULL;
+}
+
+/* Copies back the stack segment stored at [from, to) of the stack, skipping
+ * handlers installed when resuming, which might have been updated since. */
+static void continuation_thaw_range(Thaw *thaw, char *from, char *to) {
+    char *pos = from;
+    for (Handler *h = handlers_load(); h != NULL && (char *)h < to;
+         h = h->next) {
+        char *start = (char *)h, *end = (char *)(h + 1);
+        if (end <= pos)
+            continue;
+        if (start > pos)
+            continuation_copy_out(thaw->continuation, pos - thaw->target, pos,
+                                  start - pos);
+        pos = end;
+    }
+    if (pos < to)
+        continuation_copy_out(thaw->continuation, pos - thaw->target, pos,
+                              to - pos);
+}
+
+// Replaces the return address stored at `slot` with the return barrier.
+static void continuation_thaw_barrier(Thaw *thaw, void **slot) {
+    thaw->barrier_slot = slot;
+    thaw->return_address = *slot;
+    *slot = (void *)_lh_return_barrier;
+}
+
+// Copies back the next chunk of frames, or all remaining ones.
+static void continuation_thaw(Thaw *thaw, int all) {
+    Continuation *c = thaw->continuation;
+    ptrdiff_t start = thaw->copied_end - thaw->target;
+    void *last_frame = NULL;
+    ptrdiff_t end =
+        all ? c->size
+            : continuation_chunk_end(c, thaw->next_frame, start, &last_frame);
+    continuation_thaw_range(thaw, thaw->copied_end, thaw->target + end);
+    thaw->next_frame = continuation_rebase_frames(
+        c, thaw->target, thaw->next_frame, end, thaw->resumer_frame);
+    if (last_frame != NULL) {
+        thaw->copied_end = thaw->target + end;
+        continuation_thaw_barrier(
+            thaw, (void **)(thaw->target + continuation_address_diff(
+                                               last_frame, c->stack_top)) +
+                      1);
+    } else {
+        *(void **)(thaw->target + c->size - BOUNDARY_LR_OFFSET) =
+            thaw->boundary_return;
+        thaw->copied_end = NULL;
+    }
+}
+
+static void continuation_thaw_all(Thaw *thaw) {
+    *thaw->barrier_slot = thaw->return_address;
+    continuation_thaw(thaw, 1);
+}
+
+void *const scalanative_continuation_return_barrier =
+    (void *)_lh_return_barrier;
+
+// Called by `_lh_return_barrier` with the stack pointer of the frame returned
+// into, returns its original return address.
+NO_SANITIZE void *__continuation_thaw_next(void **sp) {
+    Thaw *thaw = thaws_load();
+    while (thaw != NULL &&
+           (thaw->copied_end == NULL || thaw->barrier_slot + 1 != sp))
+        thaw = thaw->next;
+    if (thaw == NULL)
+        DELIMCC_ERROR_ABORT("return barrier: no continuation to thaw at %p",
+                            (void *)sp);
+    void *return_address = thaw->return_address;
+    continuation_thaw(thaw, 0);
+    return return_address;
+}
+
+/* Prepares frames of resumed continuations within the stack segment [top,
+ * btm) of `boundary` to be captured. Frames not copied back yet at its
+ * bottom are shared with the captured continuation, all others are copied
+ * back. Returns the shared frames or NULL. */
+static Thaw *continuation_thaws_prepare(char *top, char *btm) {
+    Thaw *shared = NULL;
+    for (Thaw *t = thaws_load(); t != NULL; t = t->next) {
+        if (t->copied_end == NULL || t->copied_end >= btm ||
+            t->target + t->continuation->size <= top)
+            continue;
+        if (t->target + t->continuation->size >= btm)
+            shared = t;
+        else
+            continuation_thaw_all(t);
+    }
+    return shared;
+}
+
+/* Completes capturing the stack segment [top, btm) of `boundary` into
+ * `continuation`, after its first `copied` bytes were copied. */
+static void continuation_thaws_capture(Continuation *continuation,
+                                       Thaw *shared, Handler *boundary) {
+    char *top = continuation->stack_top;
+    char *btm = top + continuation->size;
+    // Return barriers were copied together with the frames.
+    for (Thaw *t = thaws_load(); t != NULL; t = t->next) {
+        if (t->copied_end == NULL)
+            continue;
+        char *slot = (char *)t->barrier_slot;
+        if (slot >= top && slot < top + continuation->copied)
+            *(void **)(continuation->stack + (slot - top)) = t->return_address;
+    }
+    if (shared != NULL) {
+        Continuation *rest = shared->continuation;
+        ptrdiff_t rest_offset = shared->copied_end - shared->target;
+        void *rest_owner = rest->alloc_arg;
+        while (rest_offset >= rest->copied) {
+            rest_offset = rest->rest_offset + (rest_offset - rest->copied);
+            rest_owner = rest->rest_owner;
+            rest = rest->rest;
+        }
+        continuation->rest = rest;
+        continuation->rest_offset = rest_offset;
+        continuation->rest_owner = rest_owner;
+
+        // The boundary returns from the segment after suspending, copy back
+        // its frames and let the shared frames below it continue returning.
+        // Its handler is no longer installed, but needs to be preserved.
+        char *boundary_sp = boundary->buf[JMPBUF_STACK_POINTER_OFFSET];
+        char *from =
+            boundary_sp > shared->copied_end ? boundary_sp : shared->copied_end;
+        Handler installed = *boundary;
+        continuation_thaw_range(shared, from, btm);
+        *boundary = installed;
+        Continuation *c = shared->continuation;
+        void *frame = continuation_rebase_ptr(
+            boundary->buf[JMPBUF_FRAME_POINTER_OFFSET], shared->target,
+            c->stack_top);
+        shared->next_frame =
+            continuation_rebase_frames(c, shared->target, frame,
+                                       btm - shared->target,
+                                       shared->resumer_frame);
+        if (btm == shared->target + c->size) {
+            *(void **)(btm - BOUNDARY_LR_OFFSET) = shared->boundary_return;
+            shared->copied_end = NULL;
+        } else {
+            shared->copied_end = btm;
+            continuation_thaw_barrier(shared,
+                                      (void **)(btm - BOUNDARY_LR_OFFSET));
+        }
+    }
+    // Thaws stored in the captured frames are no longer active
+    Thaw *t = thaws_load();
+    while (t != NULL && (char *)t >= top && (char *)t < btm)
+        t = t->next;
+    thaws_store(t);
+}
+#endif
+
+int scalanative_continuation_thaw_all(void) {
+    int thawed = 0;
+#ifdef DELIMCC_LAZY_THAW
+    for (Thaw *t = thaws_load(); t != NULL; t = t->next) {
+        if (t->copied_end != NULL) {
+            continuation_thaw_all(t);
+            thawed = 1;
+        }
+    }
+#endif
+    return thawed;
+}
+
 /** Clamp pointer to [frag_lo, frag_lo + frag_size]. Used when resuming to a
  * heap-allocated fragment so rebased pointers (e.g. from above_slack) don't
  * point past the end of the fragment. */
@@ -421,6 +771,12 @@ void *scalanative_continuation_suspend(ContinuationBoundaryLabel b,
     volatile void *suspend_arg = arg;
     volatile void *suspend_alloc_arg = alloc_arg;
     void *stack_top = _lh_get_sp();
+#ifdef DELIMCC_LAZY_THAW
+    Handler *boundary = handler_find(b);
+    Thaw *shared = NULL;
+    if (boundary != NULL && (uintptr_t)boundary->stack_btm > (uintptr_t)stack_top)
+        shared = continuation_thaws_prepare(stack_top, boundary->stack_btm);
+#endif
     Handler *head, *tail;
     handler_split_at(b, &head, &tail);
     if (tail->stack_btm == NULL) {
@@ -449,16 +805,28 @@ void *scalanative_continuation_suspend(ContinuationBoundaryLabel b,
         }
     }
     ptrdiff_t stack_size = (ptrdiff_t)(stack_btm_addr - stack_top_addr);
+    ptrdiff_t copied = stack_size;
+#ifdef DELIMCC_LAZY_THAW
+    if (shared != NULL)
+        copied = shared->copied_end - (char *)stack_top;
+#endif
     // set up the continuation
     Continuation *continuation = continuation_alloc_fn(
-        sizeof(Continuation) + stack_size, (void *)suspend_alloc_arg);
+        sizeof(Continuation) + copied, (void *)suspend_alloc_arg);
     continuation->stack_top = stack_top;
     continuation->handlers = head;
     continuation->size = stack_size;
     continuation->heap_stack_fragment = NULL;
     continuation->heap_fragment_alloc_size = 0;
     continuation->alloc_arg = (void *)suspend_alloc_arg;
-    memcpy(continuation->stack, continuation->stack_top, continuation->size);
+    continuation->copied = copied;
+    continuation->rest = NULL;
+    continuation->rest_offset = 0;
+    continuation->rest_owner = NULL;
+    memcpy(continuation->stack, continuation->stack_top, copied);
+#ifdef DELIMCC_LAZY_THAW
+    continuation_thaws_capture(continuation, shared, tail);
+#endif
 
     // set up return value slot
     volatile void *ret_val = NULL;
@@ -690,13 +1058,37 @@ void __continuation_resume_impl(void *tail, Continuation *continuation,
     jmpbuf_fix(return_buf);
     // copy and fix the remaining information in the continuation
     new_return_slot = (void **)fixed_addr_clamped(continuation->return_slot);
-    // install the memory
-    memcpy(target, continuation->stack, continuation->size);
+    // install the memory, possibly only its topmost frames
+    ptrdiff_t copied_size = continuation->size;
+#ifdef DELIMCC_FRAME_RECORDS
+    void *resumer_frame = *(void **)__builtin_frame_address(0);
+    void *frame = continuation->buf[JMPBUF_FRAME_POINTER_OFFSET];
+#endif
+#ifdef DELIMCC_LAZY_THAW
+    // Pushed by `scalanative_continuation_resume`
+    Thaw *thaw = thaws_load();
+    void *last_frame = NULL;
+    if (!use_heap && thaw != NULL && thaw->continuation == continuation)
+        copied_size = continuation_chunk_end(continuation, frame, 0, &last_frame);
+#endif
+    continuation_copy_out(continuation, 0, target, copied_size);
+#ifdef DELIMCC_FRAME_RECORDS
+    frame = continuation_rebase_frames(continuation, target, frame, copied_size,
+                                       resumer_frame);
+#endif
     /* Do not rewrite arbitrary stack words here.
      * Rewriting non-pointer values that happen to look like stack addresses can
      * corrupt frame data under heavy continuation churn. */
     // fix the handlers in cont->stack (continuation_rebase_ptr preserves NULL)
     for (;;) {
+        ptrdiff_t h_offset = continuation_address_diff(h_tail, target);
+        if (h_offset + (ptrdiff_t)sizeof(Handler) > copied_size)
+            continuation_copy_out(continuation, h_offset, (char *)h_tail,
+                                  sizeof(Handler));
+#ifdef DELIMCC_LAZY_THAW
+        if (continuation->rest != NULL)
+            continuation_translate_handler(continuation, h_offset, h_tail);
+#endif
         fix_addr(h_tail->result);
         if (h_tail->stack_btm != NULL) {
             if (continuation_contains_stack_address(continuation,
@@ -729,9 +1121,23 @@ void __continuation_resume_impl(void *tail, Continuation *continuation,
                             (void *)continuation);
     }
     *new_return_slot = out;
-    // fix the return address of the bottom of our new stack fragment.
-    *(void **)((char *)target + continuation->size - BOUNDARY_LR_OFFSET) =
-        ret_addr;
+#ifdef DELIMCC_LAZY_THAW
+    if (last_frame != NULL) {
+        thaw->target = target;
+        thaw->copied_end = (char *)target + copied_size;
+        thaw->next_frame = frame;
+        thaw->resumer_frame = resumer_frame;
+        thaw->boundary_return = ret_addr;
+        continuation_thaw_barrier(
+            thaw, (void **)((char *)target +
+                            continuation_address_diff(
+                                last_frame, continuation->stack_top)) +
+                      1);
+    } else
+#endif
+        // fix the return address of the bottom of our new stack fragment.
+        *(void **)((char *)target + continuation->size - BOUNDARY_LR_OFFSET) =
+            ret_addr;
     _lh_longjmp(return_buf, 1);
 #undef fixed_addr
 #undef fixed_addr_clamped
@@ -770,11 +1176,17 @@ void *scalanative_continuation_resume(Continuation *continuation, void *out) {
     volatile int resume_handler_pushed = 0;
     ContinuationExceptionHandler previous_exception_handler =
         scalanative_continuation_exception_handler();
+#ifdef DELIMCC_LAZY_THAW
+    Thaw thaw = {.continuation = continuation};
+#endif
     if (setjmp(exception_env) != 0) {
         if (resume_handler_pushed) {
             handlers_store((Handler *)saved_handlers);
             resume_handler_pushed = 0;
         }
+#ifdef DELIMCC_LAZY_THAW
+        thaws_pop(&thaw);
+#endif
         scalanative_continuation_exception_handler_set(
             previous_exception_handler);
         return scalanative_continuation_exception_to_failure(caught);
@@ -793,6 +1205,10 @@ void *scalanative_continuation_resume(Continuation *continuation, void *out) {
     Handler h = {.id = label, .result = &result, .stack_btm = NULL};
     handler_push(&h);
     resume_handler_pushed = 1;
+#ifdef DELIMCC_LAZY_THAW
+    thaw.next = thaws_load();
+    thaws_store(&thaw);
+#endif
     if (_lh_setjmp(h.buf) == 0) {
         result = _lh_resume_entry(continuation->size, continuation,
                                   (void *)resume_out);
@@ -801,6 +1217,9 @@ void *scalanative_continuation_resume(Continuation *continuation, void *out) {
     }
     handlers_store((Handler *)saved_handlers);
     resume_handler_pushed = 0;
+#ifdef DELIMCC_LAZY_THAW
+    thaws_pop(&thaw);
+#endif
     scalanative_continuation_exception_handler_set(
         previous_exception_handler); /* normal return path */
 
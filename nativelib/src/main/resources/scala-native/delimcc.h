@@ -7,6 +7,13 @@
 extern "C" {
 #endif
 
+// Frames of resumed continuations are copied back lazily, see `delimcc.c`
+#if defined(SCALANATIVE_FRAME_POINTERS) && defined(__x86_64__) &&              \
+    !defined(_WIN32) && !defined(SCALANATIVE_USING_CPP_EXCEPTIONS) &&          \
+    !defined(SCALANATIVE_DELIMCC_STACKFUL)
+#define SCALANATIVE_DELIMCC_LAZY_THAW
+#endif
+
 typedef unsigned long ContinuationBoundaryLabel;
 
 typedef struct Continuation Continuation;
@@ -48,6 +55,11 @@ void *scalanative_continuation_suspend(ContinuationBoundaryLabel b,
 // argument into the suspended computation and returns its result.
 void *scalanative_continuation_resume(Continuation *continuation, void *arg);
 
+// Releases resources of a Continuation which will never be resumed. Stacks of
+// suspended continuations are only held when `SCALANATIVE_DELIMCC_STACKFUL` is
+// defined, otherwise the stack fragments are owned by the GC and it is no-op.
+void scalanative_continuation_release(Continuation *continuation);
+
 // Reset the thread-local handler chain to NULL. Call before entering a new
 // boundary (e.g. before dispatching a virtual thread) so the carrier does not
 // inherit stale handlers from a previous VT that ran on the same carrier.
@@ -89,6 +101,18 @@ ContinuationExceptionHandler scalanative_continuation_exception_handler(void);
  */
 int scalanative_continuation_exception_escape(Exception exception);
 
+/* Copies back all frames of continuations resumed on the current thread which
+ * were not returned into yet, the unwinder cannot step through them. Returns
+ * non-zero if any frames were copied.
+ */
+int scalanative_continuation_thaw_all(void);
+
+#ifdef SCALANATIVE_DELIMCC_LAZY_THAW
+/* Return address of the last frame copied back from a resumed continuation,
+ * its callers are not copied back yet. */
+extern void *const scalanative_continuation_return_barrier;
+#endif
+
 /* Clear the exception escape handler. Called by resume on both return paths. */
 inline static void scalanative_continuation_exception_handler_clear(void) {
     ContinuationExceptionHandler handler = {NULL, NULL};
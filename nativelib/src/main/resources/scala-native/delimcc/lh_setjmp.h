@@ -0,0 +1,85 @@
+#ifndef DELIMCC_LH_SETJMP_H
+#define DELIMCC_LH_SETJMP_H
+// Platform specific primitives implemented in `delimcc/setjmp.S`, shared by
+// the implementations of continuations.
+#include <stdio.h>
+#include <stdlib.h>
+
+// Defined symbols here:
+// - ASM_JMPBUF_SIZE: The size of the jmpbuf, should be a constant defined in
+// `setjmp.S`.
+// - JMPBUF_STACK_POINTER_OFFSET: The offset within the jmpbuf where
+//   the stack pointer is located. Should be defined in `setjmp.S`.
+#if defined(__aarch64__) // ARM64
+#define ASM_JMPBUF_SIZE 192
+#define JMPBUF_STACK_POINTER_OFFSET (104 / 8)
+#define JMPBUF_FRAME_POINTER_OFFSET (88 / 8)
+#elif defined(__x86_64__) &&                                                   \
+    (defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__) ||       \
+     defined(__OpenBSD__) || defined(__NetBSD__))
+#define ASM_JMPBUF_SIZE 72
+#define JMPBUF_STACK_POINTER_OFFSET (16 / 8)
+#define JMPBUF_FRAME_POINTER_OFFSET (24 / 8)
+#elif defined(__i386__) &&                                                     \
+    (defined(__linux__) || defined(__APPLE__)) // x86 linux and macOS
+#define ASM_JMPBUF_SIZE 32
+#define JMPBUF_STACK_POINTER_OFFSET (16 / 4)
+#define JMPBUF_FRAME_POINTER_OFFSET (0 / 4)
+#elif defined(__x86_64__) && defined(_WIN64) // x86-64 Windows
+#define ASM_JMPBUF_SIZE 256
+#define JMPBUF_STACK_POINTER_OFFSET (16 / 8)
+#define JMPBUF_FRAME_POINTER_OFFSET (24 / 8)
+#else
+#error "Unsupported platform"
+#endif
+
+#ifdef SCALANATIVE_DELIMCC_DEBUG
+#define debug_printf(...) printf(__VA_ARGS__)
+#else
+#define debug_printf(...) (void)0
+#endif
+
+#define DELIMCC_ERROR(...)                                                     \
+    do {                                                                       \
+        fprintf(stderr, "[ScalaNative Continuations | Error] ");               \
+        fprintf(stderr, __VA_ARGS__);                                          \
+        fprintf(stderr, "\n");                                                 \
+        fflush(stderr);                                                        \
+    } while (0)
+
+#define DELIMCC_ERROR_ABORT(...)                                               \
+    do {                                                                       \
+        DELIMCC_ERROR(__VA_ARGS__);                                            \
+        abort();                                                               \
+    } while (0)
+
+// Apple platforms mangle the names of some symbols in assembly. We override the
+// names here.
+#if defined(__APPLE__)
+#define _lh_setjmp lh_setjmp
+#define _lh_longjmp lh_longjmp
+#define _lh_get_sp lh_get_sp
+#define _lh_stack_start lh_stack_start
+#endif
+
+#define __externc extern
+#define __noreturn __attribute__((noreturn))
+#define __returnstwice __attribute__((returns_twice))
+#ifndef __noinline
+#define __noinline __attribute__((noinline))
+#endif
+// define the lh_jmp_buf in terms of `void*` elements to have natural alignment
+typedef void *lh_jmp_buf[ASM_JMPBUF_SIZE / sizeof(void *)];
+// Non-standard setjmp.
+__externc __returnstwice int _lh_setjmp(lh_jmp_buf buf);
+// Jumps to the given setjmp'd buffer, returning arg as the value.
+// arg must be non-zero.
+__externc void *_lh_longjmp(lh_jmp_buf buf, int arg);
+// Returns the stack pointer of the calling function.
+__externc void *_lh_get_sp();
+// Switches to the given (16 bytes aligned) stack bottom and jumps to fn(arg).
+// The frame of `fn` has no return address, it shall never return.
+__externc __noreturn void _lh_stack_start(void *stack_bottom,
+                                          void (*fn)(void *), void *arg);
+
+#endif // DELIMCC_LH_SETJMP_H
@@ -0,0 +1,414 @@
+#if (defined(SCALANATIVE_COMPILE_ALWAYS) || defined(__SCALANATIVE_DELIMCC)) && \
+    defined(SCALANATIVE_DELIMCC_STACKFUL) && !defined(_WIN32)
+/* Continuations executing each boundary on a dedicated stack.
+ *
+ * The body of every `boundary` runs on its own stack mapped with a guard page
+ * at its lowest address. Pages are committed by the OS only once touched, so
+ * the reserved size limits the depth of the stack, not its footprint.
+ * Suspending and resuming swaps only the callee-saved registers and the stack
+ * pointer, its cost does not depend on the depth of the suspended stack,
+ * unlike the implementation copying stack segments in `delimcc.c`.
+ *
+ * Differences to the copying implementation:
+ * - continuations are one-shot, each can be resumed at most once,
+ * - the suspend callback is executed after leaving the suspended stack, on the
+ *   stack of the `boundary` or `resume` call that has entered it,
+ * - a continuation which is never resumed keeps its stacks until it is
+ *   released by `scalanative_continuation_release`.
+ *
+ * Stacks in use are registered with the GC, pooled ones are not. Suspended
+ * stacks are scanned from their saved stack pointer, the executed one is
+ * described by the ThreadInfo of the thread executing it.
+ */
+#include "delimcc.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <setjmp.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "gc/shared/ThreadUtil.h"
+#include "gc/shared/ScalaNativeGC.h"
+#include "gc/shared/Parsing.h"
+#include "nativeThreadTLS.h"
+#include "delimcc/lh_setjmp.h"
+
+#if UINTPTR_MAX == 0xffffffff
+#define FIBER_DEFAULT_STACK_SIZE ((size_t)256 * 1024)
+#else
+#define FIBER_DEFAULT_STACK_SIZE ((size_t)1024 * 1024)
+#endif
+// Number of released stacks kept mapped for reuse
+#define FIBER_POOL_CAPACITY 64
+
+typedef struct Fiber Fiber;
+
+struct Fiber {
+    // Bounds used by the GC, `top` is set while the fiber is not executing
+    GC_Stack stack;
+    ContinuationBoundaryLabel label;
+    // Fiber executing when this one was entered, NULL for the thread's stack
+    Fiber *parent;
+    // Registers of the suspended fiber, stored on its own stack
+    lh_jmp_buf *context;
+    // Registers of the `boundary` or `resume` call which has entered the
+    // fiber, restored once it suspends or completes
+    lh_jmp_buf *return_context;
+    ContinuationBody *body;
+    void *body_arg;
+    ContinuationExceptionHandler exception_handler;
+    void *mapping;
+    Fiber *next_free;
+};
+
+struct Continuation {
+    Fiber *inner; // the fiber which has suspended
+    Fiber *outer; // the fiber of the boundary it has suspended to
+    atomic_bool resumed;
+};
+
+// Passed from the fiber being left to the one being entered
+typedef struct Transfer {
+    void *value;
+    // Set when suspending, executed by the receiver
+    SuspendFn *suspend_fn;
+    void *suspend_arg;
+    Continuation *continuation;
+    // Completed fiber, released by the receiver
+    Fiber *completed;
+} Transfer;
+
+// Assigned allocation function. Should not be modified after `init`.
+static void *(*continuation_alloc_fn)(unsigned long, void *);
+
+volatile static atomic_ulong label_count;
+static ContinuationBoundaryLabel next_label_count() { return ++label_count; }
+
+static size_t fiber_page_size;
+static size_t fiber_mapping_size;
+
+static atomic_flag fiber_pool_lock = ATOMIC_FLAG_INIT;
+static Fiber *fiber_pool = NULL;
+static size_t fiber_pool_size = 0;
+
+/* The innermost fiber executed by current thread and the value passed with the
+ * last switch. Fibers might be suspended and resumed on different threads, so
+ * as in `delimcc.c` thread-locals are accessed only by __noinline functions
+ * to prevent caching their addresses across switches. */
+static SN_ThreadLocal Fiber *volatile current_fiber = NULL;
+static SN_ThreadLocal Transfer *volatile current_transfer = NULL;
+
+__noinline static Fiber *fiber_current(void) { return current_fiber; }
+__noinline static void fiber_set_current(Fiber *fiber) {
+    current_fiber = fiber;
+}
+__noinline static void transfer_put(Transfer *transfer) {
+    current_transfer = transfer;
+}
+__noinline static Transfer *transfer_take(void) {
+    Transfer *transfer = current_transfer;
+    current_transfer = NULL;
+    return transfer;
+}
+
+// =============================
+// Continuation exception escape state (shared by eh.c / eh.cpp)
+
+static SN_ThreadLocal struct ContinuationExceptionHandler
+    continuation_exception_handler = {NULL, NULL};
+
+void scalanative_continuation_exception_handler_set(
+    struct ContinuationExceptionHandler handler) {
+    continuation_exception_handler = handler;
+}
+struct ContinuationExceptionHandler
+scalanative_continuation_exception_handler() {
+    return continuation_exception_handler;
+}
+
+extern void *scalanative_continuation_exception_to_failure(Exception exception);
+
+// Exceptions escaping a fiber are handled using the exception handler set
+// when entering it, nothing to escape to otherwise.
+int scalanative_continuation_exception_escape(Exception exception) {
+    return 0;
+}
+
+// Frames are never copied, nothing to thaw.
+int scalanative_continuation_thaw_all(void) { return 0; }
+
+#if defined(SCALANATIVE_USING_CPP_EXCEPTIONS)
+extern void scalanative_continuation_exception_terminate_handler_install(void);
+#endif
+
+// =============================
+// Stacks
+
+static void fiber_pool_lock_acquire(void) {
+    while (atomic_flag_test_and_set_explicit(&fiber_pool_lock,
+                                             memory_order_acquire))
+        thread_yield();
+}
+
+static void fiber_pool_lock_release(void) {
+    atomic_flag_clear_explicit(&fiber_pool_lock, memory_order_release);
+}
+
+static Fiber *fiber_allocate(void) {
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#endif
+#ifdef MAP_STACK
+    flags |= MAP_STACK;
+#endif
+    char *mapping = mmap(NULL, fiber_mapping_size, PROT_READ | PROT_WRITE,
+                         flags, -1, 0);
+    if (mapping == MAP_FAILED)
+        DELIMCC_ERROR_ABORT("fiber_allocate: failed to map stack of %zu bytes",
+                            fiber_mapping_size);
+    // The stack grows down towards the guard page
+    if (mprotect(mapping, fiber_page_size, PROT_NONE) != 0)
+        DELIMCC_ERROR_ABORT("fiber_allocate: failed to protect guard page");
+
+    // Fiber is stored at the highest address, stack starts right below it
+    uintptr_t header =
+        ((uintptr_t)mapping + fiber_mapping_size - sizeof(Fiber)) &
+        ~(uintptr_t)63;
+    Fiber *fiber = (Fiber *)header;
+    memset(fiber, 0, sizeof(Fiber));
+    fiber->mapping = mapping;
+    fiber->stack.bottom = fiber;
+    return fiber;
+}
+
+static Fiber *fiber_acquire(void) {
+    fiber_pool_lock_acquire();
+    Fiber *fiber = fiber_pool;
+    if (fiber != NULL) {
+        fiber_pool = fiber->next_free;
+        fiber_pool_size--;
+    }
+    fiber_pool_lock_release();
+    if (fiber == NULL)
+        fiber = fiber_allocate();
+    fiber->next_free = NULL;
+    scalanative_GC_add_stack(&fiber->stack);
+    return fiber;
+}
+
+static void fiber_release(Fiber *fiber) {
+    // Frames left on a pooled stack are dead, they must not be scanned
+    scalanative_GC_remove_stack(&fiber->stack);
+    fiber->stack.top = NULL;
+    fiber->parent = NULL;
+    fiber->context = NULL;
+    fiber->return_context = NULL;
+    fiber->body_arg = NULL;
+
+    bool pooled = false;
+    fiber_pool_lock_acquire();
+    if (fiber_pool_size < FIBER_POOL_CAPACITY) {
+        fiber->next_free = fiber_pool;
+        fiber_pool = fiber;
+        fiber_pool_size++;
+        pooled = true;
+    }
+    fiber_pool_lock_release();
+    if (!pooled)
+        munmap(fiber->mapping, fiber_mapping_size);
+}
+
+static inline void *fiber_stack_limit(Fiber *fiber) {
+    return (char *)fiber->mapping + fiber_page_size;
+}
+
+// =============================
+// Switching
+
+/* Makes `to` (NULL for the thread's own stack) the stack executed by the
+ * current thread. `from_sp` is the lowest address in use of the stack being
+ * left, NULL if it has completed. */
+__noinline static void fiber_enter(Fiber *from, void *from_sp, Fiber *to) {
+    ThreadInfo *info = scalanative_currentThreadInfo();
+    ContinuationExceptionHandler handler = {NULL, NULL};
+    if (from != NULL)
+        from->stack.top = from_sp;
+    else
+        info->nativeStackTop = from_sp;
+    if (to != NULL) {
+        to->stack.top = NULL;
+        info->executedStackLimit = fiber_stack_limit(to);
+        info->executedStackBottom = to->stack.bottom;
+        handler = to->exception_handler;
+    } else {
+        info->executedStackBottom = NULL;
+        info->executedStackLimit = NULL;
+    }
+    fiber_set_current(to);
+    scalanative_continuation_exception_handler_set(handler);
+}
+
+__noreturn static void fiber_main(void *arg);
+
+/* Saves the registers of current stack in `*save`, enters `to` and jumps to
+ * `target`, or starts `to` if `target` is NULL. Returns what was transferred
+ * by the switch back to `*save`. */
+NO_SANITIZE __noinline static Transfer *
+fiber_switch(Fiber *from, lh_jmp_buf **save, Fiber *to, lh_jmp_buf *target,
+             Transfer *transfer) {
+    lh_jmp_buf context;
+    *save = &context;
+    if (_lh_setjmp(context) == 0) {
+        // Registers stored in `context` lie above the saved stack pointer
+        fiber_enter(from, _lh_get_sp(), to);
+        transfer_put(transfer);
+        if (target != NULL)
+            _lh_longjmp(*target, 1);
+        else
+            _lh_stack_start(to->stack.bottom, fiber_main, to);
+    }
+    return transfer_take();
+}
+
+/* Completes the `boundary` or `resume` call which was returned to. */
+static void *fiber_returned(Transfer *received) {
+    Transfer transfer = *received;
+    // Was executed on the stack of completed fiber, no longer used
+    if (transfer.completed != NULL)
+        fiber_release(transfer.completed);
+    if (transfer.suspend_fn != NULL)
+        return transfer.suspend_fn(transfer.continuation,
+                                   transfer.suspend_arg);
+    return transfer.value;
+}
+
+NO_SANITIZE __noreturn static void fiber_complete(Fiber *fiber,
+                                                  void *result) {
+    Transfer transfer = {.value = result, .completed = fiber};
+    fiber_enter(fiber, NULL, fiber->parent);
+    transfer_put(&transfer);
+    _lh_longjmp(*fiber->return_context, 1);
+    __builtin_unreachable();
+}
+
+NO_SANITIZE __noreturn static void fiber_main(void *arg) {
+    Fiber *volatile fiber = (Fiber *)arg;
+    volatile Exception caught = NULL;
+    void *volatile result = NULL;
+    jmp_buf exception_env;
+    /* Exceptions not caught by the body stop unwinding at this frame, having
+     * no return address, eh.c / eh.cpp jump back here using this handler. */
+    fiber->exception_handler.env = &exception_env;
+    fiber->exception_handler.exception_slot = (Exception *)&caught;
+    if (setjmp(exception_env) == 0) {
+        scalanative_continuation_exception_handler_set(
+            fiber->exception_handler);
+        result = fiber->body(fiber->label, fiber->body_arg);
+    } else {
+        result = scalanative_continuation_exception_to_failure(caught);
+    }
+    fiber_complete(fiber, result);
+}
+
+// =============================
+// Continuations API
+
+void scalanative_continuation_init(void *(*alloc_f)(unsigned long, void *)) {
+    if (alloc_f == NULL)
+        DELIMCC_ERROR_ABORT("scalanative_continuation_init: alloc_f is NULL\n");
+
+    continuation_alloc_fn = alloc_f;
+    atomic_init(&label_count, 0);
+
+    fiber_page_size = (size_t)sysconf(_SC_PAGESIZE);
+    size_t stack_size = Parse_Env_Or_Default(
+        "SCALANATIVE_CONTINUATION_STACK_SIZE", FIBER_DEFAULT_STACK_SIZE);
+    stack_size = (stack_size + fiber_page_size - 1) & ~(fiber_page_size - 1);
+    if (stack_size < 4 * fiber_page_size)
+        stack_size = 4 * fiber_page_size;
+    fiber_mapping_size = stack_size + fiber_page_size;
+#if defined(SCALANATIVE_USING_CPP_EXCEPTIONS)
+    scalanative_continuation_exception_terminate_handler_install();
+#endif
+}
+
+// Fibers are linked on every switch, there are no stale handlers to reset.
+void scalanative_continuation_handlers_reset(void) {}
+
+void *scalanative_continuation_boundary(ContinuationBody *body, void *arg) {
+    Fiber *parent = fiber_current();
+    Fiber *fiber = fiber_acquire();
+    fiber->label = next_label_count();
+    fiber->parent = parent;
+    fiber->body = body;
+    fiber->body_arg = arg;
+    return fiber_returned(
+        fiber_switch(parent, &fiber->return_context, fiber, NULL, NULL));
+}
+
+void *scalanative_continuation_suspend(ContinuationBoundaryLabel b,
+                                       SuspendFn *f, void *arg,
+                                       void *alloc_arg) {
+    Fiber *inner = fiber_current();
+    Fiber *outer = inner;
+    while (outer != NULL && outer->label != b)
+        outer = outer->parent;
+    if (outer == NULL)
+        DELIMCC_ERROR_ABORT("continuation_suspend: label=%lu not found",
+                            (unsigned long)b);
+
+    Continuation *continuation =
+        continuation_alloc_fn(sizeof(Continuation), alloc_arg);
+    continuation->inner = inner;
+    continuation->outer = outer;
+    atomic_init(&continuation->resumed, false);
+
+    // The callback runs only after the fiber was left, so that the published
+    // continuation can be immediately resumed by other thread
+    Transfer transfer = {
+        .suspend_fn = f, .suspend_arg = arg, .continuation = continuation};
+    Transfer *resumed = fiber_switch(inner, &inner->context, outer->parent,
+                                     outer->return_context, &transfer);
+    return resumed->value;
+}
+
+void *scalanative_continuation_resume(Continuation *continuation, void *out) {
+    bool expected = false;
+    if (!atomic_compare_exchange_strong(&continuation->resumed, &expected,
+                                        true))
+        DELIMCC_ERROR_ABORT("continuation_resume: continuation=%p was already "
+                            "resumed, continuations using dedicated stacks "
+                            "are one-shot",
+                            (void *)continuation);
+
+    Fiber *current = fiber_current();
+    Fiber *inner = continuation->inner;
+    Fiber *outer = continuation->outer;
+    outer->parent = current;
+    Transfer transfer = {.value = out};
+    return fiber_returned(fiber_switch(current, &outer->return_context, inner,
+                                       inner->context, &transfer));
+}
+
+void scalanative_continuation_release(Continuation *continuation) {
+    bool expected = false;
+    if (!atomic_compare_exchange_strong(&continuation->resumed, &expected,
+                                        true))
+        return;
+    // Suspended fibers from the innermost one up to the boundary, none of
+    // them is executed by any thread
+    Fiber *fiber = continuation->inner;
+    Fiber *outer = continuation->outer;
+    while (true) {
+        Fiber *parent = fiber->parent;
+        fiber_release(fiber);
+        if (fiber == outer)
+            break;
+        fiber = parent;
+    }
+}
+
+#endif
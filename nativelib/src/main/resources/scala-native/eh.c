@@ -283,6 +283,12 @@ __attribute__((noreturn)) void scalanative_throw(Exception obj) {
     exceptionWrapper->obj = obj;
     _Unwind_Exception *unwindException = &exceptionWrapper->unwindException;
     _Unwind_Reason_Code code = _Unwind_RaiseException(unwindException);
+#if defined(__SCALANATIVE_DELIMCC)
+    // Search phase could have stopped at frames of resumed continuation which
+    // were not copied back yet, retry after copying them.
+    if (code == _URC_END_OF_STACK && scalanative_continuation_thaw_all())
+        code = _Unwind_RaiseException(unwindException);
+#endif
 
     if (code == _URC_END_OF_STACK) {
 #if defined(__SCALANATIVE_DELIMCC)
@@ -483,6 +483,24 @@ NO_SANITIZE void Marker_markProgramStack(MutatorThread *thread, Heap *heap,
         // Can spuriously fail, very rare, yet deadly
         stackTop = MutatorThread_getStackTop(thread, false);
     } while (stackTop == NULL);
+    ThreadInfo *threadInfo = thread->threadInfo;
+    if (threadInfo != NULL && threadInfo->executedStackBottom != NULL) {
+        // Thread executes one of registered stacks, its own stack is used only
+        // above the point where it has switched to it
+        word_t **executedStackTop = stackTop;
+        word_t **executedStackBottom =
+            (word_t **)threadInfo->executedStackBottom;
+        if (!isInRange(stackTop, threadInfo->executedStackLimit,
+                       executedStackBottom)) {
+            // Safepoint reached on alternative (signal handler) stack
+            executedStackTop = (word_t **)threadInfo->executedStackLimit;
+        }
+        Marker_markRange(heap, stats, outHolder, outWeakRefHolder,
+                         executedStackTop,
+                         executedStackBottom - executedStackTop,
+                         sizeof(word_t));
+        stackTop = (word_t **)threadInfo->nativeStackTop;
+    }
 
 #ifdef SCALANATIVE_THREAD_ALT_STACK
     // If signal handler is executing in alternative stack we need to mark the
@@ -541,14 +559,20 @@ void Marker_markModules(Heap *heap, Stats *stats, GreyPacket **outHolder,
 
 void Marker_markCustomRoots(Heap *heap, Stats *stats, GreyPacket **outHolder,
                             GreyPacket **outWeakRefHolder, GC_Roots *roots) {
-    mutex_lock(&roots->modificationLock);
-    for (GC_Root *it = roots->head; it != NULL; it = it->next) {
-        size_t size = it->range.address_high - it->range.address_low;
+    GC_Roots_foreach(roots, range, {
+        size_t size = range.address_high - range.address_low;
         Marker_markRange(heap, stats, outHolder, outWeakRefHolder,
-                         (word_t **)it->range.address_low, size,
-                         sizeof(word_t));
-    }
-    mutex_unlock(&roots->modificationLock);
+                         (word_t **)range.address_low, size, sizeof(word_t));
+    });
+}
+
+void Marker_markCustomStacks(Heap *heap, Stats *stats, GreyPacket **outHolder,
+                             GreyPacket **outWeakRefHolder,
+                             GC_Stacks *stacks) {
+    GC_Stacks_foreach(stacks, low, high, {
+        Marker_markRange(heap, stats, outHolder, outWeakRefHolder, low,
+                         high - low, sizeof(word_t));
+    });
 }
 
 void Marker_MarkRoots(Heap *heap, Stats *stats) {
@@ -562,6 +586,7 @@ void Marker_MarkRoots(Heap *heap, Stats *stats) {
     }
     Marker_markModules(heap, stats, &out, &weakRefOut);
     Marker_markCustomRoots(heap, stats, &out, &weakRefOut, customRoots);
+    Marker_markCustomStacks(heap, stats, &out, &weakRefOut, customStacks);
     Marker_giveFullPacket(heap, stats, out);
     Marker_giveWeakRefPacket(heap, stats, weakRefOut);
 }
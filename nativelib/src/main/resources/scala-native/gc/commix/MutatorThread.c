@@ -18,6 +18,7 @@
 #endif
 
 static rwlock_t threadListsModificationLock;
+static atomic_uint_fast64_t nextMutatorThreadId = 1;
 
 void MutatorThread_init(Field_t *stackbottom) {
     MutatorThread *self = (MutatorThread *)malloc(sizeof(MutatorThread));
@@ -26,6 +27,9 @@ void MutatorThread_init(Field_t *stackbottom) {
     self->threadInfo = &currentThreadInfo;
 
     self->stackBottom = stackbottom;
+    Handshake_initThread(&self->safepointEpoch);
+    self->id = atomic_fetch_add(&nextMutatorThreadId, 1);
+    ThreadHandshake_initQueue(&self->handshakes);
 
     // Store thread handle for liveness checking and signal delivery
 #ifdef _WIN32
@@ -42,14 +46,6 @@ void MutatorThread_init(Field_t *stackbottom) {
         // Continue anyway - liveness check will return true (assume alive)
         self->threadHandle = NULL;
     }
-#ifdef SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
-    self->wakeupEvent = CreateEvent(NULL, true, false, NULL);
-    if (self->wakeupEvent == NULL) {
-        GC_LOG_ERROR("Failed to setup mutator thread wakeup event: errno=%lu",
-                     GetLastError());
-        exit(1);
-    }
-#endif // SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
 #else
     // Always store pthread_t for liveness checking
     self->thread = pthread_self();
@@ -58,6 +54,7 @@ void MutatorThread_init(Field_t *stackbottom) {
 #ifdef SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
     self->yieldpointTrap = YieldPointTrap_init();
     YieldPointTrap_disarm(self->yieldpointTrap);
+    atomic_init(&self->handshakeArmed, false);
     scalanative_GC_yieldpoint_trap = self->yieldpointTrap;
 #endif
 
@@ -81,15 +78,14 @@ void MutatorThread_init(Field_t *stackbottom) {
 void MutatorThread_delete(MutatorThread *self) {
     MutatorThread_switchState(self, GC_MutatorThreadState_Unmanaged);
     MutatorThreads_remove(self);
+    // Nobody can submit new handshakes after removal
+    ThreadHandshake_cancelPending(&self->handshakes);
     atomic_fetch_add(&mutatorThreadsCount, -1);
 
 #ifdef _WIN32
     if (self->threadHandle != NULL) {
         CloseHandle(self->threadHandle);
     }
-#ifdef SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
-    CloseHandle(self->wakeupEvent);
-#endif
 #endif // WIN32
 
 #ifdef SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
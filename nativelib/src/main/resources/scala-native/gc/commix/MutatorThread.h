@@ -8,13 +8,19 @@
 #include <stdbool.h>
 #include <shared/ThreadUtil.h>
 #include "immix_commix/RegistersCapture.h"
+#include "immix_commix/Handshake.h"
+#include "immix_commix/ThreadHandshake.h"
 #include "nativeThreadTLS.h"
 #include <stdint.h>
 
 typedef struct {
     _Atomic(GC_MutatorThreadState) state;
     atomic_intptr_t stackTop;
-    atomic_bool isWaiting;
+    // Last stop-the-world epoch in which thread reached safepoint
+    Handshake_ThreadEpoch safepointEpoch;
+    // Unique identifier of thread, used to target thread-local handshakes
+    uint64_t id;
+    ThreadHandshake_Queue handshakes;
     RegistersBuffer registersBuffer;
     // immutable fields
     word_t **stackBottom;
@@ -24,9 +30,6 @@ typedef struct {
     // Thread handles for liveness checking and signal delivery
 #ifdef _WIN32
     HANDLE threadHandle; // Duplicated handle for liveness checking
-#ifdef SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
-    HANDLE wakeupEvent; // Used for thread wake-up (trap mode only)
-#endif
 #else
     thread_t thread; // pthread_t - used for liveness check and signals
 #endif
@@ -37,6 +40,8 @@ typedef struct {
     void **yieldpointTrap;
     /* Faulting PC when using deferred safepoint trampoline (POSIX). */
     uintptr_t safepointResumePc;
+    /* Trap page was armed to execute pending thread-local handshakes. */
+    atomic_bool handshakeArmed;
 #endif
 } MutatorThread;
 
@@ -8,5 +8,6 @@ _Atomic(MutatorThreads) mutatorThreads = NULL;
 atomic_int_fast32_t mutatorThreadsCount = 0;
 SN_ThreadLocal MutatorThread *currentMutatorThread = NULL;
 GC_Roots *customRoots = NULL;
+GC_Stacks *customStacks = NULL;
 
 #endif
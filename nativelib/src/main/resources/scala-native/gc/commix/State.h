@@ -6,6 +6,7 @@
 #include "shared/ThreadUtil.h"
 #include "MutatorThread.h"
 #include "immix_commix/GCRoots.h"
+#include "immix_commix/GCStacks.h"
 
 extern Heap heap;
 extern BlockAllocator blockAllocator;
@@ -13,5 +14,6 @@ extern _Atomic(MutatorThreads) mutatorThreads;
 extern atomic_int_fast32_t mutatorThreadsCount;
 extern SN_ThreadLocal MutatorThread *currentMutatorThread;
 extern GC_Roots *customRoots;
+extern GC_Stacks *customStacks;
 
 #endif // IMMIX_STATE_H
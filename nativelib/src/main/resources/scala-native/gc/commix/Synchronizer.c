@@ -16,6 +16,9 @@
 #include "Settings.h"
 #include "shared/ThreadUtil.h"
 #include "shared/Time.h"
+#include "shared/SafepointStats.h"
+#include "immix_commix/Handshake.h"
+#include "immix_commix/ThreadHandshake.h"
 #include "MutatorThread.h"
 #include "shared/Log.h"
 #include <signal.h>
@@ -23,6 +26,9 @@
 
 atomic_bool Synchronizer_stopThreads = false;
 static mutex_t synchronizerLock;
+// Upper bound of a single wait for threads reaching safepoint, allows to
+// report stuck threads
+#define SYNCHRONIZER_WAIT_SLICE_MS 10
 
 // =============================================================================
 // Diagnostics for Stuck Threads
@@ -71,7 +77,6 @@ static sigset_t signalsBlockedDuringGC;
 // Internal API used to implement threads execution yielding
 static void Synchronizer_SuspendThreads(void);
 static void Synchronizer_ResumeThreads(void);
-static void Synchronizer_WaitForResumption(MutatorThread *selfThread);
 
 // =============================================================================
 // Trap-based Yieldpoints Implementation
@@ -107,7 +112,11 @@ static void YieldPointTrap_armAllMutators(void) {
 
 static void YieldPointTrap_disarmAllMutators(void) {
     MutatorThreads_foreach(mutatorThreads, node) {
-        YieldPointTrap_disarm(node->value->yieldpointTrap);
+        MutatorThread *thread = node->value;
+        // Keep the trap for threads which still need to run handshakes
+        if (!atomic_load_explicit(&thread->handshakeArmed,
+                                  memory_order_acquire))
+            YieldPointTrap_disarm(thread->yieldpointTrap);
     }
 }
 
@@ -132,8 +141,6 @@ static LONG WINAPI SafepointTrapHandler(EXCEPTION_POINTERS *ex) {
     return EXCEPTION_CONTINUE_SEARCH;
 }
 #else
-#define THREAD_WAKEUP_SIGNAL SIGCONT
-static sigset_t threadWakupSignals;
 static struct sigaction previousSigsegvHandler = {};
 #ifdef __APPLE__
 static struct sigaction previousSigbusHandler = {};
@@ -253,11 +260,6 @@ static void SetupYieldPointTrapHandler(void) {
     // Call it as first exception handler
     SetUnhandledExceptionFilter(&SafepointTrapHandler);
 #else
-    sigemptyset(&threadWakupSignals);
-    sigaddset(&threadWakupSignals, THREAD_WAKEUP_SIGNAL);
-    sigprocmask(SIG_BLOCK, &threadWakupSignals, NULL);
-    assert(sigismember(&threadWakupSignals, THREAD_WAKEUP_SIGNAL));
-
     struct sigaction sa;
     memset(&sa, 0, sizeof(struct sigaction));
     sigemptyset(&sa.sa_mask);
@@ -280,41 +282,6 @@ static void SetupYieldPointTrapHandler(void) {
 #endif
 }
 
-static void Synchronizer_WaitForResumption(MutatorThread *selfThread) {
-    assert(selfThread == currentMutatorThread);
-#ifdef _WIN32
-    if (!ResetEvent(selfThread->wakeupEvent)) {
-        GC_LOG_WARN("Failed to reset event %lu", GetLastError());
-    }
-    if (WAIT_OBJECT_0 !=
-        WaitForSingleObject(selfThread->wakeupEvent, INFINITE)) {
-        GC_LOG_ERROR("suspend thread failed: errno=%lu", GetLastError());
-        exit(GetLastError());
-    }
-#else
-    int signum;
-    if (0 != sigwait(&threadWakupSignals, &signum)) {
-        GC_LOG_ERROR("sigwait failed: %s", strerror(errno));
-        exit(errno);
-    }
-    assert(signum == THREAD_WAKEUP_SIGNAL);
-#endif
-}
-
-static void Synchronizer_ResumeThread(MutatorThread *thread) {
-#ifdef _WIN32
-    assert(thread != currentMutatorThread);
-    if (!SetEvent(thread->wakeupEvent)) {
-        GC_LOG_ERROR("Failed to set event %lu", GetLastError());
-    }
-#else
-    int status = pthread_kill(thread->thread, THREAD_WAKEUP_SIGNAL);
-    if (status != 0) {
-        GC_LOG_ERROR("Failed to resume thread after GC, retval: %d", status);
-    }
-#endif
-}
-
 static void Synchronizer_SuspendThreads(void) {
     atomic_store_explicit(&Synchronizer_stopThreads, true,
                           memory_order_release);
@@ -326,66 +293,22 @@ static void Synchronizer_ResumeThreads(void) {
     YieldPointTrap_disarmAllMutators();
     atomic_store_explicit(&Synchronizer_stopThreads, false,
                           memory_order_release);
-    MutatorThreads_foreach(mutatorThreads, node) {
-        MutatorThread *thread = node->value;
-        if (atomic_load_explicit(&thread->isWaiting, memory_order_acquire)) {
-            Synchronizer_ResumeThread(thread);
-        }
-    }
+    Handshake_resume();
 }
 
 #else // !SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
 // =============================================================================
 // Conditional Yieldpoints Implementation (Debug Mode)
 // =============================================================================
-#ifdef _WIN32
-static HANDLE threadSuspensionEvent;
-#else
-static struct {
-    pthread_mutex_t lock;
-    pthread_cond_t resume;
-} threadSuspension;
-#endif
-
-static void Synchronizer_WaitForResumption(MutatorThread *selfThread) {
-    assert(selfThread == currentMutatorThread);
-#ifdef _WIN32
-    WaitForSingleObject(threadSuspensionEvent, INFINITE);
-#else
-    pthread_mutex_lock(&threadSuspension.lock);
-    while (
-        atomic_load_explicit(&Synchronizer_stopThreads, memory_order_consume)) {
-        pthread_cond_wait(&threadSuspension.resume, &threadSuspension.lock);
-    }
-    pthread_mutex_unlock(&threadSuspension.lock);
-#endif
-}
-
 static void Synchronizer_SuspendThreads(void) {
-#ifdef _WIN32
-    ResetEvent(threadSuspensionEvent);
     atomic_store_explicit(&Synchronizer_stopThreads, true,
                           memory_order_release);
-#else
-    pthread_mutex_lock(&threadSuspension.lock);
-    atomic_store_explicit(&Synchronizer_stopThreads, true,
-                          memory_order_release);
-    pthread_mutex_unlock(&threadSuspension.lock);
-#endif
 }
 
 static void Synchronizer_ResumeThreads(void) {
-#ifdef _WIN32
-    atomic_store_explicit(&Synchronizer_stopThreads, false,
-                          memory_order_release);
-    SetEvent(threadSuspensionEvent);
-#else
-    pthread_mutex_lock(&threadSuspension.lock);
     atomic_store_explicit(&Synchronizer_stopThreads, false,
                           memory_order_release);
-    pthread_cond_broadcast(&threadSuspension.resume);
-    pthread_mutex_unlock(&threadSuspension.lock);
-#endif
+    Handshake_resume();
 }
 #endif // !SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
 
@@ -394,48 +317,159 @@ static void Synchronizer_ResumeThreads(void) {
 // =============================================================================
 void Synchronizer_init(void) {
     mutex_init(&synchronizerLock);
+    Handshake_init();
 #ifdef SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
     SetupYieldPointTrapHandler();
-#else
-#ifdef _WIN32
-    threadSuspensionEvent = CreateEvent(NULL, true, false, NULL);
-    if (threadSuspensionEvent == NULL) {
-        GC_LOG_ERROR("Failed to setup synchronizer event: errno=%lu",
-                     GetLastError());
-        exit(1);
-    }
-#else
+#endif
+#ifndef _WIN32
     sigemptyset(&signalsBlockedDuringGC);
     sigaddset(&signalsBlockedDuringGC, SIGINT);
     sigaddset(&signalsBlockedDuringGC, SIGTERM);
-    if (pthread_mutex_init(&threadSuspension.lock, NULL) != 0 ||
-        pthread_cond_init(&threadSuspension.resume, NULL) != 0) {
-        GC_LOG_ERROR("Failed to setup synchronizer lock: %s", strerror(errno));
-        exit(1);
-    }
-#endif
 #endif
 }
 
 // =============================================================================
 // Common Implementation
 // =============================================================================
-void Synchronizer_yield(void) {
+void Synchronizer_yield(void) { Synchronizer_yieldAt(NULL); }
+
+static void Synchronizer_runHandshakes(MutatorThread *self) {
+#ifdef SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
+    if (atomic_load_explicit(&self->handshakeArmed, memory_order_acquire)) {
+        // Disarm before clearing the flag, requester which observes cleared
+        // flag would arm it again after submitting its operation. During
+        // stop-the-world event the trap is disarmed when resuming threads.
+        if (!atomic_load_explicit(&Synchronizer_stopThreads,
+                                  memory_order_acquire))
+            YieldPointTrap_disarm(self->yieldpointTrap);
+        atomic_store_explicit(&self->handshakeArmed, false,
+                              memory_order_seq_cst);
+    }
+#endif
+    if (ThreadHandshake_hasPending(&self->handshakes))
+        ThreadHandshake_runPending(&self->handshakes);
+}
+
+void Synchronizer_yieldAt(void *pc) {
     MutatorThread *self = currentMutatorThread;
+    // Handshakes are executed in managed state, they might allocate
+    Synchronizer_runHandshakes(self);
     MutatorThread_switchState(self, GC_MutatorThreadState_Unmanaged);
     atomic_thread_fence(memory_order_seq_cst);
+    SafepointStats_ThreadReachedSafepoint(pc);
 
-    atomic_store_explicit(&self->isWaiting, true, memory_order_release);
-    while (
-        atomic_load_explicit(&Synchronizer_stopThreads, memory_order_consume)) {
-        Synchronizer_WaitForResumption(self);
+    // Stop flag might be stale, epoch decides whether we need to wait
+    uint32_t epoch = Handshake_currentEpoch();
+    if (Handshake_isStopping(epoch)) {
+        Handshake_acknowledge(&self->safepointEpoch, epoch);
+        Handshake_awaitResumption(epoch);
     }
-    atomic_store_explicit(&self->isWaiting, false, memory_order_release);
 
     MutatorThread_switchState(self, GC_MutatorThreadState_Managed);
     atomic_thread_fence(memory_order_seq_cst);
 }
 
+/* Waits in unmanaged state for an operation submitted by this thread. Meanwhile
+ * operations submitted to this thread are executed, otherwise two threads
+ * requesting handshakes with each other would wait for each other forever. */
+static bool Synchronizer_awaitHandshake(MutatorThread *self,
+                                        ThreadHandshake_Operation *operation) {
+    ThreadHandshake_Queue *own = self != NULL ? &self->handshakes : NULL;
+    ThreadHandshake_State state;
+    while ((state = ThreadHandshake_await(operation, own)) ==
+           ThreadHandshake_Pending) {
+        MutatorThread_switchState(self, GC_MutatorThreadState_Managed);
+        // Runs own handshakes, takes part in stop-the-world event if needed
+        Synchronizer_yield();
+        MutatorThread_switchState(self, GC_MutatorThreadState_Unmanaged);
+    }
+    return state == ThreadHandshake_Done;
+}
+
+bool Synchronizer_handshake(uint64_t threadId, GC_HandshakeCallback callback,
+                            void *arg, bool wait) {
+    MutatorThread *self = currentMutatorThread;
+    if (self != NULL && self->id == threadId) {
+        callback(arg);
+        return true;
+    }
+
+    ThreadHandshake_Operation storage;
+    ThreadHandshake_Operation *operation =
+        ThreadHandshake_newOperation(&storage, callback, arg, !wait,
+                                     self != NULL ? &self->handshakes : NULL);
+    // Don't block stop-the-world events while waiting for the lock or for the
+    // target thread
+    if (self != NULL)
+        MutatorThread_switchState(self, GC_MutatorThreadState_Unmanaged);
+
+    bool submitted = false;
+    MutatorThreads_lockRead();
+    MutatorThreads_foreach(mutatorThreads, node) {
+        MutatorThread *thread = node->value;
+        if (thread->id == threadId) {
+            ThreadHandshake_submit(&thread->handshakes, operation);
+#ifdef SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
+            if (!atomic_exchange_explicit(&thread->handshakeArmed, true,
+                                          memory_order_seq_cst))
+                YieldPointTrap_arm(thread->yieldpointTrap);
+#endif
+            submitted = true;
+            break;
+        }
+    }
+    MutatorThreads_unlockRead();
+
+    bool executed = submitted;
+    if (!submitted && !wait)
+        free(operation);
+    else if (submitted && wait)
+        executed = Synchronizer_awaitHandshake(self, operation);
+
+    if (self != NULL) {
+        MutatorThread_switchState(self, GC_MutatorThreadState_Managed);
+        scalanative_GC_yield();
+    }
+    return executed;
+}
+
+/* Prints periodic warnings about threads not reaching the safepoint and
+ * aborts if they didn't reach it before the timeout */
+static void Synchronizer_checkProgress(MutatorThread *self, int activeThreads,
+                                       uint64_t startTime,
+                                       uint64_t *lastWarningTime) {
+    uint64_t now = Time_current_millis();
+    uint64_t elapsed = now - startTime;
+
+    // Periodic warnings about stuck threads
+    if (now - *lastWarningTime >= Settings_SyncWarningIntervalMs()) {
+        *lastWarningTime = now;
+        GC_LOG_WARN("Waiting for %d thread(s) to reach safepoint "
+                    "(%.1fs elapsed)",
+                    activeThreads, elapsed / 1000.0);
+        Synchronizer_diagnoseStuckThreads(self, activeThreads);
+#ifdef SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
+        YieldPointTrap_resetTaskMachBadAccessPorts();
+#endif
+    }
+
+    // Check for timeout (0 = disabled)
+    if (Settings_SyncTimeoutMs() > 0 && elapsed >= Settings_SyncTimeoutMs()) {
+        GC_LOG_ERROR("FATAL: Timeout after %.1fs waiting for %d thread(s)\n"
+                     "Threads did not reach safepoint which blocks the GC.\n"
+                     "This is likely caused by:\n"
+                     "  - Native/extern call missing @blocking annotation\n"
+                     "  - Thread stuck in infinite loop in native code\n"
+                     "Set SCALANATIVE_GC_SYNC_TIMEOUT_MS=0 to disable timeout\n"
+                     "Current timeout: %llu ms",
+                     elapsed / 1000.0, activeThreads,
+                     (unsigned long long)Settings_SyncTimeoutMs());
+        // Abort - this is the safest option as continuing could corrupt
+        // memory
+        abort();
+    }
+}
+
 bool Synchronizer_acquire(void) {
     if (!mutex_tryLock(&synchronizerLock)) {
         scalanative_GC_yield();
@@ -445,16 +479,40 @@ bool Synchronizer_acquire(void) {
     sigprocmask(SIG_BLOCK, &signalsBlockedDuringGC, NULL);
 #endif
 
+    SafepointStats_SynchronizationStarted();
     // Don't allow for registration of any new threads
     MutatorThreads_lockRead();
-    Synchronizer_SuspendThreads();
     MutatorThread *self = currentMutatorThread;
     MutatorThread_switchState(self, GC_MutatorThreadState_Unmanaged);
 
+    uint32_t expectedThreads = 0;
+    MutatorThreads_foreach(mutatorThreads, node) {
+        if (node->value != self)
+            expectedThreads++;
+    }
+    uint32_t epoch = Handshake_stop(expectedThreads);
+    Synchronizer_SuspendThreads();
+    // Threads executing unmanaged code won't yield, acknowledge them now
+    MutatorThreads_foreach(mutatorThreads, node) {
+        MutatorThread *it = node->value;
+        if (it != self && MutatorThread_isAtSafepoint(it)) {
+            Handshake_acknowledge(&it->safepointEpoch, epoch);
+        }
+    }
+
     uint64_t startTime = Time_current_millis();
     uint64_t lastWarningTime = startTime;
-    int activeThreads;
+    uint32_t pendingThreads;
+    while ((pendingThreads = Handshake_awaitAcknowledgements(
+                SYNCHRONIZER_WAIT_SLICE_MS)) > 0) {
+        Synchronizer_checkProgress(self, (int)pendingThreads, startTime,
+                                   &lastWarningTime);
+    }
 
+    // Thread acknowledged while executing unmanaged code might have returned
+    // to managed code since then, wait until it yields again. Usually it's a
+    // single pass over the threads.
+    int activeThreads;
     do {
         atomic_thread_fence(memory_order_seq_cst);
         activeThreads = 0;
@@ -467,42 +525,12 @@ bool Synchronizer_acquire(void) {
         }
 
         if (activeThreads > 0) {
-            uint64_t now = Time_current_millis();
-            uint64_t elapsed = now - startTime;
-
-            // Periodic warnings about stuck threads
-            if (now - lastWarningTime >= Settings_SyncWarningIntervalMs()) {
-                lastWarningTime = now;
-                GC_LOG_WARN("Waiting for %d thread(s) to reach safepoint "
-                            "(%.1fs elapsed)",
-                            activeThreads, elapsed / 1000.0);
-                Synchronizer_diagnoseStuckThreads(self, activeThreads);
-#ifdef SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
-                YieldPointTrap_resetTaskMachBadAccessPorts();
-#endif
-            }
-
-            // Check for timeout (0 = disabled)
-            if (Settings_SyncTimeoutMs() > 0 &&
-                elapsed >= Settings_SyncTimeoutMs()) {
-                GC_LOG_ERROR(
-                    "FATAL: Timeout after %.1fs waiting for %d thread(s)\n"
-                    "Threads did not reach safepoint which blocks the GC.\n"
-                    "This is likely caused by:\n"
-                    "  - Native/extern call missing @blocking annotation\n"
-                    "  - Thread stuck in infinite loop in native code\n"
-                    "Set SCALANATIVE_GC_SYNC_TIMEOUT_MS=0 to disable timeout\n"
-                    "Current timeout: %llu ms",
-                    elapsed / 1000.0, activeThreads,
-                    (unsigned long long)Settings_SyncTimeoutMs());
-                // Abort - this is the safest option as continuing could corrupt
-                // memory
-                abort();
-            }
-
+            Synchronizer_checkProgress(self, activeThreads, startTime,
+                                       &lastWarningTime);
             thread_yield();
         }
     } while (activeThreads > 0);
+    SafepointStats_SynchronizationFinished();
     return true;
 }
 
@@ -37,6 +37,7 @@ NOINLINE void scalanative_GC_init() {
     MutatorThreads_init();
     MutatorThread_init((word_t **)dummy); // approximate stack bottom
     customRoots = GC_Roots_Init();
+    customStacks = GC_Stacks_Init();
     atexit(scalanative_afterexit);
 }
 
@@ -123,6 +124,14 @@ void scalanative_GC_remove_roots(void *addr_low, void *addr_high) {
     GC_Roots_RemoveByRange(customRoots, range);
 }
 
+void scalanative_GC_add_stack(GC_Stack *stack) {
+    GC_Stacks_Add(customStacks, stack);
+}
+
+void scalanative_GC_remove_stack(GC_Stack *stack) {
+    GC_Stacks_Remove(customStacks, stack);
+}
+
 typedef void *RoutineArgs;
 typedef struct {
     ThreadStartRoutine fn;
@@ -181,7 +190,28 @@ void scalanative_GC_set_mutator_thread_state(GC_MutatorThreadState state) {
 void scalanative_GC_yield() {
 #ifdef SCALANATIVE_MULTITHREADING_ENABLED
     if (atomic_load_explicit(&Synchronizer_stopThreads, memory_order_relaxed))
-        Synchronizer_yield();
+        Synchronizer_yieldAt(__builtin_return_address(0));
+#ifndef SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
+    // Conditional yieldpoints can't be armed for a single thread
+    else if (atomic_load_explicit(&ThreadHandshake_pendingCount,
+                                  memory_order_relaxed) > 0 &&
+             ThreadHandshake_hasPending(&currentMutatorThread->handshakes))
+        Synchronizer_yieldAt(__builtin_return_address(0));
+#endif
+#endif
+}
+
+uint64_t scalanative_GC_current_thread_id() { return currentMutatorThread->id; }
+
+bool scalanative_GC_handshake(uint64_t threadId, GC_HandshakeCallback callback,
+                              void *arg, bool wait) {
+#ifdef SCALANATIVE_MULTITHREADING_ENABLED
+    return Synchronizer_handshake(threadId, callback, arg, wait);
+#else
+    if (threadId != currentMutatorThread->id)
+        return false;
+    callback(arg);
+    return true;
 #endif
 }
 
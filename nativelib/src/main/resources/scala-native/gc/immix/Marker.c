@@ -161,6 +161,21 @@ NO_SANITIZE void Marker_markProgramStack(MutatorThread *thread, Heap *heap,
         // Can spuriously fail, very rare, yet deadly
         stackTop = MutatorThread_getStackTop(thread, false);
     } while (stackTop == NULL);
+    ThreadInfo *threadInfo = thread->threadInfo;
+    if (threadInfo != NULL && threadInfo->executedStackBottom != NULL) {
+        // Thread executes one of registered stacks, its own stack is used only
+        // above the point where it has switched to it
+        word_t **executedStackTop = stackTop;
+        if (!isInRange(stackTop, threadInfo->executedStackLimit,
+                       threadInfo->executedStackBottom)) {
+            // Safepoint reached on alternative (signal handler) stack
+            executedStackTop = (word_t **)threadInfo->executedStackLimit;
+        }
+        Marker_markRange(heap, stack, executedStackTop,
+                         (word_t **)threadInfo->executedStackBottom,
+                         sizeof(word_t));
+        stackTop = (word_t **)threadInfo->nativeStackTop;
+    }
 #ifdef SCALANATIVE_THREAD_ALT_STACK
     if (thread->threadInfo != NULL &&
         !isInRange(stackTop, thread->threadInfo->stackTop,
@@ -210,12 +225,15 @@ void Marker_markModules(Heap *heap, Stack *stack) {
 }
 
 void Marker_markCustomRoots(Heap *heap, Stack *stack, GC_Roots *roots) {
-    mutex_lock(&roots->modificationLock);
-    for (GC_Root *it = roots->head; it != NULL; it = it->next) {
-        Marker_markRange(heap, stack, (word_t **)it->range.address_low,
-                         (word_t **)it->range.address_high, sizeof(word_t));
-    }
-    mutex_unlock(&roots->modificationLock);
+    GC_Roots_foreach(roots, range, {
+        Marker_markRange(heap, stack, (word_t **)range.address_low,
+                         (word_t **)range.address_high, sizeof(word_t));
+    });
+}
+
+void Marker_markCustomStacks(Heap *heap, Stack *stack, GC_Stacks *stacks) {
+    GC_Stacks_foreach(stacks, low, high,
+                      Marker_markRange(heap, stack, low, high, sizeof(word_t)));
 }
 
 void Marker_MarkRoots(Heap *heap, Stack *stack) {
@@ -228,6 +246,7 @@ void Marker_MarkRoots(Heap *heap, Stack *stack) {
     }
     Marker_markModules(heap, stack);
     Marker_markCustomRoots(heap, stack, customRoots);
+    Marker_markCustomStacks(heap, stack, customStacks);
     Marker_Mark(heap, stack);
 }
 
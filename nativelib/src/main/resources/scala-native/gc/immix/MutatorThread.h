@@ -4,6 +4,8 @@
 #include "LargeAllocator.h"
 #include "shared/ScalaNativeGC.h"
 #include "immix_commix/RegistersCapture.h"
+#include "immix_commix/Handshake.h"
+#include "immix_commix/ThreadHandshake.h"
 #include <stdatomic.h>
 #include <stdbool.h>
 #include "nativeThreadTLS.h"
@@ -13,15 +15,16 @@ typedef struct {
     _Atomic(GC_MutatorThreadState) state;
     word_t **stackBottom;
     atomic_intptr_t stackTop;
-    atomic_bool isWaiting;
+    // Last stop-the-world epoch in which thread reached safepoint
+    Handshake_ThreadEpoch safepointEpoch;
+    // Unique identifier of thread, used to target thread-local handshakes
+    uint64_t id;
+    ThreadHandshake_Queue handshakes;
     RegistersBuffer registersBuffer;
 
     // Thread handles for liveness checking and signal delivery
 #ifdef _WIN32
     HANDLE threadHandle; // Duplicated handle for liveness checking
-#ifdef SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
-    HANDLE wakeupEvent; // Used for thread wake-up (trap mode only)
-#endif
 #else
     thread_t thread; // pthread_t - used for liveness check and signals
 #endif
@@ -35,6 +38,8 @@ typedef struct {
     void **yieldpointTrap;
     /* Faulting PC when using deferred safepoint trampoline (POSIX). */
     uintptr_t safepointResumePc;
+    /* Trap page was armed to execute pending thread-local handshakes. */
+    atomic_bool handshakeArmed;
 #endif
 } MutatorThread;
 
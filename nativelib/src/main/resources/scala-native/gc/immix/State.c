@@ -9,5 +9,6 @@ BlockAllocator blockAllocator = {};
 _Atomic(MutatorThreads) mutatorThreads = NULL;
 SN_ThreadLocal MutatorThread *currentMutatorThread = NULL;
 GC_Roots *customRoots = NULL;
+GC_Stacks *customStacks = NULL;
 
 #endif
@@ -5,6 +5,7 @@
 #include "shared/ThreadUtil.h"
 #include "MutatorThread.h"
 #include "immix_commix/GCRoots.h"
+#include "immix_commix/GCStacks.h"
 #include "stddef.h"
 
 extern Heap heap;
@@ -14,5 +15,6 @@ extern BlockAllocator blockAllocator;
 extern _Atomic(MutatorThreads) mutatorThreads;
 extern SN_ThreadLocal MutatorThread *currentMutatorThread;
 extern GC_Roots *customRoots;
+extern GC_Stacks *customStacks;
 
 #endif // IMMIX_STATE_H
@@ -5,60 +5,168 @@
 #include <stdio.h>
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
 #include "shared/ThreadUtil.h"
 
+#define GC_ROOTS_SHARD_INITIAL_CAPACITY 16
+
 GC_Roots *GC_Roots_Init() {
-    GC_Roots *roots = (GC_Roots *)malloc(sizeof(GC_Roots));
-    roots->head = NULL;
-    mutex_init(&roots->modificationLock);
+    GC_Roots *roots = (GC_Roots *)calloc(1, sizeof(GC_Roots));
+    if (roots == NULL) {
+        fprintf(stderr, "Failed to allocate GC roots registry\n");
+        exit(1);
+    }
+    for (int i = 0; i < GC_ROOTS_SHARDS; i++) {
+        atomic_init(&roots->shards[i].locked, false);
+    }
     return roots;
 }
 
-void GC_Roots_Add(GC_Roots *roots, AddressRange range) {
-    // Prepend the node with given range to the head of linked list of GC roots
-    GC_Root *node = (GC_Root *)malloc(sizeof(GC_Root));
-    node->range = range;
-    mutex_lock(&roots->modificationLock);
-    node->next = roots->head;
-    roots->head = node;
-    mutex_unlock(&roots->modificationLock);
+static inline word_t GC_Roots_regionOf(const word_t *address) {
+    return (word_t)address >> GC_ROOTS_REGION_BITS;
+}
+
+static inline GC_RootsShard *GC_Roots_shardOf(GC_Roots *roots,
+                                              word_t region) {
+    return &roots->shards[region % GC_ROOTS_SHARDS];
 }
 
-void GC_Roots_Add_Range_Except(GC_Roots *roots, AddressRange range,
-                               AddressRange except) {
-    assert(AddressRange_Contains(range, except));
-    if (range.address_low < except.address_low) {
-        GC_Roots_Add(roots,
-                     (AddressRange){range.address_low, except.address_low});
+/* Index of the first range with address_high >= address */
+static size_t GC_RootsShard_lowerBound(GC_RootsShard *shard,
+                                       const word_t *address) {
+    size_t low = 0, high = shard->size;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (shard->ranges[mid].address_high < address)
+            low = mid + 1;
+        else
+            high = mid;
     }
-    if (range.address_high > except.address_high) {
-        GC_Roots_Add(roots,
-                     (AddressRange){except.address_high, range.address_high});
+    return low;
+}
+
+static void GC_RootsShard_ensureCapacity(GC_RootsShard *shard,
+                                         size_t required) {
+    if (required <= shard->capacity)
+        return;
+    size_t capacity = shard->capacity == 0 ? GC_ROOTS_SHARD_INITIAL_CAPACITY
+                                           : shard->capacity * 2;
+    while (capacity < required)
+        capacity *= 2;
+    AddressRange *ranges = (AddressRange *)realloc(
+        shard->ranges, capacity * sizeof(AddressRange));
+    if (ranges == NULL) {
+        fprintf(stderr, "Failed to grow GC roots registry to %zu ranges\n",
+                capacity);
+        exit(1);
     }
+    shard->ranges = ranges;
+    shard->capacity = capacity;
 }
 
-void GC_Roots_RemoveByRange(GC_Roots *roots, AddressRange range) {
-    mutex_lock(&roots->modificationLock);
-    GC_Root *current = roots->head;
-    GC_Root *prev = NULL;
-    while (current != NULL) {
-        if (AddressRange_Contains(range, current->range)) {
-            AddressRange current_range = current->range;
-            if (prev == NULL)
-                roots->head = current->next;
-            else
-                prev->next = current->next;
-            GC_Roots_Add_Range_Except(roots, current_range, range);
+static void GC_RootsShard_add(GC_RootsShard *shard, AddressRange range) {
+    GC_RootsShard_Lock(shard);
+    // First range which overlaps or is adjacent to the new range
+    size_t first = GC_RootsShard_lowerBound(shard, range.address_low);
+    size_t last = first;
+    while (last < shard->size &&
+           shard->ranges[last].address_low <= range.address_high) {
+        AddressRange merged = shard->ranges[last];
+        if (merged.address_low < range.address_low)
+            range.address_low = merged.address_low;
+        if (merged.address_high > range.address_high)
+            range.address_high = merged.address_high;
+        last++;
+    }
+    size_t merged = last - first;
+    if (merged == 0) {
+        GC_RootsShard_ensureCapacity(shard, shard->size + 1);
+        memmove(&shard->ranges[first + 1], &shard->ranges[first],
+                (shard->size - first) * sizeof(AddressRange));
+        shard->size++;
+    } else if (merged > 1) {
+        memmove(&shard->ranges[first + 1], &shard->ranges[last],
+                (shard->size - last) * sizeof(AddressRange));
+        shard->size -= merged - 1;
+    }
+    shard->ranges[first] = range;
+    GC_RootsShard_Unlock(shard);
+}
 
-            prev = current;
-            GC_Root *next = current->next;
-            free(current);
-            current = next;
-        } else {
-            prev = current;
-            current = current->next;
+static void GC_RootsShard_remove(GC_RootsShard *shard, AddressRange range) {
+    GC_RootsShard_Lock(shard);
+    size_t idx = GC_RootsShard_lowerBound(shard, range.address_low);
+    // Skip range ending exactly at the start of removed range
+    if (idx < shard->size &&
+        shard->ranges[idx].address_high == range.address_low)
+        idx++;
+    if (idx < shard->size &&
+        shard->ranges[idx].address_low < range.address_low &&
+        shard->ranges[idx].address_high > range.address_high) {
+        // Removed range is strictly inside of registered range, split it
+        AddressRange current = shard->ranges[idx];
+        GC_RootsShard_ensureCapacity(shard, shard->size + 1);
+        memmove(&shard->ranges[idx + 1], &shard->ranges[idx],
+                (shard->size - idx) * sizeof(AddressRange));
+        shard->size++;
+        shard->ranges[idx] =
+            (AddressRange){current.address_low, range.address_low};
+        shard->ranges[idx + 1] =
+            (AddressRange){range.address_high, current.address_high};
+    } else {
+        // Trim the ranges partially covered at both ends, drop fully covered
+        if (idx < shard->size &&
+            shard->ranges[idx].address_low < range.address_low) {
+            shard->ranges[idx].address_high = range.address_low;
+            idx++;
+        }
+        size_t end = idx;
+        while (end < shard->size &&
+               shard->ranges[end].address_high <= range.address_high)
+            end++;
+        if (end < shard->size &&
+            shard->ranges[end].address_low < range.address_high) {
+            shard->ranges[end].address_low = range.address_high;
+        }
+        if (end > idx) {
+            memmove(&shard->ranges[idx], &shard->ranges[end],
+                    (shard->size - end) * sizeof(AddressRange));
+            shard->size -= end - idx;
         }
     }
-    mutex_unlock(&roots->modificationLock);
+    GC_RootsShard_Unlock(shard);
+}
+
+/* Splits the range on the region boundaries and applies the operation to the
+ * shard owning given region. */
+#define GC_Roots_forEachRegion(roots, range, shard, part, body)                \
+    do {                                                                       \
+        const word_t *_low = (range).address_low;                              \
+        while (_low < (range).address_high) {                                  \
+            word_t _region = GC_Roots_regionOf(_low);                          \
+            const word_t *_regionEnd =                                         \
+                (const word_t *)((_region + 1) << GC_ROOTS_REGION_BITS);       \
+            const word_t *_high = (range).address_high;                        \
+            if (_regionEnd > _low && _regionEnd < _high)                       \
+                _high = _regionEnd;                                            \
+            GC_RootsShard *shard = GC_Roots_shardOf(roots, _region);           \
+            AddressRange part = {_low, _high};                                 \
+            body;                                                              \
+            _low = _high;                                                      \
+        }                                                                      \
+    } while (0)
+
+void GC_Roots_Add(GC_Roots *roots, AddressRange range) {
+    if (AddressRange_IsEmpty(range))
+        return;
+    GC_Roots_forEachRegion(roots, range, shard, part,
+                           GC_RootsShard_add(shard, part));
+}
+
+void GC_Roots_RemoveByRange(GC_Roots *roots, AddressRange range) {
+    if (AddressRange_IsEmpty(range))
+        return;
+    GC_Roots_forEachRegion(roots, range, shard, part,
+                           GC_RootsShard_remove(shard, part));
 }
 #endif
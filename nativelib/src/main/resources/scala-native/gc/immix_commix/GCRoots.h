@@ -2,6 +2,8 @@
 #define GC_ROOTS_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
 #include "shared/GCTypes.h"
 #include "shared/ThreadUtil.h"
 
@@ -10,14 +12,23 @@ typedef struct AddressRange {
     const word_t *address_high;
 } AddressRange;
 
-typedef struct GC_Root {
-    AddressRange range;
-    struct GC_Root *next;
-} GC_Root;
+/* Custom roots are distributed between shards based on the address region they
+ * belong to, ranges crossing the region boundary are split. Each shard keeps
+ * its ranges sorted, disjoint and coalesced - adjacent ranges (e.g. pages of
+ * the same Zone chunk) are merged into single one. Modifications of distinct
+ * shards never contend with each other and lookups in shard are O(log n). */
+#define GC_ROOTS_SHARDS 64
+#define GC_ROOTS_REGION_BITS 20 // 1 MB
+
+typedef struct GC_RootsShard {
+    atomic_bool locked;
+    size_t size;
+    size_t capacity;
+    AddressRange *ranges;
+} GC_RootsShard;
 
 typedef struct GC_Roots {
-    GC_Root *head;
-    mutex_t modificationLock;
+    GC_RootsShard shards[GC_ROOTS_SHARDS];
 } GC_Roots;
 
 INLINE static bool AddressRange_Contains(AddressRange self,
@@ -26,11 +37,41 @@ INLINE static bool AddressRange_Contains(AddressRange self,
             other.address_high <= self.address_high);
 }
 
+INLINE static bool AddressRange_IsEmpty(AddressRange self) {
+    return self.address_low >= self.address_high;
+}
+
+INLINE static void GC_RootsShard_Lock(GC_RootsShard *shard) {
+    while (atomic_exchange_explicit(&shard->locked, true,
+                                    memory_order_acquire)) {
+        while (atomic_load_explicit(&shard->locked, memory_order_relaxed))
+            thread_yield();
+    }
+}
+
+INLINE static void GC_RootsShard_Unlock(GC_RootsShard *shard) {
+    atomic_store_explicit(&shard->locked, false, memory_order_release);
+}
+
 GC_Roots *GC_Roots_Init();
-/* Add given memory address range to the head of linked list of GC roots*/
+/* Register given memory address range as GC roots. Range is merged with
+ * already registered ranges it overlaps or is adjacent to. */
 void GC_Roots_Add(GC_Roots *roots, AddressRange range);
-/* Remove GC roots nodes for which memory adress range is fully contained within
- * range passed as an argument to this method*/
+/* Stop treating memory addresses within given range as GC roots. Registered
+ * ranges partially covered by the argument are trimmed or split. */
 void GC_Roots_RemoveByRange(GC_Roots *roots, AddressRange range);
 
-#endif
\ No newline at end of file
+/* Iterates over all registered ranges, shard by shard. Each shard is locked
+ * while being visited, the body must not modify the roots. */
+#define GC_Roots_foreach(roots, range, body)                                   \
+    for (int _shardIdx = 0; _shardIdx < GC_ROOTS_SHARDS; _shardIdx++) {        \
+        GC_RootsShard *_shard = &(roots)->shards[_shardIdx];                   \
+        GC_RootsShard_Lock(_shard);                                            \
+        for (size_t _rangeIdx = 0; _rangeIdx < _shard->size; _rangeIdx++) {    \
+            AddressRange range = _shard->ranges[_rangeIdx];                    \
+            body;                                                              \
+        }                                                                      \
+        GC_RootsShard_Unlock(_shard);                                          \
+    }
+
+#endif
@@ -0,0 +1,41 @@
+#if defined(SCALANATIVE_GC_IMMIX) || defined(SCALANATIVE_GC_COMMIX)
+
+#include "immix_commix/GCStacks.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+GC_Stacks *GC_Stacks_Init() {
+    GC_Stacks *stacks = (GC_Stacks *)calloc(1, sizeof(GC_Stacks));
+    if (stacks == NULL) {
+        fprintf(stderr, "Failed to allocate GC stacks registry\n");
+        exit(1);
+    }
+    atomic_init(&stacks->locked, false);
+    return stacks;
+}
+
+void GC_Stacks_Add(GC_Stacks *stacks, GC_Stack *stack) {
+    GC_Stacks_Lock(stacks);
+    stack->prev = NULL;
+    stack->next = stacks->head;
+    if (stacks->head != NULL)
+        stacks->head->prev = stack;
+    stacks->head = stack;
+    GC_Stacks_Unlock(stacks);
+}
+
+void GC_Stacks_Remove(GC_Stacks *stacks, GC_Stack *stack) {
+    GC_Stacks_Lock(stacks);
+    if (stack->prev != NULL)
+        stack->prev->next = stack->next;
+    else if (stacks->head == stack)
+        stacks->head = stack->next;
+    if (stack->next != NULL)
+        stack->next->prev = stack->prev;
+    stack->prev = NULL;
+    stack->next = NULL;
+    GC_Stacks_Unlock(stacks);
+}
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef GC_STACKS_H
+#define GC_STACKS_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include "shared/ScalaNativeGC.h"
+#include "shared/ThreadUtil.h"
+
+/* Stacks registered using scalanative_GC_add_stack, kept in an intrusive
+ * doubly linked list. Stacks are added and removed when they are allocated
+ * and released, never when switching between them, so a single lock is
+ * sufficient. */
+typedef struct GC_Stacks {
+    atomic_bool locked;
+    GC_Stack *head;
+} GC_Stacks;
+
+INLINE static void GC_Stacks_Lock(GC_Stacks *stacks) {
+    while (atomic_exchange_explicit(&stacks->locked, true,
+                                    memory_order_acquire)) {
+        while (atomic_load_explicit(&stacks->locked, memory_order_relaxed))
+            thread_yield();
+    }
+}
+
+INLINE static void GC_Stacks_Unlock(GC_Stacks *stacks) {
+    atomic_store_explicit(&stacks->locked, false, memory_order_release);
+}
+
+GC_Stacks *GC_Stacks_Init();
+void GC_Stacks_Add(GC_Stacks *stacks, GC_Stack *stack);
+void GC_Stacks_Remove(GC_Stacks *stacks, GC_Stack *stack);
+
+/* Iterates over registered stacks which are not executed by any thread,
+ * passing the range of addresses in use. The body must not modify the
+ * registry. */
+#define GC_Stacks_foreach(stacks, low, high, body)                             \
+    do {                                                                       \
+        GC_Stacks_Lock(stacks);                                                \
+        for (GC_Stack *_stack = (stacks)->head; _stack != NULL;                \
+             _stack = _stack->next) {                                          \
+            word_t **low = (word_t **)_stack->top;                             \
+            word_t **high = (word_t **)_stack->bottom;                         \
+            if (low != NULL && low < high) {                                   \
+                body;                                                          \
+            }                                                                  \
+        }                                                                      \
+        GC_Stacks_Unlock(stacks);                                              \
+    } while (0)
+
+#endif // GC_STACKS_H
@@ -0,0 +1,176 @@
+#if defined(SCALANATIVE_GC_IMMIX) || defined(SCALANATIVE_GC_COMMIX)
+
+#include "immix_commix/Handshake.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include "shared/Log.h"
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sys/time.h>
+#endif
+
+static atomic_uint handshakeEpoch = 0;
+static atomic_uint handshakePending = 0;
+
+// =============================================================================
+// Waiting on address
+// =============================================================================
+#if defined(__linux__)
+void Handshake_init(void) {}
+
+void Handshake_wait(atomic_uint *address, uint32_t expected,
+                           uint64_t timeoutMs) {
+    struct timespec timeout, *timeoutRef = NULL;
+    if (timeoutMs > 0) {
+        timeout.tv_sec = timeoutMs / 1000;
+        timeout.tv_nsec = (timeoutMs % 1000) * 1000000;
+        timeoutRef = &timeout;
+    }
+    if (syscall(SYS_futex, (uint32_t *)address, FUTEX_WAIT_PRIVATE, expected,
+                timeoutRef, NULL, 0) != 0 &&
+        errno != EAGAIN && errno != EINTR && errno != ETIMEDOUT) {
+        GC_LOG_ERROR("Failed to wait for GC handshake: %s", strerror(errno));
+        exit(errno);
+    }
+}
+
+void Handshake_wakeAll(atomic_uint *address) {
+    syscall(SYS_futex, (uint32_t *)address, FUTEX_WAKE_PRIVATE, INT_MAX, NULL,
+            NULL, 0);
+}
+
+#elif defined(_WIN32)
+static SRWLOCK parkingLock = SRWLOCK_INIT;
+static CONDITION_VARIABLE parkingCondition = CONDITION_VARIABLE_INIT;
+
+void Handshake_init(void) {}
+
+void Handshake_wait(atomic_uint *address, uint32_t expected,
+                           uint64_t timeoutMs) {
+    AcquireSRWLockExclusive(&parkingLock);
+    if (atomic_load_explicit(address, memory_order_acquire) == expected) {
+        SleepConditionVariableSRW(&parkingCondition, &parkingLock,
+                                  timeoutMs > 0 ? (DWORD)timeoutMs : INFINITE,
+                                  0);
+    }
+    ReleaseSRWLockExclusive(&parkingLock);
+}
+
+void Handshake_wakeAll(atomic_uint *address) {
+    // Acquire the lock to not miss the thread which have checked the value,
+    // but not started waiting yet
+    AcquireSRWLockExclusive(&parkingLock);
+    ReleaseSRWLockExclusive(&parkingLock);
+    WakeAllConditionVariable(&parkingCondition);
+}
+
+#else
+static pthread_mutex_t parkingLock;
+static pthread_cond_t parkingCondition;
+
+void Handshake_init(void) {
+    if (pthread_mutex_init(&parkingLock, NULL) != 0 ||
+        pthread_cond_init(&parkingCondition, NULL) != 0) {
+        GC_LOG_ERROR("Failed to setup GC handshake: %s", strerror(errno));
+        exit(1);
+    }
+}
+
+void Handshake_wait(atomic_uint *address, uint32_t expected,
+                           uint64_t timeoutMs) {
+    pthread_mutex_lock(&parkingLock);
+    if (atomic_load_explicit(address, memory_order_acquire) == expected) {
+        if (timeoutMs > 0) {
+            struct timeval now;
+            gettimeofday(&now, NULL);
+            uint64_t deadlineNs = (uint64_t)now.tv_sec * 1000000000ULL +
+                                  (uint64_t)now.tv_usec * 1000ULL +
+                                  timeoutMs * 1000000ULL;
+            struct timespec deadline = {
+                .tv_sec = deadlineNs / 1000000000ULL,
+                .tv_nsec = deadlineNs % 1000000000ULL};
+            pthread_cond_timedwait(&parkingCondition, &parkingLock, &deadline);
+        } else {
+            pthread_cond_wait(&parkingCondition, &parkingLock);
+        }
+    }
+    pthread_mutex_unlock(&parkingLock);
+}
+
+void Handshake_wakeAll(atomic_uint *address) {
+    pthread_mutex_lock(&parkingLock);
+    pthread_cond_broadcast(&parkingCondition);
+    pthread_mutex_unlock(&parkingLock);
+}
+#endif
+
+// =============================================================================
+// Handshake
+// =============================================================================
+uint32_t Handshake_currentEpoch(void) {
+    return atomic_load_explicit(&handshakeEpoch, memory_order_acquire);
+}
+
+uint32_t Handshake_stop(uint32_t expectedThreads) {
+    // Pending count needs to be visible before any thread observes new epoch
+    atomic_store_explicit(&handshakePending, expectedThreads,
+                          memory_order_relaxed);
+    uint32_t epoch =
+        atomic_fetch_add_explicit(&handshakeEpoch, 1, memory_order_seq_cst) +
+        1;
+    assert(Handshake_isStopping(epoch));
+    return epoch;
+}
+
+uint32_t Handshake_awaitAcknowledgements(uint64_t timeoutMs) {
+    uint32_t pending =
+        atomic_load_explicit(&handshakePending, memory_order_acquire);
+    if (pending > 0) {
+        Handshake_wait(&handshakePending, pending, timeoutMs);
+        pending = atomic_load_explicit(&handshakePending, memory_order_acquire);
+    }
+    return pending;
+}
+
+void Handshake_resume(void) {
+    atomic_fetch_add_explicit(&handshakeEpoch, 1, memory_order_seq_cst);
+    Handshake_wakeAll(&handshakeEpoch);
+}
+
+void Handshake_acknowledge(Handshake_ThreadEpoch *slot, uint32_t epoch) {
+    // Caller might use stale epoch if the synchronizer has already
+    // acknowledged it and started next one, never move the slot backwards
+    uint32_t previous = atomic_load_explicit(slot, memory_order_acquire);
+    do {
+        if ((int32_t)(previous - epoch) >= 0)
+            return;
+    } while (!atomic_compare_exchange_weak_explicit(
+        slot, &previous, epoch, memory_order_acq_rel, memory_order_acquire));
+    // Only the last thread wakes the synchronizer, if it was waiting for
+    // intermediate value of the counter its wait would fail immediately
+    if (atomic_fetch_sub_explicit(&handshakePending, 1,
+                                  memory_order_acq_rel) == 1) {
+        Handshake_wakeAll(&handshakePending);
+    }
+}
+
+void Handshake_awaitResumption(uint32_t epoch) {
+    while (atomic_load_explicit(&handshakeEpoch, memory_order_acquire) ==
+           epoch) {
+        Handshake_wait(&handshakeEpoch, epoch, 0);
+    }
+}
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef IMMIX_COMMIX_HANDSHAKE_H
+#define IMMIX_COMMIX_HANDSHAKE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "shared/GCTypes.h"
+
+/* Stop-the-world handshake between the thread owning the synchronizer and the
+ * remaining mutators. It's driven by a shared epoch: odd epoch means threads
+ * are requested to stop, even epoch means they're free to run.
+ *
+ * Each thread acknowledges reaching the safepoint once per epoch by storing
+ * the epoch in its private slot and decrementing the shared counter of pending
+ * threads - the last one wakes the waiting synchronizer. Threads already in
+ * unmanaged code are acknowledged by the synchronizer on their behalf.
+ * Resumption is a single broadcast on the epoch word, instead of waking each
+ * thread separately.
+ *
+ * Waiting uses futex on Linux and a process-wide condition variable
+ * elsewhere. */
+
+typedef atomic_uint Handshake_ThreadEpoch;
+
+void Handshake_init(void);
+// Current epoch, threads should stop if it's odd
+uint32_t Handshake_currentEpoch(void);
+
+INLINE static void Handshake_initThread(Handshake_ThreadEpoch *slot) {
+    atomic_init(slot, Handshake_currentEpoch());
+}
+
+INLINE static bool Handshake_isStopping(uint32_t epoch) {
+    return (epoch & 1) != 0;
+}
+
+// Synchronizer: starts new stopping epoch expecting acknowledgement from given
+// number of threads, returns the started epoch
+uint32_t Handshake_stop(uint32_t expectedThreads);
+// Synchronizer: waits at most timeoutMs until all threads have acknowledged
+// current epoch, returns the number of threads still pending
+uint32_t Handshake_awaitAcknowledgements(uint64_t timeoutMs);
+// Synchronizer: finishes stopping epoch and wakes all waiting threads
+void Handshake_resume(void);
+
+// Marks the thread owning the slot as stopped in given epoch, can be called
+// both by the thread itself and the synchronizer, only first call is counted.
+// Acknowledgements of already finished epochs are ignored.
+void Handshake_acknowledge(Handshake_ThreadEpoch *slot, uint32_t epoch);
+// Mutator: blocks until given stopping epoch finishes
+void Handshake_awaitResumption(uint32_t epoch);
+
+// Blocks while *address == expected, at most timeoutMs (0 means forever),
+// might return spuriously
+void Handshake_wait(atomic_uint *address, uint32_t expected,
+                    uint64_t timeoutMs);
+// Wakes all threads waiting on given address
+void Handshake_wakeAll(atomic_uint *address);
+
+#endif // IMMIX_COMMIX_HANDSHAKE_H
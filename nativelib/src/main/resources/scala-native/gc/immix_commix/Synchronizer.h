@@ -3,6 +3,8 @@
 
 #include <stdbool.h>
 #include <stdatomic.h>
+#include <stdint.h>
+#include "shared/ScalaNativeGC.h"
 
 extern atomic_bool Synchronizer_stopThreads;
 #ifdef SCALANATIVE_GC_USE_YIELDPOINT_TRAPS
@@ -21,5 +23,13 @@ void Synchronizer_release();
 // Yield execution of calling thead to synchronizer until a call to
 // Synchronizer_release is done by other thread
 void Synchronizer_yield();
+// Same as Synchronizer_yield, pc is the address of the instruction at which
+// the thread reached safepoint, used for diagnostics
+void Synchronizer_yieldAt(void *pc);
+
+// Submit callback to be executed by the thread with given id at its next
+// safepoint, see scalanative_GC_handshake
+bool Synchronizer_handshake(uint64_t threadId, GC_HandshakeCallback callback,
+                            void *arg, bool wait);
 
 #endif // SYNCHRONIZER_H
\ No newline at end of file
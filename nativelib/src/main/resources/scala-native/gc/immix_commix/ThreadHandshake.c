@@ -0,0 +1,132 @@
+#if defined(SCALANATIVE_GC_IMMIX) || defined(SCALANATIVE_GC_COMMIX)
+
+#include "immix_commix/ThreadHandshake.h"
+#include "immix_commix/Handshake.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+atomic_int ThreadHandshake_pendingCount = 0;
+
+ThreadHandshake_Operation *
+ThreadHandshake_newOperation(ThreadHandshake_Operation *storage,
+                             GC_HandshakeCallback callback, void *arg,
+                             bool detached, ThreadHandshake_Queue *requester) {
+    ThreadHandshake_Operation *operation = storage;
+    if (detached) {
+        operation = malloc(sizeof(ThreadHandshake_Operation));
+        if (operation == NULL) {
+            fprintf(stderr, "Failed to allocate thread handshake\n");
+            exit(1);
+        }
+    }
+    operation->callback = callback;
+    operation->arg = arg;
+    operation->detached = detached;
+    operation->requesterSignal =
+        (detached || requester == NULL) ? NULL : &requester->signal;
+    operation->next = NULL;
+    atomic_init(&operation->state, ThreadHandshake_Pending);
+    return operation;
+}
+
+void ThreadHandshake_submit(ThreadHandshake_Queue *queue,
+                            ThreadHandshake_Operation *operation) {
+    atomic_fetch_add_explicit(&ThreadHandshake_pendingCount, 1,
+                              memory_order_relaxed);
+    ThreadHandshake_Operation *head =
+        atomic_load_explicit(&queue->head, memory_order_relaxed);
+    do {
+        operation->next = head;
+    } while (!atomic_compare_exchange_weak_explicit(
+        &queue->head, &head, operation, memory_order_release,
+        memory_order_relaxed));
+    // Owner might be waiting for its own operation
+    atomic_fetch_add_explicit(&queue->signal, 1, memory_order_seq_cst);
+    Handshake_wakeAll(&queue->signal);
+}
+
+static void ThreadHandshake_complete(ThreadHandshake_Operation *operation,
+                                     ThreadHandshake_State state) {
+    if (operation->detached) {
+        free(operation);
+    } else if (operation->requesterSignal != NULL) {
+        // Requester might return and terminate as soon as the state is
+        // stored, the signal needs to be bumped before
+        atomic_uint *signal = operation->requesterSignal;
+        atomic_fetch_add_explicit(signal, 1, memory_order_seq_cst);
+        atomic_store_explicit(&operation->state, state, memory_order_release);
+        // The address is not dereferenced when waking
+        Handshake_wakeAll(signal);
+    } else {
+        atomic_store_explicit(&operation->state, state, memory_order_release);
+        // Requester might have already returned, the address is not
+        // dereferenced when waking
+        Handshake_wakeAll(&operation->state);
+    }
+}
+
+/* Takes all pending operations, returns them in order of submission */
+static ThreadHandshake_Operation *
+ThreadHandshake_takeAll(ThreadHandshake_Queue *queue) {
+    ThreadHandshake_Operation *head =
+        atomic_exchange_explicit(&queue->head, NULL, memory_order_acquire);
+    ThreadHandshake_Operation *reversed = NULL;
+    int count = 0;
+    while (head != NULL) {
+        ThreadHandshake_Operation *next = head->next;
+        head->next = reversed;
+        reversed = head;
+        head = next;
+        count++;
+    }
+    if (count > 0)
+        atomic_fetch_sub_explicit(&ThreadHandshake_pendingCount, count,
+                                  memory_order_relaxed);
+    return reversed;
+}
+
+void ThreadHandshake_runPending(ThreadHandshake_Queue *queue) {
+    ThreadHandshake_Operation *operation = ThreadHandshake_takeAll(queue);
+    while (operation != NULL) {
+        // Operation might be freed or reused by requester once completed
+        ThreadHandshake_Operation *next = operation->next;
+        operation->callback(operation->arg);
+        ThreadHandshake_complete(operation, ThreadHandshake_Done);
+        operation = next;
+    }
+}
+
+void ThreadHandshake_cancelPending(ThreadHandshake_Queue *queue) {
+    ThreadHandshake_Operation *operation = ThreadHandshake_takeAll(queue);
+    while (operation != NULL) {
+        ThreadHandshake_Operation *next = operation->next;
+        ThreadHandshake_complete(operation, ThreadHandshake_Cancelled);
+        operation = next;
+    }
+}
+
+ThreadHandshake_State
+ThreadHandshake_await(ThreadHandshake_Operation *operation,
+                      ThreadHandshake_Queue *requester) {
+    uint32_t state;
+    if (requester == NULL) {
+        while ((state = atomic_load_explicit(&operation->state,
+                                             memory_order_acquire)) ==
+               ThreadHandshake_Pending) {
+            Handshake_wait(&operation->state, ThreadHandshake_Pending, 0);
+        }
+        return state;
+    }
+    while (true) {
+        // Signal is read first, changes made after it wake the wait below
+        uint32_t signal =
+            atomic_load_explicit(&requester->signal, memory_order_seq_cst);
+        state = atomic_load_explicit(&operation->state, memory_order_acquire);
+        if (state != ThreadHandshake_Pending ||
+            ThreadHandshake_hasPending(requester))
+            return state;
+        Handshake_wait(&requester->signal, signal, 0);
+    }
+}
+
+#endif
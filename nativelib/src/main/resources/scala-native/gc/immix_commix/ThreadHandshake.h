@@ -0,0 +1,71 @@
+#ifndef IMMIX_COMMIX_THREAD_HANDSHAKE_H
+#define IMMIX_COMMIX_THREAD_HANDSHAKE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include "shared/GCTypes.h"
+#include "shared/ScalaNativeGC.h"
+
+/* Operations requested to be executed by a single mutator thread at its next
+ * safepoint, without stopping remaining threads. Requests are pushed to a
+ * lock-free stack owned by the target thread, which takes all of them at once
+ * and executes them in the order of submission. */
+
+typedef enum ThreadHandshake_State {
+    ThreadHandshake_Pending = 0,
+    ThreadHandshake_Done = 1,
+    ThreadHandshake_Cancelled = 2,
+} ThreadHandshake_State;
+
+typedef struct ThreadHandshake_Operation {
+    GC_HandshakeCallback callback;
+    void *arg;
+    // Operation not awaited by requester, freed after completion
+    bool detached;
+    atomic_uint state;
+    // Signal of the requester's queue, notified when completed. NULL if the
+    // requester is not a mutator, it waits on the state then.
+    atomic_uint *requesterSignal;
+    struct ThreadHandshake_Operation *next;
+} ThreadHandshake_Operation;
+
+typedef struct ThreadHandshake_Queue {
+    _Atomic(ThreadHandshake_Operation *) head;
+    // Bumped when an operation is submitted to the queue, or an operation
+    // submitted by its owner completes. The owner waits on it for both.
+    atomic_uint signal;
+} ThreadHandshake_Queue;
+
+// Number of operations submitted and not yet taken by any thread, allows for
+// cheap check in conditional yieldpoints
+extern atomic_int ThreadHandshake_pendingCount;
+
+INLINE static void ThreadHandshake_initQueue(ThreadHandshake_Queue *queue) {
+    atomic_init(&queue->head, NULL);
+    atomic_init(&queue->signal, 0);
+}
+
+INLINE static bool ThreadHandshake_hasPending(ThreadHandshake_Queue *queue) {
+    return atomic_load_explicit(&queue->head, memory_order_acquire) != NULL;
+}
+
+// Returns operation to be submitted, allocated on heap if detached. Requester
+// is the queue of the submitting mutator, or NULL.
+ThreadHandshake_Operation *
+ThreadHandshake_newOperation(ThreadHandshake_Operation *storage,
+                             GC_HandshakeCallback callback, void *arg,
+                             bool detached, ThreadHandshake_Queue *requester);
+void ThreadHandshake_submit(ThreadHandshake_Queue *queue,
+                            ThreadHandshake_Operation *operation);
+// Executes all pending operations, needs to be called by the queue owner
+void ThreadHandshake_runPending(ThreadHandshake_Queue *queue);
+// Marks all pending operations as cancelled, used when thread terminates
+void ThreadHandshake_cancelPending(ThreadHandshake_Queue *queue);
+// Blocks until operation is finished and returns its final state. Returns
+// ThreadHandshake_Pending earlier if operations were submitted to the
+// requester's own queue, they need to be executed before waiting again.
+ThreadHandshake_State
+ThreadHandshake_await(ThreadHandshake_Operation *operation,
+                      ThreadHandshake_Queue *requester);
+
+#endif // IMMIX_COMMIX_THREAD_HANDSHAKE_H
@@ -84,6 +84,11 @@ typedef struct {
     uint16_t values[0];
 } CharArray;
 
+typedef struct {
+    ArrayHeader header;
+    uint8_t values[0];
+} ByteArray;
+
 typedef struct StringObject {
     // ObjectHeader
     Rtti *rtti;
@@ -92,10 +97,12 @@ typedef struct StringObject {
 #endif
     // Object fields
     // Best effort, order of fields is not guaranteed
-    CharArray *value;
+    // ByteArray for Latin-1 strings, CharArray otherwise
+    ArrayHeader *value;
     int32_t offset;
     int32_t count;
     int32_t cached_hash_code;
+    int32_t coder;
 } StringObject;
 
 typedef struct Chunk Chunk;
@@ -166,11 +173,19 @@ static inline Field_t Field_allignedLockRef(const Field_t field) {
 static inline wchar_t *Object_nameWString(Object *object) {
     // Depending on platform wchar_t might be 2 or 4 bytes
     // Always convert Scala Char to wchar_t
-    CharArray *strChars = object->rtti->rt.name->value;
-    int nameLength = strChars->header.length;
+    ArrayHeader *strValue = object->rtti->rt.name->value;
+    int nameLength = strValue->length;
     wchar_t *buf = calloc(nameLength + 1, sizeof(wchar_t));
-    for (int i = 0; i < nameLength; i++) {
-        buf[i] = (wchar_t)strChars->values[i];
+    if (strValue->stride == 1) {
+        ByteArray *strBytes = (ByteArray *)strValue;
+        for (int i = 0; i < nameLength; i++) {
+            buf[i] = (wchar_t)strBytes->values[i];
+        }
+    } else {
+        CharArray *strChars = (CharArray *)strValue;
+        for (int i = 0; i < nameLength; i++) {
+            buf[i] = (wchar_t)strChars->values[i];
+        }
     }
     buf[nameLength] = 0;
     return buf;
@@ -185,4 +185,6 @@ void scalanative_GC_set_mutator_thread_state(GC_MutatorThreadState unused) {}
 void scalanative_GC_yield() {}
 void scalanative_GC_add_roots(void *addr_low, void *addr_high) {}
 void scalanative_GC_remove_roots(void *addr_low, void *addr_high) {}
+void scalanative_GC_add_stack(GC_Stack *stack) {}
+void scalanative_GC_remove_stack(GC_Stack *stack) {}
 #endif
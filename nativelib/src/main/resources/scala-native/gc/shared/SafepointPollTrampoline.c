@@ -44,7 +44,10 @@
 #error "SafepointPollTrampoline requires immix or commix"
 #endif
 
-void scalanative_gc_safepoint_poll_run_yield(void) { Synchronizer_yield(); }
+void scalanative_gc_safepoint_poll_run_yield(void) {
+    MutatorThread *self = currentMutatorThread;
+    Synchronizer_yieldAt(self != NULL ? (void *)self->safepointResumePc : NULL);
+}
 
 uintptr_t scalanative_gc_safepoint_load_resume_pc(void) {
     MutatorThread *self = currentMutatorThread;
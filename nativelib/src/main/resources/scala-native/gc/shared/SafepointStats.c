@@ -0,0 +1,141 @@
+// Statistics are gathered only by immix and commix, other GCs report empty
+// histograms
+#include "SafepointStats.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+
+typedef struct {
+    atomic_uint_least64_t buckets[SAFEPOINT_STATS_BUCKETS];
+    atomic_uint_least64_t totalNs;
+    atomic_uint_least64_t maxNs;
+} SafepointHistogram;
+
+typedef struct {
+    atomic_uint_least64_t timeNs;
+    _Atomic(void *) pc;
+} SlowSafepointSample;
+
+static SafepointHistogram histograms[2];
+static SlowSafepointSample slowSamples[SAFEPOINT_STATS_SLOW_SAMPLES];
+static atomic_uint_least64_t slowSamplesCount;
+
+#if defined(SCALANATIVE_GC_IMMIX) || defined(SCALANATIVE_GC_COMMIX)
+#include "Settings.h"
+#include "Time.h"
+
+// Start of the current stop-the-world event, 0 if none is in progress
+static atomic_uint_least64_t synchronizationStartNs;
+
+static inline int SafepointStats_bucketOf(uint64_t timeNs) {
+    if (timeNs == 0)
+        return 0;
+    int bucket = 63 - __builtin_clzll(timeNs);
+    return bucket < SAFEPOINT_STATS_BUCKETS ? bucket
+                                            : SAFEPOINT_STATS_BUCKETS - 1;
+}
+
+static void SafepointHistogram_record(SafepointHistogram *histogram,
+                                      uint64_t timeNs) {
+    atomic_fetch_add_explicit(
+        &histogram->buckets[SafepointStats_bucketOf(timeNs)], 1,
+        memory_order_relaxed);
+    atomic_fetch_add_explicit(&histogram->totalNs, timeNs,
+                              memory_order_relaxed);
+    uint64_t max = atomic_load_explicit(&histogram->maxNs, memory_order_relaxed);
+    while (timeNs > max &&
+           !atomic_compare_exchange_weak_explicit(&histogram->maxNs, &max,
+                                                  timeNs, memory_order_relaxed,
+                                                  memory_order_relaxed)) {
+    }
+}
+
+void SafepointStats_SynchronizationStarted(void) {
+    atomic_store_explicit(&synchronizationStartNs, Time_current_nanos(),
+                          memory_order_release);
+}
+
+void SafepointStats_SynchronizationFinished(void) {
+    uint64_t start = atomic_exchange_explicit(&synchronizationStartNs, 0,
+                                              memory_order_acq_rel);
+    if (start != 0) {
+        SafepointHistogram_record(&histograms[SafepointStats_Collection],
+                                  Time_current_nanos() - start);
+    }
+}
+
+void SafepointStats_ThreadReachedSafepoint(void *pc) {
+    uint64_t start =
+        atomic_load_explicit(&synchronizationStartNs, memory_order_acquire);
+    if (start == 0)
+        return;
+    uint64_t now = Time_current_nanos();
+    uint64_t timeNs = now > start ? now - start : 0;
+    SafepointHistogram_record(&histograms[SafepointStats_Thread], timeNs);
+
+    uint64_t slowThresholdNs = SharedSettings_SafepointSlowThresholdUs() * 1000;
+    if (slowThresholdNs > 0 && timeNs >= slowThresholdNs) {
+        uint64_t idx = atomic_fetch_add_explicit(&slowSamplesCount, 1,
+                                                 memory_order_relaxed);
+        SlowSafepointSample *sample =
+            &slowSamples[idx % SAFEPOINT_STATS_SLOW_SAMPLES];
+        atomic_store_explicit(&sample->timeNs, timeNs, memory_order_relaxed);
+        atomic_store_explicit(&sample->pc, pc, memory_order_relaxed);
+    }
+}
+
+#endif // SCALANATIVE_GC_IMMIX || SCALANATIVE_GC_COMMIX
+
+// =============================================================================
+// Public API
+// =============================================================================
+static SafepointHistogram *SafepointStats_histogramOf(int kind) {
+    if (kind == SafepointStats_Collection || kind == SafepointStats_Thread)
+        return &histograms[kind];
+    return NULL;
+}
+
+size_t scalanative_GC_stats_safepoint_histogram(int kind, uint64_t *buckets,
+                                                size_t size) {
+    SafepointHistogram *histogram = SafepointStats_histogramOf(kind);
+    if (histogram == NULL)
+        return 0;
+    for (size_t i = 0; i < size && i < SAFEPOINT_STATS_BUCKETS; i++) {
+        buckets[i] = atomic_load_explicit(&histogram->buckets[i],
+                                          memory_order_relaxed);
+    }
+    return SAFEPOINT_STATS_BUCKETS;
+}
+
+uint64_t scalanative_GC_stats_safepoint_max_ns(int kind) {
+    SafepointHistogram *histogram = SafepointStats_histogramOf(kind);
+    if (histogram == NULL)
+        return 0;
+    return atomic_load_explicit(&histogram->maxNs, memory_order_relaxed);
+}
+
+uint64_t scalanative_GC_stats_safepoint_total_ns(int kind) {
+    SafepointHistogram *histogram = SafepointStats_histogramOf(kind);
+    if (histogram == NULL)
+        return 0;
+    return atomic_load_explicit(&histogram->totalNs, memory_order_relaxed);
+}
+
+size_t scalanative_GC_stats_safepoint_slow_threads(uint64_t *timesNs,
+                                                   void **pcs, size_t size) {
+    uint64_t count =
+        atomic_load_explicit(&slowSamplesCount, memory_order_relaxed);
+    uint64_t available = count < SAFEPOINT_STATS_SLOW_SAMPLES
+                             ? count
+                             : SAFEPOINT_STATS_SLOW_SAMPLES;
+    size_t copied = 0;
+    // Most recent samples first
+    while (copied < size && copied < available) {
+        SlowSafepointSample *sample =
+            &slowSamples[(count - 1 - copied) % SAFEPOINT_STATS_SLOW_SAMPLES];
+        timesNs[copied] =
+            atomic_load_explicit(&sample->timeNs, memory_order_relaxed);
+        pcs[copied] = atomic_load_explicit(&sample->pc, memory_order_relaxed);
+        copied++;
+    }
+    return copied;
+}
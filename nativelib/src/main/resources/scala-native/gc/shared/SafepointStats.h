@@ -0,0 +1,37 @@
+#ifndef GC_SAFEPOINT_STATS_H
+#define GC_SAFEPOINT_STATS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// =============================================================================
+// Time-to-safepoint statistics
+// =============================================================================
+// Always-on measurement of the time between requesting a stop-the-world event
+// and threads reaching the safepoint. Samples are aggregated in histograms
+// with power of 2 buckets: bucket i counts samples in [2^i, 2^(i+1)) ns.
+//  - Collection histogram - time until all the threads reached a safepoint,
+//    one sample per stop-the-world event
+//  - Thread histogram - time until given thread reached a safepoint, one
+//    sample per each thread which was executing managed code when the
+//    stop-the-world event was requested
+// Threads exceeding SCALANATIVE_GC_SAFEPOINT_SLOW_THRESHOLD_US additionally
+// record the address of the instruction at which they reached the safepoint.
+
+#define SAFEPOINT_STATS_BUCKETS 48
+#define SAFEPOINT_STATS_SLOW_SAMPLES 64
+
+typedef enum {
+    SafepointStats_Collection = 0,
+    SafepointStats_Thread = 1
+} SafepointStats_Kind;
+
+// Called by the thread requesting stop-the-world before arming yieldpoints
+void SafepointStats_SynchronizationStarted(void);
+// Called by the thread requesting stop-the-world when all threads stopped
+void SafepointStats_SynchronizationFinished(void);
+// Called by a mutator upon reaching the safepoint, pc is the address of
+// instruction at which thread yielded or NULL if unknown
+void SafepointStats_ThreadReachedSafepoint(void *pc);
+
+#endif // GC_SAFEPOINT_STATS_H
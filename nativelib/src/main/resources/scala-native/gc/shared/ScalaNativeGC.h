@@ -51,6 +51,23 @@ size_t scalanative_GC_stats_collection_total();
 // The total (accumulated) elapsed time in nanos of GC runs
 size_t scalanative_GC_stats_collection_duration_total();
 
+// Time-to-safepoint histogram of given kind: 0 - time until all threads
+// stopped in each stop-the-world event, 1 - time until each thread stopped.
+// Bucket i counts samples in [2^i, 2^(i+1)) nanoseconds. Copies at most `size`
+// buckets and returns the total number of buckets.
+size_t scalanative_GC_stats_safepoint_histogram(int kind, uint64_t *buckets,
+                                                size_t size);
+// The longest observed time-to-safepoint in nanos of given kind
+uint64_t scalanative_GC_stats_safepoint_max_ns(int kind);
+// The total (accumulated) time-to-safepoint in nanos of given kind
+uint64_t scalanative_GC_stats_safepoint_total_ns(int kind);
+// Copies at most `size` most recent samples of threads exceeding
+// SCALANATIVE_GC_SAFEPOINT_SLOW_THRESHOLD_US: their time-to-safepoint in nanos
+// and address of instruction at which safepoint was reached (NULL if unknown).
+// Returns the number of copied samples.
+size_t scalanative_GC_stats_safepoint_slow_threads(uint64_t *timesNs,
+                                                   void **pcs, size_t size);
+
 // Functions used to create a new thread supporting multithreading support in
 // the garbage collector. Would execute a proxy startup routine to register
 // newly created thread upon startup and unregister it from the GC upon
@@ -100,4 +117,31 @@ extern SN_ThreadLocal void **scalanative_GC_yieldpoint_trap;
 void scalanative_GC_add_roots(void *addr_low, void *addr_high);
 void scalanative_GC_remove_roots(void *addr_low, void *addr_high);
 
+// Stack allocated by the runtime to execute code outside of the thread's own
+// stack, e.g. continuations using dedicated stacks. Registered stack is scanned
+// conservatively from `top` up to `bottom` unless `top` is NULL. Thread
+// executing the stack shall set `top` to NULL and describe it using
+// `executedStackBottom` in its ThreadInfo instead. Supported only by Immix and
+// Commix GCs.
+typedef struct scalanative_GC_Stack {
+    void *volatile top;
+    void *bottom;
+    struct scalanative_GC_Stack *prev;
+    struct scalanative_GC_Stack *next;
+} GC_Stack;
+void scalanative_GC_add_stack(GC_Stack *stack);
+void scalanative_GC_remove_stack(GC_Stack *stack);
+
+// Thread-local handshakes, supported only by Immix and Commix GCs
+typedef void (*GC_HandshakeCallback)(void *arg);
+// Identifier of the calling mutator thread, never reused by other threads
+uint64_t scalanative_GC_current_thread_id();
+// Executes callback on the thread with given id once it reaches its next
+// safepoint, without stopping other threads. Thread executing unmanaged code
+// would run it after returning to managed code. When wait is true blocks
+// until callback finishes, otherwise returns immediately. Returns false if
+// thread does not exist or has terminated before executing the callback.
+bool scalanative_GC_handshake(uint64_t threadId, GC_HandshakeCallback callback,
+                              void *arg, bool wait);
+
 #endif // SCALA_NATIVE_GC_H
@@ -10,6 +10,8 @@
 static bool syncSettingsInitialized = false;
 static uint64_t syncTimeoutMs = GC_SYNC_TIMEOUT_MS_DEFAULT;
 static uint64_t syncWarningIntervalMs = GC_SYNC_WARNING_INTERVAL_MS_DEFAULT;
+static uint64_t safepointSlowThresholdUs =
+    GC_SAFEPOINT_SLOW_THRESHOLD_US_DEFAULT;
 
 // =============================================================================
 // GC Synchronization Settings Implementation
@@ -31,9 +33,15 @@ void SharedSettings_Init(void) {
         syncWarningIntervalMs = warningVal;
     }
 
-    GC_LOG_DEBUG("GC sync timeout: %llu ms, warning interval: %llu ms",
+    safepointSlowThresholdUs =
+        Parse_Env_Or_Default_Long(GC_SAFEPOINT_SLOW_THRESHOLD_US_SETTING,
+                                  GC_SAFEPOINT_SLOW_THRESHOLD_US_DEFAULT);
+
+    GC_LOG_DEBUG("GC sync timeout: %llu ms, warning interval: %llu ms, "
+                 "slow safepoint threshold: %llu us",
                  (unsigned long long)syncTimeoutMs,
-                 (unsigned long long)syncWarningIntervalMs);
+                 (unsigned long long)syncWarningIntervalMs,
+                 (unsigned long long)safepointSlowThresholdUs);
 }
 
 uint64_t SharedSettings_TimeoutMs(void) { return syncTimeoutMs; }
@@ -46,4 +54,8 @@ bool SharedSettings_TimeoutEnabled(void) {
     return SharedSettings_TimeoutMs() > 0;
 }
 
+uint64_t SharedSettings_SafepointSlowThresholdUs(void) {
+    return safepointSlowThresholdUs;
+}
+
 #endif // SCALANATIVE_GC_IMMIX || SCALANATIVE_GC_COMMIX
@@ -10,6 +10,8 @@
 #define GC_SYNC_TIMEOUT_MS_SETTING "SCALANATIVE_GC_SYNC_TIMEOUT_MS"
 #define GC_SYNC_WARNING_INTERVAL_MS_SETTING                                    \
     "SCALANATIVE_GC_SYNC_WARNING_INTERVAL_MS"
+#define GC_SAFEPOINT_SLOW_THRESHOLD_US_SETTING                                 \
+    "SCALANATIVE_GC_SAFEPOINT_SLOW_THRESHOLD_US"
 
 // =============================================================================
 // Default Values for GC Synchronization Timeout
@@ -17,6 +19,7 @@
 // These can be overridden via environment variables
 #define GC_SYNC_TIMEOUT_MS_DEFAULT 60000          // 60 seconds
 #define GC_SYNC_WARNING_INTERVAL_MS_DEFAULT 10000 // 10 seconds
+#define GC_SAFEPOINT_SLOW_THRESHOLD_US_DEFAULT 0   // disabled
 
 // =============================================================================
 // GC Synchronization Timeout Settings API
@@ -35,4 +38,8 @@ uint64_t SharedSettings_WarningIntervalMs(void);
 // Check if sync timeout is enabled
 bool SharedSettings_TimeoutEnabled(void);
 
+// Get the time to safepoint (in microseconds) above which the location of
+// thread reaching safepoint is recorded. Returns 0 if recording is disabled
+uint64_t SharedSettings_SafepointSlowThresholdUs(void);
+
 #endif // GC_SHARED_SYNC_SETTINGS_H
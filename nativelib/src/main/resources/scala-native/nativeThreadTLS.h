@@ -23,6 +23,13 @@ typedef struct ThreadInfo {
     void *stackTop;    // highest stack address
     void *stackBottom; // lowest stack address
     void *stackGuardPage;
+    // Set while the thread executes code on a stack registered using
+    // scalanative_GC_add_stack: its highest and lowest usable addresses and
+    // the lowest address in use of the thread's own stack. NULL when executing
+    // the thread's own stack.
+    void *executedStackBottom;
+    void *executedStackLimit;
+    void *nativeStackTop;
     bool isMainThread;
 #ifndef _WIN32
     bool pendingStackOverflowException;
@@ -1,9 +1,15 @@
 package scala.scalanative.runtime
 
+import java.lang.ref.{ReferenceQueue, WeakReference}
+
 import scala.collection.mutable
 import scala.util.{Failure, Try}
 
-import scala.scalanative.meta.LinktimeInfo.isContinuationsSupported
+import scala.scalanative.meta.LinktimeInfo.{
+  isContinuationsSupported,
+  isStackfulContinuations,
+  isWeakReferenceSupported
+}
 import scala.scalanative.runtime.Intrinsics.*
 import scala.scalanative.runtime.ffi.{free, malloc}
 import scala.scalanative.unsafe.*
@@ -73,14 +79,14 @@ object Continuations:
    *  `boundary`'s caller. Returns when the continuation gets resumed.
    */
   private inline def suspendContinuation[R, T](
-      inline onSuspend: Continuation[R, T] => T
+      inline onSuspend: (R => T) => T
   )(using label: BoundaryLabel[T]): R =
     val continuation = Continuation[R, T]()
     // We want to reify the post-suspension body here,
     // while creating the full continuation object.
     val call: SuspendFn[R, T] = innerContinuation =>
       continuation.inner = innerContinuation
-      Try(onSuspend(continuation))
+      Try(onSuspend(continuation.resumable()))
     try Impl.suspend(label, suspendFn, call, continuation)
     finally reachabilityFence(continuation)
 
@@ -95,11 +101,23 @@ object Continuations:
   private[Continuations] class Continuation[-R, +T] extends (R => T):
     private[Continuations] var inner: Impl.Continuation = _
     private val allocas = mutable.ArrayBuffer[BlobArray]()
+    private var abandoned: Abandoned.Tracked = _
 
     def apply(x: R): T =
       try resume(inner, x).get
       finally reachabilityFence(this)
 
+    /** The function passed to `onSuspend`. Dedicated stacks of suspended
+     *  continuations are scanned by the GC and reference this object, a
+     *  separate handle is used to find the ones which were dropped.
+     */
+    private[Continuations] def resumable(): R => T =
+      if !Abandoned.isEnabled then this
+      else
+        val handle: R => T = this(_)
+        abandoned = Abandoned.track(handle, this)
+        handle
+
     private[Continuations] def alloc(size: CUnsignedLong): Ptr[?] =
       val obj = BlobArray.alloc(size.toInt) // round up the blob size
       allocas += obj
@@ -149,6 +167,30 @@ object Continuations:
 
   @noinline private def reachabilityFence(target: Any): Unit = ()
 
+  /** Stackful continuations which are never resumed hold their stacks until
+   *  released. Those whose handle became unreachable are released on the next
+   *  suspension. Continuations referenced from their own suspended stack stay
+   *  reachable.
+   */
+  private object Abandoned:
+    inline def isEnabled: Boolean =
+      isStackfulContinuations && isWeakReferenceSupported
+
+    private val queue = new ReferenceQueue[AnyRef]()
+
+    final class Tracked(
+        handle: AnyRef,
+        val continuation: Continuation[?, ?]
+    ) extends WeakReference[AnyRef](handle, queue)
+
+    def track(handle: AnyRef, continuation: Continuation[?, ?]): Tracked =
+      var ref = queue.poll()
+      while ref != null do
+        Impl.release(ref.asInstanceOf[Tracked].continuation.inner)
+        ref = queue.poll()
+      Tracked(handle, continuation)
+  end Abandoned
+
   /** Continuations implementation imported from C (see `delimcc.h`) */
   @extern @define("__SCALANATIVE_DELIMCC") private object Impl:
     private type ContinuationLabel = CUnsignedLong
@@ -184,6 +226,10 @@ object Continuations:
     @name("scalanative_continuation_resume")
     def resume[R, T](continuation: Continuation, arg: R): Try[T] = extern
 
+    /** Releases the stacks of a continuation which is never resumed. */
+    @name("scalanative_continuation_release")
+    def release(continuation: Continuation): Unit = extern
+
     @name("scalanative_continuation_init") def init(
         continuation_alloc_fn: CFuncPtr2[
           CUnsignedLong,
@@ -42,6 +42,11 @@ object LinktimeInfo {
   @resolvedAtLinktime()
   def asanEnabled: Boolean = enabledSanitizer == "address"
 
+  @resolvedAtLinktime(
+    "scala.scalanative.meta.linktimeinfo.framePointersEnabled"
+  )
+  def framePointersEnabled: Boolean = resolved
+
   @resolvedAtLinktime(
     "scala.scalanative.meta.linktimeinfo.isWeakReferenceSupported"
   )
@@ -53,6 +58,11 @@ object LinktimeInfo {
       !is32BitPlatform &&
       (target.arch == "x86_64" || target.arch == "aarch64")
 
+  @resolvedAtLinktime(
+    "scala.scalanative.meta.linktimeinfo.isStackfulContinuations"
+  )
+  def isStackfulContinuations: Boolean = resolved
+
   @resolvedAtLinktime()
   def isVirtualThreadsSupported: Boolean =
     isMultithreadingEnabled && isContinuationsSupported
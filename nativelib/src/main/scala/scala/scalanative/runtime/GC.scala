@@ -50,6 +50,49 @@ object GC {
   @name("scalanative_GC_stats_collection_duration_total")
   def getStatsCollectionDurationTotal(): CSize = extern
 
+  /** Kinds of time-to-safepoint statistics */
+  object SafepointStatsKind {
+
+    /** Time until all threads reached safepoint in a stop-the-world event */
+    @alwaysinline final def Collection = 0
+
+    /** Time until each individual thread reached safepoint */
+    @alwaysinline final def Thread = 1
+  }
+
+  /** Copies at most `size` buckets of time-to-safepoint histogram of given
+   *  [[SafepointStatsKind]] to `buckets`. Bucket `i` counts samples within
+   *  `[2^i, 2^(i+1))` nanoseconds. Returns the total number of buckets. Only
+   *  Immix and Commix GCs gather these statistics.
+   */
+  @name("scalanative_GC_stats_safepoint_histogram")
+  def getStatsSafepointHistogram(
+      kind: CInt,
+      buckets: Ptr[CUnsignedLongLong],
+      size: CSize
+  ): CSize = extern
+
+  // The longest observed time-to-safepoint in nanos of given kind
+  @name("scalanative_GC_stats_safepoint_max_ns")
+  def getStatsSafepointMax(kind: CInt): CUnsignedLongLong = extern
+
+  // The total (cumulative) time-to-safepoint in nanos of given kind
+  @name("scalanative_GC_stats_safepoint_total_ns")
+  def getStatsSafepointTotal(kind: CInt): CUnsignedLongLong = extern
+
+  /** Copies at most `size` most recent samples of threads which reached the
+   *  safepoint later than `SCALANATIVE_GC_SAFEPOINT_SLOW_THRESHOLD_US`
+   *  microseconds after stop-the-world was requested: their time-to-safepoint
+   *  in nanos and the address of instruction at which they stopped. Returns
+   *  the number of copied samples.
+   */
+  @name("scalanative_GC_stats_safepoint_slow_threads")
+  def getStatsSafepointSlowThreads(
+      timesNanos: Ptr[CUnsignedLongLong],
+      instructionPointers: Ptr[CVoidPtr],
+      size: CSize
+  ): CSize = extern
+
   /*  Multithreading awareness for GC Every implementation of GC supported in
    *  ScalaNative needs to register a given thread The main thread is
    *  automatically registered. Every additional thread needs to explicitly
@@ -159,6 +202,26 @@ object GC {
   @name("scalanative_GC_remove_roots")
   def removeRoots(addressLow: CVoidPtr, addressHigh: CVoidPtr): Unit = extern
 
+  private[runtime] type HandshakeCallback = CFuncPtr1[CVoidPtr, Unit]
+
+  /** Identifier of the calling thread used by [[handshake]], supported only
+   *  by Immix and Commix GC
+   */
+  @name("scalanative_GC_current_thread_id")
+  private[runtime] def getCurrentThreadId(): CUnsignedLongLong = extern
+
+  /** Executes `callback` on the thread with given id at its next safepoint,
+   *  without stopping remaining threads. Supported only by Immix and Commix
+   *  GC, see [[ThreadHandshake]]
+   */
+  @name("scalanative_GC_handshake")
+  private[runtime] def handshake(
+      threadId: CUnsignedLongLong,
+      callback: HandshakeCallback,
+      arg: CVoidPtr,
+      await: Boolean
+  ): Boolean = extern
+
   @extern object Boehm {
     @name("scalanative_GC_weak_ref_slot_create")
     private[runtime] def weakRefSlotCreate(referent: RawPtr): RawPtr = extern
@@ -197,4 +197,87 @@ object Intrinsics {
 
   def multiplyHigh(x: scala.Long, y: scala.Long): scala.Long = intrinsic
   def unsignedMultiplyHigh(x: scala.Long, y: scala.Long): scala.Long = intrinsic
+
+  /** Intrinsified SIMD operations on raw vectors.
+   *
+   *  Each operation interprets the bits of raw vectors as lanes of the type
+   *  given by its `lane` argument, one of the `Lane*` constants. Lanes, and
+   *  the operation and comparison codes, must be given as literals, as well
+   *  as lane indices. Scalars are passed as longs, floating point values as
+   *  their raw bits. Operations are lowered to LLVM vector instructions,
+   *  which LLVM legalizes on targets without matching SIMD instructions.
+   */
+  object vector {
+    final val LaneByte = 0
+    final val LaneShort = 1
+    final val LaneInt = 2
+    final val LaneLong = 3
+    final val LaneFloat = 4
+    final val LaneDouble = 5
+
+    final val OpAdd = 0
+    final val OpSub = 1
+    final val OpMul = 2
+    final val OpDiv = 3 // Floating point lanes only
+    final val OpAnd = 4
+    final val OpOr = 5
+    final val OpXor = 6
+
+    final val CompEq = 0
+    final val CompNe = 1
+    final val CompLt = 2
+    final val CompLe = 3
+    final val CompGt = 4
+    final val CompGe = 5
+
+    def load128(lane: Int, ptr: RawPtr): RawVector128 = intrinsic
+    def load256(lane: Int, ptr: RawPtr): RawVector256 = intrinsic
+    def store(lane: Int, ptr: RawPtr, value: RawVector128): Unit = intrinsic
+    def store(lane: Int, ptr: RawPtr, value: RawVector256): Unit = intrinsic
+
+    def broadcast128(lane: Int, value: Long): RawVector128 = intrinsic
+    def broadcast256(lane: Int, value: Long): RawVector256 = intrinsic
+
+    def extract(lane: Int, value: RawVector128, index: Int): Long = intrinsic
+    def extract(lane: Int, value: RawVector256, index: Int): Long = intrinsic
+    def insert(
+        lane: Int,
+        value: RawVector128,
+        index: Int,
+        elem: Long
+    ): RawVector128 = intrinsic
+    def insert(
+        lane: Int,
+        value: RawVector256,
+        index: Int,
+        elem: Long
+    ): RawVector256 = intrinsic
+
+    def bin(
+        lane: Int,
+        op: Int,
+        l: RawVector128,
+        r: RawVector128
+    ): RawVector128 = intrinsic
+    def bin(
+        lane: Int,
+        op: Int,
+        l: RawVector256,
+        r: RawVector256
+    ): RawVector256 = intrinsic
+
+    /** Lanes of the result have all bits set where the comparison holds. */
+    def compare(
+        lane: Int,
+        comp: Int,
+        l: RawVector128,
+        r: RawVector128
+    ): RawVector128 = intrinsic
+    def compare(
+        lane: Int,
+        comp: Int,
+        l: RawVector256,
+        r: RawVector256
+    ): RawVector256 = intrinsic
+  }
 }
@@ -32,9 +32,16 @@ trait NativeThread {
     case _                => _state = newState
   }
 
+  /** Identifier of the thread used by the GC for thread-local handshakes, 0
+   *  until the thread is started
+   */
+  @volatile private[runtime] var gcThreadId: scala.Long = 0L
+
   if (isMainThread) {
     TLS.assignCurrentThread(thread, this)
     state = State.Running
+    gcThreadId = ThreadHandshake.currentThreadId()
+    NativeThread.mainNativeThread = this
   } else if (isMultithreadingEnabled) {
     Registry.add(this)
   }
@@ -124,6 +131,7 @@ private object ThreadStackSize {
 
 object NativeThread {
   private def MainThreadId = 0L
+  @volatile private[runtime] var mainNativeThread: NativeThread = _
 
   def calculateStackSize(
       userDefinedStackSize: Long,
@@ -221,6 +229,7 @@ object NativeThread {
       isMainThread = false
     )
     StackOverflowGuards.setup(isMainThread = false)
+    nativeThread.gcThreadId = ThreadHandshake.currentThreadId()
 
     nativeThread.state = State.Running
     atomic_thread_fence(memory_order_seq_cst)
@@ -0,0 +1,5 @@
+package scala.scalanative
+package runtime
+
+/** A SIMD vector of 128 bits, whose lanes are interpreted by operations. */
+final abstract class RawVector128
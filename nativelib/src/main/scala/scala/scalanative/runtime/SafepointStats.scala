@@ -0,0 +1,78 @@
+package scala.scalanative
+package runtime
+
+import scala.scalanative.unsafe._
+import scala.scalanative.unsigned._
+
+/** Time-to-safepoint statistics gathered by the garbage collector, allows to
+ *  find threads delaying stop-the-world events. See [[GC.SafepointStatsKind]]
+ *  for the meaning of histograms.
+ */
+object SafepointStats {
+
+  /** Thread which reached the safepoint later than the threshold configured
+   *  using `SCALANATIVE_GC_SAFEPOINT_SLOW_THRESHOLD_US`
+   */
+  final class SlowSafepoint(
+      val timeToSafepointNanos: Long,
+      val instructionPointer: Long
+  ) {
+
+    /** Function in which the thread reached the safepoint, null if unknown */
+    lazy val location: StackTraceElement =
+      if (instructionPointer == 0L) null
+      else StackTrace.symbolize(instructionPointer)
+
+    override def toString(): String =
+      s"SlowSafepoint(${timeToSafepointNanos}ns, at $location)"
+  }
+
+  private final val MaxBuckets = 64
+  private final val MaxSlowSafepoints = 64
+
+  /** Histogram of time until all threads reached safepoint in each
+   *  stop-the-world event. Bucket `i` counts events which took
+   *  `[2^i, 2^(i+1))` nanoseconds.
+   */
+  def collectionHistogram(): Array[Long] =
+    histogram(GC.SafepointStatsKind.Collection)
+
+  /** Histogram of time until each thread reached safepoint. Bucket `i` counts
+   *  threads which needed `[2^i, 2^(i+1))` nanoseconds.
+   */
+  def threadHistogram(): Array[Long] =
+    histogram(GC.SafepointStatsKind.Thread)
+
+  def maxCollectionNanos(): Long =
+    GC.getStatsSafepointMax(GC.SafepointStatsKind.Collection).toLong
+
+  def maxThreadNanos(): Long =
+    GC.getStatsSafepointMax(GC.SafepointStatsKind.Thread).toLong
+
+  /** Sum of times until all threads reached safepoint over all events */
+  def totalCollectionNanos(): Long =
+    GC.getStatsSafepointTotal(GC.SafepointStatsKind.Collection).toLong
+
+  /** Sum of times until each thread reached safepoint */
+  def totalThreadNanos(): Long =
+    GC.getStatsSafepointTotal(GC.SafepointStatsKind.Thread).toLong
+
+  /** Most recent threads which were slow to reach safepoint, newest first */
+  def slowSafepoints(): Array[SlowSafepoint] = {
+    val times = stackalloc[CUnsignedLongLong](MaxSlowSafepoints)
+    val ips = stackalloc[CVoidPtr](MaxSlowSafepoints)
+    val count = GC
+      .getStatsSafepointSlowThreads(times, ips, MaxSlowSafepoints.toCSize)
+      .toInt
+    Array.tabulate(count) { i =>
+      new SlowSafepoint(times(i).toLong, ips(i).toLong)
+    }
+  }
+
+  private def histogram(kind: CInt): Array[Long] = {
+    val buckets = stackalloc[CUnsignedLongLong](MaxBuckets)
+    val size =
+      GC.getStatsSafepointHistogram(kind, buckets, MaxBuckets.toCSize).toInt
+    Array.tabulate(size min MaxBuckets)(buckets(_).toLong)
+  }
+}
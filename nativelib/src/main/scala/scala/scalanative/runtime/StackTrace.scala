@@ -2,10 +2,11 @@ package scala.scalanative.runtime
 
 import java.util.Arrays
 
-import scala.collection.mutable
-
+import scala.scalanative.annotation.alwaysinline
 import scala.scalanative.meta.LinktimeInfo
 import scala.scalanative.meta.LinktimeInfo.isMultithreadingEnabled
+import scala.scalanative.runtime.ffi.stdatomic._
+import scala.scalanative.runtime.ffi.stdatomic.memory_order._
 import scala.scalanative.unsafe._
 import scala.scalanative.unsigned._
 
@@ -25,10 +26,7 @@ private[runtime] object StackTrace {
         unwind.get_reg(cursor, unwind.UNW_REG_IP, ip)
         val addr =
           Intrinsics.castRawSizeToLongUnsigned(Intrinsics.loadRawSize(ip))
-        tlContext.cache.getOrElseUpdate(
-          addr,
-          makeStackTraceElement(addr)
-        )
+        SymbolCache.getOrElseUpdate(addr, makeStackTraceElement(addr))
       }
     }
       .dropWhile { elem =>
@@ -38,6 +36,10 @@ private[runtime] object StackTrace {
   }
 
   private[runtime] type InstructionPointer = Long
+
+  // JVM limit stack trace to 1024 entries
+  private final val MaxFrames = 1024
+
   @noinline private[runtime] def currentRawStackTrace()
       : scala.Array[InstructionPointer] = {
     def emptyStackTrace = scala.Array.emptyLongArray
@@ -53,6 +55,11 @@ private[runtime] object StackTrace {
       return emptyStackTrace
 
     implicit val tlContext: Context = ThreadLocalContext.get()
+    if (useFramePointers) {
+      val captured = captureUsingFramePointers()
+      if (captured != null) return captured
+    }
+
     val context = tlContext.unwindContext
     if (unwind.get_context(context) < 0)
       return emptyStackTrace
@@ -67,9 +74,8 @@ private[runtime] object StackTrace {
       val buffer = scala.Array.newBuilder[Long]
       buffer.sizeHint(32) // at least
 
-      // JVM limit stack trace to 1024 entries
       var frames = 0
-      while (unwind.step(cursor) > 0 && frames < 1024) {
+      while (unwind.step(cursor) > 0 && frames < MaxFrames) {
         frames += 1
         if (unwind.get_reg(cursor, unwind.UNW_REG_IP, ip) == 0) {
           buffer += Intrinsics.castRawSizeToLongUnsigned(
@@ -83,6 +89,38 @@ private[runtime] object StackTrace {
     }
 
   }
+
+  @resolvedAtLinktime
+  private def useFramePointers: Boolean =
+    LinktimeInfo.framePointersEnabled && !LinktimeInfo.isWindows
+
+  /* Fast path used when the program is compiled with frame pointers, walks the
+   * chain of frame records without consulting DWARF CFI. Stacks of virtual
+   * threads are relocated when resumed without rebasing the saved frame
+   * pointers, so these are always handled by the unwinder.
+   * Returns null if frame pointers cannot be used in the current context.
+   */
+  @noinline private def captureUsingFramePointers()(implicit
+      tlContext: Context
+  ): scala.Array[InstructionPointer] = {
+    if (LinktimeInfo.isVirtualThreadsSupported &&
+        Thread.currentThread().isVirtual())
+      return null
+
+    val frames = tlContext.framesBuffer
+    val captured = unwind.capture_frame_pointers(frames, MaxFrames)
+    if (captured < 0) null
+    else if (captured == 0) scala.Array.emptyLongArray
+    else {
+      val result = new scala.Array[Long](captured)
+      ffi.memcpy(
+        result.asInstanceOf[LongArray].atRawUnsafe(0),
+        frames,
+        Intrinsics.castIntToRawSizeUnsigned(captured * 8)
+      )
+      result
+    }
+  }
   private[runtime] def materializeStackTrace(
       raw: scala.Array[Long]
   ): scala.Array[StackTraceElement] = {
@@ -103,10 +141,7 @@ private[runtime] object StackTrace {
        * current function is expensive, so we cache stack trace elements
        * based on current instruction pointer.
        */
-      val elem = tlContext.cache.getOrElseUpdate(
-        addr,
-        makeStackTraceElement(addr)
-      )
+      val elem = SymbolCache.getOrElseUpdate(addr, makeStackTraceElement(addr))
       buffer += elem
 
       // Stack trace cleanup
@@ -149,9 +184,8 @@ private[runtime] object StackTrace {
         return emptyStackTrace
       if (unwind.init_local(cursor, context) < 0)
         return emptyStackTrace
-      // JVM limit stack trace to 1024 entries
       var frames = 0
-      while (unwind.step(cursor) > 0 && frames < 1024) {
+      while (unwind.step(cursor) > 0 && frames < MaxFrames) {
         frames += 1
         if (unwind.get_reg(cursor, unwind.UNW_REG_IP, ip) == 0) {
           val addr =
@@ -160,10 +194,8 @@ private[runtime] object StackTrace {
            * current function is expensive, so we cache stack trace elements
            * based on current instruction pointer.
            */
-          val elem = tlContext.cache.getOrElseUpdate(
-            addr,
-            makeStackTraceElement(addr)
-          )
+          val elem =
+            SymbolCache.getOrElseUpdate(addr, makeStackTraceElement(addr))
           buffer += elem
 
           if (frames < 4) {
@@ -185,6 +217,12 @@ private[runtime] object StackTrace {
     }
   }
 
+  /** Resolves the stack trace element for given instruction pointer */
+  private[runtime] def symbolize(ip: InstructionPointer): StackTraceElement = {
+    implicit val tlContext: Context = ThreadLocalContext.get()
+    SymbolCache.getOrElseUpdate(ip, makeStackTraceElement(ip))
+  }
+
   @resolvedAtLinktime
   private def hasDebugInfo: Boolean =
     (LinktimeInfo.isMac || LinktimeInfo.isLinux) &&
@@ -275,16 +313,51 @@ private[runtime] object StackTrace {
     )
   }
 
-  private object ThreadLocalContext extends InheritableThreadLocal[Context] {
-    override protected def initialValue(): Context =
-      new Context(mutable.LongMap.empty, ByteArray.alloc(Context.DataSize))
+  /* Process-wide cache of stack trace elements indexed by the instruction
+   * pointer. It's direct-mapped: every address can reside only in a single
+   * slot and colliding insertions replace the previous entry. Thanks to that
+   * both lookups and updates are a single atomic load or store, without any
+   * locking, and the memory used by the cache is bounded.
+   */
+  private object SymbolCache {
+    private final val SizeBits = 13
+    private final val Size = 1 << SizeBits
+
+    private final class Entry(val ip: Long, val elem: StackTraceElement)
+    private val entries = new scala.Array[Entry](Size)
+
+    @alwaysinline private def slotOf(ip: Long): RawPtr = {
+      val hash = (ip ^ (ip >>> 17)) * 0x9e3779b97f4a7c15L
+      val idx = (hash >>> (64 - SizeBits)).toInt
+      entries.asInstanceOf[ObjectArray].atRawUnsafe(idx)
+    }
 
-    override def childValue(fromParent: Context): Context = {
-      val cache = mutable.LongMap.empty[StackTraceElement]
-      cache ++= fromParent.cache
-      new Context(cache, ByteArray.alloc(Context.DataSize))
+    def getOrElseUpdate(
+        ip: Long,
+        makeElement: => StackTraceElement
+    ): StackTraceElement = {
+      val slot = slotOf(ip)
+      val cached = Intrinsics
+        .castRawPtrToObject(atomic_load_intptr(slot, memory_order_acquire))
+        .asInstanceOf[Entry]
+      if (cached != null && cached.ip == ip) cached.elem
+      else {
+        val elem = makeElement
+        val entry = new Entry(ip, elem)
+        atomic_store_intptr(
+          slot,
+          Intrinsics.castObjectToRawPtr(entry),
+          memory_order_release
+        )
+        elem
+      }
     }
   }
+
+  private object ThreadLocalContext extends ThreadLocal[Context] {
+    override protected def initialValue(): Context =
+      new Context(ByteArray.alloc(Context.DataSize))
+  }
   private object Context {
     final val SymbolMaxLength = 512
     final val ClassNameMaxLength = 256
@@ -300,12 +373,12 @@ private[runtime] object StackTrace {
     final val UnwindCursorOffset = FileNameBufferOffset + FileNameMaxLength
     final val UnwindContextOffset = UnwindCursorOffset + unwind.sizeOfCursor
     final val IPOffset = UnwindContextOffset + unwind.sizeOfContext
-    final val DataSize = IPOffset + 8
+    final val FramesBufferOffset = IPOffset + 8
+    val DataSize =
+      if (useFramePointers) FramesBufferOffset + MaxFrames * 8
+      else FramesBufferOffset
   }
-  private class Context(
-      val cache: mutable.LongMap[StackTraceElement],
-      val data: ByteArray
-  ) {
+  private class Context(val data: ByteArray) {
     def freshAt(offset: Int, size: Int): Ptr[Byte] = {
       ffi.memset(
         data.atRawUnsafe(offset),
@@ -324,5 +397,6 @@ private[runtime] object StackTrace {
     def unwindCursor = data.atUnsafe(UnwindCursorOffset)
     def unwindContext = data.atUnsafe(UnwindContextOffset)
     def ip = data.atUnsafe(IPOffset).rawptr
+    def framesBuffer = data.atRawUnsafe(FramesBufferOffset)
   }
 }
@@ -0,0 +1,87 @@
+package scala.scalanative
+package runtime
+
+import scala.annotation.nowarn
+
+import scala.scalanative.meta.LinktimeInfo
+import scala.scalanative.runtime.Intrinsics._
+import scala.scalanative.unsafe._
+import scala.scalanative.unsigned._
+
+/** Thread-local handshakes allow to execute an action on a single running
+ *  thread at its next safepoint, without stopping the remaining threads. The
+ *  action is executed by the target thread itself, so it can inspect its
+ *  stack, thread-locals or other state owned by the thread, e.g. to sample
+ *  its stack trace.
+ *
+ *  Supported only by Immix and Commix GC when multithreading is enabled.
+ */
+object ThreadHandshake {
+
+  @resolvedAtLinktime
+  def isSupported: Boolean =
+    LinktimeInfo.isMultithreadingEnabled &&
+      (LinktimeInfo.gc.isImmix || LinktimeInfo.gc.isCommix)
+
+  /** Executes `action` on given platform `thread` once it reaches its next
+   *  safepoint and blocks until it finishes. Thread executing blocking foreign
+   *  code runs the action after returning from it. Exceptions thrown by the
+   *  action are rethrown in the calling thread.
+   *
+   *  @return
+   *    true if action was executed, false if the thread is not running,
+   *    terminated before reaching the safepoint, is a virtual thread, or
+   *    handshakes are not supported
+   */
+  def runOn(thread: Thread)(action: => Unit): Boolean = {
+    if (!isSupported) false
+    else if (thread eq Thread.currentThread()) {
+      action
+      true
+    } else
+      findNativeThread(thread) match {
+        case null => false
+        case nativeThread =>
+          val task = new Task(() => action)
+          val executed = GC.handshake(
+            threadId = nativeThread.gcThreadId.toULong,
+            callback = Task.callback,
+            arg = fromRawPtr(castObjectToRawPtr(task)),
+            await = true
+          )
+          // Keep task reachable while being executed by other thread
+          task.failure match {
+            case null => executed
+            case ex   => throw ex
+          }
+      }
+  }
+
+  private[runtime] def currentThreadId(): Long =
+    if (isSupported) GC.getCurrentThreadId().toLong
+    else 0L
+
+  @nowarn // Thread.getId is deprecated since JDK 19
+  private def findNativeThread(thread: Thread): NativeThread = {
+    val nativeThread = NativeThread.mainNativeThread match {
+      case main if main != null && (main.thread eq thread) => main
+      case _ => NativeThread.Registry.getById(thread.getId()).orNull
+    }
+    if (nativeThread == null || nativeThread.gcThreadId == 0L) null
+    else nativeThread
+  }
+
+  private class Task(action: () => Unit) {
+    var failure: Throwable = _
+    def run(): Unit =
+      try action()
+      catch { case ex: Throwable => failure = ex }
+  }
+
+  private object Task {
+    val callback: GC.HandshakeCallback = CFuncPtr1.fromScalaFunction {
+      (arg: CVoidPtr) =>
+        castRawPtrToObject(toRawPtr(arg)).asInstanceOf[Task].run()
+    }
+  }
+}
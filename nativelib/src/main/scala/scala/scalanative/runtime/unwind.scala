@@ -46,4 +46,10 @@ private[runtime] object unwind {
 
   @name("scalanative_unwind_sizeof_cursor")
   def sizeOfCursor: Int = extern
+
+  /** Capture return addresses by walking the chain of frame pointers. Returns
+   *  number of stored addresses or -1 if not supported in current context.
+   */
+  @name("scalanative_stackTrace_captureFramePointers")
+  def capture_frame_pointers(buffer: RawPtr, maxFrames: CInt): CInt = extern
 }
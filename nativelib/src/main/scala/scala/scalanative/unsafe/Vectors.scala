@@ -0,0 +1,1840 @@
+// format: off
+
+// BEWARE: This file is generated - direct edits will be lost.
+// Do not edit this it directly other than to remove
+// personally identifiable information in sourceLocation lines.
+// All direct edits to this file will be lost the next time it
+// is generated.
+//
+// See nativelib runtime/Arrays.scala.gyb for details.
+
+package scala.scalanative
+package unsafe
+
+import scala.annotation.switch
+
+import scalanative.annotation.alwaysinline
+import scalanative.runtime._
+import scalanative.runtime.Intrinsics._
+import scalanative.runtime.Intrinsics.vector._
+
+/** A 128-bit SIMD vector of 16 Byte lanes.
+ *
+ *  Lane-wise operations are compiled to vector instructions of the target,
+ *  or to equivalent scalar code when it has none. Comparisons return a mask
+ *  of integer lanes with all bits set where the comparison holds.
+ */
+final class ByteVector16 private[scalanative] (
+    private[scalanative] val raw: RawVector128
+) {
+  @alwaysinline def length: Int = 16
+
+  /** Loads the lane at `index`, throws IndexOutOfBoundsException. */
+  def apply(index: Int): Byte = {
+    @alwaysinline def lane(bits: Long): Byte = bits.toByte
+    (index: @switch) match {
+      case 0 => lane(extract(LaneByte, raw, 0))
+      case 1 => lane(extract(LaneByte, raw, 1))
+      case 2 => lane(extract(LaneByte, raw, 2))
+      case 3 => lane(extract(LaneByte, raw, 3))
+      case 4 => lane(extract(LaneByte, raw, 4))
+      case 5 => lane(extract(LaneByte, raw, 5))
+      case 6 => lane(extract(LaneByte, raw, 6))
+      case 7 => lane(extract(LaneByte, raw, 7))
+      case 8 => lane(extract(LaneByte, raw, 8))
+      case 9 => lane(extract(LaneByte, raw, 9))
+      case 10 => lane(extract(LaneByte, raw, 10))
+      case 11 => lane(extract(LaneByte, raw, 11))
+      case 12 => lane(extract(LaneByte, raw, 12))
+      case 13 => lane(extract(LaneByte, raw, 13))
+      case 14 => lane(extract(LaneByte, raw, 14))
+      case 15 => lane(extract(LaneByte, raw, 15))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  /** Returns a copy of this vector with the lane at `index` set to `x`. */
+  def updated(index: Int, x: Byte): ByteVector16 = {
+    val bits = x.toLong
+    (index: @switch) match {
+      case 0 => new ByteVector16(insert(LaneByte, raw, 0, bits))
+      case 1 => new ByteVector16(insert(LaneByte, raw, 1, bits))
+      case 2 => new ByteVector16(insert(LaneByte, raw, 2, bits))
+      case 3 => new ByteVector16(insert(LaneByte, raw, 3, bits))
+      case 4 => new ByteVector16(insert(LaneByte, raw, 4, bits))
+      case 5 => new ByteVector16(insert(LaneByte, raw, 5, bits))
+      case 6 => new ByteVector16(insert(LaneByte, raw, 6, bits))
+      case 7 => new ByteVector16(insert(LaneByte, raw, 7, bits))
+      case 8 => new ByteVector16(insert(LaneByte, raw, 8, bits))
+      case 9 => new ByteVector16(insert(LaneByte, raw, 9, bits))
+      case 10 => new ByteVector16(insert(LaneByte, raw, 10, bits))
+      case 11 => new ByteVector16(insert(LaneByte, raw, 11, bits))
+      case 12 => new ByteVector16(insert(LaneByte, raw, 12, bits))
+      case 13 => new ByteVector16(insert(LaneByte, raw, 13, bits))
+      case 14 => new ByteVector16(insert(LaneByte, raw, 14, bits))
+      case 15 => new ByteVector16(insert(LaneByte, raw, 15, bits))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  @alwaysinline def store(ptr: Ptr[Byte]): Unit =
+    vector.store(LaneByte, ptr.rawptr, raw)
+
+  /** Stores lanes to `array` starting at `index`. */
+  @alwaysinline def store(array: Array[Byte], index: Int): Unit = {
+    ByteVector16.checkRange(array.length, index)
+    vector.store(
+      LaneByte,
+      array.asInstanceOf[ByteArray].atRawUnsafe(index),
+      raw
+    )
+  }
+
+  @alwaysinline def +(that: ByteVector16): ByteVector16 =
+    new ByteVector16(bin(LaneByte, OpAdd, raw, that.raw))
+  @alwaysinline def -(that: ByteVector16): ByteVector16 =
+    new ByteVector16(bin(LaneByte, OpSub, raw, that.raw))
+  @alwaysinline def *(that: ByteVector16): ByteVector16 =
+    new ByteVector16(bin(LaneByte, OpMul, raw, that.raw))
+  @alwaysinline def &(that: ByteVector16): ByteVector16 =
+    new ByteVector16(bin(LaneByte, OpAnd, raw, that.raw))
+  @alwaysinline def |(that: ByteVector16): ByteVector16 =
+    new ByteVector16(bin(LaneByte, OpOr, raw, that.raw))
+  @alwaysinline def ^(that: ByteVector16): ByteVector16 =
+    new ByteVector16(bin(LaneByte, OpXor, raw, that.raw))
+  @alwaysinline def unary_- : ByteVector16 = ByteVector16.zero - this
+
+  @alwaysinline def ===(that: ByteVector16): ByteVector16 =
+    new ByteVector16(compare(LaneByte, CompEq, raw, that.raw))
+  @alwaysinline def =!=(that: ByteVector16): ByteVector16 =
+    new ByteVector16(compare(LaneByte, CompNe, raw, that.raw))
+  @alwaysinline def <(that: ByteVector16): ByteVector16 =
+    new ByteVector16(compare(LaneByte, CompLt, raw, that.raw))
+  @alwaysinline def <=(that: ByteVector16): ByteVector16 =
+    new ByteVector16(compare(LaneByte, CompLe, raw, that.raw))
+  @alwaysinline def >(that: ByteVector16): ByteVector16 =
+    new ByteVector16(compare(LaneByte, CompGt, raw, that.raw))
+  @alwaysinline def >=(that: ByteVector16): ByteVector16 =
+    new ByteVector16(compare(LaneByte, CompGe, raw, that.raw))
+
+  /** Takes lanes of `that` where `mask` is set and of this vector elsewhere. */
+  @alwaysinline def blend(that: ByteVector16, mask: ByteVector16): ByteVector16 = {
+    val diff = bin(LaneByte, OpXor, raw, that.raw)
+    new ByteVector16(bin(LaneByte, OpXor, raw, bin(LaneByte, OpAnd, diff, mask.raw)))
+  }
+
+  @alwaysinline def min(that: ByteVector16): ByteVector16 = blend(that, that < this)
+  @alwaysinline def max(that: ByteVector16): ByteVector16 = blend(that, that > this)
+
+  /** Sum of all lanes. */
+  @alwaysinline def sum: Byte =
+    (this(0) + this(1) + this(2) + this(3) + this(4) + this(5) + this(6) + this(7) + this(8) + this(9) + this(10) + this(11) + this(12) + this(13) + this(14) + this(15)).toByte
+
+  def toArray: Array[Byte] = {
+    val array = new Array[Byte](16)
+    store(array, 0)
+    array
+  }
+
+  override def equals(other: Any): Boolean = other match {
+    case other: ByteVector16 => java.util.Arrays.equals(toArray, other.toArray)
+    case _          => false
+  }
+
+  override def hashCode: Int = java.util.Arrays.hashCode(toArray)
+
+  override def toString: String = toArray.mkString("ByteVector16(", ", ", ")")
+}
+
+object ByteVector16 {
+  @alwaysinline def zero: ByteVector16 = new ByteVector16(broadcast128(LaneByte, 0L))
+
+  /** A vector with all lanes set to `x`. */
+  @alwaysinline def broadcast(x: Byte): ByteVector16 =
+    new ByteVector16(broadcast128(LaneByte, x.toLong))
+
+  @alwaysinline def load(ptr: Ptr[Byte]): ByteVector16 =
+    new ByteVector16(load128(LaneByte, ptr.rawptr))
+
+  /** Loads lanes from `array` starting at `index`. */
+  @alwaysinline def load(array: Array[Byte], index: Int): ByteVector16 = {
+    checkRange(array.length, index)
+    new ByteVector16(
+      load128(LaneByte, array.asInstanceOf[ByteArray].atRawUnsafe(index))
+    )
+  }
+
+  def apply(x0: Byte, x1: Byte, x2: Byte, x3: Byte, x4: Byte, x5: Byte, x6: Byte, x7: Byte, x8: Byte, x9: Byte, x10: Byte, x11: Byte, x12: Byte, x13: Byte, x14: Byte, x15: Byte): ByteVector16 = {
+    var result = zero
+    result = result.updated(0, x0)
+    result = result.updated(1, x1)
+    result = result.updated(2, x2)
+    result = result.updated(3, x3)
+    result = result.updated(4, x4)
+    result = result.updated(5, x5)
+    result = result.updated(6, x6)
+    result = result.updated(7, x7)
+    result = result.updated(8, x8)
+    result = result.updated(9, x9)
+    result = result.updated(10, x10)
+    result = result.updated(11, x11)
+    result = result.updated(12, x12)
+    result = result.updated(13, x13)
+    result = result.updated(14, x14)
+    result = result.updated(15, x15)
+    result
+  }
+
+  @alwaysinline private[unsafe] def checkRange(length: Int, index: Int): Unit =
+    if (index < 0 || index > length - 16)
+      throw new ArrayIndexOutOfBoundsException(
+        s"Range [$index, ${index + 16}) out of bounds for length $length"
+      )
+}
+
+/** A 128-bit SIMD vector of 8 Short lanes.
+ *
+ *  Lane-wise operations are compiled to vector instructions of the target,
+ *  or to equivalent scalar code when it has none. Comparisons return a mask
+ *  of integer lanes with all bits set where the comparison holds.
+ */
+final class ShortVector8 private[scalanative] (
+    private[scalanative] val raw: RawVector128
+) {
+  @alwaysinline def length: Int = 8
+
+  /** Loads the lane at `index`, throws IndexOutOfBoundsException. */
+  def apply(index: Int): Short = {
+    @alwaysinline def lane(bits: Long): Short = bits.toShort
+    (index: @switch) match {
+      case 0 => lane(extract(LaneShort, raw, 0))
+      case 1 => lane(extract(LaneShort, raw, 1))
+      case 2 => lane(extract(LaneShort, raw, 2))
+      case 3 => lane(extract(LaneShort, raw, 3))
+      case 4 => lane(extract(LaneShort, raw, 4))
+      case 5 => lane(extract(LaneShort, raw, 5))
+      case 6 => lane(extract(LaneShort, raw, 6))
+      case 7 => lane(extract(LaneShort, raw, 7))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  /** Returns a copy of this vector with the lane at `index` set to `x`. */
+  def updated(index: Int, x: Short): ShortVector8 = {
+    val bits = x.toLong
+    (index: @switch) match {
+      case 0 => new ShortVector8(insert(LaneShort, raw, 0, bits))
+      case 1 => new ShortVector8(insert(LaneShort, raw, 1, bits))
+      case 2 => new ShortVector8(insert(LaneShort, raw, 2, bits))
+      case 3 => new ShortVector8(insert(LaneShort, raw, 3, bits))
+      case 4 => new ShortVector8(insert(LaneShort, raw, 4, bits))
+      case 5 => new ShortVector8(insert(LaneShort, raw, 5, bits))
+      case 6 => new ShortVector8(insert(LaneShort, raw, 6, bits))
+      case 7 => new ShortVector8(insert(LaneShort, raw, 7, bits))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  @alwaysinline def store(ptr: Ptr[Short]): Unit =
+    vector.store(LaneShort, ptr.rawptr, raw)
+
+  /** Stores lanes to `array` starting at `index`. */
+  @alwaysinline def store(array: Array[Short], index: Int): Unit = {
+    ShortVector8.checkRange(array.length, index)
+    vector.store(
+      LaneShort,
+      array.asInstanceOf[ShortArray].atRawUnsafe(index),
+      raw
+    )
+  }
+
+  @alwaysinline def +(that: ShortVector8): ShortVector8 =
+    new ShortVector8(bin(LaneShort, OpAdd, raw, that.raw))
+  @alwaysinline def -(that: ShortVector8): ShortVector8 =
+    new ShortVector8(bin(LaneShort, OpSub, raw, that.raw))
+  @alwaysinline def *(that: ShortVector8): ShortVector8 =
+    new ShortVector8(bin(LaneShort, OpMul, raw, that.raw))
+  @alwaysinline def &(that: ShortVector8): ShortVector8 =
+    new ShortVector8(bin(LaneShort, OpAnd, raw, that.raw))
+  @alwaysinline def |(that: ShortVector8): ShortVector8 =
+    new ShortVector8(bin(LaneShort, OpOr, raw, that.raw))
+  @alwaysinline def ^(that: ShortVector8): ShortVector8 =
+    new ShortVector8(bin(LaneShort, OpXor, raw, that.raw))
+  @alwaysinline def unary_- : ShortVector8 = ShortVector8.zero - this
+
+  @alwaysinline def ===(that: ShortVector8): ShortVector8 =
+    new ShortVector8(compare(LaneShort, CompEq, raw, that.raw))
+  @alwaysinline def =!=(that: ShortVector8): ShortVector8 =
+    new ShortVector8(compare(LaneShort, CompNe, raw, that.raw))
+  @alwaysinline def <(that: ShortVector8): ShortVector8 =
+    new ShortVector8(compare(LaneShort, CompLt, raw, that.raw))
+  @alwaysinline def <=(that: ShortVector8): ShortVector8 =
+    new ShortVector8(compare(LaneShort, CompLe, raw, that.raw))
+  @alwaysinline def >(that: ShortVector8): ShortVector8 =
+    new ShortVector8(compare(LaneShort, CompGt, raw, that.raw))
+  @alwaysinline def >=(that: ShortVector8): ShortVector8 =
+    new ShortVector8(compare(LaneShort, CompGe, raw, that.raw))
+
+  /** Takes lanes of `that` where `mask` is set and of this vector elsewhere. */
+  @alwaysinline def blend(that: ShortVector8, mask: ShortVector8): ShortVector8 = {
+    val diff = bin(LaneShort, OpXor, raw, that.raw)
+    new ShortVector8(bin(LaneShort, OpXor, raw, bin(LaneShort, OpAnd, diff, mask.raw)))
+  }
+
+  @alwaysinline def min(that: ShortVector8): ShortVector8 = blend(that, that < this)
+  @alwaysinline def max(that: ShortVector8): ShortVector8 = blend(that, that > this)
+
+  /** Sum of all lanes. */
+  @alwaysinline def sum: Short =
+    (this(0) + this(1) + this(2) + this(3) + this(4) + this(5) + this(6) + this(7)).toShort
+
+  def toArray: Array[Short] = {
+    val array = new Array[Short](8)
+    store(array, 0)
+    array
+  }
+
+  override def equals(other: Any): Boolean = other match {
+    case other: ShortVector8 => java.util.Arrays.equals(toArray, other.toArray)
+    case _          => false
+  }
+
+  override def hashCode: Int = java.util.Arrays.hashCode(toArray)
+
+  override def toString: String = toArray.mkString("ShortVector8(", ", ", ")")
+}
+
+object ShortVector8 {
+  @alwaysinline def zero: ShortVector8 = new ShortVector8(broadcast128(LaneShort, 0L))
+
+  /** A vector with all lanes set to `x`. */
+  @alwaysinline def broadcast(x: Short): ShortVector8 =
+    new ShortVector8(broadcast128(LaneShort, x.toLong))
+
+  @alwaysinline def load(ptr: Ptr[Short]): ShortVector8 =
+    new ShortVector8(load128(LaneShort, ptr.rawptr))
+
+  /** Loads lanes from `array` starting at `index`. */
+  @alwaysinline def load(array: Array[Short], index: Int): ShortVector8 = {
+    checkRange(array.length, index)
+    new ShortVector8(
+      load128(LaneShort, array.asInstanceOf[ShortArray].atRawUnsafe(index))
+    )
+  }
+
+  def apply(x0: Short, x1: Short, x2: Short, x3: Short, x4: Short, x5: Short, x6: Short, x7: Short): ShortVector8 = {
+    var result = zero
+    result = result.updated(0, x0)
+    result = result.updated(1, x1)
+    result = result.updated(2, x2)
+    result = result.updated(3, x3)
+    result = result.updated(4, x4)
+    result = result.updated(5, x5)
+    result = result.updated(6, x6)
+    result = result.updated(7, x7)
+    result
+  }
+
+  @alwaysinline private[unsafe] def checkRange(length: Int, index: Int): Unit =
+    if (index < 0 || index > length - 8)
+      throw new ArrayIndexOutOfBoundsException(
+        s"Range [$index, ${index + 8}) out of bounds for length $length"
+      )
+}
+
+/** A 128-bit SIMD vector of 4 Int lanes.
+ *
+ *  Lane-wise operations are compiled to vector instructions of the target,
+ *  or to equivalent scalar code when it has none. Comparisons return a mask
+ *  of integer lanes with all bits set where the comparison holds.
+ */
+final class IntVector4 private[scalanative] (
+    private[scalanative] val raw: RawVector128
+) {
+  @alwaysinline def length: Int = 4
+
+  /** Loads the lane at `index`, throws IndexOutOfBoundsException. */
+  def apply(index: Int): Int = {
+    @alwaysinline def lane(bits: Long): Int = bits.toInt
+    (index: @switch) match {
+      case 0 => lane(extract(LaneInt, raw, 0))
+      case 1 => lane(extract(LaneInt, raw, 1))
+      case 2 => lane(extract(LaneInt, raw, 2))
+      case 3 => lane(extract(LaneInt, raw, 3))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  /** Returns a copy of this vector with the lane at `index` set to `x`. */
+  def updated(index: Int, x: Int): IntVector4 = {
+    val bits = x.toLong
+    (index: @switch) match {
+      case 0 => new IntVector4(insert(LaneInt, raw, 0, bits))
+      case 1 => new IntVector4(insert(LaneInt, raw, 1, bits))
+      case 2 => new IntVector4(insert(LaneInt, raw, 2, bits))
+      case 3 => new IntVector4(insert(LaneInt, raw, 3, bits))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  @alwaysinline def store(ptr: Ptr[Int]): Unit =
+    vector.store(LaneInt, ptr.rawptr, raw)
+
+  /** Stores lanes to `array` starting at `index`. */
+  @alwaysinline def store(array: Array[Int], index: Int): Unit = {
+    IntVector4.checkRange(array.length, index)
+    vector.store(
+      LaneInt,
+      array.asInstanceOf[IntArray].atRawUnsafe(index),
+      raw
+    )
+  }
+
+  @alwaysinline def +(that: IntVector4): IntVector4 =
+    new IntVector4(bin(LaneInt, OpAdd, raw, that.raw))
+  @alwaysinline def -(that: IntVector4): IntVector4 =
+    new IntVector4(bin(LaneInt, OpSub, raw, that.raw))
+  @alwaysinline def *(that: IntVector4): IntVector4 =
+    new IntVector4(bin(LaneInt, OpMul, raw, that.raw))
+  @alwaysinline def &(that: IntVector4): IntVector4 =
+    new IntVector4(bin(LaneInt, OpAnd, raw, that.raw))
+  @alwaysinline def |(that: IntVector4): IntVector4 =
+    new IntVector4(bin(LaneInt, OpOr, raw, that.raw))
+  @alwaysinline def ^(that: IntVector4): IntVector4 =
+    new IntVector4(bin(LaneInt, OpXor, raw, that.raw))
+  @alwaysinline def unary_- : IntVector4 = IntVector4.zero - this
+
+  @alwaysinline def ===(that: IntVector4): IntVector4 =
+    new IntVector4(compare(LaneInt, CompEq, raw, that.raw))
+  @alwaysinline def =!=(that: IntVector4): IntVector4 =
+    new IntVector4(compare(LaneInt, CompNe, raw, that.raw))
+  @alwaysinline def <(that: IntVector4): IntVector4 =
+    new IntVector4(compare(LaneInt, CompLt, raw, that.raw))
+  @alwaysinline def <=(that: IntVector4): IntVector4 =
+    new IntVector4(compare(LaneInt, CompLe, raw, that.raw))
+  @alwaysinline def >(that: IntVector4): IntVector4 =
+    new IntVector4(compare(LaneInt, CompGt, raw, that.raw))
+  @alwaysinline def >=(that: IntVector4): IntVector4 =
+    new IntVector4(compare(LaneInt, CompGe, raw, that.raw))
+
+  /** Takes lanes of `that` where `mask` is set and of this vector elsewhere. */
+  @alwaysinline def blend(that: IntVector4, mask: IntVector4): IntVector4 = {
+    val diff = bin(LaneInt, OpXor, raw, that.raw)
+    new IntVector4(bin(LaneInt, OpXor, raw, bin(LaneInt, OpAnd, diff, mask.raw)))
+  }
+
+  @alwaysinline def min(that: IntVector4): IntVector4 = blend(that, that < this)
+  @alwaysinline def max(that: IntVector4): IntVector4 = blend(that, that > this)
+
+  /** Sum of all lanes. */
+  @alwaysinline def sum: Int =
+    (this(0) + this(1) + this(2) + this(3)).toInt
+
+  def toArray: Array[Int] = {
+    val array = new Array[Int](4)
+    store(array, 0)
+    array
+  }
+
+  override def equals(other: Any): Boolean = other match {
+    case other: IntVector4 => java.util.Arrays.equals(toArray, other.toArray)
+    case _          => false
+  }
+
+  override def hashCode: Int = java.util.Arrays.hashCode(toArray)
+
+  override def toString: String = toArray.mkString("IntVector4(", ", ", ")")
+}
+
+object IntVector4 {
+  @alwaysinline def zero: IntVector4 = new IntVector4(broadcast128(LaneInt, 0L))
+
+  /** A vector with all lanes set to `x`. */
+  @alwaysinline def broadcast(x: Int): IntVector4 =
+    new IntVector4(broadcast128(LaneInt, x.toLong))
+
+  @alwaysinline def load(ptr: Ptr[Int]): IntVector4 =
+    new IntVector4(load128(LaneInt, ptr.rawptr))
+
+  /** Loads lanes from `array` starting at `index`. */
+  @alwaysinline def load(array: Array[Int], index: Int): IntVector4 = {
+    checkRange(array.length, index)
+    new IntVector4(
+      load128(LaneInt, array.asInstanceOf[IntArray].atRawUnsafe(index))
+    )
+  }
+
+  def apply(x0: Int, x1: Int, x2: Int, x3: Int): IntVector4 = {
+    var result = zero
+    result = result.updated(0, x0)
+    result = result.updated(1, x1)
+    result = result.updated(2, x2)
+    result = result.updated(3, x3)
+    result
+  }
+
+  @alwaysinline private[unsafe] def checkRange(length: Int, index: Int): Unit =
+    if (index < 0 || index > length - 4)
+      throw new ArrayIndexOutOfBoundsException(
+        s"Range [$index, ${index + 4}) out of bounds for length $length"
+      )
+}
+
+/** A 128-bit SIMD vector of 2 Long lanes.
+ *
+ *  Lane-wise operations are compiled to vector instructions of the target,
+ *  or to equivalent scalar code when it has none. Comparisons return a mask
+ *  of integer lanes with all bits set where the comparison holds.
+ */
+final class LongVector2 private[scalanative] (
+    private[scalanative] val raw: RawVector128
+) {
+  @alwaysinline def length: Int = 2
+
+  /** Loads the lane at `index`, throws IndexOutOfBoundsException. */
+  def apply(index: Int): Long = {
+    @alwaysinline def lane(bits: Long): Long = bits
+    (index: @switch) match {
+      case 0 => lane(extract(LaneLong, raw, 0))
+      case 1 => lane(extract(LaneLong, raw, 1))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  /** Returns a copy of this vector with the lane at `index` set to `x`. */
+  def updated(index: Int, x: Long): LongVector2 = {
+    val bits = x
+    (index: @switch) match {
+      case 0 => new LongVector2(insert(LaneLong, raw, 0, bits))
+      case 1 => new LongVector2(insert(LaneLong, raw, 1, bits))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  @alwaysinline def store(ptr: Ptr[Long]): Unit =
+    vector.store(LaneLong, ptr.rawptr, raw)
+
+  /** Stores lanes to `array` starting at `index`. */
+  @alwaysinline def store(array: Array[Long], index: Int): Unit = {
+    LongVector2.checkRange(array.length, index)
+    vector.store(
+      LaneLong,
+      array.asInstanceOf[LongArray].atRawUnsafe(index),
+      raw
+    )
+  }
+
+  @alwaysinline def +(that: LongVector2): LongVector2 =
+    new LongVector2(bin(LaneLong, OpAdd, raw, that.raw))
+  @alwaysinline def -(that: LongVector2): LongVector2 =
+    new LongVector2(bin(LaneLong, OpSub, raw, that.raw))
+  @alwaysinline def *(that: LongVector2): LongVector2 =
+    new LongVector2(bin(LaneLong, OpMul, raw, that.raw))
+  @alwaysinline def &(that: LongVector2): LongVector2 =
+    new LongVector2(bin(LaneLong, OpAnd, raw, that.raw))
+  @alwaysinline def |(that: LongVector2): LongVector2 =
+    new LongVector2(bin(LaneLong, OpOr, raw, that.raw))
+  @alwaysinline def ^(that: LongVector2): LongVector2 =
+    new LongVector2(bin(LaneLong, OpXor, raw, that.raw))
+  @alwaysinline def unary_- : LongVector2 = LongVector2.zero - this
+
+  @alwaysinline def ===(that: LongVector2): LongVector2 =
+    new LongVector2(compare(LaneLong, CompEq, raw, that.raw))
+  @alwaysinline def =!=(that: LongVector2): LongVector2 =
+    new LongVector2(compare(LaneLong, CompNe, raw, that.raw))
+  @alwaysinline def <(that: LongVector2): LongVector2 =
+    new LongVector2(compare(LaneLong, CompLt, raw, that.raw))
+  @alwaysinline def <=(that: LongVector2): LongVector2 =
+    new LongVector2(compare(LaneLong, CompLe, raw, that.raw))
+  @alwaysinline def >(that: LongVector2): LongVector2 =
+    new LongVector2(compare(LaneLong, CompGt, raw, that.raw))
+  @alwaysinline def >=(that: LongVector2): LongVector2 =
+    new LongVector2(compare(LaneLong, CompGe, raw, that.raw))
+
+  /** Takes lanes of `that` where `mask` is set and of this vector elsewhere. */
+  @alwaysinline def blend(that: LongVector2, mask: LongVector2): LongVector2 = {
+    val diff = bin(LaneLong, OpXor, raw, that.raw)
+    new LongVector2(bin(LaneLong, OpXor, raw, bin(LaneLong, OpAnd, diff, mask.raw)))
+  }
+
+  @alwaysinline def min(that: LongVector2): LongVector2 = blend(that, that < this)
+  @alwaysinline def max(that: LongVector2): LongVector2 = blend(that, that > this)
+
+  /** Sum of all lanes. */
+  @alwaysinline def sum: Long =
+    (this(0) + this(1)).toLong
+
+  def toArray: Array[Long] = {
+    val array = new Array[Long](2)
+    store(array, 0)
+    array
+  }
+
+  override def equals(other: Any): Boolean = other match {
+    case other: LongVector2 => java.util.Arrays.equals(toArray, other.toArray)
+    case _          => false
+  }
+
+  override def hashCode: Int = java.util.Arrays.hashCode(toArray)
+
+  override def toString: String = toArray.mkString("LongVector2(", ", ", ")")
+}
+
+object LongVector2 {
+  @alwaysinline def zero: LongVector2 = new LongVector2(broadcast128(LaneLong, 0L))
+
+  /** A vector with all lanes set to `x`. */
+  @alwaysinline def broadcast(x: Long): LongVector2 =
+    new LongVector2(broadcast128(LaneLong, x))
+
+  @alwaysinline def load(ptr: Ptr[Long]): LongVector2 =
+    new LongVector2(load128(LaneLong, ptr.rawptr))
+
+  /** Loads lanes from `array` starting at `index`. */
+  @alwaysinline def load(array: Array[Long], index: Int): LongVector2 = {
+    checkRange(array.length, index)
+    new LongVector2(
+      load128(LaneLong, array.asInstanceOf[LongArray].atRawUnsafe(index))
+    )
+  }
+
+  def apply(x0: Long, x1: Long): LongVector2 = {
+    var result = zero
+    result = result.updated(0, x0)
+    result = result.updated(1, x1)
+    result
+  }
+
+  @alwaysinline private[unsafe] def checkRange(length: Int, index: Int): Unit =
+    if (index < 0 || index > length - 2)
+      throw new ArrayIndexOutOfBoundsException(
+        s"Range [$index, ${index + 2}) out of bounds for length $length"
+      )
+}
+
+/** A 128-bit SIMD vector of 4 Float lanes.
+ *
+ *  Lane-wise operations are compiled to vector instructions of the target,
+ *  or to equivalent scalar code when it has none. Comparisons return a mask
+ *  of integer lanes with all bits set where the comparison holds.
+ */
+final class FloatVector4 private[scalanative] (
+    private[scalanative] val raw: RawVector128
+) {
+  @alwaysinline def length: Int = 4
+
+  /** Loads the lane at `index`, throws IndexOutOfBoundsException. */
+  def apply(index: Int): Float = {
+    @alwaysinline def lane(bits: Long): Float = java.lang.Float.intBitsToFloat(bits.toInt)
+    (index: @switch) match {
+      case 0 => lane(extract(LaneFloat, raw, 0))
+      case 1 => lane(extract(LaneFloat, raw, 1))
+      case 2 => lane(extract(LaneFloat, raw, 2))
+      case 3 => lane(extract(LaneFloat, raw, 3))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  /** Returns a copy of this vector with the lane at `index` set to `x`. */
+  def updated(index: Int, x: Float): FloatVector4 = {
+    val bits = java.lang.Float.floatToRawIntBits(x).toLong
+    (index: @switch) match {
+      case 0 => new FloatVector4(insert(LaneFloat, raw, 0, bits))
+      case 1 => new FloatVector4(insert(LaneFloat, raw, 1, bits))
+      case 2 => new FloatVector4(insert(LaneFloat, raw, 2, bits))
+      case 3 => new FloatVector4(insert(LaneFloat, raw, 3, bits))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  @alwaysinline def store(ptr: Ptr[Float]): Unit =
+    vector.store(LaneFloat, ptr.rawptr, raw)
+
+  /** Stores lanes to `array` starting at `index`. */
+  @alwaysinline def store(array: Array[Float], index: Int): Unit = {
+    FloatVector4.checkRange(array.length, index)
+    vector.store(
+      LaneFloat,
+      array.asInstanceOf[FloatArray].atRawUnsafe(index),
+      raw
+    )
+  }
+
+  @alwaysinline def +(that: FloatVector4): FloatVector4 =
+    new FloatVector4(bin(LaneFloat, OpAdd, raw, that.raw))
+  @alwaysinline def -(that: FloatVector4): FloatVector4 =
+    new FloatVector4(bin(LaneFloat, OpSub, raw, that.raw))
+  @alwaysinline def *(that: FloatVector4): FloatVector4 =
+    new FloatVector4(bin(LaneFloat, OpMul, raw, that.raw))
+  @alwaysinline def /(that: FloatVector4): FloatVector4 =
+    new FloatVector4(bin(LaneFloat, OpDiv, raw, that.raw))
+  @alwaysinline def unary_- : FloatVector4 = this * FloatVector4.broadcast(-1)
+
+  @alwaysinline def ===(that: FloatVector4): IntVector4 =
+    new IntVector4(compare(LaneFloat, CompEq, raw, that.raw))
+  @alwaysinline def =!=(that: FloatVector4): IntVector4 =
+    new IntVector4(compare(LaneFloat, CompNe, raw, that.raw))
+  @alwaysinline def <(that: FloatVector4): IntVector4 =
+    new IntVector4(compare(LaneFloat, CompLt, raw, that.raw))
+  @alwaysinline def <=(that: FloatVector4): IntVector4 =
+    new IntVector4(compare(LaneFloat, CompLe, raw, that.raw))
+  @alwaysinline def >(that: FloatVector4): IntVector4 =
+    new IntVector4(compare(LaneFloat, CompGt, raw, that.raw))
+  @alwaysinline def >=(that: FloatVector4): IntVector4 =
+    new IntVector4(compare(LaneFloat, CompGe, raw, that.raw))
+
+  /** Takes lanes of `that` where `mask` is set and of this vector elsewhere. */
+  @alwaysinline def blend(that: FloatVector4, mask: IntVector4): FloatVector4 = {
+    val diff = bin(LaneFloat, OpXor, raw, that.raw)
+    new FloatVector4(bin(LaneFloat, OpXor, raw, bin(LaneFloat, OpAnd, diff, mask.raw)))
+  }
+
+  @alwaysinline def min(that: FloatVector4): FloatVector4 = blend(that, that < this)
+  @alwaysinline def max(that: FloatVector4): FloatVector4 = blend(that, that > this)
+
+  /** Sum of all lanes. */
+  @alwaysinline def sum: Float =
+    (this(0) + this(1) + this(2) + this(3)).toFloat
+
+  def toArray: Array[Float] = {
+    val array = new Array[Float](4)
+    store(array, 0)
+    array
+  }
+
+  override def equals(other: Any): Boolean = other match {
+    case other: FloatVector4 => java.util.Arrays.equals(toArray, other.toArray)
+    case _          => false
+  }
+
+  override def hashCode: Int = java.util.Arrays.hashCode(toArray)
+
+  override def toString: String = toArray.mkString("FloatVector4(", ", ", ")")
+}
+
+object FloatVector4 {
+  @alwaysinline def zero: FloatVector4 = new FloatVector4(broadcast128(LaneFloat, 0L))
+
+  /** A vector with all lanes set to `x`. */
+  @alwaysinline def broadcast(x: Float): FloatVector4 =
+    new FloatVector4(broadcast128(LaneFloat, java.lang.Float.floatToRawIntBits(x).toLong))
+
+  @alwaysinline def load(ptr: Ptr[Float]): FloatVector4 =
+    new FloatVector4(load128(LaneFloat, ptr.rawptr))
+
+  /** Loads lanes from `array` starting at `index`. */
+  @alwaysinline def load(array: Array[Float], index: Int): FloatVector4 = {
+    checkRange(array.length, index)
+    new FloatVector4(
+      load128(LaneFloat, array.asInstanceOf[FloatArray].atRawUnsafe(index))
+    )
+  }
+
+  def apply(x0: Float, x1: Float, x2: Float, x3: Float): FloatVector4 = {
+    var result = zero
+    result = result.updated(0, x0)
+    result = result.updated(1, x1)
+    result = result.updated(2, x2)
+    result = result.updated(3, x3)
+    result
+  }
+
+  @alwaysinline private[unsafe] def checkRange(length: Int, index: Int): Unit =
+    if (index < 0 || index > length - 4)
+      throw new ArrayIndexOutOfBoundsException(
+        s"Range [$index, ${index + 4}) out of bounds for length $length"
+      )
+}
+
+/** A 128-bit SIMD vector of 2 Double lanes.
+ *
+ *  Lane-wise operations are compiled to vector instructions of the target,
+ *  or to equivalent scalar code when it has none. Comparisons return a mask
+ *  of integer lanes with all bits set where the comparison holds.
+ */
+final class DoubleVector2 private[scalanative] (
+    private[scalanative] val raw: RawVector128
+) {
+  @alwaysinline def length: Int = 2
+
+  /** Loads the lane at `index`, throws IndexOutOfBoundsException. */
+  def apply(index: Int): Double = {
+    @alwaysinline def lane(bits: Long): Double = java.lang.Double.longBitsToDouble(bits)
+    (index: @switch) match {
+      case 0 => lane(extract(LaneDouble, raw, 0))
+      case 1 => lane(extract(LaneDouble, raw, 1))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  /** Returns a copy of this vector with the lane at `index` set to `x`. */
+  def updated(index: Int, x: Double): DoubleVector2 = {
+    val bits = java.lang.Double.doubleToRawLongBits(x)
+    (index: @switch) match {
+      case 0 => new DoubleVector2(insert(LaneDouble, raw, 0, bits))
+      case 1 => new DoubleVector2(insert(LaneDouble, raw, 1, bits))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  @alwaysinline def store(ptr: Ptr[Double]): Unit =
+    vector.store(LaneDouble, ptr.rawptr, raw)
+
+  /** Stores lanes to `array` starting at `index`. */
+  @alwaysinline def store(array: Array[Double], index: Int): Unit = {
+    DoubleVector2.checkRange(array.length, index)
+    vector.store(
+      LaneDouble,
+      array.asInstanceOf[DoubleArray].atRawUnsafe(index),
+      raw
+    )
+  }
+
+  @alwaysinline def +(that: DoubleVector2): DoubleVector2 =
+    new DoubleVector2(bin(LaneDouble, OpAdd, raw, that.raw))
+  @alwaysinline def -(that: DoubleVector2): DoubleVector2 =
+    new DoubleVector2(bin(LaneDouble, OpSub, raw, that.raw))
+  @alwaysinline def *(that: DoubleVector2): DoubleVector2 =
+    new DoubleVector2(bin(LaneDouble, OpMul, raw, that.raw))
+  @alwaysinline def /(that: DoubleVector2): DoubleVector2 =
+    new DoubleVector2(bin(LaneDouble, OpDiv, raw, that.raw))
+  @alwaysinline def unary_- : DoubleVector2 = this * DoubleVector2.broadcast(-1)
+
+  @alwaysinline def ===(that: DoubleVector2): LongVector2 =
+    new LongVector2(compare(LaneDouble, CompEq, raw, that.raw))
+  @alwaysinline def =!=(that: DoubleVector2): LongVector2 =
+    new LongVector2(compare(LaneDouble, CompNe, raw, that.raw))
+  @alwaysinline def <(that: DoubleVector2): LongVector2 =
+    new LongVector2(compare(LaneDouble, CompLt, raw, that.raw))
+  @alwaysinline def <=(that: DoubleVector2): LongVector2 =
+    new LongVector2(compare(LaneDouble, CompLe, raw, that.raw))
+  @alwaysinline def >(that: DoubleVector2): LongVector2 =
+    new LongVector2(compare(LaneDouble, CompGt, raw, that.raw))
+  @alwaysinline def >=(that: DoubleVector2): LongVector2 =
+    new LongVector2(compare(LaneDouble, CompGe, raw, that.raw))
+
+  /** Takes lanes of `that` where `mask` is set and of this vector elsewhere. */
+  @alwaysinline def blend(that: DoubleVector2, mask: LongVector2): DoubleVector2 = {
+    val diff = bin(LaneDouble, OpXor, raw, that.raw)
+    new DoubleVector2(bin(LaneDouble, OpXor, raw, bin(LaneDouble, OpAnd, diff, mask.raw)))
+  }
+
+  @alwaysinline def min(that: DoubleVector2): DoubleVector2 = blend(that, that < this)
+  @alwaysinline def max(that: DoubleVector2): DoubleVector2 = blend(that, that > this)
+
+  /** Sum of all lanes. */
+  @alwaysinline def sum: Double =
+    (this(0) + this(1)).toDouble
+
+  def toArray: Array[Double] = {
+    val array = new Array[Double](2)
+    store(array, 0)
+    array
+  }
+
+  override def equals(other: Any): Boolean = other match {
+    case other: DoubleVector2 => java.util.Arrays.equals(toArray, other.toArray)
+    case _          => false
+  }
+
+  override def hashCode: Int = java.util.Arrays.hashCode(toArray)
+
+  override def toString: String = toArray.mkString("DoubleVector2(", ", ", ")")
+}
+
+object DoubleVector2 {
+  @alwaysinline def zero: DoubleVector2 = new DoubleVector2(broadcast128(LaneDouble, 0L))
+
+  /** A vector with all lanes set to `x`. */
+  @alwaysinline def broadcast(x: Double): DoubleVector2 =
+    new DoubleVector2(broadcast128(LaneDouble, java.lang.Double.doubleToRawLongBits(x)))
+
+  @alwaysinline def load(ptr: Ptr[Double]): DoubleVector2 =
+    new DoubleVector2(load128(LaneDouble, ptr.rawptr))
+
+  /** Loads lanes from `array` starting at `index`. */
+  @alwaysinline def load(array: Array[Double], index: Int): DoubleVector2 = {
+    checkRange(array.length, index)
+    new DoubleVector2(
+      load128(LaneDouble, array.asInstanceOf[DoubleArray].atRawUnsafe(index))
+    )
+  }
+
+  def apply(x0: Double, x1: Double): DoubleVector2 = {
+    var result = zero
+    result = result.updated(0, x0)
+    result = result.updated(1, x1)
+    result
+  }
+
+  @alwaysinline private[unsafe] def checkRange(length: Int, index: Int): Unit =
+    if (index < 0 || index > length - 2)
+      throw new ArrayIndexOutOfBoundsException(
+        s"Range [$index, ${index + 2}) out of bounds for length $length"
+      )
+}
+
+/** A 256-bit SIMD vector of 32 Byte lanes.
+ *
+ *  Lane-wise operations are compiled to vector instructions of the target,
+ *  or to equivalent scalar code when it has none. Comparisons return a mask
+ *  of integer lanes with all bits set where the comparison holds.
+ */
+final class ByteVector32 private[scalanative] (
+    private[scalanative] val raw: RawVector256
+) {
+  @alwaysinline def length: Int = 32
+
+  /** Loads the lane at `index`, throws IndexOutOfBoundsException. */
+  def apply(index: Int): Byte = {
+    @alwaysinline def lane(bits: Long): Byte = bits.toByte
+    (index: @switch) match {
+      case 0 => lane(extract(LaneByte, raw, 0))
+      case 1 => lane(extract(LaneByte, raw, 1))
+      case 2 => lane(extract(LaneByte, raw, 2))
+      case 3 => lane(extract(LaneByte, raw, 3))
+      case 4 => lane(extract(LaneByte, raw, 4))
+      case 5 => lane(extract(LaneByte, raw, 5))
+      case 6 => lane(extract(LaneByte, raw, 6))
+      case 7 => lane(extract(LaneByte, raw, 7))
+      case 8 => lane(extract(LaneByte, raw, 8))
+      case 9 => lane(extract(LaneByte, raw, 9))
+      case 10 => lane(extract(LaneByte, raw, 10))
+      case 11 => lane(extract(LaneByte, raw, 11))
+      case 12 => lane(extract(LaneByte, raw, 12))
+      case 13 => lane(extract(LaneByte, raw, 13))
+      case 14 => lane(extract(LaneByte, raw, 14))
+      case 15 => lane(extract(LaneByte, raw, 15))
+      case 16 => lane(extract(LaneByte, raw, 16))
+      case 17 => lane(extract(LaneByte, raw, 17))
+      case 18 => lane(extract(LaneByte, raw, 18))
+      case 19 => lane(extract(LaneByte, raw, 19))
+      case 20 => lane(extract(LaneByte, raw, 20))
+      case 21 => lane(extract(LaneByte, raw, 21))
+      case 22 => lane(extract(LaneByte, raw, 22))
+      case 23 => lane(extract(LaneByte, raw, 23))
+      case 24 => lane(extract(LaneByte, raw, 24))
+      case 25 => lane(extract(LaneByte, raw, 25))
+      case 26 => lane(extract(LaneByte, raw, 26))
+      case 27 => lane(extract(LaneByte, raw, 27))
+      case 28 => lane(extract(LaneByte, raw, 28))
+      case 29 => lane(extract(LaneByte, raw, 29))
+      case 30 => lane(extract(LaneByte, raw, 30))
+      case 31 => lane(extract(LaneByte, raw, 31))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  /** Returns a copy of this vector with the lane at `index` set to `x`. */
+  def updated(index: Int, x: Byte): ByteVector32 = {
+    val bits = x.toLong
+    (index: @switch) match {
+      case 0 => new ByteVector32(insert(LaneByte, raw, 0, bits))
+      case 1 => new ByteVector32(insert(LaneByte, raw, 1, bits))
+      case 2 => new ByteVector32(insert(LaneByte, raw, 2, bits))
+      case 3 => new ByteVector32(insert(LaneByte, raw, 3, bits))
+      case 4 => new ByteVector32(insert(LaneByte, raw, 4, bits))
+      case 5 => new ByteVector32(insert(LaneByte, raw, 5, bits))
+      case 6 => new ByteVector32(insert(LaneByte, raw, 6, bits))
+      case 7 => new ByteVector32(insert(LaneByte, raw, 7, bits))
+      case 8 => new ByteVector32(insert(LaneByte, raw, 8, bits))
+      case 9 => new ByteVector32(insert(LaneByte, raw, 9, bits))
+      case 10 => new ByteVector32(insert(LaneByte, raw, 10, bits))
+      case 11 => new ByteVector32(insert(LaneByte, raw, 11, bits))
+      case 12 => new ByteVector32(insert(LaneByte, raw, 12, bits))
+      case 13 => new ByteVector32(insert(LaneByte, raw, 13, bits))
+      case 14 => new ByteVector32(insert(LaneByte, raw, 14, bits))
+      case 15 => new ByteVector32(insert(LaneByte, raw, 15, bits))
+      case 16 => new ByteVector32(insert(LaneByte, raw, 16, bits))
+      case 17 => new ByteVector32(insert(LaneByte, raw, 17, bits))
+      case 18 => new ByteVector32(insert(LaneByte, raw, 18, bits))
+      case 19 => new ByteVector32(insert(LaneByte, raw, 19, bits))
+      case 20 => new ByteVector32(insert(LaneByte, raw, 20, bits))
+      case 21 => new ByteVector32(insert(LaneByte, raw, 21, bits))
+      case 22 => new ByteVector32(insert(LaneByte, raw, 22, bits))
+      case 23 => new ByteVector32(insert(LaneByte, raw, 23, bits))
+      case 24 => new ByteVector32(insert(LaneByte, raw, 24, bits))
+      case 25 => new ByteVector32(insert(LaneByte, raw, 25, bits))
+      case 26 => new ByteVector32(insert(LaneByte, raw, 26, bits))
+      case 27 => new ByteVector32(insert(LaneByte, raw, 27, bits))
+      case 28 => new ByteVector32(insert(LaneByte, raw, 28, bits))
+      case 29 => new ByteVector32(insert(LaneByte, raw, 29, bits))
+      case 30 => new ByteVector32(insert(LaneByte, raw, 30, bits))
+      case 31 => new ByteVector32(insert(LaneByte, raw, 31, bits))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  @alwaysinline def store(ptr: Ptr[Byte]): Unit =
+    vector.store(LaneByte, ptr.rawptr, raw)
+
+  /** Stores lanes to `array` starting at `index`. */
+  @alwaysinline def store(array: Array[Byte], index: Int): Unit = {
+    ByteVector32.checkRange(array.length, index)
+    vector.store(
+      LaneByte,
+      array.asInstanceOf[ByteArray].atRawUnsafe(index),
+      raw
+    )
+  }
+
+  @alwaysinline def +(that: ByteVector32): ByteVector32 =
+    new ByteVector32(bin(LaneByte, OpAdd, raw, that.raw))
+  @alwaysinline def -(that: ByteVector32): ByteVector32 =
+    new ByteVector32(bin(LaneByte, OpSub, raw, that.raw))
+  @alwaysinline def *(that: ByteVector32): ByteVector32 =
+    new ByteVector32(bin(LaneByte, OpMul, raw, that.raw))
+  @alwaysinline def &(that: ByteVector32): ByteVector32 =
+    new ByteVector32(bin(LaneByte, OpAnd, raw, that.raw))
+  @alwaysinline def |(that: ByteVector32): ByteVector32 =
+    new ByteVector32(bin(LaneByte, OpOr, raw, that.raw))
+  @alwaysinline def ^(that: ByteVector32): ByteVector32 =
+    new ByteVector32(bin(LaneByte, OpXor, raw, that.raw))
+  @alwaysinline def unary_- : ByteVector32 = ByteVector32.zero - this
+
+  @alwaysinline def ===(that: ByteVector32): ByteVector32 =
+    new ByteVector32(compare(LaneByte, CompEq, raw, that.raw))
+  @alwaysinline def =!=(that: ByteVector32): ByteVector32 =
+    new ByteVector32(compare(LaneByte, CompNe, raw, that.raw))
+  @alwaysinline def <(that: ByteVector32): ByteVector32 =
+    new ByteVector32(compare(LaneByte, CompLt, raw, that.raw))
+  @alwaysinline def <=(that: ByteVector32): ByteVector32 =
+    new ByteVector32(compare(LaneByte, CompLe, raw, that.raw))
+  @alwaysinline def >(that: ByteVector32): ByteVector32 =
+    new ByteVector32(compare(LaneByte, CompGt, raw, that.raw))
+  @alwaysinline def >=(that: ByteVector32): ByteVector32 =
+    new ByteVector32(compare(LaneByte, CompGe, raw, that.raw))
+
+  /** Takes lanes of `that` where `mask` is set and of this vector elsewhere. */
+  @alwaysinline def blend(that: ByteVector32, mask: ByteVector32): ByteVector32 = {
+    val diff = bin(LaneByte, OpXor, raw, that.raw)
+    new ByteVector32(bin(LaneByte, OpXor, raw, bin(LaneByte, OpAnd, diff, mask.raw)))
+  }
+
+  @alwaysinline def min(that: ByteVector32): ByteVector32 = blend(that, that < this)
+  @alwaysinline def max(that: ByteVector32): ByteVector32 = blend(that, that > this)
+
+  /** Sum of all lanes. */
+  @alwaysinline def sum: Byte =
+    (this(0) + this(1) + this(2) + this(3) + this(4) + this(5) + this(6) + this(7) + this(8) + this(9) + this(10) + this(11) + this(12) + this(13) + this(14) + this(15) + this(16) + this(17) + this(18) + this(19) + this(20) + this(21) + this(22) + this(23) + this(24) + this(25) + this(26) + this(27) + this(28) + this(29) + this(30) + this(31)).toByte
+
+  def toArray: Array[Byte] = {
+    val array = new Array[Byte](32)
+    store(array, 0)
+    array
+  }
+
+  override def equals(other: Any): Boolean = other match {
+    case other: ByteVector32 => java.util.Arrays.equals(toArray, other.toArray)
+    case _          => false
+  }
+
+  override def hashCode: Int = java.util.Arrays.hashCode(toArray)
+
+  override def toString: String = toArray.mkString("ByteVector32(", ", ", ")")
+}
+
+object ByteVector32 {
+  @alwaysinline def zero: ByteVector32 = new ByteVector32(broadcast256(LaneByte, 0L))
+
+  /** A vector with all lanes set to `x`. */
+  @alwaysinline def broadcast(x: Byte): ByteVector32 =
+    new ByteVector32(broadcast256(LaneByte, x.toLong))
+
+  @alwaysinline def load(ptr: Ptr[Byte]): ByteVector32 =
+    new ByteVector32(load256(LaneByte, ptr.rawptr))
+
+  /** Loads lanes from `array` starting at `index`. */
+  @alwaysinline def load(array: Array[Byte], index: Int): ByteVector32 = {
+    checkRange(array.length, index)
+    new ByteVector32(
+      load256(LaneByte, array.asInstanceOf[ByteArray].atRawUnsafe(index))
+    )
+  }
+
+  def apply(x0: Byte, x1: Byte, x2: Byte, x3: Byte, x4: Byte, x5: Byte, x6: Byte, x7: Byte, x8: Byte, x9: Byte, x10: Byte, x11: Byte, x12: Byte, x13: Byte, x14: Byte, x15: Byte, x16: Byte, x17: Byte, x18: Byte, x19: Byte, x20: Byte, x21: Byte, x22: Byte, x23: Byte, x24: Byte, x25: Byte, x26: Byte, x27: Byte, x28: Byte, x29: Byte, x30: Byte, x31: Byte): ByteVector32 = {
+    var result = zero
+    result = result.updated(0, x0)
+    result = result.updated(1, x1)
+    result = result.updated(2, x2)
+    result = result.updated(3, x3)
+    result = result.updated(4, x4)
+    result = result.updated(5, x5)
+    result = result.updated(6, x6)
+    result = result.updated(7, x7)
+    result = result.updated(8, x8)
+    result = result.updated(9, x9)
+    result = result.updated(10, x10)
+    result = result.updated(11, x11)
+    result = result.updated(12, x12)
+    result = result.updated(13, x13)
+    result = result.updated(14, x14)
+    result = result.updated(15, x15)
+    result = result.updated(16, x16)
+    result = result.updated(17, x17)
+    result = result.updated(18, x18)
+    result = result.updated(19, x19)
+    result = result.updated(20, x20)
+    result = result.updated(21, x21)
+    result = result.updated(22, x22)
+    result = result.updated(23, x23)
+    result = result.updated(24, x24)
+    result = result.updated(25, x25)
+    result = result.updated(26, x26)
+    result = result.updated(27, x27)
+    result = result.updated(28, x28)
+    result = result.updated(29, x29)
+    result = result.updated(30, x30)
+    result = result.updated(31, x31)
+    result
+  }
+
+  @alwaysinline private[unsafe] def checkRange(length: Int, index: Int): Unit =
+    if (index < 0 || index > length - 32)
+      throw new ArrayIndexOutOfBoundsException(
+        s"Range [$index, ${index + 32}) out of bounds for length $length"
+      )
+}
+
+/** A 256-bit SIMD vector of 16 Short lanes.
+ *
+ *  Lane-wise operations are compiled to vector instructions of the target,
+ *  or to equivalent scalar code when it has none. Comparisons return a mask
+ *  of integer lanes with all bits set where the comparison holds.
+ */
+final class ShortVector16 private[scalanative] (
+    private[scalanative] val raw: RawVector256
+) {
+  @alwaysinline def length: Int = 16
+
+  /** Loads the lane at `index`, throws IndexOutOfBoundsException. */
+  def apply(index: Int): Short = {
+    @alwaysinline def lane(bits: Long): Short = bits.toShort
+    (index: @switch) match {
+      case 0 => lane(extract(LaneShort, raw, 0))
+      case 1 => lane(extract(LaneShort, raw, 1))
+      case 2 => lane(extract(LaneShort, raw, 2))
+      case 3 => lane(extract(LaneShort, raw, 3))
+      case 4 => lane(extract(LaneShort, raw, 4))
+      case 5 => lane(extract(LaneShort, raw, 5))
+      case 6 => lane(extract(LaneShort, raw, 6))
+      case 7 => lane(extract(LaneShort, raw, 7))
+      case 8 => lane(extract(LaneShort, raw, 8))
+      case 9 => lane(extract(LaneShort, raw, 9))
+      case 10 => lane(extract(LaneShort, raw, 10))
+      case 11 => lane(extract(LaneShort, raw, 11))
+      case 12 => lane(extract(LaneShort, raw, 12))
+      case 13 => lane(extract(LaneShort, raw, 13))
+      case 14 => lane(extract(LaneShort, raw, 14))
+      case 15 => lane(extract(LaneShort, raw, 15))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  /** Returns a copy of this vector with the lane at `index` set to `x`. */
+  def updated(index: Int, x: Short): ShortVector16 = {
+    val bits = x.toLong
+    (index: @switch) match {
+      case 0 => new ShortVector16(insert(LaneShort, raw, 0, bits))
+      case 1 => new ShortVector16(insert(LaneShort, raw, 1, bits))
+      case 2 => new ShortVector16(insert(LaneShort, raw, 2, bits))
+      case 3 => new ShortVector16(insert(LaneShort, raw, 3, bits))
+      case 4 => new ShortVector16(insert(LaneShort, raw, 4, bits))
+      case 5 => new ShortVector16(insert(LaneShort, raw, 5, bits))
+      case 6 => new ShortVector16(insert(LaneShort, raw, 6, bits))
+      case 7 => new ShortVector16(insert(LaneShort, raw, 7, bits))
+      case 8 => new ShortVector16(insert(LaneShort, raw, 8, bits))
+      case 9 => new ShortVector16(insert(LaneShort, raw, 9, bits))
+      case 10 => new ShortVector16(insert(LaneShort, raw, 10, bits))
+      case 11 => new ShortVector16(insert(LaneShort, raw, 11, bits))
+      case 12 => new ShortVector16(insert(LaneShort, raw, 12, bits))
+      case 13 => new ShortVector16(insert(LaneShort, raw, 13, bits))
+      case 14 => new ShortVector16(insert(LaneShort, raw, 14, bits))
+      case 15 => new ShortVector16(insert(LaneShort, raw, 15, bits))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  @alwaysinline def store(ptr: Ptr[Short]): Unit =
+    vector.store(LaneShort, ptr.rawptr, raw)
+
+  /** Stores lanes to `array` starting at `index`. */
+  @alwaysinline def store(array: Array[Short], index: Int): Unit = {
+    ShortVector16.checkRange(array.length, index)
+    vector.store(
+      LaneShort,
+      array.asInstanceOf[ShortArray].atRawUnsafe(index),
+      raw
+    )
+  }
+
+  @alwaysinline def +(that: ShortVector16): ShortVector16 =
+    new ShortVector16(bin(LaneShort, OpAdd, raw, that.raw))
+  @alwaysinline def -(that: ShortVector16): ShortVector16 =
+    new ShortVector16(bin(LaneShort, OpSub, raw, that.raw))
+  @alwaysinline def *(that: ShortVector16): ShortVector16 =
+    new ShortVector16(bin(LaneShort, OpMul, raw, that.raw))
+  @alwaysinline def &(that: ShortVector16): ShortVector16 =
+    new ShortVector16(bin(LaneShort, OpAnd, raw, that.raw))
+  @alwaysinline def |(that: ShortVector16): ShortVector16 =
+    new ShortVector16(bin(LaneShort, OpOr, raw, that.raw))
+  @alwaysinline def ^(that: ShortVector16): ShortVector16 =
+    new ShortVector16(bin(LaneShort, OpXor, raw, that.raw))
+  @alwaysinline def unary_- : ShortVector16 = ShortVector16.zero - this
+
+  @alwaysinline def ===(that: ShortVector16): ShortVector16 =
+    new ShortVector16(compare(LaneShort, CompEq, raw, that.raw))
+  @alwaysinline def =!=(that: ShortVector16): ShortVector16 =
+    new ShortVector16(compare(LaneShort, CompNe, raw, that.raw))
+  @alwaysinline def <(that: ShortVector16): ShortVector16 =
+    new ShortVector16(compare(LaneShort, CompLt, raw, that.raw))
+  @alwaysinline def <=(that: ShortVector16): ShortVector16 =
+    new ShortVector16(compare(LaneShort, CompLe, raw, that.raw))
+  @alwaysinline def >(that: ShortVector16): ShortVector16 =
+    new ShortVector16(compare(LaneShort, CompGt, raw, that.raw))
+  @alwaysinline def >=(that: ShortVector16): ShortVector16 =
+    new ShortVector16(compare(LaneShort, CompGe, raw, that.raw))
+
+  /** Takes lanes of `that` where `mask` is set and of this vector elsewhere. */
+  @alwaysinline def blend(that: ShortVector16, mask: ShortVector16): ShortVector16 = {
+    val diff = bin(LaneShort, OpXor, raw, that.raw)
+    new ShortVector16(bin(LaneShort, OpXor, raw, bin(LaneShort, OpAnd, diff, mask.raw)))
+  }
+
+  @alwaysinline def min(that: ShortVector16): ShortVector16 = blend(that, that < this)
+  @alwaysinline def max(that: ShortVector16): ShortVector16 = blend(that, that > this)
+
+  /** Sum of all lanes. */
+  @alwaysinline def sum: Short =
+    (this(0) + this(1) + this(2) + this(3) + this(4) + this(5) + this(6) + this(7) + this(8) + this(9) + this(10) + this(11) + this(12) + this(13) + this(14) + this(15)).toShort
+
+  def toArray: Array[Short] = {
+    val array = new Array[Short](16)
+    store(array, 0)
+    array
+  }
+
+  override def equals(other: Any): Boolean = other match {
+    case other: ShortVector16 => java.util.Arrays.equals(toArray, other.toArray)
+    case _          => false
+  }
+
+  override def hashCode: Int = java.util.Arrays.hashCode(toArray)
+
+  override def toString: String = toArray.mkString("ShortVector16(", ", ", ")")
+}
+
+object ShortVector16 {
+  @alwaysinline def zero: ShortVector16 = new ShortVector16(broadcast256(LaneShort, 0L))
+
+  /** A vector with all lanes set to `x`. */
+  @alwaysinline def broadcast(x: Short): ShortVector16 =
+    new ShortVector16(broadcast256(LaneShort, x.toLong))
+
+  @alwaysinline def load(ptr: Ptr[Short]): ShortVector16 =
+    new ShortVector16(load256(LaneShort, ptr.rawptr))
+
+  /** Loads lanes from `array` starting at `index`. */
+  @alwaysinline def load(array: Array[Short], index: Int): ShortVector16 = {
+    checkRange(array.length, index)
+    new ShortVector16(
+      load256(LaneShort, array.asInstanceOf[ShortArray].atRawUnsafe(index))
+    )
+  }
+
+  def apply(x0: Short, x1: Short, x2: Short, x3: Short, x4: Short, x5: Short, x6: Short, x7: Short, x8: Short, x9: Short, x10: Short, x11: Short, x12: Short, x13: Short, x14: Short, x15: Short): ShortVector16 = {
+    var result = zero
+    result = result.updated(0, x0)
+    result = result.updated(1, x1)
+    result = result.updated(2, x2)
+    result = result.updated(3, x3)
+    result = result.updated(4, x4)
+    result = result.updated(5, x5)
+    result = result.updated(6, x6)
+    result = result.updated(7, x7)
+    result = result.updated(8, x8)
+    result = result.updated(9, x9)
+    result = result.updated(10, x10)
+    result = result.updated(11, x11)
+    result = result.updated(12, x12)
+    result = result.updated(13, x13)
+    result = result.updated(14, x14)
+    result = result.updated(15, x15)
+    result
+  }
+
+  @alwaysinline private[unsafe] def checkRange(length: Int, index: Int): Unit =
+    if (index < 0 || index > length - 16)
+      throw new ArrayIndexOutOfBoundsException(
+        s"Range [$index, ${index + 16}) out of bounds for length $length"
+      )
+}
+
+/** A 256-bit SIMD vector of 8 Int lanes.
+ *
+ *  Lane-wise operations are compiled to vector instructions of the target,
+ *  or to equivalent scalar code when it has none. Comparisons return a mask
+ *  of integer lanes with all bits set where the comparison holds.
+ */
+final class IntVector8 private[scalanative] (
+    private[scalanative] val raw: RawVector256
+) {
+  @alwaysinline def length: Int = 8
+
+  /** Loads the lane at `index`, throws IndexOutOfBoundsException. */
+  def apply(index: Int): Int = {
+    @alwaysinline def lane(bits: Long): Int = bits.toInt
+    (index: @switch) match {
+      case 0 => lane(extract(LaneInt, raw, 0))
+      case 1 => lane(extract(LaneInt, raw, 1))
+      case 2 => lane(extract(LaneInt, raw, 2))
+      case 3 => lane(extract(LaneInt, raw, 3))
+      case 4 => lane(extract(LaneInt, raw, 4))
+      case 5 => lane(extract(LaneInt, raw, 5))
+      case 6 => lane(extract(LaneInt, raw, 6))
+      case 7 => lane(extract(LaneInt, raw, 7))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  /** Returns a copy of this vector with the lane at `index` set to `x`. */
+  def updated(index: Int, x: Int): IntVector8 = {
+    val bits = x.toLong
+    (index: @switch) match {
+      case 0 => new IntVector8(insert(LaneInt, raw, 0, bits))
+      case 1 => new IntVector8(insert(LaneInt, raw, 1, bits))
+      case 2 => new IntVector8(insert(LaneInt, raw, 2, bits))
+      case 3 => new IntVector8(insert(LaneInt, raw, 3, bits))
+      case 4 => new IntVector8(insert(LaneInt, raw, 4, bits))
+      case 5 => new IntVector8(insert(LaneInt, raw, 5, bits))
+      case 6 => new IntVector8(insert(LaneInt, raw, 6, bits))
+      case 7 => new IntVector8(insert(LaneInt, raw, 7, bits))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  @alwaysinline def store(ptr: Ptr[Int]): Unit =
+    vector.store(LaneInt, ptr.rawptr, raw)
+
+  /** Stores lanes to `array` starting at `index`. */
+  @alwaysinline def store(array: Array[Int], index: Int): Unit = {
+    IntVector8.checkRange(array.length, index)
+    vector.store(
+      LaneInt,
+      array.asInstanceOf[IntArray].atRawUnsafe(index),
+      raw
+    )
+  }
+
+  @alwaysinline def +(that: IntVector8): IntVector8 =
+    new IntVector8(bin(LaneInt, OpAdd, raw, that.raw))
+  @alwaysinline def -(that: IntVector8): IntVector8 =
+    new IntVector8(bin(LaneInt, OpSub, raw, that.raw))
+  @alwaysinline def *(that: IntVector8): IntVector8 =
+    new IntVector8(bin(LaneInt, OpMul, raw, that.raw))
+  @alwaysinline def &(that: IntVector8): IntVector8 =
+    new IntVector8(bin(LaneInt, OpAnd, raw, that.raw))
+  @alwaysinline def |(that: IntVector8): IntVector8 =
+    new IntVector8(bin(LaneInt, OpOr, raw, that.raw))
+  @alwaysinline def ^(that: IntVector8): IntVector8 =
+    new IntVector8(bin(LaneInt, OpXor, raw, that.raw))
+  @alwaysinline def unary_- : IntVector8 = IntVector8.zero - this
+
+  @alwaysinline def ===(that: IntVector8): IntVector8 =
+    new IntVector8(compare(LaneInt, CompEq, raw, that.raw))
+  @alwaysinline def =!=(that: IntVector8): IntVector8 =
+    new IntVector8(compare(LaneInt, CompNe, raw, that.raw))
+  @alwaysinline def <(that: IntVector8): IntVector8 =
+    new IntVector8(compare(LaneInt, CompLt, raw, that.raw))
+  @alwaysinline def <=(that: IntVector8): IntVector8 =
+    new IntVector8(compare(LaneInt, CompLe, raw, that.raw))
+  @alwaysinline def >(that: IntVector8): IntVector8 =
+    new IntVector8(compare(LaneInt, CompGt, raw, that.raw))
+  @alwaysinline def >=(that: IntVector8): IntVector8 =
+    new IntVector8(compare(LaneInt, CompGe, raw, that.raw))
+
+  /** Takes lanes of `that` where `mask` is set and of this vector elsewhere. */
+  @alwaysinline def blend(that: IntVector8, mask: IntVector8): IntVector8 = {
+    val diff = bin(LaneInt, OpXor, raw, that.raw)
+    new IntVector8(bin(LaneInt, OpXor, raw, bin(LaneInt, OpAnd, diff, mask.raw)))
+  }
+
+  @alwaysinline def min(that: IntVector8): IntVector8 = blend(that, that < this)
+  @alwaysinline def max(that: IntVector8): IntVector8 = blend(that, that > this)
+
+  /** Sum of all lanes. */
+  @alwaysinline def sum: Int =
+    (this(0) + this(1) + this(2) + this(3) + this(4) + this(5) + this(6) + this(7)).toInt
+
+  def toArray: Array[Int] = {
+    val array = new Array[Int](8)
+    store(array, 0)
+    array
+  }
+
+  override def equals(other: Any): Boolean = other match {
+    case other: IntVector8 => java.util.Arrays.equals(toArray, other.toArray)
+    case _          => false
+  }
+
+  override def hashCode: Int = java.util.Arrays.hashCode(toArray)
+
+  override def toString: String = toArray.mkString("IntVector8(", ", ", ")")
+}
+
+object IntVector8 {
+  @alwaysinline def zero: IntVector8 = new IntVector8(broadcast256(LaneInt, 0L))
+
+  /** A vector with all lanes set to `x`. */
+  @alwaysinline def broadcast(x: Int): IntVector8 =
+    new IntVector8(broadcast256(LaneInt, x.toLong))
+
+  @alwaysinline def load(ptr: Ptr[Int]): IntVector8 =
+    new IntVector8(load256(LaneInt, ptr.rawptr))
+
+  /** Loads lanes from `array` starting at `index`. */
+  @alwaysinline def load(array: Array[Int], index: Int): IntVector8 = {
+    checkRange(array.length, index)
+    new IntVector8(
+      load256(LaneInt, array.asInstanceOf[IntArray].atRawUnsafe(index))
+    )
+  }
+
+  def apply(x0: Int, x1: Int, x2: Int, x3: Int, x4: Int, x5: Int, x6: Int, x7: Int): IntVector8 = {
+    var result = zero
+    result = result.updated(0, x0)
+    result = result.updated(1, x1)
+    result = result.updated(2, x2)
+    result = result.updated(3, x3)
+    result = result.updated(4, x4)
+    result = result.updated(5, x5)
+    result = result.updated(6, x6)
+    result = result.updated(7, x7)
+    result
+  }
+
+  @alwaysinline private[unsafe] def checkRange(length: Int, index: Int): Unit =
+    if (index < 0 || index > length - 8)
+      throw new ArrayIndexOutOfBoundsException(
+        s"Range [$index, ${index + 8}) out of bounds for length $length"
+      )
+}
+
+/** A 256-bit SIMD vector of 4 Long lanes.
+ *
+ *  Lane-wise operations are compiled to vector instructions of the target,
+ *  or to equivalent scalar code when it has none. Comparisons return a mask
+ *  of integer lanes with all bits set where the comparison holds.
+ */
+final class LongVector4 private[scalanative] (
+    private[scalanative] val raw: RawVector256
+) {
+  @alwaysinline def length: Int = 4
+
+  /** Loads the lane at `index`, throws IndexOutOfBoundsException. */
+  def apply(index: Int): Long = {
+    @alwaysinline def lane(bits: Long): Long = bits
+    (index: @switch) match {
+      case 0 => lane(extract(LaneLong, raw, 0))
+      case 1 => lane(extract(LaneLong, raw, 1))
+      case 2 => lane(extract(LaneLong, raw, 2))
+      case 3 => lane(extract(LaneLong, raw, 3))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  /** Returns a copy of this vector with the lane at `index` set to `x`. */
+  def updated(index: Int, x: Long): LongVector4 = {
+    val bits = x
+    (index: @switch) match {
+      case 0 => new LongVector4(insert(LaneLong, raw, 0, bits))
+      case 1 => new LongVector4(insert(LaneLong, raw, 1, bits))
+      case 2 => new LongVector4(insert(LaneLong, raw, 2, bits))
+      case 3 => new LongVector4(insert(LaneLong, raw, 3, bits))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  @alwaysinline def store(ptr: Ptr[Long]): Unit =
+    vector.store(LaneLong, ptr.rawptr, raw)
+
+  /** Stores lanes to `array` starting at `index`. */
+  @alwaysinline def store(array: Array[Long], index: Int): Unit = {
+    LongVector4.checkRange(array.length, index)
+    vector.store(
+      LaneLong,
+      array.asInstanceOf[LongArray].atRawUnsafe(index),
+      raw
+    )
+  }
+
+  @alwaysinline def +(that: LongVector4): LongVector4 =
+    new LongVector4(bin(LaneLong, OpAdd, raw, that.raw))
+  @alwaysinline def -(that: LongVector4): LongVector4 =
+    new LongVector4(bin(LaneLong, OpSub, raw, that.raw))
+  @alwaysinline def *(that: LongVector4): LongVector4 =
+    new LongVector4(bin(LaneLong, OpMul, raw, that.raw))
+  @alwaysinline def &(that: LongVector4): LongVector4 =
+    new LongVector4(bin(LaneLong, OpAnd, raw, that.raw))
+  @alwaysinline def |(that: LongVector4): LongVector4 =
+    new LongVector4(bin(LaneLong, OpOr, raw, that.raw))
+  @alwaysinline def ^(that: LongVector4): LongVector4 =
+    new LongVector4(bin(LaneLong, OpXor, raw, that.raw))
+  @alwaysinline def unary_- : LongVector4 = LongVector4.zero - this
+
+  @alwaysinline def ===(that: LongVector4): LongVector4 =
+    new LongVector4(compare(LaneLong, CompEq, raw, that.raw))
+  @alwaysinline def =!=(that: LongVector4): LongVector4 =
+    new LongVector4(compare(LaneLong, CompNe, raw, that.raw))
+  @alwaysinline def <(that: LongVector4): LongVector4 =
+    new LongVector4(compare(LaneLong, CompLt, raw, that.raw))
+  @alwaysinline def <=(that: LongVector4): LongVector4 =
+    new LongVector4(compare(LaneLong, CompLe, raw, that.raw))
+  @alwaysinline def >(that: LongVector4): LongVector4 =
+    new LongVector4(compare(LaneLong, CompGt, raw, that.raw))
+  @alwaysinline def >=(that: LongVector4): LongVector4 =
+    new LongVector4(compare(LaneLong, CompGe, raw, that.raw))
+
+  /** Takes lanes of `that` where `mask` is set and of this vector elsewhere. */
+  @alwaysinline def blend(that: LongVector4, mask: LongVector4): LongVector4 = {
+    val diff = bin(LaneLong, OpXor, raw, that.raw)
+    new LongVector4(bin(LaneLong, OpXor, raw, bin(LaneLong, OpAnd, diff, mask.raw)))
+  }
+
+  @alwaysinline def min(that: LongVector4): LongVector4 = blend(that, that < this)
+  @alwaysinline def max(that: LongVector4): LongVector4 = blend(that, that > this)
+
+  /** Sum of all lanes. */
+  @alwaysinline def sum: Long =
+    (this(0) + this(1) + this(2) + this(3)).toLong
+
+  def toArray: Array[Long] = {
+    val array = new Array[Long](4)
+    store(array, 0)
+    array
+  }
+
+  override def equals(other: Any): Boolean = other match {
+    case other: LongVector4 => java.util.Arrays.equals(toArray, other.toArray)
+    case _          => false
+  }
+
+  override def hashCode: Int = java.util.Arrays.hashCode(toArray)
+
+  override def toString: String = toArray.mkString("LongVector4(", ", ", ")")
+}
+
+object LongVector4 {
+  @alwaysinline def zero: LongVector4 = new LongVector4(broadcast256(LaneLong, 0L))
+
+  /** A vector with all lanes set to `x`. */
+  @alwaysinline def broadcast(x: Long): LongVector4 =
+    new LongVector4(broadcast256(LaneLong, x))
+
+  @alwaysinline def load(ptr: Ptr[Long]): LongVector4 =
+    new LongVector4(load256(LaneLong, ptr.rawptr))
+
+  /** Loads lanes from `array` starting at `index`. */
+  @alwaysinline def load(array: Array[Long], index: Int): LongVector4 = {
+    checkRange(array.length, index)
+    new LongVector4(
+      load256(LaneLong, array.asInstanceOf[LongArray].atRawUnsafe(index))
+    )
+  }
+
+  def apply(x0: Long, x1: Long, x2: Long, x3: Long): LongVector4 = {
+    var result = zero
+    result = result.updated(0, x0)
+    result = result.updated(1, x1)
+    result = result.updated(2, x2)
+    result = result.updated(3, x3)
+    result
+  }
+
+  @alwaysinline private[unsafe] def checkRange(length: Int, index: Int): Unit =
+    if (index < 0 || index > length - 4)
+      throw new ArrayIndexOutOfBoundsException(
+        s"Range [$index, ${index + 4}) out of bounds for length $length"
+      )
+}
+
+/** A 256-bit SIMD vector of 8 Float lanes.
+ *
+ *  Lane-wise operations are compiled to vector instructions of the target,
+ *  or to equivalent scalar code when it has none. Comparisons return a mask
+ *  of integer lanes with all bits set where the comparison holds.
+ */
+final class FloatVector8 private[scalanative] (
+    private[scalanative] val raw: RawVector256
+) {
+  @alwaysinline def length: Int = 8
+
+  /** Loads the lane at `index`, throws IndexOutOfBoundsException. */
+  def apply(index: Int): Float = {
+    @alwaysinline def lane(bits: Long): Float = java.lang.Float.intBitsToFloat(bits.toInt)
+    (index: @switch) match {
+      case 0 => lane(extract(LaneFloat, raw, 0))
+      case 1 => lane(extract(LaneFloat, raw, 1))
+      case 2 => lane(extract(LaneFloat, raw, 2))
+      case 3 => lane(extract(LaneFloat, raw, 3))
+      case 4 => lane(extract(LaneFloat, raw, 4))
+      case 5 => lane(extract(LaneFloat, raw, 5))
+      case 6 => lane(extract(LaneFloat, raw, 6))
+      case 7 => lane(extract(LaneFloat, raw, 7))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  /** Returns a copy of this vector with the lane at `index` set to `x`. */
+  def updated(index: Int, x: Float): FloatVector8 = {
+    val bits = java.lang.Float.floatToRawIntBits(x).toLong
+    (index: @switch) match {
+      case 0 => new FloatVector8(insert(LaneFloat, raw, 0, bits))
+      case 1 => new FloatVector8(insert(LaneFloat, raw, 1, bits))
+      case 2 => new FloatVector8(insert(LaneFloat, raw, 2, bits))
+      case 3 => new FloatVector8(insert(LaneFloat, raw, 3, bits))
+      case 4 => new FloatVector8(insert(LaneFloat, raw, 4, bits))
+      case 5 => new FloatVector8(insert(LaneFloat, raw, 5, bits))
+      case 6 => new FloatVector8(insert(LaneFloat, raw, 6, bits))
+      case 7 => new FloatVector8(insert(LaneFloat, raw, 7, bits))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  @alwaysinline def store(ptr: Ptr[Float]): Unit =
+    vector.store(LaneFloat, ptr.rawptr, raw)
+
+  /** Stores lanes to `array` starting at `index`. */
+  @alwaysinline def store(array: Array[Float], index: Int): Unit = {
+    FloatVector8.checkRange(array.length, index)
+    vector.store(
+      LaneFloat,
+      array.asInstanceOf[FloatArray].atRawUnsafe(index),
+      raw
+    )
+  }
+
+  @alwaysinline def +(that: FloatVector8): FloatVector8 =
+    new FloatVector8(bin(LaneFloat, OpAdd, raw, that.raw))
+  @alwaysinline def -(that: FloatVector8): FloatVector8 =
+    new FloatVector8(bin(LaneFloat, OpSub, raw, that.raw))
+  @alwaysinline def *(that: FloatVector8): FloatVector8 =
+    new FloatVector8(bin(LaneFloat, OpMul, raw, that.raw))
+  @alwaysinline def /(that: FloatVector8): FloatVector8 =
+    new FloatVector8(bin(LaneFloat, OpDiv, raw, that.raw))
+  @alwaysinline def unary_- : FloatVector8 = this * FloatVector8.broadcast(-1)
+
+  @alwaysinline def ===(that: FloatVector8): IntVector8 =
+    new IntVector8(compare(LaneFloat, CompEq, raw, that.raw))
+  @alwaysinline def =!=(that: FloatVector8): IntVector8 =
+    new IntVector8(compare(LaneFloat, CompNe, raw, that.raw))
+  @alwaysinline def <(that: FloatVector8): IntVector8 =
+    new IntVector8(compare(LaneFloat, CompLt, raw, that.raw))
+  @alwaysinline def <=(that: FloatVector8): IntVector8 =
+    new IntVector8(compare(LaneFloat, CompLe, raw, that.raw))
+  @alwaysinline def >(that: FloatVector8): IntVector8 =
+    new IntVector8(compare(LaneFloat, CompGt, raw, that.raw))
+  @alwaysinline def >=(that: FloatVector8): IntVector8 =
+    new IntVector8(compare(LaneFloat, CompGe, raw, that.raw))
+
+  /** Takes lanes of `that` where `mask` is set and of this vector elsewhere. */
+  @alwaysinline def blend(that: FloatVector8, mask: IntVector8): FloatVector8 = {
+    val diff = bin(LaneFloat, OpXor, raw, that.raw)
+    new FloatVector8(bin(LaneFloat, OpXor, raw, bin(LaneFloat, OpAnd, diff, mask.raw)))
+  }
+
+  @alwaysinline def min(that: FloatVector8): FloatVector8 = blend(that, that < this)
+  @alwaysinline def max(that: FloatVector8): FloatVector8 = blend(that, that > this)
+
+  /** Sum of all lanes. */
+  @alwaysinline def sum: Float =
+    (this(0) + this(1) + this(2) + this(3) + this(4) + this(5) + this(6) + this(7)).toFloat
+
+  def toArray: Array[Float] = {
+    val array = new Array[Float](8)
+    store(array, 0)
+    array
+  }
+
+  override def equals(other: Any): Boolean = other match {
+    case other: FloatVector8 => java.util.Arrays.equals(toArray, other.toArray)
+    case _          => false
+  }
+
+  override def hashCode: Int = java.util.Arrays.hashCode(toArray)
+
+  override def toString: String = toArray.mkString("FloatVector8(", ", ", ")")
+}
+
+object FloatVector8 {
+  @alwaysinline def zero: FloatVector8 = new FloatVector8(broadcast256(LaneFloat, 0L))
+
+  /** A vector with all lanes set to `x`. */
+  @alwaysinline def broadcast(x: Float): FloatVector8 =
+    new FloatVector8(broadcast256(LaneFloat, java.lang.Float.floatToRawIntBits(x).toLong))
+
+  @alwaysinline def load(ptr: Ptr[Float]): FloatVector8 =
+    new FloatVector8(load256(LaneFloat, ptr.rawptr))
+
+  /** Loads lanes from `array` starting at `index`. */
+  @alwaysinline def load(array: Array[Float], index: Int): FloatVector8 = {
+    checkRange(array.length, index)
+    new FloatVector8(
+      load256(LaneFloat, array.asInstanceOf[FloatArray].atRawUnsafe(index))
+    )
+  }
+
+  def apply(x0: Float, x1: Float, x2: Float, x3: Float, x4: Float, x5: Float, x6: Float, x7: Float): FloatVector8 = {
+    var result = zero
+    result = result.updated(0, x0)
+    result = result.updated(1, x1)
+    result = result.updated(2, x2)
+    result = result.updated(3, x3)
+    result = result.updated(4, x4)
+    result = result.updated(5, x5)
+    result = result.updated(6, x6)
+    result = result.updated(7, x7)
+    result
+  }
+
+  @alwaysinline private[unsafe] def checkRange(length: Int, index: Int): Unit =
+    if (index < 0 || index > length - 8)
+      throw new ArrayIndexOutOfBoundsException(
+        s"Range [$index, ${index + 8}) out of bounds for length $length"
+      )
+}
+
+/** A 256-bit SIMD vector of 4 Double lanes.
+ *
+ *  Lane-wise operations are compiled to vector instructions of the target,
+ *  or to equivalent scalar code when it has none. Comparisons return a mask
+ *  of integer lanes with all bits set where the comparison holds.
+ */
+final class DoubleVector4 private[scalanative] (
+    private[scalanative] val raw: RawVector256
+) {
+  @alwaysinline def length: Int = 4
+
+  /** Loads the lane at `index`, throws IndexOutOfBoundsException. */
+  def apply(index: Int): Double = {
+    @alwaysinline def lane(bits: Long): Double = java.lang.Double.longBitsToDouble(bits)
+    (index: @switch) match {
+      case 0 => lane(extract(LaneDouble, raw, 0))
+      case 1 => lane(extract(LaneDouble, raw, 1))
+      case 2 => lane(extract(LaneDouble, raw, 2))
+      case 3 => lane(extract(LaneDouble, raw, 3))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  /** Returns a copy of this vector with the lane at `index` set to `x`. */
+  def updated(index: Int, x: Double): DoubleVector4 = {
+    val bits = java.lang.Double.doubleToRawLongBits(x)
+    (index: @switch) match {
+      case 0 => new DoubleVector4(insert(LaneDouble, raw, 0, bits))
+      case 1 => new DoubleVector4(insert(LaneDouble, raw, 1, bits))
+      case 2 => new DoubleVector4(insert(LaneDouble, raw, 2, bits))
+      case 3 => new DoubleVector4(insert(LaneDouble, raw, 3, bits))
+      case _ => throw new IndexOutOfBoundsException(index.toString)
+    }
+  }
+
+  @alwaysinline def store(ptr: Ptr[Double]): Unit =
+    vector.store(LaneDouble, ptr.rawptr, raw)
+
+  /** Stores lanes to `array` starting at `index`. */
+  @alwaysinline def store(array: Array[Double], index: Int): Unit = {
+    DoubleVector4.checkRange(array.length, index)
+    vector.store(
+      LaneDouble,
+      array.asInstanceOf[DoubleArray].atRawUnsafe(index),
+      raw
+    )
+  }
+
+  @alwaysinline def +(that: DoubleVector4): DoubleVector4 =
+    new DoubleVector4(bin(LaneDouble, OpAdd, raw, that.raw))
+  @alwaysinline def -(that: DoubleVector4): DoubleVector4 =
+    new DoubleVector4(bin(LaneDouble, OpSub, raw, that.raw))
+  @alwaysinline def *(that: DoubleVector4): DoubleVector4 =
+    new DoubleVector4(bin(LaneDouble, OpMul, raw, that.raw))
+  @alwaysinline def /(that: DoubleVector4): DoubleVector4 =
+    new DoubleVector4(bin(LaneDouble, OpDiv, raw, that.raw))
+  @alwaysinline def unary_- : DoubleVector4 = this * DoubleVector4.broadcast(-1)
+
+  @alwaysinline def ===(that: DoubleVector4): LongVector4 =
+    new LongVector4(compare(LaneDouble, CompEq, raw, that.raw))
+  @alwaysinline def =!=(that: DoubleVector4): LongVector4 =
+    new LongVector4(compare(LaneDouble, CompNe, raw, that.raw))
+  @alwaysinline def <(that: DoubleVector4): LongVector4 =
+    new LongVector4(compare(LaneDouble, CompLt, raw, that.raw))
+  @alwaysinline def <=(that: DoubleVector4): LongVector4 =
+    new LongVector4(compare(LaneDouble, CompLe, raw, that.raw))
+  @alwaysinline def >(that: DoubleVector4): LongVector4 =
+    new LongVector4(compare(LaneDouble, CompGt, raw, that.raw))
+  @alwaysinline def >=(that: DoubleVector4): LongVector4 =
+    new LongVector4(compare(LaneDouble, CompGe, raw, that.raw))
+
+  /** Takes lanes of `that` where `mask` is set and of this vector elsewhere. */
+  @alwaysinline def blend(that: DoubleVector4, mask: LongVector4): DoubleVector4 = {
+    val diff = bin(LaneDouble, OpXor, raw, that.raw)
+    new DoubleVector4(bin(LaneDouble, OpXor, raw, bin(LaneDouble, OpAnd, diff, mask.raw)))
+  }
+
+  @alwaysinline def min(that: DoubleVector4): DoubleVector4 = blend(that, that < this)
+  @alwaysinline def max(that: DoubleVector4): DoubleVector4 = blend(that, that > this)
+
+  /** Sum of all lanes. */
+  @alwaysinline def sum: Double =
+    (this(0) + this(1) + this(2) + this(3)).toDouble
+
+  def toArray: Array[Double] = {
+    val array = new Array[Double](4)
+    store(array, 0)
+    array
+  }
+
+  override def equals(other: Any): Boolean = other match {
+    case other: DoubleVector4 => java.util.Arrays.equals(toArray, other.toArray)
+    case _          => false
+  }
+
+  override def hashCode: Int = java.util.Arrays.hashCode(toArray)
+
+  override def toString: String = toArray.mkString("DoubleVector4(", ", ", ")")
+}
+
+object DoubleVector4 {
+  @alwaysinline def zero: DoubleVector4 = new DoubleVector4(broadcast256(LaneDouble, 0L))
+
+  /** A vector with all lanes set to `x`. */
+  @alwaysinline def broadcast(x: Double): DoubleVector4 =
+    new DoubleVector4(broadcast256(LaneDouble, java.lang.Double.doubleToRawLongBits(x)))
+
+  @alwaysinline def load(ptr: Ptr[Double]): DoubleVector4 =
+    new DoubleVector4(load256(LaneDouble, ptr.rawptr))
+
+  /** Loads lanes from `array` starting at `index`. */
+  @alwaysinline def load(array: Array[Double], index: Int): DoubleVector4 = {
+    checkRange(array.length, index)
+    new DoubleVector4(
+      load256(LaneDouble, array.asInstanceOf[DoubleArray].atRawUnsafe(index))
+    )
+  }
+
+  def apply(x0: Double, x1: Double, x2: Double, x3: Double): DoubleVector4 = {
+    var result = zero
+    result = result.updated(0, x0)
+    result = result.updated(1, x1)
+    result = result.updated(2, x2)
+    result = result.updated(3, x3)
+    result
+  }
+
+  @alwaysinline private[unsafe] def checkRange(length: Int, index: Int): Unit =
+    if (index < 0 || index > length - 4)
+      throw new ArrayIndexOutOfBoundsException(
+        s"Range [$index, ${index + 4}) out of bounds for length $length"
+      )
+}
+
@@ -105,6 +105,11 @@ object Mangle {
         mangleType(ty)
         str(n)
         str("_")
+      case Type.Vector(ty, n) =>
+        str("V")
+        mangleType(ty)
+        str(n)
+        str("_")
       case Type.StructValue(tys) =>
         str("S")
         tys.foreach(mangleType)
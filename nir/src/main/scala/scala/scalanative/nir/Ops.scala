@@ -19,7 +19,7 @@ sealed abstract class Op {
     case Op.Insert(aggr, _, _)     => aggr.ty
     case Op.Stackalloc(ty, _)      => Type.Ptr
     case Op.Bin(_, ty, _, _)       => ty
-    case Op.Comp(_, _, _, _)       => Type.Bool
+    case Op.Comp(_, ty, _, _)      => Type.comparisonOf(ty)
     case Op.Conv(_, ty, _)         => ty
     case Op.Fence(_)               => Type.Unit
 
@@ -55,11 +55,13 @@ private[scalanative] object Rt {
   val StringOffsetName = StringName.member(Sig.Field("offset"))
   val StringCountName = StringName.member(Sig.Field("count"))
   val StringCachedHashCodeName = StringName.member(Sig.Field("cachedHashCode"))
+  val StringCoderName = StringName.member(Sig.Field("coder"))
   def jlStringFields = Seq(
     StringValueName,
     StringOffsetName,
     StringCountName,
-    StringCachedHashCodeName
+    StringCachedHashCodeName,
+    StringCoderName
   )
 
   val PrimitiveTypes: Seq[Global.Top] = Seq(
@@ -667,6 +667,12 @@ object Show {
         str(" x ")
         str(n)
         str("]")
+      case Type.Vector(ty, n) =>
+        str("<")
+        onType(ty)
+        str(" x ")
+        str(n)
+        str(">")
       case Type.Function(args, ret) =>
         str("(")
         rep(args, sep = ", ")(onType)
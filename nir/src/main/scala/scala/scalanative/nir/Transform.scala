@@ -136,6 +136,8 @@ trait Transform {
   def onType(ty: Type): Type = ty match {
     case Type.ArrayValue(ty, n) =>
       Type.ArrayValue(onType(ty), n)
+    case Type.Vector(ty, n) =>
+      Type.Vector(onType(ty), n)
     case Type.Function(args, ty) =>
       Type.Function(args.map(onType), onType(ty))
     case Type.StructValue(tys) =>
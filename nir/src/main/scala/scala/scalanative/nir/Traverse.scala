@@ -160,6 +160,8 @@ trait Traverse {
   def onType(ty: Type): Unit = ty match {
     case Type.ArrayValue(ty, n) =>
       onType(ty)
+    case Type.Vector(ty, n) =>
+      onType(ty)
     case Type.Function(args, ty) =>
       args.foreach(onType)
       onType(ty)
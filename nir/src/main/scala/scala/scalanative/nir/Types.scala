@@ -12,6 +12,8 @@ sealed abstract class Type {
       tys(idx).elemty(rest)
     case (Type.ArrayValue(ty, n), idx +: rest) =>
       ty.elemty(rest)
+    case (Type.Vector(ty, n), idx +: rest) =>
+      ty.elemty(rest)
     case _ =>
       unsupported(s"${this}.elemty($path)")
   }
@@ -107,6 +109,19 @@ object Type {
   /** The type of a 64-bit IEEE 754 single-precision float. */
   case object Double extends F(64)
 
+  /** The type of a SIMD vector of primitive lanes.
+   *
+   *  Unlike an `ArrayValue`, a vector is a first-class value which maps to
+   *  LLVM's `<n x ty>` type. Arithmetic, comparison and conversion operations
+   *  applied to a vector act on each of its lanes.
+   *
+   *  @param ty
+   *    The type of the lanes, a primitive type other than `Size`.
+   *  @param n
+   *    The number of lanes.
+   */
+  final case class Vector(ty: Type, n: Int) extends ValueKind
+
   /** The type of an aggregate. */
   sealed abstract class AggregateKind extends ValueKind
 
@@ -255,6 +270,12 @@ object Type {
     case _                        => false
   }
 
+  /** The type of the result of comparing values of type `ty`. */
+  def comparisonOf(ty: Type): Type = ty match {
+    case Vector(_, n) => Vector(Bool, n)
+    case _            => Bool
+  }
+
   def normalize(ty: Type): Type = ty match {
     case ArrayValue(ty, n)          => ArrayValue(normalize(ty), n)
     case StructValue(tys)           => StructValue(tys.map(normalize))
@@ -109,6 +109,12 @@ object Unmangle {
           case ch =>
             error(s"expected digit or _, but got $ch")
         }
+      case 'V' =>
+        next()
+        val ty = readType()
+        val res = Type.Vector(ty, readNumber())
+        accept('_')
+        res
       case 'S' =>
         next()
         Type.StructValue(readTypes())
@@ -32,7 +32,21 @@ final class BinaryDeserializer(buffer: ByteBuffer, nirSource: NIRSource) {
 
   lazy val prelude = Prelude.readFrom(buffer, nirSource.debugName)
 
-  final def deserialize(): Seq[Defn] = {
+  // Source of the definitions being deserialized, differs per class in archives
+  private var source: NIRSource = nirSource
+
+  final def deserialize(): Seq[Defn] = deserialize(offsets)
+
+  /** Deserializes only definitions owned by `owner`, attributing their positions to `source`. Used when a single
+   *  buffer holds definitions of many classes, see [[NirArchive]].
+   */
+  final def deserialize(owner: Global.Top, source: NIRSource): Seq[Defn] = {
+    this.source = source
+    ownerCache.clear()
+    ownedOffsets.get(owner).fold(Seq.empty[Defn])(deserialize(_))
+  }
+
+  private def deserialize(offsets: Iterable[(Global, Int)]): Seq[Defn] = {
     val allDefns = mutable.UnrolledBuffer.empty[Defn]
     offsets.foreach {
       case (global, offset) =>
@@ -42,7 +56,7 @@ final class BinaryDeserializer(buffer: ByteBuffer, nirSource: NIRSource) {
           case NonFatal(ex) =>
             throw new DeserializationException(
               global,
-              nirSource.debugName,
+              source.debugName,
               compatVersion = prelude.compat,
               revision = prelude.revision,
               cause = ex
@@ -70,11 +84,15 @@ final class BinaryDeserializer(buffer: ByteBuffer, nirSource: NIRSource) {
     entries
   }
   private lazy val globals = offsets.keySet
+  private lazy val ownedOffsets: Map[Global.Top, mutable.Map[Global, Int]] =
+    offsets.groupBy(_._1.top)
 
   private val cache = new mutable.LongMap[Any]
-  private def in[T](start: Int)(getT: => T): T = {
+  // Positions refer to the source of their owner, cached only while deserializing it
+  private val ownerCache = new mutable.LongMap[Any]
+  private def in[T](start: Int, within: mutable.LongMap[Any] = cache)(getT: => T): T = {
     val target = start + getLebUnsignedInt()
-    cache
+    within
       .getOrElseUpdate(
         target, {
           val pos = buffer.position()
@@ -237,7 +255,7 @@ final class BinaryDeserializer(buffer: ByteBuffer, nirSource: NIRSource) {
   }
 
   private def getScopeId() = new ScopeId(getLebUnsignedInt())
-  private def getInsts(): Seq[Inst] = in(prelude.sections.insts) {
+  private def getInsts(): Seq[Inst] = in(prelude.sections.insts, ownerCache) {
     getSeq(getInst())
   }
   private def getInst(): Inst = {
@@ -433,6 +451,7 @@ final class BinaryDeserializer(buffer: ByteBuffer, nirSource: NIRSource) {
       case T.RefType     => Type.Ref(getGlobal().narrow[nir.Global.Top], getBool(), getBool())
       case T.SizeType    => Type.Size
       case T.Int128Type  => Type.Int128
+      case T.VectorType  => Type.Vector(getType(), getLebUnsignedInt())
     }
   }
 
@@ -494,14 +513,14 @@ final class BinaryDeserializer(buffer: ByteBuffer, nirSource: NIRSource) {
       case n => util.unsupported(s"Unknown linktime condition tag: ${n}")
     }
 
-  def getPosition(): nir.SourcePosition = in(prelude.sections.positions) {
+  def getPosition(): nir.SourcePosition = in(prelude.sections.positions, ownerCache) {
     val file = getString() match {
       case ""   => nir.SourceFile.Virtual
       case path => nir.SourceFile.Relative(path)
     }
     val line = getLebUnsignedInt()
     val column = getLebUnsignedInt()
-    nir.SourcePosition(source = file, line = line, column = column, nirSource = nirSource)
+    nir.SourcePosition(source = file, line = line, column = column, nirSource = source)
   }
 
   def getLocalNames(): LocalNames = {
@@ -116,6 +116,7 @@ final class BinarySerializer(channel: WritableByteChannel) {
       case Type.Array(ty, _)      => intern(ty)
       case Type.StructValue(tys)  => tys.foreach(intern)
       case Type.ArrayValue(ty, _) => intern(ty)
+      case Type.Vector(ty, _)     => intern(ty)
       case Type.Var(ty)           => intern(ty)
       case _                      => ()
     }
@@ -139,6 +140,7 @@ final class BinarySerializer(channel: WritableByteChannel) {
       case Type.Nothing                 => putTag(T.NothingType)
       case Type.ArrayValue(ty, n)       => putTag(T.ArrayValueType); putType(ty); putLebUnsignedInt(n)
       case Type.StructValue(tys)        => putTag(T.StructValueType); putTypes(tys)
+      case Type.Vector(ty, n)           => putTag(T.VectorType); putType(ty); putLebUnsignedInt(n)
       case Type.Vararg                  => putTag(T.VarargType)
       case Type.Var(ty)                 => putTag(T.VarType); putType(ty)
       case Type.Virtual                 =>
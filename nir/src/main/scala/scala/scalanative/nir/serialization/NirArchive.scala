@@ -0,0 +1,195 @@
+package scala.scalanative
+package nir
+package serialization
+
+import java.io.{BufferedReader, ByteArrayInputStream, ByteArrayOutputStream}
+import java.io.{DataOutputStream, InputStreamReader}
+import java.nio.{ByteBuffer, ByteOrder}
+import java.nio.channels.{Channels, FileChannel}
+import java.nio.charset.StandardCharsets
+import java.nio.file.{Files, Path, Paths, StandardCopyOption}
+import java.nio.file.StandardOpenOption
+import java.util.concurrent.ConcurrentLinkedQueue
+
+import scala.collection.mutable
+
+import scala.scalanative.io.VirtualDirectory
+
+/** A single file holding the NIR of a whole library.
+ *
+ *  Starts with an index of the classes it defines, with the names of their
+ *  original `.nir` files and whether they have entry points, followed by
+ *  the service providers of the library. The index is followed by a single
+ *  NIR file holding definitions of all the classes, which share their
+ *  strings, globals and types. Archives are meant to be memory mapped, only
+ *  the classes reached by the linker are ever decoded.
+ */
+object NirArchive {
+
+  /** Location of the archive in published jars. */
+  final val EntryName = "META-INF/scala-native/nir.archive"
+
+  // 'NIRA' followed by the version of the index format
+  private final val Magic = 0x4e495241
+  private final val Version = 1
+
+  final case class Entry(
+      name: Global.Top,
+      path: String,
+      hasEntryPoints: Boolean
+  )
+
+  /** Packs all NIR files and service providers of `directory` to `output`. */
+  def write(directory: VirtualDirectory, output: Path): Unit = {
+    val entries = mutable.UnrolledBuffer.empty[Entry]
+    val defns = mutable.UnrolledBuffer.empty[Defn]
+    val services = mutable.UnrolledBuffer.empty[(String, Seq[String])]
+
+    directory.files.sortBy(_.toString).foreach {
+      case path if path.toString.endsWith(".nir") =>
+        val fileDefns = deserializeBinary(directory, path)
+        // Defns are indexed by their owner, file names are kept for positions
+        fileDefns.groupBy(_.name.top).foreach {
+          case (owner, owned) =>
+            entries += Entry(owner, path.toString, owned.exists(_.isEntryPoint))
+        }
+        defns ++= fileDefns
+
+      // First variant for jars, second for local directories
+      case path
+          if (path.startsWith("/META-INF/services/") ||
+            path.startsWith("META-INF/services/")) =>
+        val reader = new BufferedReader(
+          new InputStreamReader(
+            new ByteArrayInputStream(directory.read(path).array())
+          )
+        )
+        val providers = Seq.newBuilder[String]
+        try
+          reader
+            .lines()
+            .map[String](_.trim())
+            .filter(_.nonEmpty)
+            .forEach(providers += _)
+        finally reader.close()
+        services += path.getFileName().toString() -> providers.result()
+
+      case _ => ()
+    }
+
+    val index = new ByteArrayOutputStream()
+    val out = new DataOutputStream(index)
+    def putString(value: String): Unit = {
+      val bytes = value.getBytes(StandardCharsets.UTF_8)
+      out.writeInt(bytes.length)
+      out.write(bytes)
+    }
+    out.writeInt(Magic)
+    out.writeInt(Version)
+    out.writeInt(entries.size)
+    entries.foreach { entry =>
+      putString(entry.name.id)
+      putString(entry.path)
+      out.writeBoolean(entry.hasEntryPoints)
+    }
+    out.writeInt(services.size)
+    services.foreach {
+      case (service, providers) =>
+        putString(service)
+        out.writeInt(providers.size)
+        providers.foreach(putString)
+    }
+    out.flush()
+
+    // Written aside and moved, the archive might be mapped by other builds
+    Files.createDirectories(output.toAbsolutePath().getParent())
+    val tmp = Files.createTempFile(
+      output.toAbsolutePath().getParent(),
+      "nir-archive",
+      ".tmp"
+    )
+    val channel = FileChannel.open(tmp, StandardOpenOption.WRITE)
+    try {
+      index.writeTo(Channels.newOutputStream(channel))
+      serializeBinary(defns.toSeq, channel)
+    } finally channel.close()
+    Files.move(tmp, output, StandardCopyOption.REPLACE_EXISTING)
+  }
+
+  /** Maps the archive at `file` to memory, `source` is the path reported in
+   *  positions of its definitions, typically the jar it was published in.
+   *  The mapping is held until the reader is closed.
+   */
+  def open(file: Path, source: Path): Reader = {
+    val channel = FileChannel.open(file, StandardOpenOption.READ)
+    val buffer =
+      try channel.map(FileChannel.MapMode.READ_ONLY, 0, channel.size())
+      finally channel.close()
+    buffer.order(ByteOrder.BIG_ENDIAN)
+
+    def getString(): String = {
+      val bytes = new Array[Byte](buffer.getInt())
+      buffer.get(bytes)
+      new String(bytes, StandardCharsets.UTF_8)
+    }
+
+    if (buffer.getInt() != Magic) throw UnknownFormat
+    if (buffer.getInt() != Version)
+      throw new IllegalStateException(
+        s"Unsupported version of NIR archive for $source"
+      )
+
+    val entries = Seq.fill(buffer.getInt()) {
+      Entry(Global.Top(getString()), getString(), buffer.get() != 0)
+    }
+    val servicesProviders = Seq.fill(buffer.getInt()) {
+      Global.Top(getString()) ->
+        Seq.fill(buffer.getInt())(Global.Top(getString()))
+    }.toMap
+
+    new Reader(entries, servicesProviders, buffer.slice(), source)
+  }
+
+  final class Reader private[serialization] (
+      val entries: Seq[Entry],
+      val servicesProviders: Map[Global.Top, Seq[Global.Top]],
+      mapped: ByteBuffer,
+      source: Path
+  ) extends AutoCloseable {
+    private val sources: Map[Global.Top, NIRSource] =
+      entries.map { entry =>
+        entry.name -> NIRSource(source, Paths.get(entry.path))
+      }.toMap
+
+    // The only reference to the mapping, released once it's dropped
+    @volatile private var defns = mapped
+
+    // Deserializers are stateful, each one decodes its own view of the
+    // definitions and is used by a single thread at a time
+    private val deserializers = new ConcurrentLinkedQueue[BinaryDeserializer]()
+
+    private def deserializer(): BinaryDeserializer = {
+      val buffer = defns
+      if (buffer == null)
+        throw new IllegalStateException(s"NIR archive of $source is closed")
+      val view = buffer.duplicate().order(ByteOrder.BIG_ENDIAN)
+      new BinaryDeserializer(view, NIRSource(source, Paths.get(EntryName)))
+    }
+
+    def contains(name: Global.Top): Boolean = sources.contains(name)
+
+    /** Decodes definitions of `name`, can be called concurrently. */
+    def load(name: Global.Top): Option[Seq[Defn]] =
+      sources.get(name).map { source =>
+        val used = Option(deserializers.poll()).getOrElse(deserializer())
+        try used.deserialize(name, source)
+        finally if (defns != null) deserializers.offer(used)
+      }
+
+    /** Drops the mapping, it must not be loaded from afterwards. */
+    def close(): Unit = {
+      defns = null
+      deserializers.clear()
+    }
+  }
+}
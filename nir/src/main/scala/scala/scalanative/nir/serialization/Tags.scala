@@ -189,6 +189,7 @@ object Tags {
   final val RefType = 1 + ArrayType
   final val SizeType = 1 + RefType
   final val Int128Type = 1 + SizeType
+  final val VectorType = 1 + Int128Type
 
   // Values
   final val TrueVal = 1
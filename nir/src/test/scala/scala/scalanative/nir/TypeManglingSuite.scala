@@ -19,6 +19,8 @@ class TypeManglingSuite {
     Type.StructValue(Seq(Type.Byte)),
     Type.StructValue(Seq(Type.Byte, Type.Int)),
     Type.StructValue(Seq(Type.Byte, Type.Int, Type.Float)),
+    Type.Vector(Type.Long, 2),
+    Type.Vector(Type.Float, 8),
     Type.Function(Seq.empty, Type.Int),
     Type.Function(Seq(Type.Int), Type.Int),
     Type.Function(Seq(Type.Float, Type.Int), Type.Int),
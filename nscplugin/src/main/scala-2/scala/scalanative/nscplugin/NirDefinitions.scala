@@ -39,6 +39,13 @@ trait NirDefinitions {
     lazy val PtrClass = getRequiredClass("scala.scalanative.unsafe.Ptr")
     lazy val RawPtrClass = getRequiredClass("scala.scalanative.runtime.RawPtr")
 
+    lazy val RawVector128Class = getRequiredClass(
+      "scala.scalanative.runtime.RawVector128"
+    )
+    lazy val RawVector256Class = getRequiredClass(
+      "scala.scalanative.runtime.RawVector256"
+    )
+
     lazy val NameClass = getRequiredClass("scala.scalanative.unsafe.name")
     lazy val LinkClass = getRequiredClass("scala.scalanative.unsafe.link")
     lazy val LinkCppRuntimeClass = getRequiredClass(
@@ -297,7 +304,9 @@ trait NirDefinitions {
     lazy val RuntimePrimitiveTypes: Set[Symbol] =
       RuntimePrimitive.values.toSet ++ Set(
         RawPtrClass,
-        RawSizeClass
+        RawSizeClass,
+        RawVector128Class,
+        RawVector256Class
       )
 
     // Used only by Scala 2.12
@@ -112,7 +112,9 @@ trait NirGenType[G <: Global with Singleton] { self: NirGenPhase[G] =>
     NullClass -> nir.Type.Null,
     NothingClass -> nir.Type.Nothing,
     RawPtrClass -> nir.Type.Ptr,
-    RawSizeClass -> nir.Type.Size
+    RawSizeClass -> nir.Type.Size,
+    RawVector128Class -> nir.Type.Vector(nir.Type.Long, 2),
+    RawVector256Class -> nir.Type.Vector(nir.Type.Long, 4)
   )
 
   def genRefType(tpe: Type): nir.Type.RefKind =
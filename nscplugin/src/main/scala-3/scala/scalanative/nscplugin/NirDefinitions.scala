@@ -64,6 +64,10 @@ final class NirDefinitions()(using ctx: Context) {
   @tu lazy val PtrClass = requiredClass("scala.scalanative.unsafe.Ptr")
   @tu lazy val RawPtrClass = requiredClass("scala.scalanative.runtime.RawPtr")
 
+  // SIMD vectors
+  @tu lazy val RawVector128Class = requiredClass("scala.scalanative.runtime.RawVector128")
+  @tu lazy val RawVector256Class = requiredClass("scala.scalanative.runtime.RawVector256")
+
   private lazy val CFuncPtrNNames = (0 to 22).map("scala.scalanative.unsafe.CFuncPtr" + _)
   @tu lazy val CFuncPtrClass = requiredClass("scala.scalanative.unsafe.CFuncPtr")
   @tu lazy val CFuncPtrNClass = CFuncPtrNNames.map(requiredClass)
@@ -190,7 +194,9 @@ final class NirDefinitions()(using ctx: Context) {
   )
   @tu lazy val RuntimePrimitiveTypes: Set[Symbol] = RuntimePrimitive.values.toSet ++ Set(
     RawPtrClass,
-    RawSizeClass
+    RawSizeClass,
+    RawVector128Class,
+    RawVector256Class
   )
 
   // Scala Native runtime boxes
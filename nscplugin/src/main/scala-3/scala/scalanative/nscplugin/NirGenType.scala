@@ -185,7 +185,9 @@ trait NirGenType(using Context) {
     defn.NullClass -> nir.Type.Null,
     defn.NothingClass -> nir.Type.Nothing,
     defnNir.RawPtrClass -> nir.Type.Ptr,
-    defnNir.RawSizeClass -> nir.Type.Size
+    defnNir.RawSizeClass -> nir.Type.Size,
+    defnNir.RawVector128Class -> nir.Type.Vector(nir.Type.Long, 2),
+    defnNir.RawVector256Class -> nir.Type.Vector(nir.Type.Long, 4)
   )
 
   def genRefType(tpe: Type): nir.Type.RefKind =
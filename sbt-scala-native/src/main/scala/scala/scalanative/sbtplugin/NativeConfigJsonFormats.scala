@@ -503,6 +503,10 @@ object NativeConfigJsonFormats {
       final val LinkStubs = "linkStubs"
       final val Optimize = "optimize"
       final val UseIncrementalCompilation = "useIncrementalCompilation"
+      final val StreamIR = "streamIR"
+      final val DistributedThinLTO = "distributedThinLTO"
+      final val FramePointers = "framePointers"
+      final val StackfulContinuations = "stackfulContinuations"
       final val Multithreading = "multithreading"
       final val LinktimeProperties = "linktimeProperties"
       final val EmbedResources = "embedResources"
@@ -536,6 +540,10 @@ object NativeConfigJsonFormats {
       builder.addField(Field.LinkStubs, obj.linkStubs)
       builder.addField(Field.Optimize, obj.optimize)
       builder.addField(Field.UseIncrementalCompilation, obj.useIncrementalCompilation)
+      builder.addField(Field.StreamIR, obj.streamIR)
+      builder.addField(Field.DistributedThinLTO, obj.distributedThinLTO)
+      builder.addField(Field.FramePointers, obj.framePointers)
+      builder.addField(Field.StackfulContinuations, obj.stackfulContinuations)
       builder.addField(Field.Multithreading, obj.multithreading)
       builder.addField(Field.LinktimeProperties, obj.linktimeProperties)
       builder.addField(Field.EmbedResources, obj.embedResources)
@@ -573,6 +581,10 @@ object NativeConfigJsonFormats {
           .withLinkStubs(unbuilder.readField[Boolean](Field.LinkStubs))
           .withOptimize(unbuilder.readField[Boolean](Field.Optimize))
           .withIncrementalCompilation(unbuilder.readField[Boolean](Field.UseIncrementalCompilation))
+          .withStreamIR(unbuilder.readField[Boolean](Field.StreamIR))
+          .withDistributedThinLTO(unbuilder.readField[Boolean](Field.DistributedThinLTO))
+          .withFramePointers(unbuilder.readField[Boolean](Field.FramePointers))
+          .withStackfulContinuations(unbuilder.readField[Boolean](Field.StackfulContinuations))
           .withMultithreading(unbuilder.readField[Option[Boolean]](Field.Multithreading))
           .withLinktimeProperties(_ => unbuilder.readField[NativeConfig.LinktimeProperites](Field.LinktimeProperties))
           .withEmbedResources(unbuilder.readField[Boolean](Field.EmbedResources))
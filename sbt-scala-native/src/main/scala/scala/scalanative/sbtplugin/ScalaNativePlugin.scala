@@ -54,6 +54,16 @@ object ScalaNativePlugin extends AutoPlugin {
         "Generates native binary in release-full configuration without running it."
       )
 
+    val nativeNirArchive =
+      taskKey[NativeLinkResult](
+        "Packs NIR of the project into a single indexed archive, read lazily by the linker."
+      )
+
+    val nativePackageNirArchive =
+      settingKey[Boolean](
+        "Whether packaged jars should include the NIR archive of the project, false by default."
+      )
+
     implicit def nativeConfigJsonFormat: JsonFormat[build.NativeConfig] =
       NativeConfigJsonFormats.NativeConfigCodec
   }
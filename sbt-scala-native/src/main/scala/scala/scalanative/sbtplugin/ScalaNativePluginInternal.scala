@@ -20,7 +20,9 @@ import scala.concurrent.duration.Duration
 import scala.sys.process.Process
 
 import scala.scalanative.build.*
+import scala.scalanative.io.VirtualDirectory
 import scala.scalanative.linker.LinkingException
+import scala.scalanative.nir.serialization.NirArchive
 import scala.scalanative.sbtplugin.PluginCompat.{*, given}
 import scala.scalanative.sbtplugin.ScalaNativePlugin.autoImport.{
   ScalaNativeCrossVersion => _, _
@@ -133,6 +135,7 @@ object ScalaNativePluginInternal {
         .withOptimize(Discover.optimize())
     },
     ThisBuild / nativeConfig := (Global / nativeConfig).value,
+    nativePackageNirArchive := false,
     nativeWarnOldJVM := {
       val logger = streams.value.log
       checkJVMVersion(logger)
@@ -314,7 +317,22 @@ object ScalaNativePluginInternal {
   )
 
   lazy val scalaNativeCompileSettings: Seq[Setting[_]] = {
-    scalaNativeConfigSettings(false)
+    scalaNativeConfigSettings(false) ++ Seq(
+      nativeNirArchive := {
+        implicit val conv: FileConverter = Keys.fileConverter.value
+        val classes = classDirectory.value.toPath()
+        val archive =
+          crossTarget.value.toPath().resolve(s"${moduleName.value}.nira")
+        compile.value
+        NirArchive.write(VirtualDirectory.local(classes), archive)
+        toFileRef(archive)
+      },
+      packageBin / mappings ++= Def.taskDyn {
+        if (nativePackageNirArchive.value)
+          Def.task(Seq(nativeNirArchive.value -> NirArchive.EntryName))
+        else Def.task(Seq.empty[(FileRef, String)])
+      }.value
+    )
   }
 
   lazy val scalaNativeTestSettings: Seq[Setting[_]] =
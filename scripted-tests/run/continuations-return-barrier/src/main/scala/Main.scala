@@ -0,0 +1,99 @@
+import scala.scalanative.meta.LinktimeInfo
+import scala.scalanative.runtime.Continuations.*
+
+/** Resumes continuations suspended below thousands of frames, so that with
+ *  frame pointers most of them are copied back by the return barrier. Every
+ *  frame holds a heap object which is checked when it is returned into, with
+ *  collections running while the frames are being copied back.
+ */
+object Main:
+  enum Step:
+    case Suspended(depth: Int, resume: Int => Step)
+    case Done(result: Long)
+
+  final class Frame(val depth: Int, val payload: Array[Long])
+
+  final class Boom extends RuntimeException
+
+  private val Depth = 2000
+  private val GCInterval = 256
+
+  private def check(cond: Boolean, msg: => String): Unit =
+    if !cond then throw new AssertionError(msg)
+
+  /** Suspends after returning from the frames below those at depths in
+   *  `suspendAt`, sum of depths and the values passed on resumption.
+   */
+  @noinline def descend(depth: Int, suspendAt: Set[Int], throwAt: Int)(using
+      BoundaryLabel[Step]
+  ): Long =
+    val frame = Frame(depth, Array.fill(4)(depth.toLong))
+    val below =
+      if depth == 0 then 0L else descend(depth - 1, suspendAt, throwAt)
+    val resumedWith =
+      if suspendAt.contains(depth) then
+        suspend[Int, Step](resume => Step.Suspended(depth, resume))
+      else 0
+    if depth == throwAt then throw Boom()
+    if depth % GCInterval == 0 then System.gc()
+    check(
+      frame.depth == depth && frame.payload.forall(_ == depth),
+      s"frame at depth $depth was corrupted"
+    )
+    below + depth + resumedWith
+
+  private def start(suspendAt: Set[Int], throwAt: Int = -1): Step =
+    boundary[Step] {
+      try Step.Done(descend(Depth, suspendAt, throwAt))
+      catch case _: Boom => Step.Done(-1L)
+    }
+
+  private def suspended(step: Step, depth: Int): Int => Step = step match
+    case Step.Suspended(`depth`, resume) => resume
+    case other =>
+      throw new AssertionError(s"expected suspension at $depth, got $other")
+
+  private def done(step: Step): Long = step match
+    case Step.Done(result) => result
+    case other => throw new AssertionError(s"expected completion, got $other")
+
+  private val sum = Depth.toLong * (Depth + 1) / 2
+
+  def resumeDeep(): Unit =
+    val resume = suspended(start(Set(0)), 0)
+    System.gc()
+    check(done(resume(7)) == sum + 7, "deep resume returned wrong result")
+
+  def resumeManyTimes(): Unit =
+    val resume = suspended(start(Set(0)), 0)
+    for value <- 1 to 5 do
+      System.gc()
+      check(
+        done(resume(value)) == sum + value,
+        s"resume number $value returned wrong result"
+      )
+
+  // Suspends again with the frames above not copied back yet
+  def suspendWhileReturning(): Unit =
+    val middle = Depth / 2
+    val resumeBottom = suspended(start(Set(0, middle)), 0)
+    val resumeMiddle = suspended(resumeBottom(1), middle)
+    System.gc()
+    check(done(resumeMiddle(10)) == sum + 11, "resumed middle was wrong")
+    check(done(resumeMiddle(20)) == sum + 21, "resumed middle again was wrong")
+    val resumeMiddle2 = suspended(resumeBottom(2), middle)
+    check(done(resumeMiddle2(30)) == sum + 32, "second middle was wrong")
+
+  def throwWhileReturning(): Unit =
+    val resume = suspended(start(Set(0), throwAt = Depth / 2), 0)
+    check(done(resume(1)) == -1L, "exception did not reach the boundary")
+    check(done(resume(2)) == -1L, "second exception did not reach the boundary")
+
+  def main(args: Array[String]): Unit =
+    println(s"Frame pointers enabled: ${LinktimeInfo.framePointersEnabled}")
+    resumeDeep()
+    resumeManyTimes()
+    suspendWhileReturning()
+    throwWhileReturning()
+    println("All checks passed")
+end Main
@@ -0,0 +1,84 @@
+import java.util.concurrent.CountDownLatch
+import java.util.concurrent.atomic.AtomicLongArray
+
+import scala.scalanative.runtime.SafepointStats
+
+/** Measures the cost of stop-the-world handshake for given numbers of running
+ *  mutator threads:
+ *    - entry: time until all threads reached safepoint, as reported by the GC
+ *    - pause: wall time of the whole System.gc() call
+ *    - exit: time since System.gc() returned until every thread made progress
+ */
+object Main {
+  final val Rounds = 20
+
+  @volatile var running = true
+
+  def main(args: Array[String]): Unit = {
+    val threadCounts =
+      args.headOption.fold(Seq(1, 8, 64, 256, 512))(_.split(',').map(_.toInt))
+
+    println(
+      f"${"threads"}%8s ${"entry avg"}%12s " +
+        f"${"pause avg"}%12s ${"exit avg"}%12s ${"exit max"}%12s"
+    )
+    threadCounts.foreach(measure)
+  }
+
+  def measure(threadsCount: Int): Unit = {
+    running = true
+    val progress = new AtomicLongArray(threadsCount)
+    val started = new CountDownLatch(threadsCount)
+    val threads = Array.tabulate(threadsCount) { idx =>
+      val thread = new Thread(() => {
+        started.countDown()
+        var iteration = 0L
+        while (running) {
+          iteration += 1
+          progress.lazySet(idx, iteration)
+        }
+      })
+      thread.setDaemon(true)
+      thread.start()
+      thread
+    }
+    started.await()
+
+    // Warmup
+    System.gc()
+
+    val entryBefore = SafepointStats.collectionHistogram().sum
+    val entryTotalBefore = SafepointStats.totalCollectionNanos()
+    var pauseTotal, exitTotal, exitMax = 0L
+    val snapshot = new Array[Long](threadsCount)
+    for (_ <- 0 until Rounds) {
+      val pauseStart = System.nanoTime()
+      System.gc()
+      val pauseEnd = System.nanoTime()
+      for (i <- 0 until threadsCount) snapshot(i) = progress.get(i)
+      var i = 0
+      while (i < threadsCount) {
+        if (progress.get(i) != snapshot(i)) i += 1
+        else Thread.`yield`()
+      }
+      val exit = System.nanoTime() - pauseEnd
+      pauseTotal += pauseEnd - pauseStart
+      exitTotal += exit
+      exitMax = exitMax max exit
+    }
+    val collections = SafepointStats.collectionHistogram().sum - entryBefore
+    val entryTotal = SafepointStats.totalCollectionNanos() - entryTotalBefore
+    val entryAvg = if (collections == 0) 0L else entryTotal / collections
+
+    running = false
+    threads.foreach(_.join())
+
+    println(
+      f"$threadsCount%8d ${micros(entryAvg)}%12s " +
+        f"${micros(pauseTotal / Rounds)}%12s " +
+        f"${micros(exitTotal / Rounds)}%12s ${micros(exitMax)}%12s"
+    )
+  }
+
+  private def micros(nanos: Long): String = f"${nanos / 1000.0}%.1fus"
+}
@@ -0,0 +1,83 @@
+import scala.scalanative.meta.LinktimeInfo
+import scala.scalanative.runtime.Continuations.*
+
+/** Allocates objects which don't escape their method, and which the
+ *  optimizer can't scalar replace as they're passed to methods not inlined.
+ *  Checks they stay intact when allocated again by a loop, while collections
+ *  run, and when their frame is suspended by a continuation and resumed
+ *  below a different number of frames.
+ */
+object Main:
+  final class Point(val x: Long, val y: Long)
+
+  enum Step:
+    case Suspended(resume: Long => Step)
+    case Done(result: Long)
+
+  private val Iterations = 100000
+  private val GCInterval = 10000
+
+  private def check(cond: Boolean, msg: => String): Unit =
+    if !cond then throw new AssertionError(msg)
+
+  @noinline def norm(p: Point): Long = p.x * p.x + p.y * p.y
+
+  // Heap objects allocated while the points are live, for the GC to collect
+  @noinline def garbage(n: Int): Array[Point] = Array.fill(64)(Point(n, n))
+
+  def allocateInLoop(): Unit =
+    var sum = 0L
+    var i = 0
+    while i < Iterations do
+      val p = Point(i, i + 1)
+      val heap = garbage(i)
+      if i % GCInterval == 0 then System.gc()
+      check(p.x == i && p.y == i + 1, s"point of iteration $i was overwritten")
+      check(heap.forall(_.x == i), s"heap of iteration $i was overwritten")
+      sum += norm(p)
+      i += 1
+    val expected = (0 until Iterations).map(i => norm(Point(i, i + 1))).sum
+    check(sum == expected, s"sum $sum of the loop, expected $expected")
+
+  @noinline def suspending(n: Long)(using BoundaryLabel[Step]): Long =
+    val p = Point(n, n + 1)
+    val resumedWith = suspend[Long, Step](Step.Suspended(_))
+    garbage(n.toInt)
+    System.gc()
+    check(p.x == n && p.y == n + 1, s"point of frame $n was moved")
+    norm(p) + resumedWith
+
+  // Resumes continuations with more frames on the stack than when suspended
+  @noinline def resumeBelow(
+      frames: Int,
+      resume: Long => Step,
+      value: Long
+  ): Step =
+    if frames == 0 then resume(value)
+    else
+      val pad = Point(frames, frames)
+      val step = resumeBelow(frames - 1, resume, value)
+      check(norm(pad) == 2L * frames * frames, s"frame $frames was overwritten")
+      step
+
+  def suspendAndResume(): Unit =
+    for n <- 1L to 100L do
+      val resume = boundary[Step](Step.Done(suspending(n))) match
+        case Step.Suspended(resume) => resume
+        case other => throw new AssertionError(s"expected suspension, $other")
+      System.gc()
+      resumeBelow(n.toInt % 4 * 16 + 1, resume, n) match
+        case Step.Done(result) =>
+          val expected = n * n + (n + 1) * (n + 1) + n
+          check(result == expected, s"result $result, expected $expected")
+        case other =>
+          throw new AssertionError(s"expected completion, got $other")
+
+  def main(args: Array[String]): Unit =
+    println(
+      s"Stackful continuations: ${LinktimeInfo.isStackfulContinuations}"
+    )
+    allocateInLoop()
+    suspendAndResume()
+    println("All checks passed")
+end Main
@@ -1,4 +1,6 @@
 import scala.scalanative.meta.LinktimeInfo
+import scala.scalanative.unsafe._
+import scala.scalanative.unsigned._
 
 /** Test that stack traces work correctly across different build configurations.
  *
@@ -30,6 +32,7 @@ object Main {
     printConfiguration()
     testBasicStackTrace()
     testExceptionStackTrace()
+    testFramePointers()
     println("All stack trace tests passed!")
   }
 
@@ -46,6 +49,7 @@ object Main {
     println(
       s"  Source-level debugging: ${LinktimeInfo.sourceLevelDebuging.generateFunctionSourcePositions}"
     )
+    println(s"  Frame pointers: ${LinktimeInfo.framePointersEnabled}")
     println("======================================")
   }
 
@@ -186,4 +190,27 @@ object Main {
   @noinline def throwingMethod(): Unit = {
     throw new RuntimeException("Test exception for stack trace verification")
   }
+
+  /** With frame pointers the stack traces checked above are captured by
+   *  walking frame records, unless the walk bails out and the unwinder is used
+   *  instead. Check that it doesn't bail out on the main thread's stack.
+   */
+  @noinline def testFramePointers(): Unit =
+    if (LinktimeInfo.framePointersEnabled && !LinktimeInfo.isWindows) {
+      println("\nTesting frame pointers capture...")
+      val maxFrames = 64
+      val buffer = stackalloc[CSize](maxFrames)
+      val frames = FramePointers.capture(buffer, maxFrames)
+      println(s"Captured $frames frames using frame pointers")
+      assert(frames > 0, "Expected frames captured using frame pointers")
+      (0 until frames).foreach { idx =>
+        assert(buffer(idx) != 0.toUSize, s"Null return address at $idx")
+      }
+      println("Frame pointers test passed!")
+    }
+}
+
+@extern object FramePointers {
+  @name("scalanative_stackTrace_captureFramePointers")
+  def capture(buffer: Ptr[CSize], maxFrames: CInt): CInt = extern
 }
@@ -8,6 +8,7 @@ import java.util.concurrent.TimeUnit
 
 import scala.concurrent.ExecutionContext.Implicits.global
 import scala.concurrent._
+import scala.collection.mutable
 import scala.concurrent.duration._
 
 import org.openjdk.jmh.annotations.Mode._
@@ -47,6 +48,7 @@ abstract class CodeGenBench(nativeConfig: NativeConfig => NativeConfig) {
   @TearDown(Level.Trial)
   def cleanup(): Unit = {
     val workdir = config.baseDir
+    reportArtifactSizes(config.workDir.resolve("generated"))
     Files
       .walk(workdir)
       .sorted(Comparator.reverseOrder())
@@ -61,6 +63,27 @@ abstract class CodeGenBench(nativeConfig: NativeConfig => NativeConfig) {
     val paths = Await.result(codegen, Duration.Inf)
     assert(paths.nonEmpty)
   }
+
+  @Benchmark
+  def codeGenAndCompile(): Unit = {
+    val compiled = ScalaNative
+      .codegen(config, analysis)
+      .flatMap(Build.compileIR(config, analysis, _))
+    val paths = Await.result(compiled, Duration.Inf)
+    assert(paths.nonEmpty)
+  }
+
+  private def reportArtifactSizes(dir: Path): Unit = if (Files.exists(dir)) {
+    val sizes = mutable.Map.empty[String, Long].withDefaultValue(0L)
+    Files.walk(dir).filter(Files.isRegularFile(_: Path)).forEach { file =>
+      val name = file.getFileName().toString
+      val ext = name.substring(name.indexOf('.').max(0))
+      sizes(ext) += Files.size(file)
+    }
+    sizes.toSeq.sorted.foreach {
+      case (ext, size) => println(s"Generated $ext files: ${size / 1024} KiB")
+    }
+  }
 }
 
 class CodeGen
@@ -80,3 +103,10 @@ class CodeGenWithDebugMetadata
       nativeConfig = _.withSourceLevelDebuggingConfig(_.enableAll)
         .withIncrementalCompilation(false)
     )
+
+class CodeGenStreamed
+    extends CodeGenBench(
+      nativeConfig = _.withMultithreading(false)
+        .withStreamIR(true)
+        .withIncrementalCompilation(false)
+    )
@@ -3,9 +3,8 @@ package benchmarks
 
 import java.nio.file.{Files, Path}
 import java.util.Comparator
-import java.util.concurrent.TimeUnit
+import java.util.concurrent.{ExecutorService, Executors, TimeUnit}
 
-import scala.concurrent.ExecutionContext.Implicits.global
 import scala.concurrent._
 import scala.concurrent.duration._
 
@@ -19,7 +18,26 @@ import org.openjdk.jmh.annotations._
 @Warmup(iterations = 5, time = 2, timeUnit = TimeUnit.SECONDS)
 @Measurement(iterations = 10, time = 2, timeUnit = TimeUnit.SECONDS)
 class LinkerBench {
+  // Shows how classpath listing and deserialization scale across cores
+  @Param(Array("1", "2", "4", "8"))
+  var threads: Int = _
+
   var workdir: Path = _
+  var executor: ExecutorService = _
+  var executionContext: ExecutionContext = _
+
+  @Setup(Level.Trial)
+  def setupExecutor(): Unit = {
+    executor = Executors.newFixedThreadPool(threads)
+    executionContext = ExecutionContext.fromExecutor(executor)
+  }
+
+  @TearDown(Level.Trial)
+  def shutdownExecutor(): Unit = {
+    executor.shutdown()
+    executor = null
+    executionContext = null
+  }
 
   @Setup(Level.Iteration)
   def setup(): Unit = {
@@ -37,6 +55,7 @@ class LinkerBench {
 
   @Benchmark
   def link(): Unit = util.Scope { implicit scope =>
+    implicit val ec: ExecutionContext = executionContext
     val config = defaultConfig
       .withBaseDir(workdir)
       .withMainClass(Some(TestMain))
@@ -3,7 +3,7 @@ package benchmarks
 
 import java.nio.file.{Files, Path}
 import java.util.Comparator
-import java.util.concurrent.TimeUnit
+import java.util.concurrent.{ForkJoinPool, TimeUnit}
 
 import scala.concurrent.ExecutionContext.Implicits.global
 import scala.concurrent._
@@ -22,11 +22,17 @@ import scala.scalanative.linker.ReachabilityAnalysis
 @Warmup(iterations = 5, time = 2, timeUnit = TimeUnit.SECONDS)
 @Measurement(iterations = 10, time = 2, timeUnit = TimeUnit.SECONDS)
 abstract class OptimizerBench(mode: build.Mode) {
+  // Shows how optimization of independent methods scales across cores
+  @Param(Array("1", "2", "4", "8", "16", "32"))
+  var threads: Int = _
+
   var config: Config = _
   var analysis: ReachabilityAnalysis.Result = _
+  var pool: ForkJoinPool = _
 
   @Setup(Level.Trial)
   def setup(): Unit = {
+    pool = new ForkJoinPool(threads)
     val workdir = Files.createTempDirectory("optimize-bench")
     config = defaultConfig
       .withBaseDir(workdir)
@@ -51,11 +57,14 @@ abstract class OptimizerBench(mode: build.Mode) {
       .forEach(Files.delete)
     analysis = null
     config = null
+    pool.shutdown()
+    pool = null
   }
 
   @Benchmark
   def optimize(): Unit = {
-    val optimize = ScalaNative.optimize(config, analysis)
+    val ec = ExecutionContext.fromExecutorService(pool)
+    val optimize = ScalaNative.optimize(config, analysis)(ec)
     val optimized = Await.result(optimize, Duration.Inf)
   }
 }
@@ -153,29 +153,23 @@ object Build {
             .flatMap { irGenerators =>
               compile(config, linkerResult, irGenerators)
             }
-            .map(objects => link(config, linkerResult, objects))
+            .flatMap(objects => link(config, linkerResult, objects))
             .map(artifact => postProcess(config, artifact))
         }
         .andThen { case Success(_) => dumpUserConfigHash(config) }
     }
   }
 
-  /** Compiles `generatedIR`, which is a sequence of LLVM IR files. */
+  /** Compiles `generatedIR`, which is a sequence of LLVM IR files, or of
+   *  object files already compiled from streamed IR.
+   */
   private def compile(
       config: Config,
       analysis: ReachabilityAnalysis.Result,
       irGenerators: Seq[Future[Path]]
   )(implicit ec: ExecutionContext): Future[Seq[Path]] =
     config.logger.timeAsync("Compiling to native code") {
-      // compile generated LLVM IR
-      val compileGeneratedIR = Future
-        .sequence {
-          irGenerators.map(irGenerator =>
-            irGenerator.flatMap(generatedIR =>
-              LLVM.compile(config, analysis, generatedIR)
-            )
-          )
-        }
+      val compileGeneratedIR = compileIR(config, analysis, irGenerators)
 
       /* Finds all the libraries on the classpath that contain native
        * code and then compiles them.
@@ -187,12 +181,30 @@ object Build {
       )(_ ++ _)
     }
 
+  /** Compiles generated LLVM IR files, objects compiled from streamed IR are
+   *  passed through.
+   */
+  private[scalanative] def compileIR(
+      config: Config,
+      analysis: ReachabilityAnalysis.Result,
+      irGenerators: Seq[Future[Path]]
+  )(implicit ec: ExecutionContext): Future[Seq[Path]] =
+    Future.sequence {
+      irGenerators.map(irGenerator =>
+        irGenerator.flatMap { generated =>
+          if (generated.toString.endsWith(LLVM.oExt))
+            Future.successful(generated)
+          else LLVM.compile(config, analysis, generated)
+        }
+      )
+    }
+
   /** Links the given object files using the system's linker. */
   private def link(
       config: Config,
       analysis: ReachabilityAnalysis.Result,
       compiled: Seq[Path]
-  ): Path = config.logger.time(
+  )(implicit ec: ExecutionContext): Future[Path] = config.logger.timeAsync(
     s"Linking native code (${config.gc.name} gc, ${config.LTO.name} lto)"
   ) {
     LLVM.link(config, analysis, compiled)
@@ -184,6 +184,28 @@ sealed trait Config {
       Seq("netbsd").exists(customTriple.contains(_))
     }
 
+  /** Linker selected by the last `-fuse-ld=` linking option, either a name or
+   *  a path.
+   */
+  private[scalanative] lazy val linker: Option[String] =
+    linkingOptions.reverseIterator.collectFirst {
+      case option if option.startsWith("-fuse-ld=") =>
+        option.stripPrefix("-fuse-ld=")
+    }
+
+  private[scalanative] lazy val usesLld: Boolean =
+    linker.exists(isLinker(_, Set("lld", "ld.lld", "ld64.lld")))
+
+  private[scalanative] lazy val usesGold: Boolean =
+    linker.exists(isLinker(_, Set("gold", "ld.gold")))
+
+  // Matches names and paths, possibly suffixed with a version: ld.lld-17
+  private def isLinker(linker: String, names: Set[String]): Boolean = {
+    val separator = math.max(linker.lastIndexOf('/'), linker.lastIndexOf('\\'))
+    val fileName = linker.substring(separator + 1)
+    names.exists(name => fileName == name || fileName.startsWith(name + "-"))
+  }
+
   // see https://no-color.org/
   private[scalanative] lazy val noColor: Boolean = sys.env.contains("NO_COLOR")
 
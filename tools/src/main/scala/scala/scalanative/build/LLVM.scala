@@ -1,8 +1,11 @@
 package scala.scalanative
 package build
 
-import java.io.{File, PrintWriter}
+import java.io.{BufferedWriter, File, OutputStream, OutputStreamWriter}
+import java.io.{PrintWriter, Writer}
+import java.nio.charset.StandardCharsets
 import java.nio.file.{Files, Path, Paths, StandardCopyOption}
+import java.util.concurrent.SynchronousQueue
 
 import scala.concurrent._
 import scala.sys.process._
@@ -64,6 +67,53 @@ private[scalanative] object LLVM {
     else Future.successful(objPath)
   }
 
+  /** Compiles LLVM IR written by `gen` to the object file at `objPath`.
+   *
+   *  The IR is piped to clang while being generated, it is never written to
+   *  disk and clang parses it concurrently with its generation.
+   *
+   *  @param config
+   *    The configuration of the toolchain.
+   *  @param analysis
+   *    The output of the reachability analysis.
+   *  @param objPath
+   *    The path of the `.o` file to create.
+   *  @param gen
+   *    Writes the textual LLVM IR of a single module.
+   *  @return
+   *    The path of the `.o` file.
+   */
+  def compileStreamed(
+      config: Config,
+      analysis: ReachabilityAnalysis.Result,
+      objPath: Path
+  )(gen: Writer => Unit): Path = {
+    implicit val _config: Config = config
+    implicit val _analysis: ReachabilityAnalysis.Result = analysis
+
+    val outpath = objPath.abs
+    // Input language needs to be given explicitly for the standard input
+    val compilec = compileCommand("-", outpath, isCpp = false, isLl = true)
+      .patch(2, Seq("-x", "ir"), 0)
+
+    config.logger.running(compilec)
+    val stdin = new SynchronousQueue[OutputStream]()
+    val io = BasicIO(withIn = false, Logger.toProcessLogger(config.logger))
+      .withInput(stdin.put(_))
+    val process = Process(compilec, config.workDir.toFile).run(io)
+    val writer = new BufferedWriter(
+      new OutputStreamWriter(stdin.take(), StandardCharsets.UTF_8)
+    )
+    // Closing the input lets clang finish even if generation failed
+    try gen(writer)
+    finally writer.close()
+    if (process.exitValue() != 0) {
+      throw new BuildException(s"Failed to compile ${outpath}")
+    }
+
+    objPath
+  }
+
   private def compileFile(srcPath: Path, objPath: Path)(implicit
       config: Config,
       analysis: ReachabilityAnalysis.Result,
@@ -73,8 +123,28 @@ private[scalanative] object LLVM {
     val outpath = objPath.abs
     val isCpp = inpath.endsWith(cppExt)
     val isLl = inpath.endsWith(llExt)
-    val workDir = config.workDir
+    val compilec = compileCommand(inpath, outpath, isCpp, isLl)
+
+    // compile
+    config.logger.running(compilec)
+    val result = Process(compilec, config.workDir.toFile) !
+      Logger.toProcessLogger(config.logger)
+    if (result != 0) {
+      throw new BuildException(s"Failed to compile ${inpath}")
+    }
+
+    objPath
+  }
 
+  private def compileCommand(
+      inpath: String,
+      outpath: String,
+      isCpp: Boolean,
+      isLl: Boolean
+  )(implicit
+      config: Config,
+      analysis: ReachabilityAnalysis.Result
+  ): Seq[String] = {
     val compiler = if (isCpp) config.clangPP.abs else config.clang.abs
     val langOptions = {
       if (isLl) llvmIrFeatures
@@ -95,9 +165,18 @@ private[scalanative] object LLVM {
         if (config.usingCppExceptions)
           Seq("-DSCALANATIVE_USING_CPP_EXCEPTIONS")
         else Nil
+      val stackfulContinuations =
+        if (config.compilerConfig.stackfulContinuations)
+          Seq("-DSCALANATIVE_DELIMCC_STACKFUL")
+        else Nil
+      val framePointers =
+        if (config.compilerConfig.framePointers)
+          Seq("-DSCALANATIVE_FRAME_POINTERS")
+        else Nil
       val allowTargetOverrrides =
         config.compilerConfig.targetTriple.map(_ => s"-Wno-override-module")
-      multithreadingEnabled ++ usingCppExceptions ++ allowTargetOverrrides
+      multithreadingEnabled ++ usingCppExceptions ++ stackfulContinuations ++
+        framePointers ++ allowTargetOverrrides
     }
     // Always generate debug metadata on Windows, it's required for stack traces to work
     val debugFlags =
@@ -107,24 +186,18 @@ private[scalanative] object LLVM {
         List("-gdwarf-4")
       } else Nil
 
+    val framePointerFlags =
+      if (config.compilerConfig.framePointers)
+        Seq("-fno-omit-frame-pointer", "-mno-omit-leaf-frame-pointer")
+      else Seq("-fomit-frame-pointer")
+
     val flags: Seq[String] =
       buildTargetCompileOpts ++ flto ++ sanitizer ++ target ++
         langOptions ++ platformFlags ++ debugFlags ++
         configFlags ++ Seq("-fvisibility=hidden", opt) ++
-        Seq("-fomit-frame-pointer") ++
+        framePointerFlags ++
         config.compileOptions
-    val compilec: Seq[String] =
-      Seq(compiler, "-c", inpath, "-o", outpath) ++ flags
-
-    // compile
-    config.logger.running(compilec)
-    val result = Process(compilec, workDir.toFile) !
-      Logger.toProcessLogger(config.logger)
-    if (result != 0) {
-      throw new BuildException(s"Failed to compile ${inpath}")
-    }
-
-    objPath
+    Seq(compiler, "-c", inpath, "-o", outpath) ++ flags
   }
 
   /** Links a collection of `.ll.o` files and the `.o` files from the
@@ -144,28 +217,186 @@ private[scalanative] object LLVM {
       config: Config,
       analysis: ReachabilityAnalysis.Result,
       objectsPaths: Seq[Path]
-  ): Path = {
+  )(implicit ec: ExecutionContext): Future[Path] = {
     implicit val _config: Config = config
     val buildPath = config.buildPath
 
     // don't link if no changes
     if (!needsLinking(objectsPaths, buildPath)) {
-      return copyOutput(config, buildPath)
+      return Future.successful(copyOutput(config, buildPath))
     }
 
     val command = config.compilerConfig.buildTarget match {
-      case BuildTarget.Application | BuildTarget.LibraryDynamic =>
-        prepareLinkCommand(objectsPaths, analysis)
       case BuildTarget.LibraryStatic =>
-        prepareArchiveCommand(objectsPaths)
+        Future.successful(prepareArchiveCommand(objectsPaths))
+      case _ if config.compilerConfig.distributedThinLTO =>
+        compileThinLTOBackends(objectsPaths, analysis).map { objects =>
+          prepareLinkCommand(objects, analysis, ltoFlags = Nil)
+        }
+      case BuildTarget.Application | BuildTarget.LibraryDynamic =>
+        val ltoFlags = flto ++ thinLTOCache
+        Future.successful(prepareLinkCommand(objectsPaths, analysis, ltoFlags))
     }
-    // link
-    val result = command ! Logger.toProcessLogger(config.logger)
-    if (result != 0) {
-      throw new BuildException(s"Failed to link ${buildPath}")
+    command.map { command =>
+      // link
+      val result = command ! Logger.toProcessLogger(config.logger)
+      if (result != 0) {
+        throw new BuildException(s"Failed to link ${buildPath}")
+      }
+
+      copyOutput(config, buildPath)
     }
+  }
 
-    copyOutput(config, buildPath)
+  /* ThinLTO keeps the results of its backends, keyed by the module and
+   * everything it imports, in `workDir/thinlto/cache`. Flags passing the
+   * directory and its pruning policy are specific to each linker.
+   */
+  private[build] def thinLTOCache(implicit config: Config): Seq[String] = {
+    val cacheDir = config.workDir.resolve("thinlto").resolve("cache").abs
+    val useCache = config.compilerConfig.lto == LTO.Thin &&
+      config.compilerConfig.useIncrementalCompilation
+    if (!useCache) Nil
+    else if (config.targetsWindows)
+      Seq(
+        s"-Wl,/lldltocache:$cacheDir",
+        s"-Wl,/lldltocachepolicy:$ThinLTOCachePolicy"
+      )
+    else if (config.usesLld)
+      Seq(
+        s"-Wl,--thinlto-cache-dir=$cacheDir",
+        s"-Wl,--thinlto-cache-policy=$ThinLTOCachePolicy"
+      )
+    else if (config.targetsMac)
+      Seq(
+        s"-Wl,-cache_path_lto,$cacheDir",
+        s"-Wl,-prune_after_lto,${ThinLTOCacheExpirationHours * 3600}",
+        "-Wl,-max_relative_cache_size_lto,10"
+      )
+    else if (config.usesGold)
+      // Options of the LLVM gold plugin
+      Seq(
+        s"-Wl,-plugin-opt,cache-dir=$cacheDir",
+        s"-Wl,-plugin-opt,cache-policy=$ThinLTOCachePolicy"
+      )
+    // Other linkers might not load the plugin, backends are not cached
+    else Nil
+  }
+
+  // Entries unused for a week are pruned, at most 10% of free space is used
+  private final val ThinLTOCacheExpirationHours = 7 * 24
+  private val ThinLTOCachePolicy =
+    s"prune_after=${ThinLTOCacheExpirationHours}h:cache_size=10%"
+
+  /** Compiles the ThinLTO backends of bitcode `objectsPaths` to native
+   *  objects in parallel, the linker only computes the ThinLTO index.
+   *
+   *  Backends of modules, and of the modules they import, which are unchanged
+   *  since the previous build are not compiled again. Returns the objects to
+   *  link, without the modules the linker found unused.
+   */
+  private def compileThinLTOBackends(
+      objectsPaths: Seq[Path],
+      analysis: ReachabilityAnalysis.Result
+  )(implicit config: Config, ec: ExecutionContext): Future[Seq[Path]] = {
+    val thinDir = config.workDir.resolve("thinlto")
+    val bitcodeList = thinDir.resolve("bitcode")
+    // Outputs of objects in `workDir` are written to `thinDir`, other ones
+    // next to their objects
+    val workPrefix = config.workDir.abs + File.separator
+    val thinPrefix = thinDir.abs + File.separator
+    def outputPrefix(path: String) =
+      if (path.startsWith(workPrefix)) thinPrefix + path.stripPrefix(workPrefix)
+      else path
+
+    val bitcode = Future {
+      Files.createDirectories(thinDir)
+      Files.deleteIfExists(bitcodeList)
+      val indexFlags = thinLTOIndexFlags(bitcodeList, workPrefix, thinPrefix)
+      val index = prepareLinkCommand(objectsPaths, analysis, indexFlags)
+      if ((index ! Logger.toProcessLogger(config.logger)) != 0) {
+        throw new BuildException("Failed to compute the ThinLTO index")
+      }
+      new String(Files.readAllBytes(bitcodeList), StandardCharsets.UTF_8)
+        .split('\n')
+        .map(_.trim())
+        .filter(_.nonEmpty)
+        .toSet
+    }
+
+    bitcode.flatMap { bitcode =>
+      Future.sequence(objectsPaths.map { path =>
+        if (bitcode.contains(path.abs))
+          compileThinLTOBackend(path, outputPrefix(path.abs)).map(Some(_))
+        // Bitcode left out by the linker, it defines nothing used
+        else if (isBitcode(path)) Future.successful(None)
+        else Future.successful(Some(path))
+      })
+    }.map(_.flatten)
+  }
+
+  /** Flags making lld write the ThinLTO index of each module instead of
+   *  linking, with the modules to compile listed in `bitcodeList`.
+   */
+  private[build] def thinLTOIndexFlags(
+      bitcodeList: Path,
+      workPrefix: String,
+      thinPrefix: String
+  )(implicit config: Config): Seq[String] =
+    flto ++ Seq(
+      "-fuse-ld=lld",
+      s"-Wl,--thinlto-index-only=${bitcodeList.abs}",
+      s"-Wl,--thinlto-prefix-replace=$workPrefix;$thinPrefix"
+    )
+
+  private def compileThinLTOBackend(objPath: Path, outputPrefix: String)(
+      implicit
+      config: Config,
+      ec: ExecutionContext
+  ): Future[Path] = Future {
+    val index = Paths.get(outputPrefix + ".thinlto.bc")
+    val native = Paths.get(outputPrefix + ".native" + oExt)
+    val checksum = Paths.get(outputPrefix + ".sha1")
+    // Indices are written by each link, only their content is compared
+    val key = IO.sha1files(Seq(index, objPath)).map("%02x".format(_)).mkString
+    def previousKey =
+      new String(Files.readAllBytes(checksum), StandardCharsets.UTF_8)
+    def upToDate =
+      Files.exists(native) && Files.exists(checksum) && previousKey == key &&
+        !Build.userConfigHasChanged(config)
+
+    if (!upToDate) {
+      val command = Seq(
+        config.clang.abs,
+        "-c",
+        "-x",
+        "ir",
+        objPath.abs,
+        "-o",
+        native.abs,
+        s"-fthinlto-index=${index.abs}",
+        opt,
+        "-Wno-unused-command-line-argument"
+      ) ++ target ++ sanitizer
+      config.logger.running(command)
+      val result = Process(command, config.workDir.toFile) !
+        Logger.toProcessLogger(config.logger)
+      if (result != 0) {
+        throw new BuildException(s"Failed to compile ThinLTO backend $objPath")
+      }
+      Files.write(checksum, key.getBytes(StandardCharsets.UTF_8))
+    }
+    native
+  }
+
+  // Starts with the 'BC' 0xC0DE magic of LLVM bitcode
+  private def isBitcode(path: Path): Boolean = {
+    val in = Files.newInputStream(path)
+    try {
+      val magic = new Array[Byte](4)
+      in.read(magic) == 4 &&
+      magic.sameElements(Array[Byte]('B', 'C', 0xc0.toByte, 0xde.toByte))
+    } finally in.close()
   }
 
   /** Links the DWARF debug information found in the object file at `path`,
@@ -218,7 +449,8 @@ private[scalanative] object LLVM {
 
   private def prepareLinkCommand(
       objectsPaths: Seq[Path],
-      analysis: ReachabilityAnalysis.Result
+      analysis: ReachabilityAnalysis.Result,
+      ltoFlags: Seq[String]
   )(implicit config: Config) = {
     val workDir = config.workDir
     val links = {
@@ -302,7 +534,7 @@ private[scalanative] object LLVM {
 
       try {
         buildTargetLinkOpts.foreach(add)
-        flto.foreach(add)
+        ltoFlags.foreach(add)
         debugFlags.foreach(add)
         platformFlags.foreach(add)
         linkNameFlags.foreach(add)
@@ -310,16 +542,14 @@ private[scalanative] object LLVM {
         sanitizer.foreach(add)
         target.foreach(add)
 
-        val useLdd = config.linkingOptions.contains("-fuse-ld=lld")
-
         // lld requires that object files are listed in the order
         // they require each other. We don't do that so we wrap
         // the files in --start-lib and --end-lib which consider
         // them like they were in a .a library and links all symbols
         // regardless of ordering
-        if (useLdd) add("-Wl,--start-lib")
+        if (config.usesLld) add("-Wl,--start-lib")
         objectsPaths.foreach(p => add(p.abs))
-        if (useLdd) add("-Wl,--end-lib")
+        if (config.usesLld) add("-Wl,--end-lib")
 
         linkopts.foreach(add)
 
@@ -71,6 +71,39 @@ sealed trait NativeConfig {
   /** Shall we use the incremental compilation? */
   def useIncrementalCompilation: Boolean
 
+  /** Shall the generated LLVM IR be piped to clang instead of being written
+   *  to `.ll` files? Clang parses the IR while it is being generated and the
+   *  intermediate files, which reach hundreds of MB for large programs, are
+   *  never written nor read back. Generated IR can no longer be inspected.
+   */
+  def streamIR: Boolean
+
+  /** Shall ThinLTO backends run as separate compilations scheduled by the
+   *  build instead of inside the linker? The linker only computes the
+   *  whole-program index, each module is then optimized and compiled in
+   *  parallel and is not compiled again until its imports change. Only used
+   *  with [[LTO.thin]] on ELF targets, requires `ld.lld`.
+   */
+  def distributedThinLTO: Boolean
+
+  /** Shall the generated code preserve frame pointers? When enabled exception
+   *  stack traces are captured by walking the chain of frame pointers instead
+   *  of unwinding using DWARF call frame information, making
+   *  `Throwable.fillInStackTrace` significantly cheaper at the cost of
+   *  reserving one register. Frames of foreign code compiled without frame
+   *  pointers might be missing from the captured stack traces.
+   */
+  def framePointers: Boolean
+
+  /** Shall continuations, and virtual threads built on top of them, execute on
+   *  dedicated stacks? When enabled suspending and resuming a continuation
+   *  switches between stacks instead of copying the captured frames, making
+   *  its cost independent of the stack depth. Continuations become one-shot,
+   *  each can be resumed at most once. Not supported by Boehm GC and on
+   *  Windows.
+   */
+  def stackfulContinuations: Boolean
+
    // format: off
   /** Shall be compiled with multithreading support.
    *
@@ -264,6 +297,18 @@ sealed trait NativeConfig {
   /** Create a new config with given incrementalCompilation value */
   def withIncrementalCompilation(value: Boolean): NativeConfig
 
+  /** Create a new config with given streamIR value */
+  def withStreamIR(value: Boolean): NativeConfig
+
+  /** Create a new config with given distributedThinLTO value */
+  def withDistributedThinLTO(value: Boolean): NativeConfig
+
+  /** Create a new config with given framePointers value */
+  def withFramePointers(value: Boolean): NativeConfig
+
+  /** Create a new config with given stackfulContinuations value */
+  def withStackfulContinuations(value: Boolean): NativeConfig
+
   /** Create a new config with support for multithreading */
   def withMultithreading(enabled: Boolean): NativeConfig
 
@@ -347,6 +392,10 @@ object NativeConfig {
       linkStubs = false,
       optimize = true,
       useIncrementalCompilation = true,
+      streamIR = false,
+      distributedThinLTO = false,
+      framePointers = false,
+      stackfulContinuations = false,
       multithreading = None, // detect
       linktimeProperties = Map.empty,
       embedResources = false,
@@ -379,6 +428,10 @@ object NativeConfig {
       linkStubs: Boolean,
       optimize: Boolean,
       useIncrementalCompilation: Boolean,
+      streamIR: Boolean,
+      distributedThinLTO: Boolean,
+      framePointers: Boolean,
+      stackfulContinuations: Boolean,
       multithreading: Option[Boolean],
       linktimeProperties: LinktimeProperites,
       embedResources: Boolean,
@@ -458,6 +511,18 @@ object NativeConfig {
     override def withIncrementalCompilation(value: Boolean): NativeConfig =
       copy(useIncrementalCompilation = value)
 
+    def withStreamIR(value: Boolean): NativeConfig =
+      copy(streamIR = value)
+
+    def withDistributedThinLTO(value: Boolean): NativeConfig =
+      copy(distributedThinLTO = value)
+
+    def withFramePointers(value: Boolean): NativeConfig =
+      copy(framePointers = value)
+
+    def withStackfulContinuations(value: Boolean): NativeConfig =
+      copy(stackfulContinuations = value)
+
     def withMultithreading(enabled: Boolean): NativeConfig =
       copy(multithreading = Some(enabled))
 
@@ -551,6 +616,10 @@ object NativeConfig {
           | - linkStubs:               $linkStubs
           | - optimize                 $optimize
           | - incrementalCompilation:  $useIncrementalCompilation
+          | - streamIR:                $streamIR
+          | - distributedThinLTO:      $distributedThinLTO
+          | - framePointers:           $framePointers
+          | - stackfulContinuations:   $stackfulContinuations
           | - multithreading           ${multithreading.getOrElse("detect")}
           | - linktimeProperties:      ${showMap(linktimeProperties)}
           | - embedResources:          $embedResources
@@ -58,8 +58,40 @@ private[build] object Validator {
         "LTO.thin is unstable on MacOS, it can lead to compilation errors. Consider using LTO.full (legacy, slower) or LTO.none (disabled)"
       )
 
+    val stackfulContinuationsUnsupported =
+      if (!c.stackfulContinuations) None
+      else if (c.gc == GC.boehm) Some("Boehm GC")
+      else if (c.gc == GC.experimental) Some("experimental GC")
+      else if (config.targetsWindows) Some("Windows")
+      else None
+    val withContinuations = stackfulContinuationsUnsupported match {
+      case None         => config
+      case Some(reason) =>
+        warn(
+          s"Stackful continuations are not supported on $reason, falling back to copying the continuation stacks"
+        )
+        config.withCompilerConfig(_.withStackfulContinuations(false))
+    }
+
+    val distributedThinLTOUnsupported =
+      if (!c.distributedThinLTO) None
+      else if (c.lto != LTO.thin) Some(s"LTO.${c.lto}")
+      else if (config.targetsMac || config.targetsWindows)
+        Some("non-ELF targets")
+      // The index is computed by lld
+      else if (config.usesLld) None
+      else config.linker.map(linker => s"linker $linker")
+    val validated = distributedThinLTOUnsupported match {
+      case None         => withContinuations
+      case Some(reason) =>
+        warn(
+          s"Distributed ThinLTO is not supported with $reason, ThinLTO backends would run in the linker"
+        )
+        withContinuations.withCompilerConfig(_.withDistributedThinLTO(false))
+    }
+
     issues.result() match {
-      case Nil    => config
+      case Nil    => validated
       case issues =>
         throw new BuildException(
           (s"Found ${issues.size} issue within provided confguration: " :: issues)
@@ -429,6 +429,8 @@ private[scalanative] final class Check(implicit
               }
             case nir.Type.ArrayValue(elemty, _) =>
               loop(elemty, rest)
+            case nir.Type.Vector(elemty, _) =>
+              loop(elemty, rest)
             case _ =>
               error(s"can't index non-aggregate type ${ty.show}")
           }
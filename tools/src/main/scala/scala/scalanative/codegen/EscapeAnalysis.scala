@@ -0,0 +1,251 @@
+package scala.scalanative
+package codegen
+
+import scala.collection.mutable
+
+/** Interprocedural escape analysis of the allocations left by the optimizer.
+ *
+ *  Interflow only virtualizes allocations it can scalar replace entirely, an
+ *  object passed to a method which is not inlined is always materialized.
+ *  Each method is summarized by how its parameters escape: not at all, only
+ *  through its return value, or anywhere, including into fields, arrays,
+ *  block parameters, thrown exceptions and calls which are not resolved to a
+ *  single method. Summaries start optimistic and are refined until no
+ *  summary changes, so recursive methods are handled as well.
+ *
+ *  Allocations which don't escape the method allocating them can use its
+ *  stack frame. They never flow into block parameters, so none of them is
+ *  live when its allocation is executed again. Frames must stay at the same
+ *  address for as long as they're live, see [[movesFrames]].
+ */
+private[scalanative] object EscapeAnalysis {
+
+  sealed abstract class Escape(val level: Int) {
+    def max(other: Escape): Escape = if (other.level > level) other else this
+  }
+  case object NoEscape extends Escape(0)
+  case object ReturnEscape extends Escape(1)
+  case object GlobalEscape extends Escape(2)
+
+  final class Result(
+      val summaries: Map[nir.Global.Member, Seq[Escape]],
+      stackAllocated: Map[nir.Global, Set[nir.Local]]
+  ) {
+
+    /** Allocations of method `name` which don't escape it. */
+    def nonEscaping(name: nir.Global): Set[nir.Local] =
+      stackAllocated.getOrElse(name, Set.empty)
+  }
+
+  object Result {
+    val empty = new Result(Map.empty, Map.empty)
+  }
+
+  private val ContinuationSuspend: nir.Sig =
+    nir.Sig.Extern("scalanative_continuation_suspend")
+
+  /** Whether frames of the program might be moved while they're live.
+   *
+   *  Unless they're stackful, continuations copy the frames they suspend off
+   *  the stack and copy them back to another address when resumed. Pointers
+   *  to objects in those frames would still refer to the old address.
+   */
+  def movesFrames(defns: Seq[nir.Defn], config: build.NativeConfig): Boolean =
+    !config.stackfulContinuations && defns.exists {
+      _.name match {
+        case nir.Global.Member(_, sig) => sig == ContinuationSuspend
+        case _                         => false
+      }
+    }
+
+  def apply(defns: Seq[nir.Defn]): Result = {
+    val methods = defns.collect {
+      case defn: nir.Defn.Define => defn.name -> defn
+    }.toMap
+    val summaries = mutable.Map.empty[nir.Global.Member, Seq[Escape]]
+    val callers = mutable.Map.empty[nir.Global, mutable.Set[nir.Global.Member]]
+    methods.foreach {
+      case (name, defn) =>
+        val nir.Inst.Label(_, params) = defn.insts.head: @unchecked
+        summaries(name) = params.map(_ => NoEscape)
+        defn.insts.foreach {
+          case nir.Inst.Let(_, DirectCall(callee, _), _) =>
+            callers.getOrElseUpdate(callee, mutable.Set.empty) += name
+          case _ =>
+            ()
+        }
+    }
+
+    def summary(name: nir.Global): Option[Seq[Escape]] = name match {
+      case name: nir.Global.Member => summaries.get(name)
+      case _                       => None
+    }
+
+    // Callers are analyzed again whenever the summary of a callee changes
+    val worklist = mutable.Queue.empty[nir.Global.Member] ++= methods.keys
+    val queued = mutable.Set.empty[nir.Global.Member] ++= methods.keys
+    while (worklist.nonEmpty) {
+      val name = worklist.dequeue()
+      queued -= name
+      val updated = new MethodEscapes(methods(name), summary).paramEscapes
+      if (updated != summaries(name)) {
+        summaries(name) = updated
+        callers.get(name).foreach(_.foreach { caller =>
+          if (queued.add(caller)) worklist.enqueue(caller)
+        })
+      }
+    }
+
+    val stackAllocated = methods.map {
+      case (name, defn) =>
+        (name: nir.Global) -> new MethodEscapes(defn, summary).nonEscaping
+    }.filter(_._2.nonEmpty)
+    new Result(summaries.toMap, stackAllocated)
+  }
+
+  /** Escape of the parameters and allocations of a single method. */
+  private final class MethodEscapes(
+      defn: nir.Defn.Define,
+      summary: nir.Global => Option[Seq[Escape]]
+  ) {
+    private val nir.Inst.Label(_, params) = defn.insts.head: @unchecked
+
+    // Parameters and allocations are the sources of the tracked values
+    private val sources = mutable.Map.empty[nir.Local, Int]
+    private val allocations = mutable.UnrolledBuffer.empty[nir.Local]
+    params.zipWithIndex.foreach { case (param, idx) => sources(param.id) = idx }
+    defn.insts.foreach {
+      case nir.Inst.Let(n, _: nir.Op.Classalloc | _: nir.Op.Arrayalloc, _) =>
+        sources(n) = sources.size
+        allocations += n
+      case _ =>
+        ()
+    }
+    private val escapes = Array.fill[Escape](sources.size)(NoEscape)
+
+    /* Values which might be the same object as their operands. They're not
+     * defined by block parameters, which escape, so they're never cyclic.
+     */
+    private val aliases = mutable.Map.empty[nir.Local, Seq[nir.Val]]
+    defn.insts.foreach {
+      case nir.Inst.Let(n, nir.Op.Copy(v), _) =>
+        aliases(n) = Seq(v)
+      case nir.Inst.Let(n, nir.Op.As(_, v), _) =>
+        aliases(n) = Seq(v)
+      case nir.Inst.Let(n, DirectCall(callee, args), _) =>
+        summary(callee).foreach { calleeEscapes =>
+          val returned = args.zip(calleeEscapes).collect {
+            case (arg, ReturnEscape) => arg
+          }
+          if (returned.nonEmpty) aliases(n) = returned
+        }
+      case _ =>
+        ()
+    }
+
+    private val aliased = mutable.Map.empty[nir.Local, Set[Int]]
+    private def sourcesOf(value: nir.Val): Set[Int] = value match {
+      case nir.Val.Local(n, _) =>
+        aliased.getOrElseUpdate(
+          n,
+          sources.get(n) match {
+            case Some(source) => Set(source)
+            case None         =>
+              aliases.get(n).fold(Set.empty[Int])(_.flatMap(sourcesOf).toSet)
+          }
+        )
+      case _ =>
+        Set.empty
+    }
+
+    private def escape(value: nir.Val, level: Escape): Unit =
+      sourcesOf(value).foreach { source =>
+        escapes(source) = escapes(source).max(level)
+      }
+
+    private def escapeAll(op: nir.Op): Unit = {
+      val collector = new CollectLocals
+      collector.onOp(op)
+      collector.locals.foreach(escape(_, GlobalEscape))
+    }
+
+    private def escapeNext(next: nir.Next): Unit = next match {
+      case nir.Next.Label(_, args) => args.foreach(escape(_, GlobalEscape))
+      case nir.Next.Unwind(_, next) => escapeNext(next)
+      case nir.Next.Case(_, next)  => escapeNext(next)
+      case nir.Next.None           => ()
+    }
+
+    defn.insts.foreach {
+      case nir.Inst.Let(_, op, unwind) =>
+        escapeNext(unwind)
+        op match {
+          case _: nir.Op.Copy | _: nir.Op.As | _: nir.Op.Is |
+              _: nir.Op.Comp | _: nir.Op.Method | _: nir.Op.Dynmethod |
+              _: nir.Op.Fieldload | _: nir.Op.Arrayload |
+              _: nir.Op.Arraylength | _: nir.Op.Classalloc |
+              _: nir.Op.Module =>
+            ()
+          case nir.Op.Fieldstore(_, _, _, value) =>
+            escape(value, GlobalEscape)
+          case nir.Op.Arraystore(_, _, _, value) =>
+            escape(value, GlobalEscape)
+          case nir.Op.Arrayalloc(_, _: nir.Val.Int, _) =>
+            ()
+          case DirectCall(callee, args) =>
+            // Unknown callees, and variadic arguments, escape
+            val calleeEscapes = summary(callee).getOrElse(Nil)
+            args.zipWithIndex.foreach {
+              case (arg, idx) =>
+                if (calleeEscapes.lift(idx).forall(_ == GlobalEscape))
+                  escape(arg, GlobalEscape)
+            }
+          case op =>
+            escapeAll(op)
+        }
+      case nir.Inst.Ret(value) =>
+        escape(value, ReturnEscape)
+      case nir.Inst.Throw(value, unwind) =>
+        escape(value, GlobalEscape)
+        escapeNext(unwind)
+      case nir.Inst.Jump(next) =>
+        escapeNext(next)
+      case nir.Inst.If(_, thenp, elsep) =>
+        escapeNext(thenp)
+        escapeNext(elsep)
+      case nir.Inst.Switch(_, default, cases) =>
+        escapeNext(default)
+        cases.foreach(escapeNext)
+      case nir.Inst.Unreachable(unwind) =>
+        escapeNext(unwind)
+      case _: nir.Inst.Label | _: nir.Inst.LinktimeCf =>
+        ()
+    }
+
+    def paramEscapes: Seq[Escape] = params.indices.map(escapes(_))
+
+    def nonEscaping: Set[nir.Local] =
+      allocations.filter(n => escapes(sources(n)) == NoEscape).toSet
+  }
+
+  private object DirectCall {
+    def unapply(op: nir.Op): Option[(nir.Global, Seq[nir.Val])] = op match {
+      case nir.Op.Call(_, nir.Val.Global(callee, _), args) =>
+        Some((callee, args))
+      case _ =>
+        None
+    }
+  }
+
+  private final class CollectLocals extends nir.Traverse {
+    val locals = mutable.UnrolledBuffer.empty[nir.Val.Local]
+
+    override def onVal(value: nir.Val): Unit = {
+      value match {
+        case v: nir.Val.Local => locals += v
+        case _                => ()
+      }
+      super.onVal(value)
+    }
+  }
+}
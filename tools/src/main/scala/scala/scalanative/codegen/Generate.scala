@@ -224,16 +224,23 @@ private[codegen] object Generate {
           val cond = nir.Val.Local(fresh(), nir.Type.Bool)
           val alloc = nir.Val.Local(fresh(), clsTy)
 
-          if (cls.isConstantModule) {
+          if (meta.hasStaticInstance(cls)) {
             val moduleTyName = name.member(nir.Sig.Generated("type"))
             val moduleTyVal = nir.Val.Global(moduleTyName, nir.Type.Ptr)
             val instanceName = name.member(nir.Sig.Generated("instance"))
-            val instanceVal = nir.Val.StructValue(moduleTyVal :: meta.lockWordVals)
+            val headerVal = nir.Val.StructValue(moduleTyVal :: meta.lockWordVals)
+            // Pre-initialized modules are emitted together with their fields
+            val (instanceTy, instanceVal) =
+              if (cls.isConstantModule) (meta.layouts.ObjectHeader.layout, headerVal)
+              else {
+                val fields = meta.preinitializedModules.fieldValues(cls)
+                (meta.layout(cls).struct, nir.Val.StructValue(headerVal +: fields))
+              }
             // Needs to be defined as var, const does not allow to modify lock-word field
             val instanceDefn = nir.Defn.Var(
               nir.Attrs.None,
               instanceName,
-              meta.layouts.ObjectHeader.layout,
+              instanceTy,
               instanceVal
             )
 
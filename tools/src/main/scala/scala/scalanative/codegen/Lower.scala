@@ -12,11 +12,12 @@ import scalanative.util.{ScopedVar, unsupported}
 private[scalanative] object Lower {
 
   def apply(
-      defns: Seq[nir.Defn]
+      defns: Seq[nir.Defn],
+      escapes: EscapeAnalysis.Result = EscapeAnalysis.Result.empty
   )(implicit meta: Metadata, logger: build.Logger): Seq[nir.Defn] =
-    (new Impl).onDefns(defns)
+    (new Impl(escapes)).onDefns(defns)
 
-  private final class Impl(implicit meta: Metadata, logger: build.Logger) extends nir.Transform {
+  private final class Impl(escapes: EscapeAnalysis.Result)(implicit meta: Metadata, logger: build.Logger) extends nir.Transform {
     import meta._
     import meta.layouts.{ArrayHeader, ClassRtti, ITable, Rtti}
 
@@ -32,6 +33,7 @@ private[scalanative] object Lower {
     val ClassRttiITableSizePath = Seq(zero, nir.Val.Int(ClassRtti.ITableSizeIdx))
     val ClassRttiItablesPath = Seq(zero, nir.Val.Int(ClassRtti.ItablesIdx))
     val ArrayHeaderLengthPath = Seq(zero, nir.Val.Int(ArrayHeader.LengthIdx))
+    val ArrayHeaderStridePath = Seq(zero, nir.Val.Int(ArrayHeader.StrideIdx))
 
     // Type of the bare runtime type information struct.
     private val classRttiType =
@@ -41,7 +43,7 @@ private[scalanative] object Lower {
     private val stringFieldNames = {
       val node = ClassRef.unapply(nir.Rt.StringName).get
       val names = layout(node).entries.map(_.name)
-      assert(names.length == 4, "java.lang.String is expected to have 4 fields")
+      assert(names.length == 5, "java.lang.String is expected to have 5 fields")
       names
     }
 
@@ -51,6 +53,8 @@ private[scalanative] object Lower {
     private implicit val currentDefn: util.ScopedVar[nir.Defn.Define] = new util.ScopedVar()
     private implicit val intrinsicMethods: util.ScopedVar[mutable.Map[nir.Local, IntrinsicCall]] = new util.ScopedVar()
     private val blockInfo = mutable.Map.empty[Block, BlockInfo]
+    // Slots in the frame of allocations which don't escape the current method
+    private val stackSlots = mutable.Map.empty[nir.Local, nir.Val]
     private var currentBlock: Block = _
     private def getCurrentBlockInfo: BlockInfo = {
       assert(currentBlock != null)
@@ -132,7 +136,10 @@ private[scalanative] object Lower {
           intrinsicMethods := mutable.Map.empty
         ) {
           try super.onDefn(defn)
-          finally blockInfo.clear()
+          finally {
+            blockInfo.clear()
+            stackSlots.clear()
+          }
         }
       case _ =>
         super.onDefn(defn)
@@ -198,9 +205,14 @@ private[scalanative] object Lower {
         }
       )
 
+      val nonEscaping = escapes.nonEscaping(defn.name)
       insts.foreach {
         case inst @ nir.Inst.Let(n, nir.Op.Var(ty), unwind) =>
           buf.let(n, nir.Op.Stackalloc(ty, one), unwind)(inst.pos, inst.scopeId)
+        case inst @ nir.Inst.Let(n, op, _) if nonEscaping.contains(n) =>
+          stackAllocatedType(op).foreach { ty =>
+            stackSlots(n) = buf.stackalloc(ty, one, nir.Next.None)(inst.pos, inst.scopeId)
+          }
         case _ => ()
       }
 
@@ -568,6 +580,8 @@ private[scalanative] object Lower {
           genSizeOfOp(buf, n, op)
         case op: nir.Op.AlignmentOf =>
           genAlignmentOfOp(buf, n, op)
+        case op @ (_: nir.Op.Classalloc | _: nir.Op.Arrayalloc) if stackSlots.contains(n) =>
+          genStackAllocatedOp(buf, n, op, stackSlots(n))
         case op: nir.Op.Classalloc =>
           genClassallocOp(buf, n, op)
         case op: nir.Op.Conv =>
@@ -980,6 +994,130 @@ private[scalanative] object Lower {
         val highBitsShift = if (isSigned) nir.Bin.Ashr else nir.Bin.Lshr
         val high64 = buf.bin(highBitsShift, nir.Type.Int128, res128, nir.Val.Int(64), nir.Next.None)
         buf.let(n, nir.Op.Conv(nir.Conv.Trunc, nir.Type.Long, high64), nir.Next.None)
+
+      case kind: IntrinsicCall.VectorOp =>
+        genVectorIntrinsicCallOp(kind, buf, n, op)
+    }
+
+    // Raw vectors are containers of bits, reinterpreted by each operation as a vector of given lanes.
+    // See scala.scalanative.runtime.Intrinsics.vector for the meaning of the literal arguments.
+    def genVectorIntrinsicCallOp(
+        kind: IntrinsicCall.VectorOp,
+        buf: nir.InstructionBuilder,
+        n: nir.Local,
+        op: nir.Op.Call
+    )(implicit srcPosition: nir.SourcePosition, scopeId: nir.ScopeId): Unit = {
+      import IntrinsicCall._
+
+      // Skips the module instance, if passed
+      val args = op.args.takeRight(kind.arity).map(genVal(buf, _))
+      def literal(value: nir.Val): Int = value match {
+        case nir.Val.Int(value) => value
+        case _                  => unsupported(s"Vector intrinsic with non-literal argument ${value.show}: ${op.show}")
+      }
+
+      val lane = literal(args.head) match {
+        case 0    => nir.Type.Byte
+        case 1    => nir.Type.Short
+        case 2    => nir.Type.Int
+        case 3    => nir.Type.Long
+        case 4    => nir.Type.Float
+        case 5    => nir.Type.Double
+        case code => unsupported(s"Unknown vector lane $code: ${op.show}")
+      }
+      val isFloating = lane.isInstanceOf[nir.Type.F]
+      val raw = kind match {
+        case VectorStore   => args(2).ty
+        case VectorExtract => args(1).ty
+        case _             => op.ty.ret
+      }
+      val lanes = (MemoryLayout.sizeOf(raw) / MemoryLayout.sizeOf(lane)).toInt
+      val shape = nir.Type.Vector(lane, lanes)
+      // Bitwise operations and comparison results use integer lanes of the same width
+      val intShape = lane match {
+        case nir.Type.Float  => nir.Type.Vector(nir.Type.Int, lanes)
+        case nir.Type.Double => nir.Type.Vector(nir.Type.Long, lanes)
+        case _               => shape
+      }
+
+      def laneIndex(value: nir.Val): Int = {
+        val index = literal(value)
+        if (index < 0 || index >= lanes) unsupported(s"Vector lane index $index out of bounds: ${op.show}")
+        index
+      }
+      def as(ty: nir.Type, value: nir.Val): nir.Val =
+        buf.conv(nir.Conv.Bitcast, ty, value, nir.Next.None)
+      def ret(value: nir.Val): Unit =
+        buf.let(n, nir.Op.Conv(nir.Conv.Bitcast, raw, value), nir.Next.None)
+      def toLane(bits: nir.Val): nir.Val = lane match {
+        case nir.Type.Long   => bits
+        case nir.Type.Double => as(nir.Type.Double, bits)
+        case nir.Type.Float  => as(nir.Type.Float, buf.conv(nir.Conv.Trunc, nir.Type.Int, bits, nir.Next.None))
+        case _               => buf.conv(nir.Conv.Trunc, lane, bits, nir.Next.None)
+      }
+      def fromLane(value: nir.Val): nir.Op = lane match {
+        case nir.Type.Long   => nir.Op.Copy(value)
+        case nir.Type.Double => nir.Op.Conv(nir.Conv.Bitcast, nir.Type.Long, value)
+        case nir.Type.Float  => nir.Op.Conv(nir.Conv.Zext, nir.Type.Long, as(nir.Type.Int, value))
+        case _               => nir.Op.Conv(nir.Conv.Sext, nir.Type.Long, value)
+      }
+
+      kind match {
+        case VectorLoad =>
+          ret(buf.load(shape, args(1), nir.Next.None))
+
+        case VectorStore =>
+          buf.let(n, nir.Op.Store(shape, args(1), as(shape, args(2))), nir.Next.None)
+
+        case VectorBroadcast =>
+          // Recognized by LLVM as a splat
+          val elem = toLane(args(1))
+          ret(0.until(lanes).foldLeft[nir.Val](nir.Val.Zero(shape)) { (vec, idx) =>
+            buf.insert(vec, elem, Seq(idx), nir.Next.None)
+          })
+
+        case VectorExtract =>
+          val elem = buf.extract(as(shape, args(1)), Seq(laneIndex(args(2))), nir.Next.None)
+          buf.let(n, fromLane(elem), nir.Next.None)
+
+        case VectorInsert =>
+          ret(buf.insert(as(shape, args(1)), toLane(args(3)), Seq(laneIndex(args(2))), nir.Next.None))
+
+        case VectorBin =>
+          val (bin, ty) = (literal(args(1)), isFloating) match {
+            case (0, false) => (nir.Bin.Iadd, shape)
+            case (0, true)  => (nir.Bin.Fadd, shape)
+            case (1, false) => (nir.Bin.Isub, shape)
+            case (1, true)  => (nir.Bin.Fsub, shape)
+            case (2, false) => (nir.Bin.Imul, shape)
+            case (2, true)  => (nir.Bin.Fmul, shape)
+            case (3, true)  => (nir.Bin.Fdiv, shape)
+            case (4, _)     => (nir.Bin.And, intShape)
+            case (5, _)     => (nir.Bin.Or, intShape)
+            case (6, _)     => (nir.Bin.Xor, intShape)
+            case (code, _)  => unsupported(s"Unknown vector operation $code for ${lane.show} lanes: ${op.show}")
+          }
+          ret(buf.bin(bin, ty, as(ty, args(2)), as(ty, args(3)), nir.Next.None))
+
+        case VectorCompare =>
+          val comp = (literal(args(1)), isFloating) match {
+            case (0, false) => nir.Comp.Ieq
+            case (0, true)  => nir.Comp.Feq
+            case (1, false) => nir.Comp.Ine
+            case (1, true)  => nir.Comp.Fne
+            case (2, false) => nir.Comp.Slt
+            case (2, true)  => nir.Comp.Flt
+            case (3, false) => nir.Comp.Sle
+            case (3, true)  => nir.Comp.Fle
+            case (4, false) => nir.Comp.Sgt
+            case (4, true)  => nir.Comp.Fgt
+            case (5, false) => nir.Comp.Sge
+            case (5, true)  => nir.Comp.Fge
+            case (code, _)  => unsupported(s"Unknown vector comparison $code: ${op.show}")
+          }
+          val mask = buf.comp(comp, shape, as(shape, args(2)), as(shape, args(3)), nir.Next.None)
+          ret(buf.conv(nir.Conv.Sext, intShape, mask, nir.Next.None))
+      }
     }
 
     // Extern functions that don't block in strict mode
@@ -1464,6 +1602,59 @@ private[scalanative] object Lower {
       }
     }
 
+    /* Objects which don't escape their method are allocated in its frame if
+     * they're small enough. Slots are reserved in the entry block, like
+     * variables, and initialized again by each execution of the allocation.
+     * Their fields are scanned by the GC together with the rest of the stack.
+     */
+    private def stackAllocatedType(op: nir.Op): Option[nir.Type] = op match {
+      case nir.Op.Classalloc(ClassRef(cls), None) if !ReferenceClass.exists(cls.is) =>
+        val layout = meta.layout(cls)
+        val alignedFields = layout.entries.exists(_.attrs.align.isDefined)
+        if (alignedFields || layout.size > MaxStackAllocatedSize) None
+        else Some(layout.struct)
+      case nir.Op.Arrayalloc(ty, nir.Val.Int(length), None) if length >= 0 =>
+        val struct = arrayMemoryLayout(ty, length)
+        if (MemoryLayout.sizeOf(struct) > MaxStackAllocatedSize) None
+        else Some(struct)
+      case _ =>
+        None
+    }
+
+    // References are tracked by the GC, they're always allocated on the heap
+    private val ReferenceClass =
+      analysis.infos.get(nir.Global.Top("java.lang.ref.Reference")).collect { case cls: Class => cls }
+
+    def genStackAllocatedOp(
+        buf: nir.InstructionBuilder,
+        n: nir.Local,
+        op: nir.Op,
+        slot: nir.Val
+    )(implicit srcPosition: nir.SourcePosition, scopeId: nir.ScopeId): Unit = {
+      val ty = stackAllocatedType(op).get
+      buf.call(
+        memsetSig,
+        memset,
+        Seq(slot, nir.Val.Int(0), nir.Val.Size(MemoryLayout.sizeOf(ty))),
+        unwind
+      )
+      op match {
+        case nir.Op.Classalloc(ClassRef(cls), _) =>
+          buf.store(nir.Type.Ptr, slot, rtti(cls).const, unwind)
+        case nir.Op.Arrayalloc(elemty, length, _) =>
+          val arrcls = analysis.infos(nir.Type.toArrayClass(elemty))
+          val stride = MemoryLayout.sizeOf(elemty).toInt
+          buf.store(nir.Type.Ptr, slot, rtti(arrcls).const, unwind)
+          val lengthPtr = buf.elem(ArrayHeader.layout, slot, ArrayHeaderLengthPath, unwind)
+          buf.store(nir.Type.Int, lengthPtr, length, unwind)
+          val stridePtr = buf.elem(ArrayHeader.layout, slot, ArrayHeaderStridePath, unwind)
+          buf.store(nir.Type.Int, stridePtr, nir.Val.Int(stride), unwind)
+        case _ =>
+          util.unreachable
+      }
+      buf.let(n, nir.Op.Copy(slot), unwind)
+    }
+
     def genConvOp(
         buf: nir.InstructionBuilder,
         n: nir.Local,
@@ -1772,7 +1963,7 @@ private[scalanative] object Lower {
       val nir.Op.Module(name) = op
 
       meta.analysis.infos(name) match {
-        case cls: Class if cls.isConstantModule =>
+        case cls: Class if meta.hasStaticInstance(cls) =>
           val instance = name.member(nir.Sig.Generated("instance"))
           buf.let(
             n,
@@ -1966,20 +2157,26 @@ private[scalanative] object Lower {
 
     def genStringVal(value: String): nir.Val = {
       val StringCls = ClassRef.unapply(nir.Rt.StringName).get
-      val CharArrayCls = ClassRef.unapply(CharArrayName).get
 
       val chars = value.toCharArray
       val charsLength = nir.Val.Int(chars.length)
+      // Strings with all chars in Latin-1 range store a single byte per char
+      val isLatin1 = isLatin1String(value)
+      val (arrayName, elemTy, stride, elems) =
+        if (isLatin1) {
+          val bytes = chars.toSeq.map(c => nir.Val.Byte(c.toByte))
+          (ByteArrayName, nir.Type.Byte, 1, bytes)
+        } else {
+          val utf16 = chars.toSeq.map(nir.Val.Char(_))
+          (CharArrayName, nir.Type.Char, 2, utf16)
+        }
       val charsConst = nir.Val.Const(
         nir.Val.StructValue(
-          rtti(CharArrayCls).const ::
+          rtti(ClassRef.unapply(arrayName).get).const ::
             meta.lockWordVals :::
             charsLength ::
-            nir.Val.Int(2) :: // stride is used only by GC
-            nir.Val.ArrayValue(
-              nir.Type.Char,
-              chars.toSeq.map(nir.Val.Char(_))
-            ) :: Nil
+            nir.Val.Int(stride) :: // stride is used only by GC
+            nir.Val.ArrayValue(elemTy, elems) :: Nil
         )
       )
 
@@ -1992,6 +2189,8 @@ private[scalanative] object Lower {
           charsLength
         case nir.Rt.StringCachedHashCodeName =>
           nir.Val.Int(stringHashCode(value))
+        case nir.Rt.StringCoderName =>
+          nir.Val.Int(if (isLatin1) StringLatin1Coder else StringUTF16Coder)
         case _ =>
           util.unreachable
       }
@@ -2058,6 +2257,28 @@ private[scalanative] object Lower {
     object MultiplyHigh extends IntrinsicCall
     object UnsignedMultiplyHigh extends IntrinsicCall
 
+    /** An operation of scala.scalanative.runtime.Intrinsics.vector taking `arity` arguments. */
+    sealed abstract class VectorOp(val arity: Int) extends IntrinsicCall
+    object VectorLoad extends VectorOp(2)
+    object VectorStore extends VectorOp(3)
+    object VectorBroadcast extends VectorOp(2)
+    object VectorExtract extends VectorOp(3)
+    object VectorInsert extends VectorOp(4)
+    object VectorBin extends VectorOp(4)
+    object VectorCompare extends VectorOp(4)
+
+    private val vectorOps = Map[String, VectorOp](
+      "load128" -> VectorLoad,
+      "load256" -> VectorLoad,
+      "store" -> VectorStore,
+      "broadcast128" -> VectorBroadcast,
+      "broadcast256" -> VectorBroadcast,
+      "extract" -> VectorExtract,
+      "insert" -> VectorInsert,
+      "bin" -> VectorBin,
+      "compare" -> VectorCompare
+    )
+
     private def resolveIntrinsicCall(owner: nir.Global.Top, sig: nir.Sig)(implicit
         metadata: Metadata,
         logger: build.Logger,
@@ -2068,6 +2289,7 @@ private[scalanative] object Lower {
         case ("scala.scalanative.runtime.LinkedClassesRepository$", nir.Sig.Method("loadAll", _, _)) => Some(LoadAllClassess)
         case ("scala.scalanative.runtime.Intrinsics$", nir.Sig.Method("multiplyHigh", _, _))         => Some(MultiplyHigh)
         case ("scala.scalanative.runtime.Intrinsics$", nir.Sig.Method("unsignedMultiplyHigh", _, _)) => Some(UnsignedMultiplyHigh)
+        case ("scala.scalanative.runtime.Intrinsics$vector$", nir.Sig.Method(id, _, _))             => vectorOps.get(id)
 
         case (_, nir.Sig.Method("intrinsic", _, _)) if owner == nir.Rt.Runtime.name =>
           val symbol @ nir.Global.Member(owner, sig) = currentDefn.get.name
@@ -2120,6 +2342,7 @@ private[scalanative] object Lower {
     }
 
   val LARGE_OBJECT_MIN_SIZE = 8192
+  val MaxStackAllocatedSize = 256
 
   val allocSig: nir.Type.Function =
     nir.Type.Function(Seq(nir.Type.Ptr, nir.Type.Size), nir.Type.Ptr)
@@ -2160,6 +2383,15 @@ private[scalanative] object Lower {
 
   val CharArrayName =
     nir.Global.Top("scala.scalanative.runtime.CharArray")
+  val ByteArrayName =
+    nir.Global.Top("scala.scalanative.runtime.ByteArray")
+
+  // Values of java.lang.String.coder, see java.lang._String
+  val StringLatin1Coder = 0
+  val StringUTF16Coder = 1
+
+  def isLatin1String(value: String): Boolean =
+    value.forall(_ <= 0xff)
 
   val BoxesRunTime = nir.Global.Top("scala.runtime.BoxesRunTime$")
   val RuntimeBoxes = nir.Global.Top("scala.scalanative.runtime.Boxes$")
@@ -2473,6 +2705,7 @@ private[scalanative] object Lower {
     buf += nir.Rt.StringName
     buf ++= nir.Rt.jlStringFields
     buf += CharArrayName
+    buf += ByteArrayName
     buf += BoxesRunTime
     buf += RuntimeBoxes
     buf += unitName
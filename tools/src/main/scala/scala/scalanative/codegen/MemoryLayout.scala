@@ -63,6 +63,8 @@ private[scalanative] object MemoryLayout {
         math.max(t.width / BITS_IN_BYTE, 1)
       case nir.Type.ArrayValue(ty, n) =>
         sizeOf(ty) * n
+      case nir.Type.Vector(ty, n) =>
+        sizeOf(ty) * n
       case nir.Type.StructValue(tys) =>
         MemoryLayout(tys).size
       case _ =>
@@ -79,6 +81,10 @@ private[scalanative] object MemoryLayout {
         math.max(t.width / BITS_IN_BYTE, 1)
       case nir.Type.ArrayValue(ty, n) =>
         alignmentOf(ty)
+      // Vectors are loaded from and stored to memory which is only known
+      // to be aligned for their lanes, e.g. elements of arrays.
+      case nir.Type.Vector(ty, n) =>
+        alignmentOf(ty)
       case nir.Type.StructValue(Seq()) =>
         1
       case nir.Type.StructValue(tys) =>
@@ -28,6 +28,7 @@ private[scalanative] class Metadata(
 
   val classes = initClassIdsAndRanges()
   val (traits, traitIdsContext) = initTraitIds()
+  val preinitializedModules = new PreinitializedModules(this)
   val moduleArray = new ModuleArray(this)
 
   initTraitMetadata()
@@ -35,6 +36,10 @@ private[scalanative] class Metadata(
 
   val canAlwaysUseFastITables = rtti.valuesIterator.forall(_.canUseFastITables)
 
+  /** Modules with an instance emitted as data, which are never initialized. */
+  def hasStaticInstance(cls: Class): Boolean =
+    cls.isConstantModule(analysis) || preinitializedModules.contains(cls)
+
   def initTraitIds(): (Seq[Trait], TraitsUniverse.TraitId.Context) = {
     val traits = analysis.infos.valuesIterator.collect {
       case info: Trait => info
@@ -20,7 +20,7 @@ private[codegen] class ModuleArray(meta: Metadata) {
     nir.Val.ArrayValue(
       nir.Type.Ptr,
       modules.toSeq.map { cls =>
-        if (cls.isConstantModule(meta.analysis))
+        if (meta.hasStaticInstance(cls))
           nir.Val.Global(
             cls.name.member(nir.Sig.Generated("instance")),
             nir.Type.Ptr
@@ -0,0 +1,176 @@
+package scala.scalanative
+package codegen
+
+import scala.collection.mutable
+
+import scalanative.linker.Class
+
+/** Modules whose instances are built while linking and emitted as data.
+ *
+ *  A module qualifies if its optimized constructor only stores constants to
+ *  the fields of the instance: primitives, strings, null and instances of
+ *  other modules which don't need to be initialized. Interflow has already
+ *  inlined and folded pure constructors, so those are the ones left in this
+ *  shape. The collector doesn't trace objects outside of the heap, fields
+ *  stored to anywhere else can't be part of a snapshot.
+ *
+ *  Accessing such a module loads its instance directly, its constructor is
+ *  never called.
+ */
+private[codegen] class PreinitializedModules(meta: Metadata) {
+
+  // Snapshots are taken of optimized constructors only
+  private val isEnabled = meta.buildConfig.mode match {
+    case _: build.Mode.Release => meta.config.optimize
+    case _                     => false
+  }
+
+  // Only indexed by builds taking snapshots
+  private lazy val defines = meta.analysis.defns.collect {
+    case defn: nir.Defn.Define => defn.name -> defn
+  }.toMap
+
+  // Fields stored to by anything but the constructor of their instance
+  private lazy val mutatedFields: Set[nir.Global] = {
+    val out = mutable.Set.empty[nir.Global]
+    defines.values.foreach { defn =>
+      val self = defn.insts.headOption.collect {
+        case nir.Inst.Label(_, nir.Val.Local(self, _) +: _)
+            if defn.name.sig.isCtor =>
+          self
+      }
+      defn.insts.foreach {
+        case nir.Inst.Let(_, nir.Op.Fieldstore(_, obj, name, _), _) =>
+          obj match {
+            case nir.Val.Local(n, _) if self.contains(n) => ()
+            case _                                       => out += name
+          }
+        case nir.Inst.Let(_, nir.Op.Field(_, name), _) =>
+          out += name
+        case _ =>
+          ()
+      }
+    }
+    out.toSet
+  }
+
+  private val snapshots = mutable.Map.empty[Class, Option[Seq[nir.Val]]]
+  private val visiting = mutable.Set.empty[Class]
+
+  meta.classes.foreach { cls =>
+    if (isEnabled && cls.isModule && cls.allocated) snapshot(cls)
+  }
+
+  def contains(cls: Class): Boolean =
+    snapshots.get(cls).exists(_.isDefined)
+
+  /** Values of the fields of module `cls`, in the order of their layout. */
+  def fieldValues(cls: Class): Seq[nir.Val] = snapshots(cls).get
+
+  private def instanceOf(name: nir.Global.Top): Option[nir.Val] =
+    meta.analysis.infos.get(name).collect {
+      case cls: Class
+          if cls.isModule && (cls.isConstantModule(meta.analysis) ||
+            snapshot(cls).isDefined) =>
+        nir.Val.Global(name.member(nir.Sig.Generated("instance")), nir.Type.Ptr)
+    }
+
+  private def snapshot(cls: Class): Option[Seq[nir.Val]] =
+    snapshots.get(cls) match {
+      case Some(result) => result
+      // Modules on a cycle are initialized at runtime
+      case None if visiting.contains(cls) => None
+      case None                           =>
+        visiting += cls
+        val result =
+          if (cls.isConstantModule(meta.analysis)) None
+          else evaluate(cls)
+        visiting -= cls
+        snapshots(cls) = result
+        result
+    }
+
+  private def isTrivial(name: nir.Global): Boolean =
+    defines.get(name).exists { defn =>
+      defn.insts match {
+        case Seq(_: nir.Inst.Label, _: nir.Inst.Ret) => true
+        case _                                       => false
+      }
+    }
+
+  private def evaluate(cls: Class): Option[Seq[nir.Val]] = {
+    val hasPlainFields = cls.fields.forall { fld =>
+      fld.attrs.align.isEmpty && !mutatedFields.contains(fld.name)
+    }
+    val ctor = defines.get(cls.name.member(nir.Sig.Ctor(Seq.empty)))
+    if (!hasPlainFields) None
+    else
+      ctor.fold[Option[Seq[nir.Val]]] {
+        Some(cls.fields.map(fld => nir.Val.Zero(fld.ty)))
+      } { defn =>
+        val nir.Inst.Label(_, nir.Val.Local(self, _) +: _) =
+          defn.insts.head: @unchecked
+        val fields = mutable.Map.empty[nir.Global, nir.Val]
+        val locals = mutable.Map.empty[nir.Local, nir.Val]
+
+        def eval(value: nir.Val): Option[nir.Val] = value match {
+          case nir.Val.Local(n, _)                    => locals.get(n)
+          case _: nir.Val.Global | _: nir.Val.ClassOf => None
+          case v if v.isCanonical || v.isZero         => Some(v)
+          case v @ (_: nir.Val.String | nir.Val.Unit) => Some(v)
+          case _                                      => None
+        }
+        def isSelf(value: nir.Val) = value match {
+          case nir.Val.Local(`self`, _) => true
+          case _                        => false
+        }
+        def zero(name: nir.Global) =
+          cls.fields.find(_.name == name).map(fld => nir.Val.Zero(fld.ty))
+
+        // Straight-line code, blocks are only split by unconditional jumps
+        val insts = defn.insts.tail
+        val isEvaluated = insts.indices.forall { idx =>
+          insts(idx) match {
+            case nir.Inst.Let(n, op, _) =>
+              val result = op match {
+                case nir.Op.Copy(v) =>
+                  eval(v)
+                case nir.Op.Module(name) =>
+                  instanceOf(name)
+                case nir.Op.Fieldload(_, obj, name) if isSelf(obj) =>
+                  fields.get(name).orElse(zero(name))
+                case nir.Op.Fieldstore(_, obj, name, v) if isSelf(obj) =>
+                  eval(v).map { value =>
+                    fields(name) = value
+                    nir.Val.Unit
+                  }
+                case nir.Op.Call(_, nir.Val.Global(callee, _), _)
+                    if isTrivial(callee) =>
+                  Some(nir.Val.Unit)
+                case _ =>
+                  None
+              }
+              result.foreach(locals(n) = _)
+              result.isDefined
+            case nir.Inst.Jump(nir.Next.Label(target, Seq())) =>
+              insts.lift(idx + 1).exists {
+                case nir.Inst.Label(`target`, Seq()) => true
+                case _                               => false
+              }
+            case nir.Inst.Label(_, Seq()) =>
+              idx > 0 && insts(idx - 1).isInstanceOf[nir.Inst.Jump]
+            case nir.Inst.Ret(_) =>
+              idx == insts.size - 1
+            case _ =>
+              false
+          }
+        }
+
+        if (!isEvaluated) None
+        else
+          Some(cls.fields.map { fld =>
+            fields.getOrElse(fld.name, nir.Val.Zero(fld.ty))
+          })
+      }
+  }
+}
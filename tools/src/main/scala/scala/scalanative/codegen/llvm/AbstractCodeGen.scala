@@ -1,7 +1,8 @@
 package scala.scalanative.codegen
 package llvm
 
-import java.nio.file.{Path, Paths}
+import java.io.Writer
+import java.nio.file.{Files, Path, Paths}
 import java.{lang => jl}
 
 import scala.collection.mutable
@@ -85,6 +86,36 @@ private[codegen] abstract class AbstractCodeGen(
     dir.merge(Seq(body, metadata), headers)
   }
 
+  /** Generates the module straight to `output`. Globals can be referenced
+   *  before being defined, so unlike in [[gen]] the body does not need to be
+   *  buffered until all of its dependencies are known. Only metadata, emitted
+   *  alongside the body, is buffered in `dir`.
+   */
+  def gen(id: String, dir: VirtualDirectory, output: Writer): Unit = {
+    val metadata = Paths.get(s"$id-metadata.ll")
+
+    val metadataPath = dir.write(metadata) { metadataWriter =>
+      implicit val metadata: MetadataCodeGen.Context =
+        new MetadataCodeGen.Context(this, new FileShowBuilder(metadataWriter))
+      implicit val sb: ShowBuilder = new FileShowBuilder(output)
+      genPlatformMetadata()
+      genPrelude()
+      genDefns(defns)
+      genConsts()
+      genDeps()
+      dbg("llvm.dbg.cu")(this.compilationUnits: _*)
+    }
+
+    val reader = Files.newBufferedReader(metadataPath)
+    try {
+      val buffer = new Array[Char](64 * 1024)
+      var read = 0
+      while ({ read = reader.read(buffer); read >= 0 })
+        output.write(buffer, 0, read)
+    } finally reader.close()
+    Files.delete(metadataPath)
+  }
+
   private def genPlatformMetadata()(implicit
       ctx: MetadataCodeGen.Context
   ): Unit = {
@@ -313,6 +344,9 @@ private[codegen] abstract class AbstractCodeGen(
         implicit val cfg: CFG = CFG(insts)
         implicit val _fresh: nir.Fresh = fresh
         implicit val _debugInfo: DebugInfo = debugInfo
+        // Frame pointer preservation of .ll files is controlled by function
+        // attributes, clang flags affects only C/C++ sources
+        if (config.framePointers) str(" \"frame-pointer\"=\"all\"")
         str(" ")
         str(os.gxxPersonality)
         def genBody() = {
@@ -531,6 +565,12 @@ private[codegen] abstract class AbstractCodeGen(
         str("{ ")
         rep(tys, sep = ", ")(genType)
         str(" }")
+      case nir.Type.Vector(ty, n) =>
+        str("<")
+        str(n)
+        str(" x ")
+        genType(ty)
+        str(">")
       case nir.Type.Function(args, ret) =>
         genType(ret)
         str(" (")
@@ -873,6 +913,10 @@ private[codegen] abstract class AbstractCodeGen(
               str(" !{i64 ")
               str(size)
               str("}")
+            case _: nir.Type.Vector =>
+              // LLVM would otherwise assume the natural vector alignment
+              str(", align ")
+              str(MemoryLayout.alignmentOf(ty))
             case _ =>
               ()
           }
@@ -1185,6 +1229,20 @@ private[codegen] abstract class AbstractCodeGen(
   private[codegen] def genOp(op: nir.Op)(implicit sb: ShowBuilder): Unit = {
     import sb._
     op match {
+      case nir.Op.Extract(aggr, Seq(index))
+          if aggr.ty.isInstanceOf[nir.Type.Vector] =>
+        str("extractelement ")
+        genVal(aggr)
+        str(", i32 ")
+        str(index)
+      case nir.Op.Insert(aggr, value, Seq(index))
+          if aggr.ty.isInstanceOf[nir.Type.Vector] =>
+        str("insertelement ")
+        genVal(aggr)
+        str(", ")
+        genVal(value)
+        str(", i32 ")
+        str(index)
       case nir.Op.Extract(aggr, indexes) =>
         str("extractvalue ")
         genVal(aggr)
@@ -11,7 +11,7 @@ import scala.util.Success
 
 import scala.scalanative.build
 import scala.scalanative.build.ScalaNative.{dumpDefns, encodedMainClass}
-import scala.scalanative.build.{Build, Config, IO}
+import scala.scalanative.build.{Build, Config, IO, LLVM}
 import scala.scalanative.codegen.llvm.compat.os.OsCompat
 import scala.scalanative.codegen.{Metadata => CodeGenMetadata}
 import scala.scalanative.io.VirtualDirectory
@@ -39,7 +39,7 @@ object CodeGen {
     val lowered = lower(generated ++ embedded)
     lowered
       .andThen { case Success(defns) => dumpDefns(config, "lowered", defns) }
-      .map(emit(config, _))
+      .map(emit(config, analysis, _))
   }
 
   private[scalanative] def lower(
@@ -50,8 +50,17 @@ object CodeGen {
       ec: ExecutionContext
   ): Future[Seq[nir.Defn]] = {
 
+    // Stack allocation is an optimization of release builds
+    val escapes = meta.buildConfig.mode match {
+      case _: build.Mode.Release
+          if meta.config.optimize &&
+            !EscapeAnalysis.movesFrames(defns, meta.config) =>
+        EscapeAnalysis(defns)
+      case _ =>
+        EscapeAnalysis.Result.empty
+    }
     val loweringJobs = partitionBy(defns)(_.name).map {
-      case (_, defns) => Future(Lower(defns))
+      case (_, defns) => Future(Lower(defns, escapes))
     }
 
     Future
@@ -64,7 +73,11 @@ object CodeGen {
   private final val EmptyPath = "__empty"
 
   /** Generate code for given assembly. */
-  private def emit(config: build.Config, assembly: Seq[nir.Defn])(implicit
+  private def emit(
+      config: build.Config,
+      analysis: ReachabilityAnalysis.Result,
+      assembly: Seq[nir.Defn]
+  )(implicit
       meta: CodeGenMetadata,
       ec: ExecutionContext
   ): IRGenerators =
@@ -81,6 +94,17 @@ object CodeGen {
         defn.pos.source.directory
           .getOrElse(EmptyPath)
 
+      // Streamed IR is compiled while being generated, producing objects
+      val streamIR = config.compilerConfig.streamIR
+      def objectPath(id: String): Path =
+        outputDirPath.resolve(id + LLVM.llExt + LLVM.oExt)
+      def gen(codeGen: AbstractCodeGen, id: String): Path =
+        if (!streamIR) codeGen.gen(id, outputDir)
+        else
+          LLVM.compileStreamed(config, analysis, objectPath(id)) {
+            codeGen.gen(id, outputDir, _)
+          }
+
       // Partition into multiple LLVM IR files proportional to number
       // of available processors. This prevents LLVM from optimizing
       // across IR module boundary unless LTO is turned on.
@@ -89,7 +113,7 @@ object CodeGen {
           case (id, defns) =>
             Future {
               val sorted = defns.sortBy(_.name)
-              Impl(env, sorted, sourceCodeCache).gen(id.toString, outputDir)
+              gen(Impl(env, sorted, sourceCodeCache), id.toString)
             }
         }
 
@@ -118,15 +142,18 @@ object CodeGen {
           case (dir, defns) =>
             Future {
               val hash = dir.hashCode().toHexString
-              val outFile = outputDirPath.resolve(s"$hash.ll")
+              val outFile =
+                if (streamIR) objectPath(hash)
+                else outputDirPath.resolve(s"$hash.ll")
               val ownerDirectory = outFile.getParent()
 
               ctx.addEntry(hash, defns)
-              if (ctx.shouldCompile(hash)) {
+              if (ctx.shouldCompile(hash) ||
+                  streamIR && !Files.exists(outFile)) {
                 val sorted = defns.sortBy(_.name)
                 if (!Files.exists(ownerDirectory))
                   Files.createDirectories(ownerDirectory)
-                Impl(env, sorted, sourceCodeCache).gen(hash, outputDir)
+                gen(Impl(env, sorted, sourceCodeCache), hash)
               } else {
                 assert(ownerDirectory.toFile.exists())
                 config.logger.debug(
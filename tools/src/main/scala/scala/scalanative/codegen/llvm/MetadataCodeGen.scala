@@ -453,6 +453,14 @@ private[codegen] trait MetadataCodeGen { self: AbstractCodeGen =>
           size = MemoryLayout.sizeOf(ty).toDISize
         ).withElements(DISubrange(count = n.const) :: Nil)
 
+      case Vector(elemTy, n) =>
+        new DICompositeType(
+          tag = DWTag.Array,
+          baseType = toMetadataType(elemTy),
+          size = MemoryLayout.sizeOf(ty).toDISize,
+          flags = DIFlags(DIFlag.DIFlagVector)
+        ).withElements(DISubrange(count = n.const) :: Nil)
+
       case ty: nir.Type.ValueKind => DIBasicTypes(ty)
 
       case ArrayRef(componentCls, _) =>
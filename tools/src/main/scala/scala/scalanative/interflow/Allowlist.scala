@@ -10,6 +10,7 @@ private[scalanative] object Allowlist {
   val constantModules = {
     val out = collection.mutable.Set.empty[nir.Global]
     out += nir.Global.Top("scala.scalanative.runtime.BoxedUnit$")
+    out += nir.Global.Top("scala.scalanative.runtime.Intrinsics$vector$")
     out += nir.Global.Top("scala.scalanative.runtime.LazyVals$")
     out += nir.Global.Top("scala.scalanative.runtime.MemoryLayout$")
     out += nir.Global.Top("scala.scalanative.runtime.MemoryLayout$Array$")
@@ -1041,12 +1041,21 @@ private[interflow] trait Eval { self: Interflow =>
     offset >= 0 && offset < length
   }
 
-  private def isPureModule(clsName: nir.Global.Top): Boolean = {
+  def isPureModule(clsName: nir.Global.Top): Boolean = {
     var visiting = List[nir.Global.Top]()
+    // Modules on a cycle are impure whichever of them is checked first, but
+    // purity of constructors cut by the optimized method depends on it and
+    // is never shared with other methods
+    var hasCut = false
+    val purity = mutable.Map.empty[nir.Global.Top, Boolean]
 
     def isPureModule(clsName: nir.Global.Top): Boolean = {
       if (hasModulePurity(clsName)) {
         getModulePurity(clsName)
+      } else if (purity.contains(clsName)) {
+        purity(clsName)
+      } else if (visiting.contains(clsName)) {
+        false
       } else {
         visiting = clsName :: visiting
 
@@ -1057,7 +1066,9 @@ private[interflow] trait Eval { self: Interflow =>
               isPureModuleCtor
             )
 
-        setModulePurity(clsName, isPure)
+        visiting = visiting.tail
+        hasCut ||= isCut(init)
+        purity(clsName) = isPure
         isPure
       }
     }
@@ -1113,11 +1124,7 @@ private[interflow] trait Eval { self: Interflow =>
             ) =>
           true
         case inst @ nir.Inst.Let(_, nir.Op.Module(name), _) =>
-          if (!visiting.contains(name)) {
-            isPureModule(name)
-          } else {
-            false
-          }
+          isPureModule(name)
         case nir.Inst.Let(_, nir.Op.Fieldload(_, nir.Val.Local(to, _), _), _)
             if canStoreTo.contains(to) =>
           true
@@ -1156,6 +1163,11 @@ private[interflow] trait Eval { self: Interflow =>
       }
     }
 
-    isPureModule(clsName)
+    val isPure = isPureModule(clsName)
+    if (!hasCut) {
+      purity.foreach { case (name, value) => setModulePurity(name, value) }
+    }
+    recordPurity(clsName, isPure)
+    isPure
   }
 }
@@ -1,12 +1,16 @@
 package scala.scalanative
 package interflow
 
+import java.util.concurrent.ConcurrentHashMap
 import java.util.function.Supplier
 
 import scala.collection.mutable
 import scala.concurrent._
 
 import scala.scalanative.codegen.PlatformInfo
+import scala.scalanative.interflow.OptimizationCache.{
+  Callee, Dependency, Entry, Optimized, Original, Purity, Stats
+}
 import scala.scalanative.linker._
 import scala.scalanative.nir.Defn.Define.DebugInfo
 import scala.scalanative.util.ScopedVar
@@ -31,12 +35,60 @@ private[scalanative] class Interflow(val config: build.Config)(implicit
   }
 
   private val todo = mutable.Queue.empty[nir.Global.Member]
-  private val done = mutable.Map.empty[nir.Global.Member, nir.Defn.Define]
-  private val started = mutable.Set.empty[nir.Global.Member]
-  private val denylist = mutable.Set.empty[nir.Global.Member]
   private val reached = mutable.HashSet.empty[nir.Global.Member]
+  // Submits a job visiting the next method in todo, set by the visit loop
+  private var spawn: () => Unit = null
+  private val done = new ConcurrentHashMap[nir.Global.Member, nir.Defn.Define]
+  private val tasks = mutable.HashMap.empty[nir.Global.Member, Task]
   private val modulePurity = mutable.Map.empty[nir.Global.Top, Boolean]
 
+  // Methods optimized by the previous build, see OptimizationCache
+  private val useCache = mode match {
+    case build.Mode.Debug      => false
+    case _: build.Mode.Release =>
+      config.compilerConfig.useIncrementalCompilation &&
+        !config.compilerConfig.sourceLevelDebuggingConfig.enabled
+  }
+  private val cacheDirectory = config.workDir.resolve("interflow")
+  private val world =
+    if (useCache) OptimizationCache.world(config, analysis) else ""
+  private val cached =
+    if (useCache) OptimizationCache.load(cacheDirectory, world)
+    else Map.empty[String, Entry]
+  private val entries = new ConcurrentHashMap[nir.Global.Member, Entry]
+  private val reused = ConcurrentHashMap.newKeySet[nir.Global.Member]()
+
+  /* Methods are optimized by jobs running in parallel, a method inlining its
+   * callees optimizes them first on the same thread, each in a fresh context.
+   * Results never depend on the scheduling of jobs: a method waiting for a
+   * callee optimized on another thread is aborted and restarted once the
+   * callee is done. Methods waiting for each other form a cycle, which is
+   * broken by its smallest member, it treats its callee as not optimized.
+   */
+  private final class Task(val name: nir.Global.Member) {
+    // Guarded by tasks
+    var running = false
+    var waitingOn: Task = null
+    var waiters: List[Task] = Nil
+    // Digest of the original method, computed on first run
+    var key: String = null
+    // Callees on a cycle with this method, written by its own thread
+    @volatile var cuts: Set[nir.Global.Member] = Set.empty
+  }
+  private final class Frame(val task: Task) {
+    // Callees as seen by this method, including the originals they shadow
+    val seen = mutable.Map.empty[nir.Global.Member, nir.Defn.Define]
+    // Recorded for the cache in the order they were checked
+    val dependencies = mutable.UnrolledBuffer.empty[Dependency]
+    val roots = mutable.UnrolledBuffer.empty[nir.Global.Member]
+  }
+  private case object Blocked
+      extends Exception
+      with scala.util.control.NoStackTrace
+  private final case class CutTo(task: Task)
+      extends Exception
+      with scala.util.control.NoStackTrace
+
   def currentFreshScope = freshScopeTl.get()
   private val freshScopeTl =
     ThreadLocal.withInitial(() => new ScopedVar[nir.Fresh])
@@ -78,6 +130,8 @@ private[scalanative] class Interflow(val config: build.Config)(implicit
     ThreadLocal.withInitial(() => List.empty[MergeProcessor])
   private val blockFreshTl =
     ThreadLocal.withInitial(() => List.empty[nir.Fresh])
+  private val framesTl =
+    ThreadLocal.withInitial(() => List.empty[Frame])
 
   def hasOriginal(name: nir.Global.Member): Boolean =
     originals.contains(name) && originals(name).isInstanceOf[nir.Defn.Define]
@@ -94,53 +148,250 @@ private[scalanative] class Interflow(val config: build.Config)(implicit
         todo.dequeue()
       }
     }
-  def pushTodo(name: nir.Global.Member): Unit =
-    todo.synchronized {
-      if (!reached.contains(name)) {
-        todo.enqueue(name)
-        reached += name
+  def pushTodo(name: nir.Global.Member): Unit = {
+    if (useCache) framesTl.get.headOption.foreach(_.roots += name)
+    val isNew = todo.synchronized(reached.add(name))
+    if (isNew) enqueueTodo(name)
+  }
+  private def enqueueTodo(name: nir.Global.Member): Unit = {
+    val spawn = todo.synchronized {
+      todo.enqueue(name)
+      this.spawn
+    }
+    if (spawn != null) spawn()
+  }
+  def startTodo(spawn: () => Unit): Unit = {
+    val pending = todo.synchronized {
+      this.spawn = spawn
+      todo.size
+    }
+    (0 until pending).foreach(_ => spawn())
+  }
+
+  /** Optimizes `name` unless it's done or visited by another job. */
+  def visitTodo(name: nir.Global.Member): Unit = {
+    val task = tasks.synchronized {
+      if (done.containsKey(name)) null
+      else {
+        val task = tasks.getOrElseUpdate(name, new Task(name))
+        if (task.running || task.waitingOn != null) null
+        else {
+          task.running = true
+          task
+        }
       }
     }
-  def allTodo(): Seq[nir.Global.Member] =
-    todo.synchronized {
-      todo.toSeq
+    if (task != null) {
+      try runTask(task)
+      catch { case Blocked => () }
     }
+  }
 
-  def isDone(name: nir.Global.Member): Boolean =
-    done.synchronized {
-      done.contains(name)
+  /** Optimized `name` as seen by the method optimized on this thread, none
+   *  if it's on a cycle of methods waiting for each other.
+   */
+  def awaitDone(name: nir.Global.Member): Option[nir.Defn.Define] = {
+    val frame = framesTl.get.head
+    val result = await(frame.task, name)
+    result.foreach { defn =>
+      frame.seen(name) = defn
+      frame.seen(defn.name) = defn
     }
-  def setDone(name: nir.Global.Member, value: nir.Defn.Define) =
-    done.synchronized {
-      done(name) = value
+    if (useCache) {
+      frame.dependencies += Callee(name, result.map(_ => digest(name)))
     }
-  def getDone(name: nir.Global.Member): nir.Defn.Define =
-    done.synchronized {
-      done(name)
+    result
+  }
+
+  private def await(
+      caller: Task,
+      name: nir.Global.Member
+  ): Option[nir.Defn.Define] =
+    if (caller.cuts.contains(name)) None
+    else {
+      val defn = done.get(name)
+      if (defn != null) Some(defn)
+      else
+        tasks.synchronized(dependOn(caller, name)) match {
+          case Some(callee) =>
+            try {
+              val defn = runTask(callee)
+              tasks.synchronized { caller.waitingOn = null }
+              Some(defn)
+            } catch {
+              case CutTo(task) if task eq caller => None
+            }
+          case None if caller.cuts.contains(name) =>
+            None
+          case None =>
+            Some(done.get(name))
+        }
     }
-  def maybeDone(name: nir.Global.Member): Option[nir.Defn.Define] =
-    done.synchronized {
-      done.get(name)
+
+  // Callee to optimize on this thread, none if it's done or cut
+  private def dependOn(
+      caller: Task,
+      name: nir.Global.Member
+  ): Option[Task] =
+    if (done.containsKey(name)) None
+    else {
+      val callee = tasks.getOrElseUpdate(name, new Task(name))
+      caller.waitingOn = callee
+      if (!callee.running && callee.waitingOn == null) {
+        callee.running = true
+        Some(callee)
+      } else {
+        // Only methods on the stack of this thread are running and waiting
+        val cycle = mutable.UnrolledBuffer.empty[Task]
+        var task = callee
+        while (task != null && (task ne caller)) {
+          cycle += task
+          task = task.waitingOn
+        }
+        if (task == null) throw Blocked
+        cycle += caller
+        val cut = cycle.minBy(task => task.name: nir.Global)
+        cut.cuts += cut.waitingOn.name
+        cut.waitingOn = null
+        if (cut eq caller) None
+        else if (cut.running) throw CutTo(cut)
+        else {
+          enqueueTodo(cut.name)
+          throw Blocked
+        }
+      }
     }
 
-  def hasStarted(name: nir.Global.Member): Boolean =
-    started.synchronized {
-      started.contains(name)
+  private def runTask(task: Task): nir.Defn.Define = {
+    val backtrace = inliningBacktraceTl.get
+    inliningBacktraceTl.set(new SymbolsStack())
+    framesTl.set(new Frame(task) :: framesTl.get)
+    try {
+      val previous = reuse(task)
+      val defn = previous.getOrElse(visitMethod(task.name))
+      if (useCache) {
+        if (previous.isDefined) reused.add(task.name)
+        val frame = framesTl.get.head
+        val result = defn.attrs.opt match {
+          case nir.Attr.BailOpt(msg) =>
+            Original(defn.name, Some(msg))
+          case _ if originals.get(defn.name).exists(_ eq defn) =>
+            Original(defn.name, None)
+          case _ =>
+            Optimized(defn)
+        }
+        val deps = frame.dependencies.toSeq
+        val entry = Entry(task.name, task.key, deps, frame.roots.toSeq, result)
+        entries.put(task.name, entry)
+      }
+      val ready = tasks.synchronized {
+        done.put(task.name, defn)
+        task.running = false
+        val ready = task.waiters.filter(_.waitingOn eq task)
+        ready.foreach(_.waitingOn = null)
+        task.waiters = Nil
+        ready
+      }
+      ready.foreach(waiter => enqueueTodo(waiter.name))
+      defn
+    } catch {
+      case ex @ (Blocked | _: CutTo) =>
+        val ready = tasks.synchronized {
+          task.running = false
+          val callee = task.waitingOn
+          if (callee == null || done.containsKey(callee.name)) {
+            task.waitingOn = null
+            true
+          } else {
+            callee.waiters ::= task
+            false
+          }
+        }
+        if (ready) enqueueTodo(task.name)
+        throw ex
+    } finally {
+      framesTl.set(framesTl.get.tail)
+      inliningBacktraceTl.set(backtrace)
     }
-  def markStarted(name: nir.Global.Member): Unit =
-    started.synchronized {
-      started += name
+  }
+
+  // Result of the previous build, if everything it depends on is unchanged
+  private def reuse(task: Task): Option[nir.Defn.Define] =
+    if (!useCache) None
+    else {
+      if (task.key == null) {
+        val orig = getOriginal(originalName(task.name))
+        task.key = OptimizationCache.key(world, task.name, orig)
+      }
+      cached.get(task.key).flatMap { entry =>
+        // Checked in the same order, until the first changed dependency
+        val frame = framesTl.get.head
+        val isValid = entry.dependencies.forall {
+          case dep @ Callee(name, _) =>
+            awaitDone(name)
+            frame.dependencies.last == dep
+          case dep @ Purity(name, _) =>
+            isPureModule(name)
+            frame.dependencies.last == dep
+        }
+        if (!isValid) {
+          frame.seen.clear()
+          frame.dependencies.clear()
+          None
+        } else {
+          entry.roots.foreach(pushTodo)
+          entry.result match {
+            case Optimized(defn) =>
+              Some(defn)
+            case Original(name, None) =>
+              Some(getOriginal(name))
+            case Original(name, Some(msg)) =>
+              Some(bailedOut(getOriginal(name), msg))
+          }
+        }
+      }
     }
 
-  def isDenylisted(name: nir.Global.Member): Boolean =
-    denylist.synchronized {
-      denylist.contains(name)
+  private def digest(name: nir.Global.Member): String =
+    entries.get(name).digest
+
+  def recordPurity(name: nir.Global.Top, isPure: Boolean): Unit =
+    if (useCache) {
+      framesTl.get.head.dependencies += Purity(name, isPure)
     }
-  def markDenylisted(name: nir.Global.Member): Unit =
-    denylist.synchronized {
-      denylist += name
+
+  /** Persists entries of all methods optimized by this build. */
+  def saveCache(): Unit =
+    if (useCache) {
+      val saved = mutable.ArrayBuffer.empty[Entry]
+      entries.forEach((_, entry) => saved += entry)
+      val sorted = saved.sortBy(_.name: nir.Global).toSeq
+      OptimizationCache.save(cacheDirectory, world, sorted)
+      val stats = cacheStats
+      config.logger.debug(
+        s"Reused ${stats.hits} of ${stats.hits + stats.misses} methods " +
+          "optimized by the previous build"
+      )
     }
 
+  /** Methods of this build reused from the cache and optimized anew. */
+  def cacheStats: Stats = {
+    val names = mutable.Set.empty[nir.Global.Member]
+    entries.forEach((name, _) => names += name)
+    val (hits, misses) = names.toSet.partition(reused.contains)
+    Stats(hits, misses)
+  }
+
+  def maybeDone(name: nir.Global.Member): Option[nir.Defn.Define] =
+    framesTl.get.head.seen.get(name)
+  def getDone(name: nir.Global.Member): nir.Defn.Define =
+    framesTl.get.head.seen(name)
+  def isCut(name: nir.Global.Member): Boolean =
+    framesTl.get.headOption.exists(_.task.cuts.contains(name))
+
+  def isDenylisted(name: nir.Global.Member): Boolean =
+    maybeDone(name).exists(_.attrs.opt.isInstanceOf[nir.Attr.BailOpt])
+
   def hasModulePurity(name: nir.Global.Top): Boolean =
     modulePurity.synchronized {
       modulePurity.contains(name)
@@ -182,7 +433,17 @@ private[scalanative] class Interflow(val config: build.Config)(implicit
 
   def result(): Seq[nir.Defn] = {
     val optimized = originals.clone()
-    optimized ++= done
+    val results = mutable.ArrayBuffer.empty[(nir.Global, nir.Defn.Define)]
+    done.forEach((name, defn) => results += name -> defn)
+    results.sortBy(_._1).foreach {
+      case (name, defn) if defn.name == name =>
+        optimized(name) = defn
+      // Bail outs and unoptimized duplicates shadow their originals
+      case (_, defn) if !done.containsKey(defn.name) =>
+        optimized(defn.name) = defn
+      case _ =>
+        ()
+    }
     optimized.values.toSeq
   }
 
@@ -194,12 +455,19 @@ object Interflow {
 
   def optimize(config: build.Config, analysis: ReachabilityAnalysis.Result)(
       implicit ec: ExecutionContext
+  ): Future[Seq[nir.Defn]] =
+    optimize(new Interflow(config)(analysis))
+
+  private[scalanative] def optimize(interflow: Interflow)(implicit
+      ec: ExecutionContext
   ): Future[Seq[nir.Defn]] = {
-    val interflow = new Interflow(config)(analysis)
     interflow.visitEntries()
     interflow
       .visitLoop()
-      .map(_ => interflow.result())
+      .map { _ =>
+        interflow.saveCache()
+        interflow.result()
+      }
   }
 
   private[scalanative] object LLVMIntrinsics {
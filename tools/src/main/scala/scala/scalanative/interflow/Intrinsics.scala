@@ -29,6 +29,8 @@ private[interflow] trait Intrinsics { self: Interflow =>
   private val Class = nir.Global.Top("java.lang.Class")
   private val Integer = nir.Global.Top("java.lang.Integer$")
   private val Math = nir.Global.Top("java.lang.Math$")
+  private val Vector =
+    nir.Global.Top("scala.scalanative.runtime.Intrinsics$vector$")
 
   def intrinsic(
       ty: nir.Type.Function,
@@ -161,6 +163,9 @@ private[interflow] trait Intrinsics { self: Interflow =>
           case _ =>
             None
         }
+      case nir.Global.Member(Vector, _) =>
+        // Lowered in codegen, the stub must not be inlined
+        Some(emit(rawArgs.map(eval)))
       case _ if arrayApplyIntrinsics.contains(name) =>
         val Seq(arr, idx) = rawArgs
         val nir.Type.Function(_, elemty) = ty
@@ -0,0 +1,273 @@
+package scala.scalanative
+package interflow
+
+import java.io.{ByteArrayOutputStream, DataInputStream, DataOutputStream}
+import java.nio.channels.FileChannel
+import java.nio.charset.StandardCharsets
+import java.nio.file.{Files, Path, StandardCopyOption, StandardOpenOption}
+import java.security.MessageDigest
+
+import scala.collection.mutable
+import scala.util.control.NonFatal
+
+import scala.scalanative.io.VirtualDirectory
+import scala.scalanative.linker._
+import scala.scalanative.nir.serialization.{deserializeBinary, serializeBinary}
+
+/** Methods optimized by the previous build, persisted in its working
+ *  directory.
+ *
+ *  An entry is found by the digest of its original method and of the facts
+ *  Interflow reads without visiting other methods: signatures and attributes
+ *  of all reachable definitions, the class hierarchy, dispatch tables and
+ *  the compiler config. It's reused only if the callees awaited while
+ *  optimizing it, and the purity of modules it checked, are still the same.
+ *  Editing bodies of methods only invalidates them and the methods they are
+ *  inlined in, any change to the program's structure invalidates all of it.
+ */
+private[interflow] object OptimizationCache {
+
+  // Bumped whenever the format of persisted entries changes
+  private final val Header = "interflow-cache-1"
+  private final val IndexFile = "index"
+  private final val DefnsFile = "optimized.nir"
+
+  sealed abstract class Dependency
+  final case class Callee(name: nir.Global.Member, digest: Option[String])
+      extends Dependency
+  final case class Purity(name: nir.Global.Top, isPure: Boolean)
+      extends Dependency
+
+  sealed abstract class Result
+  final case class Optimized(defn: nir.Defn.Define) extends Result
+  // Originals, possibly marked as bailed out, are not persisted
+  final case class Original(name: nir.Global.Member, bailOut: Option[String])
+      extends Result
+
+  final case class Entry(
+      name: nir.Global.Member,
+      key: String,
+      dependencies: Seq[Dependency],
+      roots: Seq[nir.Global.Member],
+      result: Result
+  ) {
+
+    /** Digest of the optimized method, reused in digests of its callers. */
+    lazy val digest: String = OptimizationCache.digest(key, dependencies)
+  }
+
+  /** Methods optimized by a build, by whether their entry was reused. */
+  final case class Stats(
+      reused: Set[nir.Global.Member],
+      missed: Set[nir.Global.Member]
+  ) {
+    def hits: Int = reused.size
+    def misses: Int = missed.size
+  }
+
+  private final class Digest {
+    private val md = MessageDigest.getInstance("SHA-1")
+    def add(value: String): this.type = {
+      md.update(value.getBytes(StandardCharsets.UTF_8))
+      md.update('\n'.toByte)
+      this
+    }
+    def result(): String = md.digest().map("%02x".format(_)).mkString
+  }
+
+  /** Digest of the program facts shared by all entries. */
+  def world(
+      config: build.Config,
+      analysis: ReachabilityAnalysis.Result
+  ): String = {
+    val digest = new Digest()
+      .add(Header)
+      .add(nir.Versions.current)
+      .add(config.compilerConfig.toString)
+
+    analysis.defns.sortBy(_.name).foreach {
+      case defn: nir.Defn.Define =>
+        digest
+          .add(defn.attrs.show)
+          .add(defn.name.show)
+          .add(defn.ty.show)
+          .add(defn.insts.nonEmpty.toString)
+      case defn =>
+        digest.add(defn.show)
+    }
+
+    def responds(table: mutable.Map[nir.Sig, nir.Global.Member]) =
+      table.toSeq.map { case (sig, impl) => s"${sig.mangle} ${impl.mangle}" }
+    analysis.infos.values
+      .collect { case info: ScopeInfo => info }
+      .toSeq
+      .sortBy(_.name: nir.Global)
+      .foreach { info =>
+        digest.add(info.name.show)
+        responds(info.responds).sorted.foreach(digest.add)
+        info match {
+          case cls: Class =>
+            digest.add(cls.allocated.toString)
+            responds(cls.defaultResponds).sorted.foreach(digest.add)
+          case _ =>
+            ()
+        }
+      }
+    analysis.dynimpls.map(_.mangle).sorted.foreach(digest.add)
+
+    digest.result()
+  }
+
+  /** Digest of the original method `name`, as seen in program `world`. */
+  def key(
+      world: String,
+      name: nir.Global.Member,
+      orig: nir.Defn.Define
+  ): String =
+    new Digest().add(world).add(name.mangle).add(orig.show).result()
+
+  def digest(key: String, dependencies: Seq[Dependency]): String = {
+    val digest = new Digest().add(key)
+    dependencies.foreach {
+      case Callee(name, calleeDigest) =>
+        digest.add(name.mangle).add(calleeDigest.getOrElse("cut"))
+      case Purity(name, isPure) =>
+        digest.add(name.mangle).add(isPure.toString)
+    }
+    digest.result()
+  }
+
+  /** Entries of the previous build by their keys, none if it was optimizing
+   *  another program.
+   */
+  def load(directory: Path, world: String): Map[String, Entry] = {
+    val index = directory.resolve(IndexFile)
+    if (!Files.exists(index)) Map.empty
+    else
+      try {
+        val in = new DataInputStream(Files.newInputStream(index))
+        try {
+          if (in.readUTF() != Header || in.readUTF() != world) Map.empty
+          else {
+            val defns = deserializeBinary(
+              VirtualDirectory.local(directory),
+              directory.resolve(DefnsFile)
+            ).collect { case defn: nir.Defn.Define => defn.name -> defn }.toMap
+            Seq.fill(in.readInt())(readEntry(in, defns)).map { entry =>
+              entry.key -> entry
+            }.toMap
+          }
+        } finally in.close()
+      } catch {
+        // Corrupted caches are dropped
+        case NonFatal(_) => Map.empty
+      }
+  }
+
+  /** Replaces the persisted entries with `entries`. */
+  def save(directory: Path, world: String, entries: Seq[Entry]): Unit = {
+    val index = new ByteArrayOutputStream()
+    val out = new DataOutputStream(index)
+    out.writeUTF(Header)
+    out.writeUTF(world)
+    out.writeInt(entries.size)
+    entries.foreach(writeEntry(out, _))
+    out.flush()
+
+    // Written aside and moved, the index is only valid with its definitions
+    Files.createDirectories(directory)
+    val defnsTmp = Files.createTempFile(directory, "optimized", ".tmp")
+    val channel = FileChannel.open(defnsTmp, StandardOpenOption.WRITE)
+    try
+      serializeBinary(
+        entries.collect { case Entry(_, _, _, _, Optimized(defn)) => defn },
+        channel
+      )
+    finally channel.close()
+    val indexTmp = Files.createTempFile(directory, "index", ".tmp")
+    Files.write(indexTmp, index.toByteArray())
+    Files.deleteIfExists(directory.resolve(IndexFile))
+    Files.move(
+      defnsTmp,
+      directory.resolve(DefnsFile),
+      StandardCopyOption.REPLACE_EXISTING
+    )
+    Files.move(
+      indexTmp,
+      directory.resolve(IndexFile),
+      StandardCopyOption.REPLACE_EXISTING
+    )
+  }
+
+  private def putString(out: DataOutputStream, value: String): Unit = {
+    val bytes = value.getBytes(StandardCharsets.UTF_8)
+    out.writeInt(bytes.length)
+    out.write(bytes)
+  }
+  private def getString(in: DataInputStream): String = {
+    val bytes = new Array[Byte](in.readInt())
+    in.readFully(bytes)
+    new String(bytes, StandardCharsets.UTF_8)
+  }
+  private def putGlobal(out: DataOutputStream, name: nir.Global): Unit =
+    putString(out, name.mangle)
+  private def getGlobal(in: DataInputStream): nir.Global =
+    nir.Unmangle.unmangleGlobal(getString(in))
+  private def getMember(in: DataInputStream): nir.Global.Member =
+    getGlobal(in).asInstanceOf[nir.Global.Member]
+
+  private def writeEntry(out: DataOutputStream, entry: Entry): Unit = {
+    putGlobal(out, entry.name)
+    putString(out, entry.key)
+    out.writeInt(entry.dependencies.size)
+    entry.dependencies.foreach {
+      case Callee(name, digest) =>
+        out.writeByte(0)
+        putGlobal(out, name)
+        out.writeBoolean(digest.isDefined)
+        digest.foreach(putString(out, _))
+      case Purity(name, isPure) =>
+        out.writeByte(1)
+        putGlobal(out, name)
+        out.writeBoolean(isPure)
+    }
+    out.writeInt(entry.roots.size)
+    entry.roots.foreach(putGlobal(out, _))
+    entry.result match {
+      case Optimized(defn) =>
+        out.writeByte(0)
+        putGlobal(out, defn.name)
+      case Original(name, bailOut) =>
+        out.writeByte(1)
+        putGlobal(out, name)
+        out.writeBoolean(bailOut.isDefined)
+        bailOut.foreach(putString(out, _))
+    }
+  }
+
+  private def readEntry(
+      in: DataInputStream,
+      defns: Map[nir.Global.Member, nir.Defn.Define]
+  ): Entry = {
+    val name = getMember(in)
+    val key = getString(in)
+    val dependencies = Seq.fill(in.readInt()) {
+      in.readByte() match {
+        case 0 =>
+          val name = getMember(in)
+          Callee(name, if (in.readBoolean()) Some(getString(in)) else None)
+        case _ =>
+          Purity(getGlobal(in).top, in.readBoolean())
+      }
+    }
+    val roots = Seq.fill(in.readInt())(getMember(in))
+    val result = in.readByte() match {
+      case 0 =>
+        Optimized(defns(getMember(in)))
+      case _ =>
+        val name = getMember(in)
+        Original(name, if (in.readBoolean()) Some(getString(in)) else None)
+    }
+    Entry(name, key, dependencies, roots, result)
+  }
+}
@@ -74,18 +74,25 @@ private[interflow] final class State(val blockId: nir.Local)(
       scopeId: nir.ScopeId
   ): Addr = {
     val charsArray = value.toArray
-    val charsAddr = allocArray(nir.Type.Char, charsArray.length, zone = None)
+    val isLatin1 = Lower.isLatin1String(value)
+    val elemty = if (isLatin1) nir.Type.Byte else nir.Type.Char
+    val charsAddr = allocArray(elemty, charsArray.length, zone = None)
     val chars = derefVirtual(charsAddr)
     charsArray.zipWithIndex.foreach {
       case (value, idx) =>
-        chars.values(idx) = nir.Val.Char(value)
+        chars.values(idx) =
+          if (isLatin1) nir.Val.Byte(value.toByte)
+          else nir.Val.Char(value)
     }
-    val values = new Array[nir.Val](4)
+    val values = new Array[nir.Val](analysis.StringClass.fields.length)
     values(analysis.StringValueField.index) = nir.Val.Virtual(charsAddr)
     values(analysis.StringOffsetField.index) = nir.Val.Int(0)
     values(analysis.StringCountField.index) = nir.Val.Int(charsArray.length)
     values(analysis.StringCachedHashCodeField.index) =
       nir.Val.Int(Lower.stringHashCode(value))
+    values(analysis.StringCoderField.index) = nir.Val.Int(
+      if (isLatin1) Lower.StringLatin1Coder else Lower.StringUTF16Coder
+    )
     alloc(StringKind, analysis.StringClass, values, zone = None)
   }
   def delay(
@@ -348,6 +355,7 @@ private[interflow] final class State(val blockId: nir.Local)(
         val chars = derefVirtual(charsAddr).values
           .map {
             case nir.Val.Char(v) => v
+            case nir.Val.Byte(v) => (v & 0xff).toChar
             case _               => unreachable
           }
           .toArray[Char]
@@ -1,7 +1,8 @@
 package scala.scalanative
 package interflow
 
-import scala.annotation.tailrec
+import java.util.concurrent.atomic.AtomicInteger
+
 import scala.concurrent._
 
 import scalanative.linker._
@@ -86,73 +87,67 @@ private[interflow] trait Visit { self: Interflow =>
       case _: build.Mode.Release =>
         val dup = duplicateName(name, argtys)
         if (shallVisit(dup)) {
-          if (!isDone(dup)) {
-            visitMethod(dup)
-          }
-          maybeDone(dup)
+          awaitDone(dup)
         } else {
           None
         }
     }
   }
 
+  /** Visits every method reached from the entries, each root is visited by
+   *  its own job, methods reached while optimizing are scheduled as new jobs.
+   */
   def visitLoop()(implicit ec: ExecutionContext): Future[Unit] = {
-    def visit(name: nir.Global.Member): Unit = {
-      if (!isDone(name)) {
-        visitMethod(name)
+    val finished = Promise[Unit]()
+    val pending = new AtomicInteger(1)
+    def release(): Unit =
+      if (pending.decrementAndGet() == 0) {
+        finished.trySuccess(())
       }
-    }
 
-    @tailrec def loop(): Unit = popTodo() match {
+    def visit(): Unit = popTodo() match {
       case name: nir.Global.Member =>
-        visit(name); loop()
-      case nir.Global.None =>
-        ()
-      case name: nir.Global.Top =>
+        visitTodo(name)
+      case name =>
         throw new IllegalStateException(
-          s"Unexpected Global.Top in visit loop: ${name}"
+          s"Unexpected global in visit loop: ${name}"
         )
     }
 
-    mode match {
-      case build.Mode.Debug =>
-        Future
-          .traverse(allTodo()) { defn => Future(visit(defn)) }
-          .map(_ => ())
-      case _: build.Mode.Release =>
-        Future(loop())
+    startTodo { () =>
+      pending.incrementAndGet()
+      ec.execute { () =>
+        try visit()
+        catch { case ex: Throwable => finished.tryFailure(ex) }
+        finally release()
+      }
     }
+    release()
+    finished.future
   }
 
-  def visitMethod(name: nir.Global.Member): Unit =
-    if (!hasStarted(name)) {
-      markStarted(name)
-      val origname = originalName(name)
-      val origdefn = getOriginal(origname)
-      try {
-        if (shallOpt(name)) {
-          setDone(name, opt(name))
-        } else {
-          noOpt(origdefn)
-          setDone(name, origdefn)
-          setDone(origname, origdefn)
-        }
-      } catch {
-        case BailOut(msg) =>
-          log(s"failed to expand ${name.show}: $msg")
-          val baildefn =
-            origdefn.copy(attrs =
-              origdefn.attrs.withOpt(nir.Attr.BailOpt(msg))
-            )(
-              origdefn.pos
-            )
-          noOpt(origdefn)
-          setDone(name, baildefn)
-          setDone(origname, baildefn)
-          markDenylisted(name)
-          markDenylisted(origname)
+  def visitMethod(name: nir.Global.Member): nir.Defn.Define = {
+    val origname = originalName(name)
+    val origdefn = getOriginal(origname)
+    try {
+      if (shallOpt(name)) {
+        opt(name)
+      } else {
+        noOpt(origdefn)
+        origdefn
       }
+    } catch {
+      case BailOut(msg) =>
+        log(s"failed to expand ${name.show}: $msg")
+        noOpt(origdefn)
+        bailedOut(origdefn, msg)
     }
+  }
+
+  def bailedOut(origdefn: nir.Defn.Define, msg: String): nir.Defn.Define =
+    origdefn.copy(attrs = origdefn.attrs.withOpt(nir.Attr.BailOpt(msg)))(
+      origdefn.pos
+    )
 
   def originalName(name: nir.Global.Member): nir.Global.Member = name match {
     case nir.Global.Member(owner, sig) if sig.isDuplicate =>
@@ -1,10 +1,14 @@
 package scala.scalanative
 package linker
 
+import java.util.concurrent.ConcurrentHashMap
+import java.util.concurrent.atomic.AtomicBoolean
+
 import scala.collection.mutable
+import scala.concurrent.duration.Duration
+import scala.concurrent.{Await, ExecutionContext, Future, Promise}
+import scala.util.Try
 
-import scala.scalanative.build.Logger
-import scalanative.io.VirtualDirectory
 import scalanative.util.Scope
 
 sealed abstract class ClassLoader {
@@ -15,21 +19,34 @@ sealed abstract class ClassLoader {
 
   def load(global: nir.Global.Top): Option[Seq[nir.Defn]]
 
+  /** Hints that given global is likely to be loaded soon. */
+  def prefetch(global: nir.Global.Top): Unit = ()
+
 }
 
 object ClassLoader {
 
-  def fromDisk(config: build.Config)(implicit in: Scope): ClassLoader = {
-    val classpath = config.classPath.map { path =>
-      ClassPath(VirtualDirectory.real(path), config.logger)
-    }
-    new FromDisk(classpath)
+  /** Lists entries of the classpath in parallel. */
+  def fromDisk(
+      config: build.Config
+  )(implicit in: Scope, ec: ExecutionContext): Future[ClassLoader] = {
+    val cacheDir = config.workDir.resolve("classpath")
+    Future
+      .traverse(config.classPath) { path =>
+        Future(ClassPath.cached(path, cacheDir, config.logger))
+      }
+      .map(new FromDisk(_))
   }
 
   def fromMemory(defns: Seq[nir.Defn]): ClassLoader =
     new FromMemory(defns)
 
-  final class FromDisk(classpath: Seq[ClassPath]) extends ClassLoader {
+  /** Loads globals from the classpath, deserializing the prefetched ones in
+   *  the background while the linker is visiting already loaded definitions.
+   */
+  final class FromDisk(classpath: Seq[ClassPath])(implicit
+      ec: ExecutionContext
+  ) extends ClassLoader {
     lazy val classesWithEntryPoints: Iterable[nir.Global.Top] = {
       classpath.flatMap(_.classesWithEntryPoints)
     }
@@ -37,11 +54,47 @@ object ClassLoader {
         : Map[nir.Global.Top, Iterable[nir.Global.Top]] =
       classpath.flatMap(_.definedServicesProviders).toMap
 
+    // The first entry of the classpath defining a global shadows the others
+    private val index = {
+      val out = new java.util.HashMap[nir.Global.Top, ClassPath](
+        classpath.map(_.names.size).sum * 2
+      )
+      classpath.foreach { path =>
+        path.names.foreach(out.putIfAbsent(_, path))
+      }
+      out
+    }
+
+    private val prefetched = new ConcurrentHashMap[nir.Global.Top, Prefetch]
+
+    // Runs once, either in the background or by the thread loading it
+    private final class Prefetch(global: nir.Global.Top) extends Runnable {
+      private val claimed = new AtomicBoolean(false)
+      val result = Promise[Option[Seq[nir.Defn]]]()
+
+      def run(): Unit =
+        if (claimed.compareAndSet(false, true))
+          result.complete(Try(loadNow(global)))
+    }
+
+    override def prefetch(global: nir.Global.Top): Unit =
+      if (index.containsKey(global) && !prefetched.containsKey(global)) {
+        val task = new Prefetch(global)
+        if (prefetched.putIfAbsent(global, task) == null) ec.execute(task)
+      }
+
     def load(global: nir.Global.Top): Option[Seq[nir.Defn]] =
-      classpath.collectFirst {
-        case path if path.contains(global) =>
-          path.load(global)
-      }.flatten
+      prefetched.remove(global) match {
+        case null => loadNow(global)
+        case task =>
+          // Never waits for a task which is not running yet, the thread pool
+          // might be busy with the caller itself
+          task.run()
+          Await.result(task.result.future, Duration.Inf)
+      }
+
+    private def loadNow(global: nir.Global.Top): Option[Seq[nir.Defn]] =
+      Option(index.get(global)).flatMap(_.load(global))
   }
 
   final class FromMemory(defns: Seq[nir.Defn]) extends ClassLoader {
@@ -2,15 +2,20 @@ package scala.scalanative
 package linker
 
 import java.io.{BufferedReader, ByteArrayInputStream, InputStreamReader}
-import java.nio.file.Path
+import java.nio.charset.StandardCharsets
+import java.nio.file.{Files, Path, StandardCopyOption}
 
+import scala.collection.concurrent.TrieMap
 import scala.collection.mutable
+import scala.util.control.NonFatal
 
-import scala.scalanative.build.Logger
+import scala.scalanative.build.{IO, Logger}
 import scala.scalanative.io.VirtualDirectory
 import scala.scalanative.nir.serialization.{
-  NirDeserializationException, Prelude => NirPrelude, deserializeBinary
+  NirArchive, NirDeserializationException, Prelude => NirPrelude,
+  deserializeBinary
 }
+import scala.scalanative.util.{Scope, acquire}
 
 sealed trait ClassPath {
 
@@ -20,6 +25,9 @@ sealed trait ClassPath {
   /** Load given global and info about its dependencies. */
   private[scalanative] def load(name: nir.Global.Top): Option[Seq[nir.Defn]]
 
+  /** All top-level globals defined in this classpath. */
+  private[scalanative] def names: Iterable[nir.Global.Top]
+
   private[scalanative] def classesWithEntryPoints: Iterable[nir.Global.Top]
 
   private[scalanative] def definedServicesProviders
@@ -30,58 +38,103 @@ object ClassPath {
 
   /** Create classpath based on the virtual directory. */
   private[scalanative] def apply(directory: VirtualDirectory): ClassPath =
-    new Impl(directory, Logger.nullLogger)
+    apply(directory, Logger.nullLogger)
 
   /** Create classpath based on the virtual directory. */
   private[scalanative] def apply(
       directory: VirtualDirectory,
       log: Logger
   ): ClassPath =
-    new Impl(directory, log)
+    new Impl(() => directory, Listing(directory, log))
 
-  private final class Impl(directory: VirtualDirectory, log: Logger)
-      extends ClassPath {
-    val nirFiles = mutable.Map.empty[nir.Global.Top, Path]
-    val serviceProviders = mutable.Map.empty[nir.Global.Top, Path]
-
-    directory.files
-      .foreach {
-        case path if path.toString.endsWith(".nir") =>
-          val name = nir.Global.Top(io.packageNameFromPath(path))
-          nirFiles.update(name, path)
-
-        // First variant for jars, seconds for local directories
-        case path
-            if (path.startsWith("/META-INF/services/") ||
-              path.startsWith("META-INF/services/")) =>
-          val serviceName = nir.Global.Top(path.getFileName().toString())
-          serviceProviders.update(serviceName, path)
-
-        case _ => ()
-      }
+  /** Create classpath of a jar or a directory on the local file system.
+   *
+   *  Listings of jars are persisted in `cacheDir`, keyed by the checksum of
+   *  the jar, so unchanged dependencies are neither listed again nor opened
+   *  unless they define a global used by the linker. Directories are always
+   *  listed, their content changes with every compilation.
+   *
+   *  Jars published with a [[NirArchive]] are never listed, their archive is
+   *  extracted once to `cacheDir` and memory mapped until `in` is closed.
+   */
+  private[scalanative] def cached(path: Path, cacheDir: Path, log: Logger)(
+      implicit in: Scope
+  ): ClassPath = {
+    lazy val directory = VirtualDirectory.real(path)
+    if (Files.isDirectory(path))
+      new Impl(() => directory, Listing(directory, log))
+    else {
+      val checksum = IO.sha1(path).map("%02x".format(_)).mkString
+      val listingPath = cacheDir.resolve(checksum)
+      val archivePath = cacheDir.resolve(checksum + ".nira")
+      def archive = new Archive(acquire(NirArchive.open(archivePath, path)))
+      if (Files.exists(archivePath)) archive
+      else
+        Listing.read(listingPath) match {
+          case Some(listing) => new Impl(() => directory, listing)
+          case None          =>
+            val entry = directory.getPath("/" + NirArchive.EntryName)
+            if (Files.exists(entry)) {
+              extract(directory, entry, archivePath)
+              archive
+            } else {
+              val listing = Listing(directory, log)
+              Listing.write(listingPath, listing)
+              new Impl(() => directory, listing)
+            }
+        }
+    }
+  }
+
+  private def extract(
+      directory: VirtualDirectory,
+      entry: Path,
+      target: Path
+  ): Unit = {
+    // Written aside and moved, other builds might be mapping it
+    Files.createDirectories(target.getParent())
+    val tmp = Files.createTempFile(target.getParent(), "archive", ".tmp")
+    Files.copy(entry, tmp, StandardCopyOption.REPLACE_EXISTING)
+    Files.move(tmp, target, StandardCopyOption.REPLACE_EXISTING)
+  }
 
-    private val cache =
-      mutable.Map.empty[nir.Global.Top, Option[Seq[nir.Defn]]]
+  /** Globals defined in a classpath entry, and the names of their files. */
+  private final case class Listing(
+      nirFiles: Map[nir.Global.Top, String],
+      classesWithEntryPoints: Set[nir.Global.Top],
+      servicesProviders: Map[nir.Global.Top, Seq[nir.Global.Top]]
+  )
 
-    def contains(name: nir.Global) =
-      nirFiles.contains(name.top)
+  private object Listing {
+    // Bumped whenever the format of persisted listings changes
+    private final val Header = s"nir-listing-1 ${nir.Versions.current}"
 
-    private def makeBufferName(directory: VirtualDirectory, file: Path) =
-      directory.uri
-        .resolve(new java.net.URI(file.getFileName().toString))
-        .toString
+    def apply(directory: VirtualDirectory, log: Logger): Listing = {
+      val nirFiles = mutable.Map.empty[nir.Global.Top, Path]
+      val serviceProviders = mutable.Map.empty[nir.Global.Top, Path]
 
-    def load(name: nir.Global.Top): Option[Seq[nir.Defn]] =
-      cache.getOrElseUpdate(
-        name, {
-          nirFiles.get(name.top).map { file =>
-            deserializeBinary(directory, file)
-          }
+      directory.files
+        .foreach {
+          case path if path.toString.endsWith(".nir") =>
+            val name = nir.Global.Top(io.packageNameFromPath(path))
+            nirFiles.update(name, path)
+
+          // First variant for jars, seconds for local directories
+          case path
+              if (path.startsWith("/META-INF/services/") ||
+                path.startsWith("META-INF/services/")) =>
+            val serviceName = nir.Global.Top(path.getFileName().toString())
+            serviceProviders.update(serviceName, path)
+
+          case _ => ()
         }
-      )
 
-    lazy val classesWithEntryPoints: Iterable[nir.Global.Top] = {
-      nirFiles.filter {
+      def makeBufferName(file: Path) =
+        directory.uri
+          .resolve(new java.net.URI(file.getFileName().toString))
+          .toString
+
+      val classesWithEntryPoints = nirFiles.filter {
         case (_, file) =>
           def logUnreadableFile(err: NirDeserializationException): Unit =
             log.warn(
@@ -89,16 +142,13 @@ object ClassPath {
             )
           val buffer = directory.read(file, len = NirPrelude.length)
           NirPrelude
-            .tryReadFrom(buffer, makeBufferName(directory, file))
+            .tryReadFrom(buffer, makeBufferName(file))
             .left
             .map(logUnreadableFile)
             .exists(_.hasEntryPoints)
       }.keySet
-    }
 
-    lazy val definedServicesProviders
-        : Map[nir.Global.Top, Seq[nir.Global.Top]] = {
-      serviceProviders.map {
+      val servicesProviders = serviceProviders.map {
         case (name, path) =>
           val b = Seq.newBuilder[nir.Global.Top]
           val reader = new BufferedReader(
@@ -114,7 +164,118 @@ object ClassPath {
               .forEach(b += nir.Global.Top(_))
           finally reader.close()
           name -> b.result()
-      }.toMap
+      }
+
+      Listing(
+        nirFiles.map { case (name, path) => name -> path.toString }.toMap,
+        classesWithEntryPoints.toSet,
+        servicesProviders.toMap
+      )
+    }
+
+    /* Persisted as lines of tab separated fields:
+     *   nir <global> <file> <has entry points>
+     *   service <service> <providers...>
+     */
+    def write(file: Path, listing: Listing): Unit = {
+      val sb = new java.lang.StringBuilder(Header).append('\n')
+      listing.nirFiles.foreach {
+        case (name, path) =>
+          val hasEntryPoints = listing.classesWithEntryPoints.contains(name)
+          sb.append("nir\t").append(name.id).append('\t').append(path)
+          sb.append('\t').append(hasEntryPoints).append('\n')
+      }
+      listing.servicesProviders.foreach {
+        case (name, providers) =>
+          sb.append("service\t").append(name.id)
+          providers.foreach(p => sb.append('\t').append(p.id))
+          sb.append('\n')
+      }
+      // Written aside and moved, other builds might be reading it
+      Files.createDirectories(file.getParent())
+      val tmp = Files.createTempFile(file.getParent(), "listing", ".tmp")
+      Files.write(tmp, sb.toString.getBytes(StandardCharsets.UTF_8))
+      Files.move(tmp, file, StandardCopyOption.REPLACE_EXISTING)
     }
+
+    def read(file: Path): Option[Listing] =
+      if (!Files.exists(file)) None
+      else
+        try {
+          val lines = new String(
+            Files.readAllBytes(file),
+            StandardCharsets.UTF_8
+          ).split('\n')
+          if (lines.isEmpty || lines.head != Header) None
+          else {
+            val nirFiles = Map.newBuilder[nir.Global.Top, String]
+            val withEntryPoints = Set.newBuilder[nir.Global.Top]
+            val servicesProviders =
+              Map.newBuilder[nir.Global.Top, Seq[nir.Global.Top]]
+            lines.iterator.drop(1).map(_.split('\t')).foreach {
+              case Array("nir", id, path, hasEntryPoints) =>
+                val name = nir.Global.Top(id)
+                nirFiles += name -> path
+                if (hasEntryPoints.toBoolean) withEntryPoints += name
+              case Array("service", id, providers @ _*) =>
+                servicesProviders +=
+                  nir.Global.Top(id) -> providers.map(nir.Global.Top(_))
+              case line =>
+                throw new IllegalStateException(line.mkString("\t"))
+            }
+            Some(
+              Listing(
+                nirFiles.result(),
+                withEntryPoints.result(),
+                servicesProviders.result()
+              )
+            )
+          }
+        } catch {
+          // Corrupted listings are listed again
+          case NonFatal(_) => None
+        }
+  }
+
+  private final class Impl(open: () => VirtualDirectory, listing: Listing)
+      extends ClassPath {
+    private lazy val directory = open()
+
+    // Loaded concurrently when prefetched by the class loader
+    private val cache = TrieMap.empty[nir.Global.Top, Option[Seq[nir.Defn]]]
+
+    def contains(name: nir.Global) =
+      listing.nirFiles.contains(name.top)
+
+    def load(name: nir.Global.Top): Option[Seq[nir.Defn]] =
+      cache.getOrElseUpdate(
+        name, {
+          listing.nirFiles.get(name.top).map { file =>
+            deserializeBinary(directory, directory.getPath(file))
+          }
+        }
+      )
+
+    def names: Iterable[nir.Global.Top] = listing.nirFiles.keys
+
+    def classesWithEntryPoints: Iterable[nir.Global.Top] =
+      listing.classesWithEntryPoints
+
+    def definedServicesProviders: Map[nir.Global.Top, Seq[nir.Global.Top]] =
+      listing.servicesProviders
+  }
+
+  private final class Archive(archive: NirArchive.Reader) extends ClassPath {
+    def contains(name: nir.Global) = archive.contains(name.top)
+
+    def load(name: nir.Global.Top): Option[Seq[nir.Defn]] = archive.load(name)
+
+    def names: Iterable[nir.Global.Top] = archive.entries.map(_.name)
+
+    def classesWithEntryPoints: Iterable[nir.Global.Top] =
+      archive.entries.collect { case e if e.hasEntryPoints => e.name }
+
+    def definedServicesProviders: Map[nir.Global.Top, Seq[nir.Global.Top]] =
+      archive.servicesProviders
   }
 }
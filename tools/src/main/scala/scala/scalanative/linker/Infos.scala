@@ -264,6 +264,8 @@ object ReachabilityAnalysis {
       infos(nir.Rt.StringCountName).asInstanceOf[Field]
     lazy val StringCachedHashCodeField = infos(nir.Rt.StringCachedHashCodeName)
       .asInstanceOf[Field]
+    lazy val StringCoderField =
+      infos(nir.Rt.StringCoderName).asInstanceOf[Field]
 
     private[scalanative] object references {
       // Currently unused, useful for debugging
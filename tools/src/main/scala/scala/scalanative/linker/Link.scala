@@ -1,15 +1,18 @@
 package scala.scalanative
 package linker
 
+import scala.concurrent.{ExecutionContext, Future}
+
 import scalanative.util.Scope
 
 object Link {
 
   /** Load all clases and methods reachable from the entry points. */
   def apply(config: build.Config, entries: Seq[nir.Global])(implicit
-      scope: Scope
-  ): ReachabilityAnalysis =
-    Reach(config, entries, ClassLoader.fromDisk(config))
+      scope: Scope,
+      ec: ExecutionContext
+  ): Future[ReachabilityAnalysis] =
+    ClassLoader.fromDisk(config).map(Reach(config, entries, _))
 
   /** Run reachability analysis on already loaded methods. */
   def apply(
@@ -33,6 +33,8 @@ private[linker] trait LinktimeValueResolver { self: Reach =>
       s"$linktimeInfo.enabledSanitizer" -> conf.sanitizer
         .map(_.name)
         .getOrElse(""),
+      s"$linktimeInfo.framePointersEnabled" -> conf.framePointers,
+      s"$linktimeInfo.isStackfulContinuations" -> conf.stackfulContinuations,
       s"$linktimeInfo.isMsys" -> config.targetsMsys,
       s"$linktimeInfo.isCygwin" -> config.targetsCygwin,
       s"$linktimeInfo.runtimeVersion" -> nir.Versions.current,
@@ -317,6 +317,8 @@ private[linker] class Reach(
       enqueued += name
       track(name)
       todo ::= name
+      // Deserialized in the background until the worklist reaches it
+      if (!loaded.contains(name.top)) loader.prefetch(name.top)
     }
 
   def reachGlobalNow(
@@ -65,7 +65,7 @@ abstract class LinkerSpec {
       val files = compiler.compile(sourcesDir)
       val config = makeConfig(outDir, entry, setupConfig)
       val entries = ScalaNative.entries(config)
-      val result = linker.Link(config, entries)
+      val result = Await.result(linker.Link(config, entries), Duration.Inf)
       fn(config, result)
     }
 
@@ -0,0 +1,165 @@
+package scala.scalanative.build
+
+import java.nio.file.{Files, Paths}
+
+import org.junit.Assert._
+import org.junit.Test
+
+import scala.scalanative.build.IO.RichPath
+
+class ThinLTOTest {
+
+  private def config(
+      triple: String,
+      setup: NativeConfig => NativeConfig = identity
+  ): Config =
+    Config.empty
+      .withBaseDir(Files.createTempDirectory("thinlto"))
+      .withMainClass(Some("Test"))
+      .withLogger(Logger.nullLogger)
+      .withCompilerConfig { c =>
+        setup(
+          c.withClang(Discover.clang())
+            .withClangPP(Discover.clangpp())
+            .withBaseName("test")
+            .withTargetTriple(triple)
+            .withLTO(LTO.thin)
+            .withIncrementalCompilation(true)
+        )
+      }
+
+  private val Linux = "x86_64-unknown-linux-gnu"
+  private val Mac = "arm64-apple-darwin22.4.0"
+  private val Windows = "x86_64-pc-windows-msvc"
+  private val Policy = "prune_after=168h:cache_size=10%"
+
+  private def assertCacheFlags(
+      triple: String,
+      setup: NativeConfig => NativeConfig = identity
+  )(expected: String => Seq[String]): Unit = {
+    val conf = config(triple, setup)
+    val cacheDir = conf.workDir.resolve("thinlto").resolve("cache").abs
+    assertEquals(expected(cacheDir), LLVM.thinLTOCache(conf))
+  }
+
+  @Test def cacheFlagsOfLinker(): Unit = {
+    val lld: NativeConfig => NativeConfig =
+      _.withLinkingOptions(Seq("-fuse-ld=lld"))
+    assertCacheFlags(Linux, lld) { dir =>
+      Seq(
+        s"-Wl,--thinlto-cache-dir=$dir",
+        s"-Wl,--thinlto-cache-policy=$Policy"
+      )
+    }
+    assertCacheFlags(Mac, lld) { dir =>
+      Seq(
+        s"-Wl,--thinlto-cache-dir=$dir",
+        s"-Wl,--thinlto-cache-policy=$Policy"
+      )
+    }
+    val gold: NativeConfig => NativeConfig =
+      _.withLinkingOptions(Seq("-fuse-ld=gold"))
+    assertCacheFlags(Linux, gold) { dir =>
+      Seq(
+        s"-Wl,-plugin-opt,cache-dir=$dir",
+        s"-Wl,-plugin-opt,cache-policy=$Policy"
+      )
+    }
+    assertCacheFlags(Linux)(_ => Nil)
+    assertCacheFlags(Mac) { dir =>
+      Seq(
+        s"-Wl,-cache_path_lto,$dir",
+        s"-Wl,-prune_after_lto,${168 * 3600}",
+        "-Wl,-max_relative_cache_size_lto,10"
+      )
+    }
+    assertCacheFlags(Windows) { dir =>
+      Seq(s"-Wl,/lldltocache:$dir", s"-Wl,/lldltocachepolicy:$Policy")
+    }
+  }
+
+  @Test def cacheFlagsOfLastSelectedLinker(): Unit = {
+    def linking(options: String*): NativeConfig => NativeConfig =
+      _.withLinkingOptions(options)
+    assertCacheFlags(Linux, linking("-fuse-ld=lld", "-fuse-ld=gold")) { dir =>
+      Seq(
+        s"-Wl,-plugin-opt,cache-dir=$dir",
+        s"-Wl,-plugin-opt,cache-policy=$Policy"
+      )
+    }
+    assertCacheFlags(Linux, linking("-fuse-ld=/usr/bin/ld.lld")) { dir =>
+      Seq(
+        s"-Wl,--thinlto-cache-dir=$dir",
+        s"-Wl,--thinlto-cache-policy=$Policy"
+      )
+    }
+    assertCacheFlags(Linux, linking("-fuse-ld=gold", "-fuse-ld=bfd"))(_ => Nil)
+  }
+
+  @Test def cacheOnlyUsedByIncrementalThinLTO(): Unit = {
+    assertEquals(Nil, LLVM.thinLTOCache(config(Linux, _.withLTO(LTO.full))))
+    assertEquals(
+      Nil,
+      LLVM.thinLTOCache(config(Linux, _.withIncrementalCompilation(false)))
+    )
+  }
+
+  @Test def distributedIndexIsComputedByLld(): Unit = {
+    val linux = config(Linux, _.withDistributedThinLTO(true))
+    val flags = LLVM.thinLTOIndexFlags(
+      Paths.get("bitcode"),
+      "/work/",
+      "/work/thinlto/"
+    )(linux)
+    assertEquals("-flto=thin", flags.head)
+    assertTrue(flags.contains("-fuse-ld=lld"))
+    assertTrue(flags.exists(_.startsWith("-Wl,--thinlto-index-only=")))
+    assertTrue(
+      flags.contains("-Wl,--thinlto-prefix-replace=/work/;/work/thinlto/")
+    )
+  }
+
+  @Test def distributedThinLTOIsValidOnElfTargets(): Unit = {
+    val setup: NativeConfig => NativeConfig =
+      _.withDistributedThinLTO(true)
+        .withLinkingOptions(Seq("-fuse-ld=gold", "-fuse-ld=lld"))
+    val validated = Validator.validate(config(Linux, setup))
+    assertTrue(validated.compilerConfig.distributedThinLTO)
+
+    val lldPath: NativeConfig => NativeConfig =
+      _.withDistributedThinLTO(true)
+        .withLinkingOptions(Seq("-fuse-ld=/usr/bin/ld.lld"))
+    assertTrue(
+      Validator
+        .validate(config(Linux, lldPath))
+        .compilerConfig
+        .distributedThinLTO
+    )
+  }
+
+  @Test def distributedThinLTOFallsBack(): Unit = {
+    def validated(triple: String, setup: NativeConfig => NativeConfig) =
+      Validator
+        .validate(config(triple, setup.andThen(_.withDistributedThinLTO(true))))
+        .compilerConfig
+        .distributedThinLTO
+
+    assertFalse(validated(Mac, identity))
+    assertFalse(validated(Windows, identity))
+    assertFalse(validated(Linux, _.withLTO(LTO.full)))
+    assertFalse(validated(Linux, _.withLTO(LTO.none)))
+    assertFalse(validated(Linux, _.withLinkingOptions(Seq("-fuse-ld=gold"))))
+    assertFalse(
+      validated(
+        Linux,
+        _.withLinkingOptions(Seq("-fuse-ld=lld", "-fuse-ld=bfd"))
+      )
+    )
+    assertFalse(
+      validated(
+        Linux,
+        _.withLinkingOptions(Seq("-fuse-ld=lld", "-fuse-ld=/usr/bin/ld.gold"))
+      )
+    )
+  }
+}
@@ -0,0 +1,48 @@
+package scala.scalanative.codegen
+
+import java.nio.file.Files
+
+import org.junit.Assert._
+import org.junit.Test
+
+class FramePointersTest extends CodeGenSpec {
+
+  private val source = Map(
+    "Main.scala" ->
+      """|object Main {
+         |  def main(args: Array[String]): Unit = println("ok")
+         |}""".stripMargin
+  )
+
+  private val FramePointerAttr = "\"frame-pointer\"=\"all\""
+
+  private def emittedIr(outfiles: Seq[java.nio.file.Path]): String =
+    outfiles.iterator
+      .map(p => new String(Files.readAllBytes(p)))
+      .mkString("\n")
+
+  @Test def emitsFramePointerAttributeWhenEnabled(): Unit = codegen(
+    entry = "Main",
+    sources = source,
+    setupConfig = _.withFramePointers(true)
+  ) {
+    case (_, _, outfiles) =>
+      val ir = emittedIr(outfiles)
+      assertTrue(
+        s"Expected `$FramePointerAttr` in emitted IR",
+        ir.contains(FramePointerAttr)
+      )
+  }
+
+  @Test def omitsFramePointerAttributeByDefault(): Unit = codegen(
+    entry = "Main",
+    sources = source
+  ) {
+    case (_, _, outfiles) =>
+      val ir = emittedIr(outfiles)
+      assertFalse(
+        s"`$FramePointerAttr` must not be emitted by default",
+        ir.contains(FramePointerAttr)
+      )
+  }
+}
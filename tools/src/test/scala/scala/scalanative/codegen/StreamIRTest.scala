@@ -0,0 +1,33 @@
+package scala.scalanative.codegen
+
+import java.nio.file.Files
+
+import org.junit.Assert._
+import org.junit.Test
+
+class StreamIRTest extends CodeGenSpec {
+
+  private val source = Map(
+    "Main.scala" ->
+      """|object Main {
+         |  def main(args: Array[String]): Unit = println("ok")
+         |}""".stripMargin
+  )
+
+  @Test def compilesWithoutIntermediateFiles(): Unit = codegen(
+    entry = "Main",
+    sources = source,
+    setupConfig = _.withStreamIR(true)
+      .withSourceLevelDebuggingConfig(_.enableAll)
+  ) {
+    case (_, _, outfiles) =>
+      val names = outfiles.map(_.getFileName().toString)
+      val objects = outfiles.filter(_.toString.endsWith(".ll.o"))
+      assertTrue("No objects compiled", objects.nonEmpty)
+      objects.foreach(obj => assertTrue(Files.size(obj) > 0))
+      // Only build info is not streamed
+      names.filter(_.endsWith(".ll")).foreach { name =>
+        assertEquals("__buildInfo.ll", name)
+      }
+  }
+}
@@ -0,0 +1,127 @@
+package scala.scalanative
+package linker
+
+import java.io.File
+import java.nio.file.{Files, Path, Paths}
+import java.util.concurrent.{Callable, Executors, TimeUnit}
+
+import org.junit.Assert._
+import org.junit.Assume.assumeTrue
+import org.junit.Test
+
+import scala.scalanative.buildinfo.ScalaNativeBuildInfo
+import scala.scalanative.build.Logger
+import scala.scalanative.io.VirtualDirectory
+import scala.scalanative.nir.serialization.NirArchive
+import scala.scalanative.util.Scope
+
+class ClassPathTest {
+
+  private def withJar(fn: Path => Unit): Unit = {
+    val jar = ScalaNativeBuildInfo.nativeRuntimeClasspath
+      .split(File.pathSeparator)
+      .map(Paths.get(_))
+      .find(_.toString.endsWith(".jar"))
+    assumeTrue("No jar on the runtime classpath", jar.isDefined)
+    fn(jar.get)
+  }
+
+  @Test def persistedListingMatchesListedJar(): Unit = withJar { jar =>
+    Scope { implicit in =>
+      val cacheDir = Files.createTempDirectory("classpath-cache")
+      val listed = ClassPath(VirtualDirectory.real(jar))
+      val created = ClassPath.cached(jar, cacheDir, Logger.nullLogger)
+      assertEquals(1, Files.list(cacheDir).count())
+      val restored = ClassPath.cached(jar, cacheDir, Logger.nullLogger)
+
+      Seq(created, restored).foreach { classpath =>
+        assertEquals(listed.names.toSet, classpath.names.toSet)
+        assertEquals(
+          listed.classesWithEntryPoints.toSet,
+          classpath.classesWithEntryPoints.toSet
+        )
+        assertEquals(
+          listed.definedServicesProviders,
+          classpath.definedServicesProviders
+        )
+      }
+
+      val name = listed.names.head
+      assertTrue(restored.contains(name))
+      assertEquals(
+        listed.load(name).map(_.map(_.name)),
+        restored.load(name).map(_.map(_.name))
+      )
+    }
+  }
+
+  @Test def corruptedListingIsIgnored(): Unit = withJar { jar =>
+    Scope { implicit in =>
+      val cacheDir = Files.createTempDirectory("classpath-cache")
+      val listed = ClassPath.cached(jar, cacheDir, Logger.nullLogger)
+      Files.list(cacheDir).forEach(Files.write(_, "garbage".getBytes()))
+
+      val restored = ClassPath.cached(jar, cacheDir, Logger.nullLogger)
+      assertEquals(listed.names.toSet, restored.names.toSet)
+    }
+  }
+
+  @Test def archiveMatchesListedJar(): Unit = withJar { jar =>
+    Scope { implicit in =>
+      val directory = VirtualDirectory.real(jar)
+      val listed = ClassPath(directory)
+      val file = Files.createTempFile("classpath", ".nira")
+      NirArchive.write(directory, file)
+      val archive = NirArchive.open(file, jar)
+
+      assertEquals(listed.names.toSet, archive.entries.map(_.name).toSet)
+      assertEquals(
+        listed.classesWithEntryPoints.toSet,
+        archive.entries.filter(_.hasEntryPoints).map(_.name).toSet
+      )
+      assertEquals(listed.definedServicesProviders, archive.servicesProviders)
+
+      listed.names.take(20).foreach { name =>
+        val defns = archive.load(name).get
+        assertEquals(
+          listed.load(name).get.map(_.name).toSet,
+          defns.map(_.name).toSet
+        )
+        defns.map(_.pos.nirSource).filter(_.exists).foreach { source =>
+          assertEquals(jar, source.directory)
+          assertTrue(source.path.toString.endsWith(".nir"))
+        }
+      }
+    }
+  }
+
+  @Test def archiveLoadsConcurrently(): Unit = withJar { jar =>
+    val directory = VirtualDirectory.real(jar)
+    val file = Files.createTempFile("classpath", ".nira")
+    NirArchive.write(directory, file)
+    val archive = NirArchive.open(file, jar)
+    val names = archive.entries.map(_.name).take(200)
+    val expected = names.map(archive.load(_).get.map(_.name).toSet)
+
+    val executor = Executors.newFixedThreadPool(8)
+    try {
+      val tasks = (0 until 8).map { _ =>
+        executor.submit(new Callable[Seq[Set[nir.Global]]] {
+          def call(): Seq[Set[nir.Global]] =
+            names.reverse.map(archive.load(_).get.map(_.name).toSet).reverse
+        })
+      }
+      tasks.foreach(task => assertEquals(expected, task.get()))
+    } finally {
+      executor.shutdown()
+      executor.awaitTermination(1, TimeUnit.MINUTES)
+    }
+
+    archive.close()
+    assertTrue(archive.contains(names.head))
+    try {
+      archive.load(names.head)
+      fail("Loaded from a closed archive")
+    } catch { case _: IllegalStateException => () }
+  }
+}
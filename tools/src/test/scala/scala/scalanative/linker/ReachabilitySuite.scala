@@ -88,7 +88,7 @@ trait ReachabilitySuite {
       val sourcesDir = NIRCompiler.writeSources(sourceMap)
       val files = compiler.compile(sourcesDir)
       val config = makeConfig(outDir, mainClass)
-      val result = Link(config, entries)
+      val result = Await.result(Link(config, entries), Duration.Inf)
       f(result)
     }
 
@@ -0,0 +1,142 @@
+package scala.scalanative
+package optimizer
+
+import java.nio.file.{Files, Path}
+
+import scala.concurrent.ExecutionContext.Implicits.global
+import scala.concurrent._
+import scala.concurrent.duration._
+
+import org.junit.Assert._
+import org.junit.Test
+
+import scala.scalanative.build.{Config, IO, Mode, ScalaNative}
+import scala.scalanative.interflow.Interflow
+import scala.scalanative.linker.ReachabilityAnalysis
+
+class OptimizationCacheTest extends OptimizerSpec {
+
+  private val sources = Map(
+    "Test.scala" ->
+      """|object Test {
+         |  class Counter(var value: Int) {
+         |    def inc(): Unit = value += 1
+         |  }
+         |  lazy val counter = new Counter(0)
+         |
+         |  def main(args: Array[String]): Unit = {
+         |    args.foreach(_ => counter.inc())
+         |    println(counter.value)
+         |  }
+         |}
+         |""".stripMargin
+  )
+
+  // Counter.inc is inlined in bump, tripled is unrelated to it
+  private def edited(increment: Int) = Map(
+    "Test.scala" ->
+      s"""|object Test {
+          |  class Counter(var value: Int) {
+          |    def inc(): Unit = value += $increment
+          |  }
+          |  @noinline def bump(counter: Counter): Unit = counter.inc()
+          |  @noinline def tripled(n: Int): Int = n * 3 + 1
+          |
+          |  def main(args: Array[String]): Unit = {
+          |    val counter = new Counter(args.length)
+          |    bump(counter)
+          |    println(counter.value + tripled(args.length))
+          |  }
+          |}
+          |""".stripMargin
+  )
+
+  private def optimized(
+      config: Config,
+      linked: ReachabilityAnalysis.Result
+  ): Seq[String] = {
+    val optimized = ScalaNative.optimize(config, linked)
+    Await.result(optimized, Duration.Inf).defns.map(_.show).sorted
+  }
+
+  @Test def reusesMethodsOptimizedByPreviousBuild(): Unit =
+    link("Test", sources, _.withMode(Mode.releaseFast)) {
+      case (config, linked) =>
+        val expected = optimized(config, linked)
+        val index = config.workDir.resolve("interflow").resolve("index")
+        assertTrue("Cache not persisted", Files.exists(index))
+        assertEquals(expected, optimized(config, linked))
+    }
+
+  @Test def corruptedCacheIsIgnored(): Unit =
+    link("Test", sources, _.withMode(Mode.releaseFast)) {
+      case (config, linked) =>
+        val expected = optimized(config, linked)
+        val cache = config.workDir.resolve("interflow")
+        Files.list(cache).forEach(Files.write(_, "garbage".getBytes()))
+        assertEquals(expected, optimized(config, linked))
+    }
+
+  @Test def notUsedWithoutIncrementalCompilation(): Unit =
+    link(
+      "Test",
+      sources,
+      _.withMode(Mode.releaseFast).withIncrementalCompilation(false)
+    ) {
+      case (config, linked) =>
+        optimized(config, linked)
+        assertFalse(Files.exists(config.workDir.resolve("interflow")))
+    }
+
+  @Test def editedMethodsAndTheirInlinersAreInvalidated(): Unit =
+    link("Test", edited(1), _.withMode(Mode.releaseFast)) {
+      case (previousConfig, previousLinked) =>
+        optimized(previousConfig, previousLinked)
+        val previousCache = previousConfig.workDir.resolve("interflow")
+
+        link("Test", edited(2), _.withMode(Mode.releaseFast)) {
+          case (config, linked) =>
+            val cache = config.workDir.resolve("interflow")
+            copyDirectory(previousCache, cache)
+            val interflow = new Interflow(config)(linked)
+            val defns =
+              Await.result(Interflow.optimize(interflow), Duration.Inf)
+            val stats = interflow.cacheStats
+
+            def method(owner: String, id: String): nir.Global.Member =
+              (stats.reused ++ stats.missed).find { name =>
+                name.owner == nir.Global.Top(owner) &&
+                (name.sig.unmangled match {
+                  case nir.Sig.Method(`id`, _, _) => true
+                  case _                          => false
+                })
+              }.get
+            assertTrue(stats.missed.contains(method("Test$Counter", "inc")))
+            assertTrue(stats.missed.contains(method("Test$", "bump")))
+            assertTrue(stats.reused.contains(method("Test$", "tripled")))
+            assertTrue(
+              s"${stats.misses} misses, ${stats.hits} hits",
+              stats.hits > stats.misses
+            )
+
+            // Reused entries don't change the outcome
+            IO.deleteRecursive(cache)
+            val uncached = new Interflow(config)(linked)
+            assertEquals(
+              defns.map(_.show).sorted,
+              Await
+                .result(Interflow.optimize(uncached), Duration.Inf)
+                .map(_.show)
+                .sorted
+            )
+            assertEquals(0, uncached.cacheStats.hits)
+        }
+    }
+
+  private def copyDirectory(from: Path, to: Path): Unit = {
+    Files.createDirectories(to)
+    Files.list(from).forEach { file =>
+      Files.copy(file, to.resolve(file.getFileName()))
+    }
+  }
+}
@@ -0,0 +1,56 @@
+package scala.scalanative
+package optimizer
+
+import java.util.concurrent.ForkJoinPool
+
+import scala.concurrent._
+import scala.concurrent.duration._
+
+import org.junit.Assert._
+import org.junit.Test
+
+import scala.scalanative.build.{Mode, NativeConfig, ScalaNative}
+
+class ParallelOptimizerTest extends OptimizerSpec {
+
+  private val sources = Map(
+    "Test.scala" ->
+      """|object Test {
+         |  // Mutually recursive methods are optimized while waiting for each other
+         |  def isEven(n: Int): Boolean = if (n == 0) true else isOdd(n - 1)
+         |  def isOdd(n: Int): Boolean = if (n == 0) false else isEven(n - 1)
+         |
+         |  class Node(val value: Int, val next: Node) {
+         |    def sum: Int = value + (if (next == null) 0 else next.sum)
+         |  }
+         |
+         |  def main(args: Array[String]): Unit = {
+         |    val list = new Node(1, new Node(2, new Node(3, null)))
+         |    println(isEven(list.sum) + " " + isOdd(args.length))
+         |  }
+         |}
+         |""".stripMargin
+  )
+
+  // Results of the first run would be reused by the next ones
+  private def noCache(config: NativeConfig) =
+    config.withMode(Mode.releaseFull).withIncrementalCompilation(false)
+
+  @Test def resultsDoNotDependOnThreads(): Unit =
+    link("Test", sources, config => noCache(config)) {
+      case (config, linked) =>
+        def optimize(threads: Int): Seq[String] = {
+          val pool = new ForkJoinPool(threads)
+          try {
+            val ec = ExecutionContext.fromExecutorService(pool)
+            val optimized = ScalaNative.optimize(config, linked)(ec)
+            Await.result(optimized, Duration.Inf).defns.map(_.show).sorted
+          } finally pool.shutdown()
+        }
+
+        val expected = optimize(threads = 1)
+        Seq(2, 8, 8).foreach { threads =>
+          assertEquals(expected, optimize(threads))
+        }
+    }
+}
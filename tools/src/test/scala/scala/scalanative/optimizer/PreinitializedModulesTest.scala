@@ -0,0 +1,75 @@
+package scala.scalanative
+package optimizer
+
+import org.junit.Assert._
+import org.junit.Test
+
+import scala.scalanative.codegen.{Metadata, PlatformInfo}
+import scala.scalanative.linker.Class
+
+class PreinitializedModulesTest extends OptimizerSpec {
+
+  private val sources = Map(
+    "Test.scala" ->
+      """|object Test {
+         |  object Config {
+         |    val name = "app"
+         |    val retries = 3
+         |    val verbose = false
+         |    val defaults = Defaults
+         |  }
+         |  object Defaults {
+         |    val timeout = 30L
+         |  }
+         |  object Counter {
+         |    var count = 0
+         |  }
+         |  object Clock {
+         |    val start = System.nanoTime()
+         |  }
+         |
+         |  def main(args: Array[String]): Unit = {
+         |    Counter.count += args.length
+         |    println(Config.name + Config.retries + Config.verbose)
+         |    println(Config.defaults.timeout + Counter.count + Clock.start)
+         |  }
+         |}
+         |""".stripMargin
+  )
+
+  private def module(name: String) = nir.Global.Top(s"Test$$$name$$")
+
+  @Test def preinitializesPureModules(): Unit =
+    optimize("Test", sources, _.withMode(build.Mode.releaseFast)) {
+      case (config, result) =>
+        implicit val platform: PlatformInfo = PlatformInfo(config)
+        val meta = new Metadata(result, config, Nil)
+        def isPreinitialized(name: String) =
+          result.infos.get(module(name)).exists {
+            case cls: Class => meta.hasStaticInstance(cls)
+            case _          => false
+          }
+        assertTrue(isPreinitialized("Config"))
+        assertTrue(isPreinitialized("Defaults"))
+        // Stored to outside of the constructor
+        assertFalse(isPreinitialized("Counter"))
+        // Initialized by a call to native code
+        assertFalse(isPreinitialized("Clock"))
+
+        afterLowering(config, result) { lowered =>
+          val main = findEntry(result.defns).get
+          val loweredMain = lowered.collectFirst {
+            case defn: nir.Defn.Define if defn.name == main.name => defn
+          }.get
+          val loaded = loweredMain.insts.collect {
+            case nir.Inst.Let(_, nir.Op.Call(_, nir.Val.Global(load, _), _), _)
+                if load.isInstanceOf[nir.Global.Member] &&
+                  load.asInstanceOf[nir.Global.Member].sig ==
+                  nir.Sig.Generated("load") =>
+              load.top
+          }.toSet
+          assertFalse(loaded.contains(module("Config")))
+          assertFalse(loaded.contains(module("Defaults")))
+        }
+    }
+}
@@ -0,0 +1,111 @@
+package scala.scalanative
+package optimizer
+
+import org.junit.Assert._
+import org.junit.Test
+
+import scala.scalanative.codegen.EscapeAnalysis
+
+class StackAllocationTest extends OptimizerSpec {
+
+  private val sources = Map(
+    "Test.scala" ->
+      """|object Test {
+         |  class Point(val x: Int, val y: Int)
+         |  var kept: Point = _
+         |
+         |  @noinline def norm(p: Point): Int = p.x * p.x + p.y * p.y
+         |  @noinline def keep(p: Point): Int = { kept = p; p.x }
+         |  @noinline def same(p: Point): Point = p
+         |  @noinline def fill(arr: Array[Int]): Unit = arr(0) = 42
+         |
+         |  def main(args: Array[String]): Unit = {
+         |    val local = new Point(args.length, 1)
+         |    val escaping = new Point(args.length, 2)
+         |    val returned = same(new Point(args.length, 3))
+         |    val arr = new Array[Int](4)
+         |    fill(arr)
+         |    val sum = norm(local) + keep(escaping) + norm(returned) + arr(0)
+         |    println(sum)
+         |  }
+         |}
+         |""".stripMargin
+  )
+
+  private val Point = nir.Global.Top("Test$Point")
+
+  private def methodNamed(defns: Seq[nir.Defn], id: String) =
+    defns.collectFirst {
+      case defn @ nir.Defn.Define(_, nir.Global.Member(_, sig), _, _, _)
+          if sig.unmangled.isInstanceOf[nir.Sig.Method] &&
+            sig.unmangled.asInstanceOf[nir.Sig.Method].id == id =>
+        defn
+    }.get
+
+  @Test def summarizesEscapeOfParameters(): Unit =
+    optimize("Test", sources, _.withMode(build.Mode.releaseFast)) {
+      case (_, result) =>
+        val escapes = EscapeAnalysis(result.defns)
+        def paramEscape(id: String) =
+          escapes.summaries(methodNamed(result.defns, id).name).last
+        assertEquals(EscapeAnalysis.NoEscape, paramEscape("norm"))
+        assertEquals(EscapeAnalysis.GlobalEscape, paramEscape("keep"))
+        assertEquals(EscapeAnalysis.ReturnEscape, paramEscape("same"))
+        assertEquals(EscapeAnalysis.NoEscape, paramEscape("fill"))
+    }
+
+  @Test def allocatesNonEscapingObjectsOnStack(): Unit =
+    optimize("Test", sources, _.withMode(build.Mode.releaseFast)) {
+      case (config, result) =>
+        val main = findEntry(result.defns).get
+        val escapes = EscapeAnalysis(result.defns)
+        val nonEscaping = escapes.nonEscaping(main.name)
+        val points = main.insts.collect {
+          case nir.Inst.Let(n, nir.Op.Classalloc(Point, _), _) => n
+        }
+        val arrays = main.insts.collect {
+          case nir.Inst.Let(n, _: nir.Op.Arrayalloc, _) => n
+        }
+        assertEquals(3, points.size)
+        // Only the point kept by `keep` escapes
+        assertEquals(2, points.count(nonEscaping.contains))
+        assertEquals(1, arrays.size)
+        assertTrue(nonEscaping.contains(arrays.head))
+
+        afterLowering(config, result) { lowered =>
+          val loweredMain = lowered.collectFirst {
+            case defn: nir.Defn.Define if defn.name == main.name => defn
+          }.get
+          val slots = loweredMain.insts.collect {
+            case nir.Inst.Let(n, _: nir.Op.Stackalloc, _) => n
+          }.toSet
+          val stackAllocated = loweredMain.insts.collect {
+            case nir.Inst.Let(n, nir.Op.Copy(nir.Val.Local(slot, _)), _)
+                if slots.contains(slot) =>
+              n
+          }.toSet
+          assertEquals(nonEscaping, stackAllocated.intersect(nonEscaping))
+        }
+    }
+
+  @Test def notUsedWhenContinuationsMoveFrames(): Unit = {
+    implicit val pos: nir.SourcePosition = nir.SourcePosition.NoPosition
+    val suspend = nir.Defn.Declare(
+      nir.Attrs.None,
+      nir.Global
+        .Top("Continuations$Impl$")
+        .member(nir.Sig.Extern("scalanative_continuation_suspend")),
+      nir.Type.Function(Seq(nir.Type.Ptr), nir.Type.Ptr)
+    )
+    val config = build.NativeConfig.empty
+    assertFalse(EscapeAnalysis.movesFrames(Nil, config))
+    assertTrue(EscapeAnalysis.movesFrames(Seq(suspend), config))
+    // Stackful continuations resume their frames in place
+    assertFalse(
+      EscapeAnalysis.movesFrames(
+        Seq(suspend),
+        config.withStackfulContinuations(true)
+      )
+    )
+  }
+}
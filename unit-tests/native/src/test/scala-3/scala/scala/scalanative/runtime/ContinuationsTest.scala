@@ -1,5 +1,6 @@
 package scala.scalanative.runtime
 
+import java.io.{BufferedReader, FileReader}
 import java.util.concurrent.atomic.{AtomicBoolean, AtomicInteger}
 import java.util.concurrent.{CountDownLatch, LinkedBlockingQueue, TimeUnit}
 
@@ -9,7 +10,7 @@ import org.junit.Assert._
 import org.junit.Test
 
 import scala.scalanative.meta.LinktimeInfo.{
-  is32BitPlatform, isContinuationsSupported
+  is32BitPlatform, isContinuationsSupported, isLinux
 }
 
 import Continuations._
@@ -56,6 +57,21 @@ class ContinuationsTest:
       val r2 = r1.nx(3)
       assert(r2.n == 5)
 
+  @Test def canSuspendToOuterBoundary() =
+    if isContinuationsSupported then
+      case class Step(n: Int, next: Int => Step)
+      val r0 = boundary[Step] {
+        val outer = summon[BoundaryLabel[Step]]
+        val inner = boundary[Int] {
+          val x = suspend[Int, Step](cb => Step(1, cb))(using outer)
+          x + suspend[Int, Int](cb => cb(10))
+        }
+        Step(inner, _ => ???)
+      }
+      assert(r0.n == 1)
+      val r1 = r0.next(5)
+      assert(r1.n == 15)
+
   @Test def fibonacci(): Unit = {
     if isContinuationsSupported then
       import scala.collection.mutable.ArrayBuffer
@@ -591,4 +607,34 @@ class ContinuationsTest:
       assertEquals("deep stack local corruption", 0, errors.get())
     }
 
+
+  // Each leaked stack of a stackful continuation adds a mapping, with its
+  // guard page possibly another one
+  @Test def droppedContinuationsAreReleased(): Unit =
+    if isContinuationsSupported && isLinux then {
+      def mappings(): Int =
+        val reader = new BufferedReader(new FileReader("/proc/self/maps"))
+        try
+          var lines = 0
+          while reader.readLine() != null do lines += 1
+          lines
+        finally reader.close()
+
+      val dropped = 20000
+      val before = mappings()
+      var i = 0
+      while i < dropped do
+        boundary[Int] {
+          suspend[Int](_ => 0)
+          1
+        }
+        i += 1
+        if i % 1000 == 0 then System.gc()
+      val growth = mappings() - before
+      assertTrue(
+        s"$growth mappings added by $dropped dropped continuations",
+        growth < dropped / 2
+      )
+    }
+
 end ContinuationsTest
@@ -0,0 +1,100 @@
+package org.scalanative.testsuite.javalib.lang
+
+import java.nio.{ByteBuffer, CharBuffer}
+import java.nio.charset.StandardCharsets.UTF_8
+
+import org.junit.Assert._
+import org.junit.Test
+
+import scala.scalanative.javalib.lang.Utf8
+import scala.scalanative.unsafe._
+import scala.scalanative.unsigned._
+
+class Utf8Test {
+
+  /** Decodes `input` into at most `dstLen` chars, returns them and the number
+   *  of consumed bytes.
+   */
+  private def decode(input: String, dstLen: Int): (String, Int) = {
+    val src = input.getBytes(UTF_8)
+    val dst = new Array[Char](dstLen + 1)
+    val read = stackalloc[CSize]()
+    val written = Utf8
+      .scalanative_utf8_to_utf16(
+        src.at(0),
+        src.length.toCSize,
+        dst.at(0),
+        dstLen.toCSize,
+        read
+      )
+      .toInt
+    (new String(dst, 0, written), (!read).toInt)
+  }
+
+  @Test def decodesMultibyteSequencesIntoSmallOutput(): Unit = {
+    assertEquals(("€", 3), decode("€a", 1))
+    assertEquals(("€a", 4), decode("€a", 2))
+    assertEquals(("éé", 4), decode("ééé", 2))
+  }
+
+  @Test def doesNotSplitSurrogatePairs(): Unit = {
+    val emoji = "😀"
+    assertEquals(("", 0), decode(emoji, 1))
+    assertEquals((emoji, 4), decode(emoji + emoji, 3))
+    assertEquals((emoji + emoji, 8), decode(emoji + emoji, 4))
+  }
+
+  @Test def fillsOutputOfEverySize(): Unit = {
+    val text = ("ascii éè € 😀 " * 2000) + "end"
+    for (dstLen <- Seq(0, 1, 2, 3, 7, 100, 4097, 16385, 30000, text.length)) {
+      val (decoded, read) = decode(text, dstLen)
+      // Only a surrogate pair might not fit in the last char
+      assertTrue(s"under-filled $dstLen", decoded.length >= dstLen - 1)
+      assertEquals(text.substring(0, decoded.length), decoded)
+      assertEquals(decoded.getBytes(UTF_8).length, read)
+    }
+  }
+
+  private def decodeInChunks(bytes: Array[Byte]): String = {
+    val decoder = UTF_8.newDecoder()
+    val in = ByteBuffer.wrap(bytes)
+    val out = CharBuffer.allocate(1000)
+    val sb = new java.lang.StringBuilder(bytes.length)
+    var done = false
+    while (!done) {
+      val result = decoder.decode(in, out, true)
+      out.flip()
+      sb.append(out)
+      out.clear()
+      assertFalse(s"decoding failed: $result", result.isError())
+      done = result.isUnderflow()
+    }
+    sb.toString
+  }
+
+  @Test def transcodesLargeTexts(): Unit = {
+    val random = new java.util.Random(42)
+    // Code points encoded as 2, 3 and 4 bytes
+    val nonAscii = Array(0xe9, 0x3b1, 0x20ac, 0x4e2d, 0x1f600, 0x1f680)
+    for (ratio <- Seq(0.0, 0.1, 0.4, 1.0)) {
+      val sb = new java.lang.StringBuilder
+      while (sb.length < 256 * 1024) {
+        if (random.nextDouble() < ratio)
+          sb.appendCodePoint(nonAscii(random.nextInt(nonAscii.length)))
+        else sb.append(('a' + random.nextInt(26)).toChar)
+      }
+      val text = sb.toString
+      val bytes = text.getBytes(UTF_8)
+      assertEquals(s"decode $ratio", text, new String(bytes, UTF_8))
+      assertEquals(s"decoder $ratio", text, decodeInChunks(bytes))
+
+      val malformed = java.util.Arrays.copyOf(bytes, bytes.length + 1)
+      malformed(bytes.length) = 0xff.toByte
+      assertEquals(
+        s"malformed $ratio",
+        text + "\ufffd",
+        new String(malformed, UTF_8)
+      )
+    }
+  }
+}
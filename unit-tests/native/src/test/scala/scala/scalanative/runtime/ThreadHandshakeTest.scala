@@ -0,0 +1,104 @@
+package scala.scalanative.runtime
+
+import java.util.concurrent.CountDownLatch
+import java.util.concurrent.atomic.{AtomicBoolean, AtomicInteger}
+
+import org.junit.Assert._
+import org.junit.Assume._
+import org.junit.Test
+
+import org.scalanative.testsuite.utils.AssertThrows.assertThrows
+
+class ThreadHandshakeTest {
+
+  private def withRunningThread(fn: Thread => Unit): Unit = {
+    assumeTrue("handshakes not supported", ThreadHandshake.isSupported)
+    val running = new AtomicBoolean(true)
+    val started = new CountDownLatch(1)
+    val thread = new Thread(() => {
+      started.countDown()
+      var counter = 0L
+      while (running.get()) counter += 1
+    })
+    thread.start()
+    started.await()
+    try fn(thread)
+    finally {
+      running.set(false)
+      thread.join()
+    }
+  }
+
+  @Test def executesActionOnTargetThread(): Unit =
+    withRunningThread { thread =>
+      var executedBy: Thread = null
+      var stackTrace: Array[StackTraceElement] = null
+      assertTrue(ThreadHandshake.runOn(thread) {
+        executedBy = Thread.currentThread()
+        stackTrace = new Throwable().getStackTrace()
+      })
+      assertSame(thread, executedBy)
+      assertTrue(stackTrace.nonEmpty)
+    }
+
+  @Test def executesConsecutiveActions(): Unit =
+    withRunningThread { thread =>
+      var executed = 0
+      for (_ <- 0 until 100)
+        assertTrue(ThreadHandshake.runOn(thread)(executed += 1))
+      assertEquals(100, executed)
+    }
+
+  @Test def rethrowsExceptionOfAction(): Unit =
+    withRunningThread { thread =>
+      assertThrows(
+        classOf[IllegalStateException],
+        ThreadHandshake.runOn(thread)(throw new IllegalStateException())
+      )
+    }
+
+  @Test def executesOnCurrentThread(): Unit = {
+    var executed = false
+    val result = ThreadHandshake.runOn(Thread.currentThread())(executed = true)
+    assertEquals(ThreadHandshake.isSupported, result)
+    assertEquals(ThreadHandshake.isSupported, executed)
+  }
+
+  @Test def executesMutualHandshakes(): Unit = {
+    assumeTrue("handshakes not supported", ThreadHandshake.isSupported)
+    val iterations = 100
+    val started = new AtomicInteger(0)
+    val finished = new AtomicInteger(0)
+    val executed = new AtomicInteger(0)
+    val threads = new Array[Thread](2)
+    // Both threads request handshakes from each other at the same time. They
+    // only spin between requests, blocked threads don't reach safepoints.
+    def requestFrom(self: Int): Runnable = () => {
+      val other = threads(1 - self)
+      started.incrementAndGet()
+      while (started.get() < 2) ()
+      try
+        for (_ <- 0 until iterations)
+          assertTrue(ThreadHandshake.runOn(other)(executed.incrementAndGet()))
+      finally finished.incrementAndGet()
+      // Requests of the other thread are still executed while it finishes
+      while (finished.get() < 2) ()
+    }
+    threads(0) = new Thread(requestFrom(0))
+    threads(1) = new Thread(requestFrom(1))
+    threads.foreach(_.start())
+    threads.foreach(_.join(30000))
+    assertFalse("deadlocked", threads.exists(_.isAlive()))
+    assertEquals(2 * iterations, executed.get())
+  }
+
+  @Test def failsForTerminatedThread(): Unit = {
+    assumeTrue("handshakes not supported", ThreadHandshake.isSupported)
+    val thread = new Thread(() => ())
+    thread.start()
+    thread.join()
+    var executed = false
+    assertFalse(ThreadHandshake.runOn(thread)(executed = true))
+    assertFalse(executed)
+  }
+}
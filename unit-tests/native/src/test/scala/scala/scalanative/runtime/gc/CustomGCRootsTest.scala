@@ -88,9 +88,67 @@ class CustomGCRootsTest {
       }
     } finally zone.close()
   }
+
+  @Test def `can mark objects referenced from overlapping and partially removed regions`()
+      : Unit = {
+    // Spans multiple 1 MB regions, ranges crossing them are split and stored
+    // by different shards of the registry
+    val size = 3 * RegionSize
+    val chunk = malloc(size.toUSize)
+    memset(chunk, 0, size.toUSize)
+    def at(offset: Int): Ptr[Byte] = chunk + offset
+    // Offsets of slots registered by at least one of the ranges after removal
+    val kept = Seq(
+      0,
+      128,
+      RegionSize / 2,
+      RegionSize + 64,
+      3 * RegionSize / 2 + 64,
+      2 * RegionSize - 64,
+      2 * RegionSize + 128,
+      size - 64
+    )
+    try {
+      GC.addRoots(at(0), at(3 * RegionSize / 2))
+      // Overlaps with previous range, merged into one
+      GC.addRoots(at(RegionSize), at(size))
+      // Fully contained in already registered ranges
+      GC.addRoots(at(64), at(256))
+      GC.addRoots(at(2 * RegionSize - 128), at(2 * RegionSize + 4096))
+      // Splits the registered range
+      GC.removeRoots(at(RegionSize / 4), at(RegionSize / 4 + 4096))
+      // Trims the end of registered range
+      GC.removeRoots(at(size - 32), at(size))
+      // Adjacent to the registered range, coalesced with it
+      GC.addRoots(at(size - 32), at(size))
+
+      storeArrays(chunk, kept)
+      for (_ <- 0 until 5) {
+        Seq.fill(50)(genGarbage())
+        System.gc()
+        kept.foreach { offset =>
+          val array = !(at(offset).asInstanceOf[Ptr[Array[Int]]])
+          assertNotNull(s"object at offset $offset", array)
+          assertTrue(s"object at offset $offset", array.forall(_ == offset))
+        }
+      }
+    } finally {
+      GC.removeRoots(at(0), at(size))
+      free(chunk)
+    }
+  }
 }
 
 object CustomGCRootsTest {
+  private final val RegionSize = 1024 * 1024
+
+  // Arrays are reachable only through the slots in the memory at `chunk`
+  @noinline private def storeArrays(chunk: Ptr[Byte], offsets: Seq[Int]) =
+    offsets.foreach { offset =>
+      !((chunk + offset).asInstanceOf[Ptr[Array[Int]]]) =
+        Array.fill(16)(offset)
+    }
+
   private def genGarbage(): AnyRef = scala.util.Random.alphanumeric
     .take(128)
     .map(_.toUpper)
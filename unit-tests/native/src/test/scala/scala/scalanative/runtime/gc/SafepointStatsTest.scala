@@ -0,0 +1,51 @@
+package scala.scalanative.runtime.gc
+
+import java.util.concurrent.atomic.AtomicBoolean
+
+import org.junit.Assert._
+import org.junit.Assume._
+import org.junit.Test
+
+import scala.scalanative.junit.utils.AssumesHelper
+import scala.scalanative.meta.LinktimeInfo
+import scala.scalanative.runtime.SafepointStats
+
+class SafepointStatsTest {
+
+  @Test def `records time to safepoint of running threads`(): Unit = {
+    AssumesHelper.assumeMultithreadingIsEnabled()
+    assumeTrue(
+      "Statistics are gathered only by Immix and Commix",
+      LinktimeInfo.gc.isImmix || LinktimeInfo.gc.isCommix
+    )
+
+    val collectionsBefore = SafepointStats.collectionHistogram().sum
+    val running = new AtomicBoolean(true)
+    val worker = new Thread(() => {
+      var acc = 0L
+      while (running.get()) {
+        acc += new Array[Byte](64).length
+      }
+    })
+    worker.start()
+    try {
+      for (_ <- 0 until 5) System.gc()
+    } finally {
+      running.set(false)
+      worker.join()
+    }
+
+    val collections = SafepointStats.collectionHistogram()
+    val threads = SafepointStats.threadHistogram()
+    assertTrue("histogram buckets", collections.length > 0)
+    assertEquals(collections.length, threads.length)
+    assertTrue(
+      "recorded stop-the-world events",
+      collections.sum >= collectionsBefore + 5
+    )
+    assertTrue("recorded threads reaching safepoint", threads.sum > 0)
+    assertTrue(
+      SafepointStats.maxCollectionNanos() >= SafepointStats.maxThreadNanos()
+    )
+  }
+}
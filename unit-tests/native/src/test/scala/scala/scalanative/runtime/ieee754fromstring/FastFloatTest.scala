@@ -0,0 +1,106 @@
+package scala.scalanative
+package runtime
+package ieee754fromstring
+
+import java.nio.charset.StandardCharsets
+
+import org.junit.Assert._
+import org.junit.Test
+
+import org.scalanative.testsuite.utils.AssertThrows.assertThrows
+
+class FastFloatTest {
+
+  private def assertDoubleBits(expected: scala.Long, s: String): Unit = {
+    assertEquals(s, expected, java.lang.Double.doubleToRawLongBits(parse(s)))
+    val bytes = s.getBytes(StandardCharsets.US_ASCII)
+    val fromBytes = FastFloat.parseDouble(bytes, 0, bytes.length)
+    assertEquals(
+      s"bytes: $s",
+      expected,
+      java.lang.Double.doubleToRawLongBits(fromBytes)
+    )
+  }
+
+  private def assertFloatBits(expected: scala.Int, s: String): Unit = {
+    val value = java.lang.Float.parseFloat(s)
+    assertEquals(s, expected, java.lang.Float.floatToRawIntBits(value))
+    val fromChars = FastFloat.parseFloat(s, 0, s.length)
+    assertEquals(
+      s"chars: $s",
+      expected,
+      java.lang.Float.floatToRawIntBits(fromChars)
+    )
+  }
+
+  private def parse(s: String): scala.Double = java.lang.Double.parseDouble(s)
+
+  @Test def simpleCases(): Unit = {
+    assertDoubleBits(0x0000000000000000L, "0")
+    assertDoubleBits(0x8000000000000000L, "-0.0")
+    assertDoubleBits(0x3ff0000000000000L, "1")
+    assertDoubleBits(0x3fb999999999999aL, "0.1")
+    assertDoubleBits(0xc00921fb54442d18L, "-3.141592653589793")
+    assertDoubleBits(0x3ff8000000000000L, "+.15e1")
+    assertDoubleBits(0x4059000000000000L, "100.")
+    assertDoubleBits(0x4059000000000000L, " \t1e2d\n")
+    assertDoubleBits(0x4059000000000000L, "0000000000000000000000100")
+  }
+
+  @Test def roundingBoundaries(): Unit = {
+    // 2^53 + 1 is halfway between two doubles, ties to even
+    assertDoubleBits(0x4340000000000000L, "9007199254740993")
+    assertDoubleBits(0x4340000000000001L, "9007199254740994")
+    assertDoubleBits(0x7fefffffffffffffL, "1.7976931348623157e308")
+    assertDoubleBits(0x7ff0000000000000L, "1.7976931348623159e308")
+    assertDoubleBits(0x7ff0000000000000L, "1e400")
+    assertDoubleBits(0x0010000000000000L, "2.2250738585072014E-308")
+    assertDoubleBits(0x000fffffffffffffL, "2.2250738585072011E-308")
+    assertDoubleBits(0x0000000000000001L, "4.9e-324")
+    assertDoubleBits(0x0000000000000000L, "2.4703282292062327e-324")
+    assertDoubleBits(0x0000000000000001L, "2.4703282292062328e-324")
+    assertDoubleBits(0x0000000000000000L, "1e-400")
+  }
+
+  @Test def manyDigits(): Unit = {
+    assertDoubleBits(
+      0x3ff0000000000000L,
+      "1.00000000000000000000000000000000000000000000000001e0"
+    )
+    // Exactly halfway between 1 and the next double, requires slow path
+    assertDoubleBits(
+      0x3ff0000000000000L,
+      "1.00000000000000011102230246251565404236316680908203125"
+    )
+    assertDoubleBits(
+      0x3ff0000000000001L,
+      "1.00000000000000011102230246251565404236316680908203126"
+    )
+    assertDoubleBits(
+      0x4415af1d78b58c40L,
+      "100000000000000000000.000000000000000000001"
+    )
+  }
+
+  @Test def floats(): Unit = {
+    assertFloatBits(0x3dcccccd, "0.1")
+    assertFloatBits(0x3dcccccd, "0.1f")
+    assertFloatBits(0x4b800000, "16777217")
+    assertFloatBits(0x7f7fffff, "3.4028235e38")
+    assertFloatBits(0x7f800000, "3.4028236e38")
+    assertFloatBits(0x00800000, "1.17549435E-38")
+    assertFloatBits(0x00000001, "1.4e-45")
+    assertFloatBits(0x80000000, "-1e-46")
+  }
+
+  @Test def delegatedInputs(): Unit = {
+    assertTrue(parse("NaN").isNaN)
+    assertEquals(scala.Double.NegativeInfinity, parse("-Infinity"), 0.0)
+    assertEquals(24.0, parse("0x1.8p4"), 0.0)
+    assertEquals(2.0, FastFloat.parseDouble("[2.0]", 1, 4), 0.0)
+
+    val invalid = Seq("", " ", ".", "e5", "1e", "1e+", "1..0", "1 d", "--1")
+    for (s <- invalid)
+      assertThrows(classOf[NumberFormatException], parse(s))
+  }
+}
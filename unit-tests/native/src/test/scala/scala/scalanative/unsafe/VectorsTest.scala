@@ -0,0 +1,99 @@
+package scala.scalanative
+package unsafe
+
+import org.junit.Assert._
+import org.junit.Test
+
+import org.scalanative.testsuite.utils.AssertThrows.assertThrows
+
+class VectorsTest {
+
+  @Test def lanes(): Unit = {
+    val v = IntVector4(1, -2, 3, Int.MinValue)
+    assertEquals(4, v.length)
+    assertEquals(1, v(0))
+    assertEquals(-2, v(1))
+    assertEquals(3, v(2))
+    assertEquals(Int.MinValue, v(3))
+    assertEquals(IntVector4(1, -2, 42, Int.MinValue), v.updated(2, 42))
+    assertThrows(classOf[IndexOutOfBoundsException], v(4))
+    assertThrows(classOf[IndexOutOfBoundsException], v.updated(-1, 0))
+  }
+
+  @Test def lanesKeepSignAndBits(): Unit = {
+    val bytes = ByteVector16.broadcast(-1).updated(15, Byte.MaxValue)
+    assertEquals(-1.toByte, bytes(0))
+    assertEquals(Byte.MaxValue, bytes(15))
+
+    val floats = FloatVector4(-0.0f, Float.NaN, 1.5f, Float.MinPositiveValue)
+    assertEquals(-0.0f, floats(0), 0.0f)
+    assertTrue(
+      java.lang.Float.floatToRawIntBits(floats(0)) ==
+        java.lang.Float.floatToRawIntBits(-0.0f)
+    )
+    assertTrue(floats(1).isNaN)
+    assertEquals(Float.MinPositiveValue, floats(3), 0.0f)
+
+    val doubles = DoubleVector4.broadcast(Math.PI)
+    assertEquals(Math.PI, doubles(3), 0.0)
+  }
+
+  @Test def arithmetic(): Unit = {
+    val a = LongVector2(Long.MaxValue, 7L)
+    val b = LongVector2(1L, -3L)
+    assertEquals(LongVector2(Long.MinValue, 4L), a + b)
+    assertEquals(LongVector2(Long.MaxValue - 1, 10L), a - b)
+    assertEquals(LongVector2(Long.MaxValue, -21L), a * b)
+    assertEquals(LongVector2(1L, 5L), a & b)
+    assertEquals(LongVector2(-Long.MaxValue, -7L), -a)
+
+    val x = DoubleVector2(1.0, 10.0)
+    val y = DoubleVector2(4.0, -4.0)
+    assertEquals(DoubleVector2(0.25, -2.5), x / y)
+    assertEquals(DoubleVector2(-1.0, -10.0), -x)
+
+    val s = ShortVector16.broadcast(Short.MaxValue)
+    assertEquals(Short.MinValue, (s + ShortVector16.broadcast(1))(9))
+  }
+
+  @Test def comparisonsAndBlend(): Unit = {
+    val a = FloatVector8(1, 2, 3, 4, 5, 6, 7, 8)
+    val b = FloatVector8(8, 7, 6, 5, 4, 3, 2, 1)
+    val mask = a < b
+    assertEquals(IntVector8(-1, -1, -1, -1, 0, 0, 0, 0), mask)
+    assertEquals(FloatVector8(8, 7, 6, 5, 5, 6, 7, 8), a.blend(b, mask))
+    assertEquals(FloatVector8(1, 2, 3, 4, 4, 3, 2, 1), a.min(b))
+    assertEquals(FloatVector8(8, 7, 6, 5, 5, 6, 7, 8), a.max(b))
+    assertEquals(IntVector8.zero, a === b)
+
+    val c = IntVector4(-5, 0, 5, 0)
+    assertEquals(IntVector4(-1, 0, 0, 0), c < IntVector4.zero)
+    assertEquals(IntVector4(0, -1, -1, -1), c >= IntVector4.zero)
+    assertEquals(IntVector4(-1, 0, -1, 0), c =!= IntVector4.zero)
+  }
+
+  @Test def loadStore(): Unit = {
+    val array = Array.tabulate[Int](20)(i => i * i)
+    val v = IntVector8.load(array, 3)
+    assertEquals(IntVector8(9, 16, 25, 36, 49, 64, 81, 100), v)
+    assertEquals(9 + 16 + 25 + 36 + 49 + 64 + 81 + 100, v.sum)
+
+    v.store(array, 12)
+    assertEquals(100, array(19))
+    assertEquals(121, array(11))
+    assertThrows(classOf[ArrayIndexOutOfBoundsException], v.store(array, 13))
+    assertThrows(
+      classOf[ArrayIndexOutOfBoundsException],
+      IntVector8.load(array, -1)
+    )
+
+    val ptr = stackalloc[Double](4)
+    DoubleVector4(1.0, 2.0, 3.0, 4.0).store(ptr)
+    assertEquals(3.0, ptr(2), 0.0)
+    assertEquals(10.0, DoubleVector4.load(ptr).sum, 0.0)
+  }
+
+  @Test def stringRepresentation(): Unit = {
+    assertEquals("IntVector4(1, 2, 3, 4)", IntVector4(1, 2, 3, 4).toString)
+  }
+}
@@ -220,4 +220,49 @@ class ArraysMismatchTestOnJDK9 {
     )
   }
 
+  @Test def mismatch_LongArraysEveryPosition(): Unit = {
+    // Mismatches in any lane of a vector and in the tail after the last one
+    val srcSize = 100
+
+    val ints = Array.tabulate(srcSize)(i => i * 0x01010101)
+    val chars = Array.tabulate(srcSize)(i => (i + 0x100).toChar)
+
+    for (i <- 0 until srcSize) {
+      val otherInts = ints.clone()
+      otherInts(i) = -1
+      assertEquals(s"Int at $i", i, Arrays.mismatch(ints, otherInts))
+      assertEquals(s"compare Int at $i", 1, Arrays.compare(ints, otherInts))
+      assertEquals(
+        s"compareUnsigned Int at $i",
+        -1,
+        Arrays.compareUnsigned(ints, otherInts)
+      )
+
+      val otherChars = chars.clone()
+      otherChars(i) = (otherChars(i) + 1).toChar
+      assertEquals(s"Char at $i", i, Arrays.mismatch(chars, otherChars))
+      assertEquals(
+        s"compare Char at $i",
+        -1,
+        Integer.signum(Arrays.compare(chars, otherChars))
+      )
+      assertEquals(
+        s"Char range from $i",
+        -1,
+        Arrays.mismatch(chars, i, srcSize, chars.clone(), i, srcSize)
+      )
+    }
+  }
+
+  @Test def mismatch_FloatingPointCompareElements(): Unit = {
+    // Equal elements which are not bitwise equal, and the other way around
+    val otherNaN = java.lang.Double.longBitsToDouble(0x7ff8000000000001L)
+    val arrA = Array.fill(40)(Double.NaN)
+    val arrB = Array.fill(40)(otherNaN)
+    assertEquals("NaNs", -1, Arrays.mismatch(arrA, arrB))
+
+    arrA(33) = 0.0
+    arrB(33) = -0.0
+    assertEquals("zeros", 33, Arrays.mismatch(arrA, arrB))
+  }
 }
@@ -270,6 +270,50 @@ class VirtualThreadSchedulerTest {
     )
   }
 
+  @Test def manyTimedSleeps(): Unit = {
+    val count = 10_000
+    val early = new AtomicInteger(0)
+    val latch = new CountDownLatch(count)
+
+    for (i <- 0 until count) {
+      Thread.ofVirtual().start { () =>
+        val delayMillis = 1L + (i % 50)
+        val start = System.nanoTime()
+        Thread.sleep(delayMillis)
+        val elapsed = System.nanoTime() - start
+        if (elapsed < TimeUnit.MILLISECONDS.toNanos(delayMillis))
+          early.incrementAndGet()
+        latch.countDown()
+      }
+    }
+
+    assertTrue(latch.await(Timeout, TimeUnit.MILLISECONDS))
+    assertEquals("sleeps finished too early", 0, early.get())
+  }
+
+  @Test def timedParkCancelledByUnpark(): Unit = {
+    val count = 1000
+    val parked = new CountDownLatch(count)
+    val latch = new CountDownLatch(count)
+    val threads = Array.fill(count) {
+      Thread.ofVirtual().start { () =>
+        parked.countDown()
+        LockSupport.parkNanos(TimeUnit.MINUTES.toNanos(10))
+        latch.countDown()
+      }
+    }
+    assertTrue(parked.await(Timeout, TimeUnit.MILLISECONDS))
+    threads.foreach(LockSupport.unpark(_))
+    assertTrue(latch.await(Timeout, TimeUnit.MILLISECONDS))
+
+    // Pending timeouts were cancelled, other ones still expire
+    val start = System.nanoTime()
+    val vt = Thread.ofVirtual().start(() => Thread.sleep(10))
+    vt.join(Timeout)
+    assertFalse(vt.isAlive())
+    assertTrue(System.nanoTime() - start >= TimeUnit.MILLISECONDS.toNanos(10))
+  }
+
   @Test def carrierRecycled(): Unit = {
     val carriers = new ConcurrentHashMap[String, java.lang.Boolean]()
     val count = 50
@@ -0,0 +1,131 @@
+package org.scalanative.testsuite.javalib.lang
+
+import java.net.{InetAddress, ServerSocket, Socket, SocketTimeoutException}
+import java.util.concurrent._
+import java.util.concurrent.atomic.AtomicInteger
+
+import org.junit.Assert._
+import org.junit._
+
+import scala.scalanative.junit.utils.AssumesHelper
+
+import org.scalanative.testsuite.utils.Platform
+
+object VirtualThreadSocketTest {
+  @BeforeClass def checkRuntime(): Unit =
+    AssumesHelper.assumeSupportsVirtualThreads()
+}
+
+class VirtualThreadSocketTest {
+  private val Timeout = 10000L
+
+  @Test def echoOverLoopback(): Unit = {
+    Assume.assumeTrue("requires the epoll poller", Platform.isLinux)
+    val clients = 64
+    val server = new ServerSocket(0, clients, InetAddress.getLoopbackAddress())
+    val echoed = new AtomicInteger(0)
+    try {
+      // More blocked readers than carriers, they can only make progress when
+      // parked instead of blocking their carrier threads
+      val acceptor = Thread.ofVirtual().start { () =>
+        for (_ <- 0 until clients) {
+          val conn = server.accept()
+          Thread.ofVirtual().start { () =>
+            try {
+              val in = conn.getInputStream()
+              val out = conn.getOutputStream()
+              var b = in.read()
+              while (b >= 0) {
+                out.write(b)
+                b = in.read()
+              }
+            } finally conn.close()
+          }
+        }
+      }
+      val threads = for (i <- 0 until clients) yield Thread.ofVirtual().start { () =>
+        val socket = new Socket(server.getInetAddress(), server.getLocalPort())
+        try {
+          val message = s"message $i".getBytes()
+          socket.getOutputStream().write(message)
+          val in = socket.getInputStream()
+          val received = new Array[Byte](message.length)
+          var read = 0
+          while (read < message.length) {
+            val n = in.read(received, read, message.length - read)
+            assertTrue("unexpected end of stream", n > 0)
+            read += n
+          }
+          if (java.util.Arrays.equals(message, received))
+            echoed.incrementAndGet()
+        } finally socket.close()
+      }
+      threads.foreach(_.join(Timeout))
+      acceptor.join(Timeout)
+      assertEquals(clients, echoed.get())
+    } finally server.close()
+  }
+
+  @Test def readTimesOut(): Unit = {
+    val server = new ServerSocket(0, 1, InetAddress.getLoopbackAddress())
+    val timedOut = new CountDownLatch(1)
+    try {
+      val vt = Thread.ofVirtual().start { () =>
+        val socket = new Socket(server.getInetAddress(), server.getLocalPort())
+        try {
+          socket.setSoTimeout(100)
+          try socket.getInputStream().read()
+          catch { case _: SocketTimeoutException => timedOut.countDown() }
+        } finally socket.close()
+      }
+      val conn = server.accept()
+      try {
+        assertTrue(timedOut.await(Timeout, TimeUnit.MILLISECONDS))
+        vt.join(Timeout)
+      } finally conn.close()
+    } finally server.close()
+  }
+
+  @Test def sharedSocketReaders(): Unit = {
+    Assume.assumeTrue("requires the epoll poller", Platform.isLinux)
+    val readers = 16
+    val server = new ServerSocket(0, 1, InetAddress.getLoopbackAddress())
+    try {
+      val socket = new Socket(server.getInetAddress(), server.getLocalPort())
+      val conn = server.accept()
+      try {
+        val in = socket.getInputStream()
+        val received = new AtomicInteger(0)
+        // All of them wait for the same descriptor at once
+        val threads = for (_ <- 0 until readers) yield Thread.ofVirtual().start {
+          () => if (in.read() >= 0) received.incrementAndGet()
+        }
+        Thread.sleep(100)
+        conn.getOutputStream().write(new Array[Byte](readers))
+        threads.foreach(_.join(Timeout))
+        assertEquals(readers, received.get())
+      } finally {
+        conn.close()
+        socket.close()
+      }
+    } finally server.close()
+  }
+
+  @Test def readsProcessOutput(): Unit = {
+    Assume.assumeTrue("requires the epoll poller", Platform.isLinux)
+    val processes = 32
+    val read = new AtomicInteger(0)
+    // More readers waiting for their child than carriers
+    val threads = for (i <- 0 until processes) yield Thread.ofVirtual().start {
+      () =>
+        val process =
+          new ProcessBuilder("sh", "-c", s"sleep 0.5; echo $i").start()
+        try {
+          val out = new String(process.getInputStream().readAllBytes()).trim
+          if (out == i.toString) read.incrementAndGet()
+        } finally process.waitFor()
+    }
+    threads.foreach(_.join(Timeout))
+    assertEquals(processes, read.get())
+  }
+}
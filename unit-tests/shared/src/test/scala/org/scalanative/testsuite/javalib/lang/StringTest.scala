@@ -488,6 +488,30 @@ class StringTest {
     assertTrue("fubår".lastIndexOf(97, 4) == -1)
   }
 
+  @Test def searchCompareAndHashLongStrings(): Unit = {
+    // Long enough for the vectorized paths, in both Latin-1 and UTF-16
+    for (size <- Seq(15, 16, 17, 33, 64, 100); filler <- Seq('x', '\u0416')) {
+      val chars = Array.fill(size)(filler)
+      val expectedHash = chars.foldLeft(0)(31 * _ + _)
+      assertEquals(s"hashCode $size", expectedHash, new String(chars).hashCode)
+
+      for (i <- 0 until size) {
+        val marked = chars.clone()
+        marked(i) = 'a'
+        val s = new String(marked)
+        assertEquals(s"indexOf $size at $i", i, s.indexOf('a'))
+        assertEquals(s"lastIndexOf $size at $i", i, s.lastIndexOf('a'))
+        assertEquals(s"lastIndexOf before $i", -1, s.lastIndexOf('a', i - 1))
+        assertTrue(s"compareTo $size at $i", s.compareTo(new String(chars)) < 0)
+        assertEquals(
+          s"compareTo itself $size at $i",
+          0,
+          s.compareTo(new String(marked))
+        )
+      }
+    }
+  }
+
   @Test def lastIndexOfSubStringWithSurrogatePair(): Unit = {
     val helloInSurrogatePairs =
       "\ud835\udd59\ud835\udd56\ud835\udd5d\ud835\udd5d\ud835\udd60"
@@ -1325,4 +1349,123 @@ class StringTest {
     // needle > haystack
     assertFalse("c.4", "Scala Native".contains("Scala NativeN"))
   }
+
+  // Strings with chars in Latin-1 range and the remaining ones might use
+  // different internal representation, mix them in all operations.
+  @Test def latin1AndUtf16Strings(): Unit = {
+    val latin1 = "caf\u00e9"
+    val utf16 = new StringBuilder("caf\u00e9\u0100")
+      .substring(0, 5)
+      .substring(0, 4)
+
+    assertEquals("equals", latin1, utf16)
+    assertEquals("hashCode", latin1.hashCode, utf16.hashCode)
+    assertEquals("compareTo", 0, latin1.compareTo(utf16))
+    assertTrue("compareTo.2", latin1.compareTo("caf\u0100") < 0)
+    assertTrue("compareTo.3", "caf\u0100".compareTo(latin1) > 0)
+    assertEquals("indexOf", 3, "caf\u0100\u00e9".indexOf("\u0100\u00e9"))
+    assertEquals("indexOf.2", 1, "x\u00e9y".indexOf("\u00e9y"))
+    assertEquals("indexOf.3", -1, latin1.indexOf('\u0100'))
+    assertEquals("lastIndexOf", 3, latin1.lastIndexOf('\u00e9'))
+    assertTrue(
+      "regionMatches",
+      "\u0100caf\u00e9".regionMatches(1, latin1, 0, 4)
+    )
+
+    val concat = latin1.concat("\u0100")
+    assertEquals("concat", 5, concat.length)
+    assertEquals("concat.2", '\u0100', concat.charAt(4))
+    assertEquals("concat.3", "caf\u00e9\u0100", concat)
+
+    val builder = new java.lang.StringBuilder("\u00ff")
+    builder.append('\u20ac').append("abc")
+    assertEquals("builder", "\u00ff\u20acabc", builder.toString())
+    builder.setLength(1)
+    assertEquals("builder.2", "\u00ff", builder.toString())
+  }
+
+  @Test def latin1StringsEncoding(): Unit = {
+    val s = "a\u00e9\u00ff"
+    val utf8 = s.getBytes(StandardCharsets.UTF_8)
+    assertArrayEquals(
+      Array[Byte](0x61, 0xc3.toByte, 0xa9.toByte, 0xc3.toByte, 0xbf.toByte),
+      utf8
+    )
+    assertEquals(s, new String(utf8, StandardCharsets.UTF_8))
+
+    val latin1 = s.getBytes(StandardCharsets.ISO_8859_1)
+    assertArrayEquals(Array[Byte](0x61, 0xe9.toByte, 0xff.toByte), latin1)
+    assertEquals(s, new String(latin1, StandardCharsets.ISO_8859_1))
+
+    assertArrayEquals(
+      Array[Byte](0x61, '?', '?'),
+      s.getBytes(StandardCharsets.US_ASCII)
+    )
+    assertEquals(
+      "a\ufffd",
+      new String(Array[Byte](0x61, 0xe9.toByte), StandardCharsets.US_ASCII)
+    )
+  }
+
+  @Test def utf8LongStringsEncoding(): Unit = {
+    // Runs long enough for the vectorized paths, sequences crossing vectors
+    val pieces = Seq("a", "\u00e9", "\u20ac", "\ud83d\ude00", "0123456789")
+    val random = new scala.util.Random(7)
+    for (length <- Seq(15, 16, 31, 32, 33, 63, 64, 65, 200, 1000)) {
+      val builder = new java.lang.StringBuilder()
+      while (builder.length() < length)
+        builder.append(pieces(random.nextInt(pieces.length)))
+      val s = builder.toString()
+      val expected = s.codePoints().toArray().flatMap { cp =>
+        if (cp < 0x80) Array(cp)
+        else if (cp < 0x800) Array(0xc0 | (cp >> 6), 0x80 | (cp & 0x3f))
+        else if (cp < 0x10000)
+          Array(
+            0xe0 | (cp >> 12),
+            0x80 | ((cp >> 6) & 0x3f),
+            0x80 | (cp & 0x3f)
+          )
+        else
+          Array(
+            0xf0 | (cp >> 18),
+            0x80 | ((cp >> 12) & 0x3f),
+            0x80 | ((cp >> 6) & 0x3f),
+            0x80 | (cp & 0x3f)
+          )
+      }.map(_.toByte)
+      val utf8 = s.getBytes(StandardCharsets.UTF_8)
+      assertArrayEquals(s"encode $length", expected, utf8)
+      assertEquals(
+        s"decode $length",
+        s,
+        new String(utf8, StandardCharsets.UTF_8)
+      )
+
+      // Malformed byte and unpaired surrogate are replaced
+      val at = random.nextInt(utf8.length)
+      val malformed = utf8.clone()
+      malformed(at) = 0xff.toByte
+      val decoded = new String(malformed, StandardCharsets.UTF_8)
+      assertTrue(s"malformed $length", decoded.contains("\ufffd"))
+      val valid = new String(utf8, 0, at, StandardCharsets.UTF_8)
+      assertEquals(
+        s"prefix $length",
+        valid.takeWhile(_ != '\ufffd'),
+        decoded.substring(0, decoded.indexOf('\ufffd'))
+      )
+      val surrogate = s + "\ud800" + s
+      assertArrayEquals(
+        s"surrogate $length",
+        utf8 ++ Array('?'.toByte) ++ utf8,
+        surrogate.getBytes(StandardCharsets.UTF_8)
+      )
+    }
+  }
+
+  @Test def latin1StringsCaseConversion(): Unit = {
+    // Upper case of both chars is outside of Latin-1 range
+    assertEquals("\u0178\u039c", "\u00ff\u00b5".toUpperCase)
+    assertEquals("\u00e9a", "\u00c9A".toLowerCase)
+    assertEquals("SS", "\u00df".toUpperCase)
+  }
 }
@@ -557,4 +557,26 @@ class BigIntegerDivideTest {
     }
     assertEquals(1, result.signum())
   }
+
+  @Test def testLargeOperands(): Unit = {
+    val rnd = new java.util.Random(42L)
+    val sizes = Seq((12000, 4000), (40000, 6000), (64000, 31000))
+    for ((dividendBits, divisorBits) <- sizes) {
+      val divisor = new BigInteger(divisorBits, rnd).setBit(divisorBits - 1)
+      val quotient = new BigInteger(dividendBits - divisorBits, rnd)
+      val remainder = new BigInteger(divisorBits - 1, rnd)
+      val dividend = quotient.multiply(divisor).add(remainder)
+
+      val qr = dividend.divideAndRemainder(divisor)
+      assertEquals(quotient, qr(0))
+      assertEquals(remainder, qr(1))
+      assertEquals(quotient, dividend.divide(divisor))
+      assertEquals(remainder, dividend.remainder(divisor))
+
+      val negated = dividend.negate().divideAndRemainder(divisor)
+      assertEquals(quotient.negate(), negated(0))
+      assertEquals(remainder.negate(), negated(1))
+      assertEquals(quotient.negate(), dividend.divide(divisor.negate()))
+    }
+  }
 }
@@ -355,4 +355,36 @@ class BigIntegerMultiplyTest {
       BigInt(46).pow(31)
     )
   }
+
+  @Test def testLargeOperands(): Unit = {
+    val rnd = new java.util.Random(42L)
+    val a = new BigInteger(40000, rnd).setBit(39999)
+    val b = new BigInteger(25000, rnd).setBit(24999).negate()
+
+    // Reference product built from chunks short enough for schoolbook
+    // multiplication
+    val chunkBits = 32 * 40
+    val mask = BigInteger.ONE.shiftLeft(chunkBits).subtract(BigInteger.ONE)
+    var expected = BigInteger.ZERO
+    var shift = 0
+    while (shift < b.bitLength()) {
+      val chunk = b.abs().shiftRight(shift).and(mask)
+      expected = expected.add(a.multiply(chunk).shiftLeft(shift))
+      shift += chunkBits
+    }
+    expected = expected.negate()
+
+    assertEquals(expected, a.multiply(b))
+    assertEquals(expected, b.multiply(a))
+
+    // (2^k - 1)^2 = 2^2k - 2^(k+1) + 1
+    val k = 50000
+    val ones = BigInteger.ONE.shiftLeft(k).subtract(BigInteger.ONE)
+    val square = BigInteger.ONE
+      .shiftLeft(2 * k)
+      .subtract(BigInteger.ONE.shiftLeft(k + 1))
+      .add(BigInteger.ONE)
+    assertEquals(square, ones.multiply(ones))
+    assertEquals(square, ones.pow(2))
+  }
 }
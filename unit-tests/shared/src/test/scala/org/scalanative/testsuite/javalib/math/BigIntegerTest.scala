@@ -322,4 +322,36 @@ class BigIntegerTest {
     assertFalse(jbi1 == jbi2)
   }
 
+  /* Sizes crossing the thresholds of Toom-Cook-3 multiplication,
+   * Burnikel-Ziegler division and recursive conversion to string, checked
+   * against identities independent of the algorithms used.
+   */
+  @Test def largeOperandsAgreeWithIdentities(): Unit = {
+    val random = new java.util.Random(42L)
+    for (bits <- Seq(8192, 24576)) {
+      val a = new BigInteger(bits, random).setBit(bits - 1)
+      val b = new BigInteger(bits, random).setBit(bits - 1)
+      val c = new BigInteger(bits - 1, random)
+
+      // (a+b)^2 - (a-b)^2 = 4ab
+      val product = a.multiply(b)
+      assertEquals(
+        a.add(b).pow(2).subtract(a.subtract(b).pow(2)),
+        product.shiftLeft(2)
+      )
+      // a^2 - b^2 = (a+b)(a-b)
+      assertEquals(
+        a.add(b).multiply(a.subtract(b)),
+        a.pow(2).subtract(b.pow(2))
+      )
+
+      val qr = product.add(c).divideAndRemainder(b)
+      assertEquals(a, qr(0))
+      assertEquals(c, qr(1))
+
+      val decimal = product.toString
+      assertEquals(product, new BigInteger(decimal))
+      assertTrue(decimal.length >= (bits * 2 - 2) * 3 / 10)
+    }
+  }
 }
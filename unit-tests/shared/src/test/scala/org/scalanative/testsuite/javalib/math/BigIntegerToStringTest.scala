@@ -178,4 +178,27 @@ class BigIntegerToStringTest {
     val result = aNumber.toString(45)
     assertEquals(value, result)
   }
+
+  @Test def testLargeNumbers(): Unit = {
+    val digits = 5000
+    val tenPow = BigInteger.TEN.pow(digits)
+    assertEquals("1" + "0" * digits, tenPow.toString)
+    assertEquals("9" * digits, tenPow.subtract(BigInteger.ONE).toString)
+    assertEquals(
+      "-1" + "0" * (digits - 1) + "1",
+      tenPow.add(BigInteger.ONE).negate().toString
+    )
+    assertEquals(
+      "f" * 3000,
+      BigInteger.ONE.shiftLeft(4 * 3000).subtract(BigInteger.ONE).toString(16)
+    )
+
+    val rnd = new java.util.Random(42L)
+    val str = (1 to 7000).map(i => ('0' + rnd.nextInt(10)).toChar).mkString
+    val value = "7" + str
+    assertEquals(value, new BigInteger(value).toString)
+    assertEquals("-" + value, new BigInteger("-" + value).toString)
+    val base7 = new BigInteger(value).toString(7)
+    assertEquals(new BigInteger(value), new BigInteger(base7, 7))
+  }
 }
@@ -0,0 +1,158 @@
+package org.scalanative.testsuite.javalib.nio.channels
+
+import java.io.File
+import java.nio.ByteBuffer
+import java.nio.channels._
+import java.nio.file.{Files, Path, StandardOpenOption}
+import java.util.concurrent.{CountDownLatch, TimeUnit}
+import java.util.concurrent.atomic.AtomicReference
+
+import org.junit.Assert._
+import org.junit.Test
+
+import org.scalanative.testsuite.utils.AssertThrows.assertThrows
+
+class AsynchronousFileChannelTest {
+
+  def withTemporaryDirectory(fn: Path => Unit): Unit = {
+    val file = File.createTempFile("test", ".tmp")
+    assertTrue(file.delete())
+    assertTrue(file.mkdir())
+    fn(file.toPath)
+  }
+
+  private def pattern(size: Int): Array[Byte] =
+    Array.tabulate[Byte](size)(i => (i * 31 + i / 251).toByte)
+
+  @Test def readsAtPositionsConcurrently(): Unit = {
+    withTemporaryDirectory { dir =>
+      val f = dir.resolve("f")
+      val bytes = pattern(256 * 1024)
+      Files.write(f, bytes)
+
+      val channel = AsynchronousFileChannel.open(f, StandardOpenOption.READ)
+      try {
+        val random = new scala.util.Random(42)
+        val positions = Array.fill(500)(random.nextInt(bytes.length - 4096))
+        val buffers = positions.map(_ => ByteBuffer.allocate(4096))
+        val futures = positions.indices.map { i =>
+          channel.read(buffers(i), positions(i).toLong)
+        }
+        for (i <- positions.indices) {
+          assertEquals(4096, futures(i).get(10, TimeUnit.SECONDS).intValue())
+          assertEquals(4096, buffers(i).position())
+          val expected = bytes.slice(positions(i), positions(i) + 4096)
+          assertTrue(s"read $i", buffers(i).array().sameElements(expected))
+        }
+      } finally channel.close()
+    }
+  }
+
+  @Test def readsLargeAndDirectBuffers(): Unit = {
+    withTemporaryDirectory { dir =>
+      val f = dir.resolve("f")
+      val bytes = pattern(100 * 1000)
+      Files.write(f, bytes)
+
+      val channel = AsynchronousFileChannel.open(f)
+      try {
+        val large = ByteBuffer.allocate(bytes.length)
+        var read = 0
+        while (read < bytes.length)
+          read += channel.read(large, read.toLong).get().intValue()
+        assertTrue(large.array().sameElements(bytes))
+
+        val direct = ByteBuffer.allocateDirect(1000)
+        assertEquals(1000, channel.read(direct, 5000L).get().intValue())
+        direct.flip()
+        val copy = new Array[Byte](1000)
+        direct.get(copy)
+        assertTrue(copy.sameElements(bytes.slice(5000, 6000)))
+      } finally channel.close()
+    }
+  }
+
+  @Test def readAtEndOfFile(): Unit = {
+    withTemporaryDirectory { dir =>
+      val f = dir.resolve("f")
+      Files.write(f, Array[Byte](1, 2, 3))
+
+      val channel = AsynchronousFileChannel.open(f)
+      try {
+        val buffer = ByteBuffer.allocate(10)
+        assertEquals(3, channel.read(buffer, 0L).get().intValue())
+        assertEquals(-1, channel.read(buffer, 3L).get().intValue())
+        assertEquals(-1, channel.read(buffer, 100L).get().intValue())
+        val empty = ByteBuffer.allocate(0)
+        assertEquals(0, channel.read(empty, 0L).get().intValue())
+      } finally channel.close()
+    }
+  }
+
+  @Test def writesWithCompletionHandler(): Unit = {
+    withTemporaryDirectory { dir =>
+      val f = dir.resolve("f")
+      val channel = AsynchronousFileChannel.open(
+        f,
+        StandardOpenOption.CREATE,
+        StandardOpenOption.READ,
+        StandardOpenOption.WRITE
+      )
+      try {
+        val done = new CountDownLatch(2)
+        val results = new AtomicReference[List[Any]](Nil)
+        val handler = new CompletionHandler[Integer, String] {
+          def completed(result: Integer, attachment: String): Unit = {
+            results.getAndUpdate(attachment :: _)
+            done.countDown()
+          }
+          def failed(exc: Throwable, attachment: String): Unit = {
+            results.getAndUpdate(exc :: _)
+            done.countDown()
+          }
+        }
+        channel.write(ByteBuffer.wrap("world".getBytes()), 6L, "b", handler)
+        channel.write(ByteBuffer.wrap("hello ".getBytes()), 0L, "a", handler)
+        assertTrue(done.await(10, TimeUnit.SECONDS))
+        assertEquals(Set("a", "b"), results.get().toSet)
+
+        assertEquals(11L, channel.size())
+        val buffer = ByteBuffer.allocate(11)
+        assertEquals(11, channel.read(buffer, 0L).get().intValue())
+        assertEquals("hello world", new String(buffer.array()))
+      } finally channel.close()
+    }
+  }
+
+  @Test def checksAccessMode(): Unit = {
+    withTemporaryDirectory { dir =>
+      val f = dir.resolve("f")
+      Files.write(f, Array[Byte](1, 2, 3))
+
+      val reading = AsynchronousFileChannel.open(f, StandardOpenOption.READ)
+      try {
+        assertThrows(
+          classOf[NonWritableChannelException],
+          reading.write(ByteBuffer.allocate(1), 0L)
+        )
+        assertThrows(
+          classOf[IllegalArgumentException],
+          reading.read(ByteBuffer.allocate(1), -1L)
+        )
+      } finally reading.close()
+
+      val writing = AsynchronousFileChannel.open(f, StandardOpenOption.WRITE)
+      try
+        assertThrows(
+          classOf[NonReadableChannelException],
+          writing.read(ByteBuffer.allocate(1), 0L)
+        )
+      finally writing.close()
+
+      assertThrows(
+        classOf[UnsupportedOperationException],
+        AsynchronousFileChannel.open(f, StandardOpenOption.APPEND)
+      )
+    }
+  }
+}
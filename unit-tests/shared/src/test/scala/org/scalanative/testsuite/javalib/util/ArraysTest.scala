@@ -310,6 +310,47 @@ class ArraysTest {
     assertArrayEquals(Array(0.0, 42.0, -1.0, -1.0, -1.0, 0.0), doubles)
   }
 
+  @Test def fill_LongArrays_with_start_and_end_index(): Unit = {
+    // Unaligned ranges, leaving the elements around them unchanged
+    val size = 100
+    for ((from, to) <- Seq((0, 0), (1, 2), (3, 40), (5, 99), (0, size))) {
+      def check[T](name: String, arr: Array[T], value: T, zero: T): Unit =
+        for (i <- 0 until size) {
+          val expected = if (i >= from && i < to) value else zero
+          assertEquals(s"$name [$from, $to) at $i", expected, arr(i))
+        }
+
+      val shorts = new Array[Short](size)
+      Arrays.fill(shorts, from, to, -2.toShort)
+      check("Short", shorts, -2.toShort, 0.toShort)
+
+      val chars = new Array[Char](size)
+      Arrays.fill(chars, from, to, '\uabcd')
+      check("Char", chars, '\uabcd', '\u0000')
+
+      val ints = new Array[Int](size)
+      Arrays.fill(ints, from, to, 0x12345678)
+      check("Int", ints, 0x12345678, 0)
+
+      val longs = new Array[Long](size)
+      Arrays.fill(longs, from, to, Long.MinValue)
+      check("Long", longs, Long.MinValue, 0L)
+
+      val floats = new Array[Float](size)
+      Arrays.fill(floats, from, to, -0.0f)
+      for (i <- from until to)
+        assertEquals(0x80000000, java.lang.Float.floatToRawIntBits(floats(i)))
+
+      val doubles = new Array[Double](size)
+      Arrays.fill(doubles, from, to, Double.NaN)
+      check("Double", doubles, Double.NaN, 0.0)
+
+      val booleans = new Array[Boolean](size)
+      Arrays.fill(booleans, from, to, true)
+      check("Boolean", booleans, true, false)
+    }
+  }
+
   @Test def fill_AnyRef(): Unit = {
     val array = new Array[AnyRef](6)
     Arrays.fill(array, "a")
@@ -819,6 +860,31 @@ class ArraysTest {
     }
   }
 
+  @Test def hashCode_LongArrays(): Unit = {
+    // Long enough for the vectorized paths, sizes not multiple of vectors
+    for (size <- Seq(7, 8, 31, 32, 33, 100, 1027)) {
+      val ints = Array.tabulate(size)(i => i * 0x9e3779b9)
+      def expected(elems: Seq[Int]): Int = elems.foldLeft(1)(31 * _ + _)
+
+      assertEquals(s"Int $size", expected(ints), Arrays.hashCode(ints))
+      assertEquals(
+        s"Short $size",
+        expected(ints.map(_.toShort.toInt)),
+        Arrays.hashCode(ints.map(_.toShort))
+      )
+      assertEquals(
+        s"Char $size",
+        expected(ints.map(_.toChar.toInt)),
+        Arrays.hashCode(ints.map(_.toChar))
+      )
+      assertEquals(
+        s"Byte $size",
+        expected(ints.map(_.toByte.toInt)),
+        Arrays.hashCode(ints.map(_.toByte))
+      )
+    }
+  }
+
   @Test def hashCode_AnyRef(): Unit = {
     assertEquals(0, Arrays.hashCode(null: Array[AnyRef]))
     assertEquals(1, Arrays.hashCode(Array[AnyRef]()))
@@ -37,6 +37,9 @@ sealed trait VirtualDirectory {
   /** List all files in this directory. */
   def files: Seq[Path]
 
+  /** Path of the file with given name, as listed by [[files]]. */
+  def getPath(name: String): Path
+
   /** Merges content of source paths into single file in target */
   def merge(sources: Seq[Path], target: Path): Path
 
@@ -157,6 +160,8 @@ object VirtualDirectory {
     override protected def resolve(path: Path): Path =
       this.path.resolve(path)
 
+    override def getPath(name: String): Path = Paths.get(name)
+
     override def files: Seq[Path] =
       jIteratorToSeq {
         Files
@@ -188,6 +193,8 @@ object VirtualDirectory {
     override def pathMatcher(pattern: String): PathMatcher =
       fileSystem.getPathMatcher(pattern)
 
+    override def getPath(name: String): Path = fileSystem.getPath(name)
+
     override def files: Seq[Path] = {
       val roots = jIteratorToSeq(fileSystem.getRootDirectories.iterator())
 
@@ -208,6 +215,8 @@ object VirtualDirectory {
 
     override def files = Seq.empty[Path]
 
+    override def getPath(name: String): Path = Paths.get(name)
+
     override def read(path: Path): ByteBuffer =
       throw new UnsupportedOperationException(
         "Can't read from empty directory."